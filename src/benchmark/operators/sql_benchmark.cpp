@@ -1,12 +1,15 @@
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "../benchmark_basic_fixture.hpp"
 #include "SQLParser.h"
 #include "benchmark/benchmark.h"
 #include "logical_query_plan/lqp_translator.hpp"
+#include "sql/parameterized_plan_cache.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "sql/sql_pipeline_statement.hpp"
+#include "sql/sql_query_cache.hpp"
 #include "sql/sql_translator.hpp"
 #include "storage/storage_manager.hpp"
 #include "utils/load_table.hpp"
@@ -21,6 +24,7 @@ class SQLBenchmark : public BenchmarkBasicFixture {
   void SetUp(benchmark::State& st) override {
     // Disable and clear all SQL caches.
     SQLQueryCache<SQLQueryPlan>::get().resize(0);
+    ParameterizedPlanCache::get().resize(0);
 
     // Add tables to StorageManager.
     // This is required for the translator to get the column names of a table.
@@ -86,4 +90,39 @@ BENCHMARK_F(SQLBenchmark, BM_ParseQuery)(benchmark::State& st) { BM_ParseQuery(s
 BENCHMARK_F(SQLBenchmark, BM_PlanQuery)(benchmark::State& st) { BM_PlanQuery(st, query); }
 BENCHMARK_F(SQLBenchmark, BM_QueryPlanCacheQuery)(benchmark::State& st) { BM_QueryPlanCache(st, query); }
 
+// Looks up cached entries from multiple threads. The argument is the number of shards of the cache, showing how the
+// throughput scales compared to a single mutex protecting the entire cache.
+void BM_QueryCacheConcurrentLookup(benchmark::State& state) {  // NOLINT
+  constexpr auto QUERY_COUNT = size_t{512};
+
+  static const auto queries = []() {
+    auto queries = std::vector<std::string>{};
+    for (auto query_id = size_t{0}; query_id < QUERY_COUNT; ++query_id) {
+      queries.emplace_back("SELECT * FROM t WHERE a = " + std::to_string(query_id));
+    }
+    return queries;
+  }();
+
+  // The caches are shared by all threads of a benchmark run
+  static auto caches = []() {
+    auto caches = std::vector<std::unique_ptr<SQLQueryCache<size_t>>>{};
+    for (const auto shard_count : {size_t{1}, size_t{16}}) {
+      caches.emplace_back(std::make_unique<SQLQueryCache<size_t>>(DefaultCacheCapacity, shard_count));
+      for (auto query_id = size_t{0}; query_id < QUERY_COUNT; ++query_id) {
+        caches.back()->set(queries[query_id], query_id);
+      }
+    }
+    return caches;
+  }();
+
+  auto& cache = *caches[state.range(0) == 1 ? 0 : 1];
+  auto query_id = size_t{0};
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(cache.try_get(queries[query_id]));
+    query_id = (query_id + 1) % QUERY_COUNT;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_QueryCacheConcurrentLookup)->Arg(1)->Arg(16)->ThreadRange(1, 16)->UseRealTime();
+
 }  // namespace opossum
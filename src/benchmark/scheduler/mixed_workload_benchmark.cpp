@@ -0,0 +1,99 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/resource_group_manager.hpp"
+#include "scheduler/topology.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/storage_manager.hpp"
+#include "table_generator.hpp"
+
+namespace {
+constexpr auto HEAVY_QUERY_CLIENT_COUNT = size_t{4};
+// Above the estimated cost of the point query (one scan of 40,000 rows), below that of the join and aggregate query
+constexpr auto HEAVY_QUERY_COST_THRESHOLD = opossum::Cost{100'000};
+}  // namespace
+
+namespace opossum {
+
+/**
+ * Measures the latency of short point queries while HEAVY_QUERY_CLIENT_COUNT clients continuously run expensive
+ * aggregations. The argument toggles the ResourceGroupManager: with 0, all queries are treated as short queries and
+ * compete for the workers with the same priority; with 1, the heavy queries run in the heavy query group, i.e., with
+ * the lowest priority and a limited number of concurrent queries.
+ */
+class MixedWorkloadBenchmark : public benchmark::Fixture {
+ public:
+  void SetUp(::benchmark::State& state) override {
+    auto table_generator = TableGenerator{};
+    StorageManager::get().add_table("table_a", table_generator.generate_table(ChunkID{2000}));
+    StorageManager::get().add_table("table_b", table_generator.generate_table(ChunkID{2000}));
+
+    Topology::use_numa_topology();
+    CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+    ResourceGroupManager::get().set_heavy_query_cost_threshold(
+        state.range(0) ? std::optional<Cost>{HEAVY_QUERY_COST_THRESHOLD} : std::nullopt);
+  }
+
+  void TearDown(::benchmark::State&) override {
+    CurrentScheduler::get()->finish();
+    CurrentScheduler::set(nullptr);
+    ResourceGroupManager::reset();
+    StorageManager::get().reset();
+  }
+
+ protected:
+  const std::string _short_query = "SELECT * FROM table_a WHERE a = 4242";
+  const std::string _heavy_query =
+      "SELECT table_a.b, SUM(table_b.c) FROM table_a JOIN table_b ON table_a.a = table_b.a GROUP BY table_a.b "
+      "ORDER BY table_a.b";
+};
+
+BENCHMARK_DEFINE_F(MixedWorkloadBenchmark, BM_ShortQueryLatency)(benchmark::State& state) {
+  auto stop_heavy_queries = std::atomic_bool{false};
+  auto heavy_query_clients = std::vector<std::thread>{};
+  for (auto client_id = size_t{0}; client_id < HEAVY_QUERY_CLIENT_COUNT; ++client_id) {
+    heavy_query_clients.emplace_back([&]() {
+      while (!stop_heavy_queries) {
+        auto pipeline = SQLPipelineBuilder{_heavy_query}.create_pipeline();
+        pipeline.get_result_table();
+      }
+    });
+  }
+
+  auto latencies = std::vector<double>{};
+  while (state.KeepRunning()) {
+    const auto begin = std::chrono::high_resolution_clock::now();
+    auto pipeline = SQLPipelineBuilder{_short_query}.create_pipeline();
+    benchmark::DoNotOptimize(pipeline.get_result_table());
+    const auto end = std::chrono::high_resolution_clock::now();
+    latencies.emplace_back(std::chrono::duration<double, std::micro>(end - begin).count());
+  }
+
+  stop_heavy_queries = true;
+  for (auto& client : heavy_query_clients) {
+    client.join();
+  }
+
+  // Latency percentiles of the short queries in microseconds
+  std::sort(latencies.begin(), latencies.end());
+  const auto percentile = [&](const double fraction) {
+    return latencies[std::min(latencies.size() - 1, static_cast<size_t>(fraction * latencies.size()))];
+  };
+  state.counters["p50_us"] = percentile(0.5);
+  state.counters["p90_us"] = percentile(0.9);
+  state.counters["p99_us"] = percentile(0.99);
+}
+
+BENCHMARK_REGISTER_F(MixedWorkloadBenchmark, BM_ShortQueryLatency)->Arg(0)->Arg(1)->UseRealTime();
+
+}  // namespace opossum
@@ -0,0 +1,117 @@
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "storage/base_encoded_column.hpp"
+#include "storage/column_encoding_utils.hpp"
+#include "storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
+#include "storage/index/b_tree/b_tree_index.hpp"
+#include "storage/index/delta/delta_index.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/value_column.hpp"
+#include "type_cast.hpp"
+
+namespace {
+constexpr auto CHUNK_SIZE = size_t{100'000};
+constexpr auto LOOKUP_COUNT = size_t{1'000};
+}  // namespace
+
+namespace opossum {
+
+// Creates a column of CHUNK_SIZE uniformly distributed values in [0, distinct_value_count), dictionary-encoded for all
+// indexes but the DeltaIndex, which only works on ValueColumns
+template <typename Index>
+std::shared_ptr<const BaseColumn> create_indexed_column(const int32_t distinct_value_count) {
+  std::mt19937 random_engine{42};
+  std::uniform_int_distribution<int32_t> value_distribution{0, distinct_value_count - 1};
+
+  auto values = std::vector<int32_t>(CHUNK_SIZE);
+  for (auto& value : values) {
+    value = value_distribution(random_engine);
+  }
+  const auto value_column = std::make_shared<ValueColumn<int32_t>>(values);
+
+  if constexpr (std::is_same_v<Index, DeltaIndex>) {
+    return value_column;
+  } else {
+    return encode_column(EncodingType::Dictionary, DataType::Int, value_column);
+  }
+}
+
+std::vector<AllTypeVariant> create_lookup_values(const int32_t distinct_value_count) {
+  std::mt19937 random_engine{1337};
+  std::uniform_int_distribution<int32_t> value_distribution{0, distinct_value_count - 1};
+
+  auto lookup_values = std::vector<AllTypeVariant>(LOOKUP_COUNT);
+  for (auto& lookup_value : lookup_values) {
+    lookup_value = value_distribution(random_engine);
+  }
+  return lookup_values;
+}
+
+// The argument is the number of distinct values in the indexed column
+template <typename Index>
+void BM_IndexBuild(benchmark::State& state) {  // NOLINT
+  const auto column = create_indexed_column<Index>(static_cast<int32_t>(state.range(0)));
+
+  while (state.KeepRunning()) {
+    const auto index = std::make_shared<Index>(std::vector<std::shared_ptr<const BaseColumn>>{column});
+    benchmark::DoNotOptimize(index);
+  }
+}
+
+template <typename Index>
+void BM_IndexPointLookup(benchmark::State& state) {  // NOLINT
+  const auto distinct_value_count = static_cast<int32_t>(state.range(0));
+  const auto column = create_indexed_column<Index>(distinct_value_count);
+  const auto index = std::make_shared<Index>(std::vector<std::shared_ptr<const BaseColumn>>{column});
+  const auto lookup_values = create_lookup_values(distinct_value_count);
+
+  while (state.KeepRunning()) {
+    for (const auto& lookup_value : lookup_values) {
+      auto match_count = std::distance(index->lower_bound({lookup_value}), index->upper_bound({lookup_value}));
+      benchmark::DoNotOptimize(match_count);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * LOOKUP_COUNT);
+}
+
+// Scans about 1% of the values, starting at random positions
+template <typename Index>
+void BM_IndexRangeLookup(benchmark::State& state) {  // NOLINT
+  const auto distinct_value_count = static_cast<int32_t>(state.range(0));
+  const auto range_size = std::max(int32_t{1}, distinct_value_count / 100);
+  const auto column = create_indexed_column<Index>(distinct_value_count);
+  const auto index = std::make_shared<Index>(std::vector<std::shared_ptr<const BaseColumn>>{column});
+  const auto lookup_values = create_lookup_values(distinct_value_count);
+
+  while (state.KeepRunning()) {
+    for (const auto& lookup_value : lookup_values) {
+      const auto range_end_value = AllTypeVariant{type_cast<int32_t>(lookup_value) + range_size};
+      auto match_count = std::distance(index->lower_bound({lookup_value}), index->lower_bound({range_end_value}));
+      benchmark::DoNotOptimize(match_count);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * LOOKUP_COUNT);
+}
+
+BENCHMARK_TEMPLATE(BM_IndexBuild, GroupKeyIndex)->Range(16, 1 << 16);
+BENCHMARK_TEMPLATE(BM_IndexBuild, AdaptiveRadixTreeIndex)->Range(16, 1 << 16);
+BENCHMARK_TEMPLATE(BM_IndexBuild, BTreeIndex)->Range(16, 1 << 16);
+BENCHMARK_TEMPLATE(BM_IndexBuild, DeltaIndex)->Range(16, 1 << 16);
+
+BENCHMARK_TEMPLATE(BM_IndexPointLookup, GroupKeyIndex)->Range(16, 1 << 16);
+BENCHMARK_TEMPLATE(BM_IndexPointLookup, AdaptiveRadixTreeIndex)->Range(16, 1 << 16);
+BENCHMARK_TEMPLATE(BM_IndexPointLookup, BTreeIndex)->Range(16, 1 << 16);
+BENCHMARK_TEMPLATE(BM_IndexPointLookup, DeltaIndex)->Range(16, 1 << 16);
+
+BENCHMARK_TEMPLATE(BM_IndexRangeLookup, GroupKeyIndex)->Range(16, 1 << 16);
+BENCHMARK_TEMPLATE(BM_IndexRangeLookup, AdaptiveRadixTreeIndex)->Range(16, 1 << 16);
+BENCHMARK_TEMPLATE(BM_IndexRangeLookup, BTreeIndex)->Range(16, 1 << 16);
+BENCHMARK_TEMPLATE(BM_IndexRangeLookup, DeltaIndex)->Range(16, 1 << 16);
+
+}  // namespace opossum
@@ -62,6 +62,7 @@ std::shared_ptr<Table> TpccTableGenerator::generate_items_table() {
   for (const auto& chunk_columns : columns_by_chunk) table->append_chunk(chunk_columns);
 
   _encode_table("ITEM", table);
+  _create_primary_key_index(table, {"I_ID"});
   return table;
 }
 
@@ -99,6 +100,7 @@ std::shared_ptr<Table> TpccTableGenerator::generate_warehouse_table() {
   for (const auto& chunk_columns : columns_by_chunk) table->append_chunk(chunk_columns);
 
   _encode_table("WAREHOUSE", table);
+  _create_primary_key_index(table, {"W_ID"});
   return table;
 }
 
@@ -148,6 +150,7 @@ std::shared_ptr<Table> TpccTableGenerator::generate_stock_table() {
   for (const auto& chunk_columns : columns_by_chunk) table->append_chunk(chunk_columns);
 
   _encode_table("STOCK", table);
+  _create_primary_key_index(table, {"S_I_ID", "S_W_ID"});
   return table;
 }
 
@@ -190,6 +193,7 @@ std::shared_ptr<Table> TpccTableGenerator::generate_district_table() {
   for (const auto& chunk_columns : columns_by_chunk) table->append_chunk(chunk_columns);
 
   _encode_table("DISTRICT", table);
+  _create_primary_key_index(table, {"D_ID", "D_W_ID"});
   return table;
 }
 
@@ -257,6 +261,7 @@ std::shared_ptr<Table> TpccTableGenerator::generate_customer_table() {
   for (const auto& chunk_columns : columns_by_chunk) table->append_chunk(chunk_columns);
 
   _encode_table("CUSTOMER", table);
+  _create_primary_key_index(table, {"C_ID", "C_D_ID", "C_W_ID"});
   return table;
 }
 
@@ -335,6 +340,7 @@ std::shared_ptr<Table> TpccTableGenerator::generate_order_table(
   for (const auto& chunk_columns : columns_by_chunk) table->append_chunk(chunk_columns);
 
   _encode_table("ORDER", table);
+  _create_primary_key_index(table, {"O_ID", "O_D_ID", "O_W_ID"});
   return table;
 }
 
@@ -438,6 +444,7 @@ std::shared_ptr<Table> TpccTableGenerator::generate_order_line_table(
   for (const auto& chunk_columns : columns_by_chunk) table->append_chunk(chunk_columns);
 
   _encode_table("ORDER_LINE", table);
+  _create_primary_key_index(table, {"OL_O_ID", "OL_D_ID", "OL_W_ID", "OL_NUMBER"});
   return table;
 }
 
@@ -464,6 +471,7 @@ std::shared_ptr<Table> TpccTableGenerator::generate_new_order_table() {
   for (const auto& chunk_columns : columns_by_chunk) table->append_chunk(chunk_columns);
 
   _encode_table("NEW_ORDER", table);
+  _create_primary_key_index(table, {"NO_O_ID", "NO_D_ID", "NO_W_ID"});
   return table;
 }
 
@@ -530,4 +538,13 @@ void TpccTableGenerator::_encode_table(const std::string& table_name, const std:
   BenchmarkTableEncoder::encode(table_name, table, _encoding_config);
 }
 
+void TpccTableGenerator::_create_primary_key_index(const std::shared_ptr<Table>& table,
+                                                   const std::vector<std::string>& column_names) {
+  auto column_ids = std::vector<ColumnID>{};
+  for (const auto& column_name : column_names) {
+    column_ids.emplace_back(table->column_id_by_name(column_name));
+  }
+  table->create_primary_key_index(column_ids, "PRIMARY KEY");
+}
+
 }  // namespace opossum
@@ -63,6 +63,9 @@ class TpccTableGenerator : public opossum::AbstractBenchmarkTableGenerator {
  protected:
   void _encode_table(const std::string& table_name, const std::shared_ptr<Table>& table);
 
+  // The TPC-C transactions access most tables by their primary key, which the PrimaryKeyIndex makes O(1) lookups
+  void _create_primary_key_index(const std::shared_ptr<Table>& table, const std::vector<std::string>& column_names);
+
   template <typename T>
   std::vector<T> _generate_inner_order_line_column(std::vector<size_t> indices,
                                                    order_line_counts_type order_line_counts,
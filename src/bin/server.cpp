@@ -1,8 +1,11 @@
 #include <boost/asio/io_service.hpp>
 
+#include <algorithm>
 #include <cstdio>
 #include <cstdlib>
 #include <iostream>
+#include <thread>
+#include <vector>
 
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
@@ -33,7 +36,19 @@ int main(int argc, char* argv[]) {
     // constructor and then runs forever.
     opossum::Server server{io_service, port};
 
+    // The io_service threads only handle the network protocol, while the queries are executed by the scheduler's
+    // workers. Thus, a few of them are enough for many concurrent sessions.
+    const auto io_thread_count = std::clamp(std::thread::hardware_concurrency() / 8, 1u, 4u);
+    std::vector<std::thread> io_threads;
+    for (auto thread_id = 1u; thread_id < io_thread_count; ++thread_id) {
+      io_threads.emplace_back([&io_service]() { io_service.run(); });
+    }
+
     io_service.run();
+
+    for (auto& io_thread : io_threads) {
+      io_thread.join();
+    }
   } catch (std::exception& e) {
     std::cerr << "Exception: " << e.what() << "\n";
   }
@@ -4,6 +4,7 @@
 #include "cost_feature_operator_proxy.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
 #include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
 #include "logical_query_plan/predicate_node.hpp"
 #include "logical_query_plan/union_node.hpp"
 #include "operators/join_hash.hpp"
@@ -35,14 +36,18 @@ Cost AbstractCostModel::estimate_lqp_node_cost(const std::shared_ptr<AbstractLQP
 
     case LQPNodeType::Join: {
       const auto join_node = std::static_pointer_cast<JoinNode>(node);
+
+      if (join_node->join_mode == JoinMode::Cross) {
+        operator_type = OperatorType::Product;
+        break;
+      }
+
       const auto operator_predicate = OperatorJoinPredicate::from_expression(
           *join_node->join_predicate, *join_node->left_input(), *join_node->right_input());
       Assert(operator_predicate, "Expected Join predicate to be OperatorScanPredicate compatible");
 
-      if (join_node->join_mode == JoinMode::Cross) {
-        operator_type = OperatorType::Product;
-      } else if (join_node->join_mode == JoinMode::Inner &&
-                 operator_predicate->predicate_condition == PredicateCondition::Equals) {
+      if (join_node->join_mode == JoinMode::Inner &&
+          operator_predicate->predicate_condition == PredicateCondition::Equals) {
         operator_type = OperatorType::JoinHash;
       } else {
         operator_type = OperatorType::JoinSortMerge;
@@ -53,13 +58,65 @@ Cost AbstractCostModel::estimate_lqp_node_cost(const std::shared_ptr<AbstractLQP
       operator_type = OperatorType::UnionPositions;
     } break;
 
+    case LQPNodeType::Aggregate:
+      operator_type = OperatorType::Aggregate;
+      break;
+
+    case LQPNodeType::Sort:
+      operator_type = OperatorType::Sort;
+      break;
+
     default:
       // TODO(anybody) we're not costing this OperatorType yet (since it is not involved in JoinOrdering and all
       //               costing is currently done for JoinOrdering only)
       return 0.0f;
   }
 
+  return estimate_lqp_node_cost(node, operator_type);
+}
+
+Cost AbstractCostModel::estimate_lqp_node_cost(const std::shared_ptr<AbstractLQPNode>& node,
+                                               const OperatorType operator_type) const {
   CostFeatureLQPNodeProxy feature_proxy(node);
   return _cost_model_impl(operator_type, feature_proxy);
 }
+
+std::optional<Cost> AbstractCostModel::estimate_plan_cost(const std::shared_ptr<AbstractLQPNode>& lqp) const {
+  auto estimable = true;
+  visit_lqp(lqp, [&](const auto& node) {
+    switch (node->type) {
+      case LQPNodeType::Aggregate:
+      case LQPNodeType::Alias:
+      case LQPNodeType::Limit:
+      case LQPNodeType::Predicate:
+      case LQPNodeType::Projection:
+      case LQPNodeType::Root:
+      case LQPNodeType::Sort:
+      case LQPNodeType::StoredTable:
+      case LQPNodeType::Validate:
+        break;
+
+      case LQPNodeType::Join: {
+        // Statistics for Semi and Anti Joins are not implemented
+        const auto join_mode = std::static_pointer_cast<JoinNode>(node)->join_mode;
+        estimable &= join_mode != JoinMode::Semi && join_mode != JoinMode::Anti;
+      } break;
+
+      default:
+        estimable = false;
+    }
+    return estimable ? LQPVisitation::VisitInputs : LQPVisitation::DoNotVisitInputs;
+  });
+
+  if (!estimable) return std::nullopt;
+
+  auto cost = Cost{0};
+  visit_lqp(lqp, [&](const auto& node) {
+    cost += estimate_lqp_node_cost(node);
+    return LQPVisitation::VisitInputs;
+  });
+
+  return cost;
+}
+
 }  // namespace opossum
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 
 #include "cost.hpp"
 
@@ -45,6 +46,18 @@ class AbstractCostModel {
    */
   Cost estimate_lqp_node_cost(const std::shared_ptr<AbstractLQPNode>& node) const;
 
+  /**
+   * @return the Cost of an LQP node if it were translated into an Operator of type @param operator_type. Used by the
+   *         LQPTranslator to choose between the Operators implementing a node.
+   */
+  Cost estimate_lqp_node_cost(const std::shared_ptr<AbstractLQPNode>& node, const OperatorType operator_type) const;
+
+  /**
+   * @return the sum of the Costs of all nodes in the LQP, or std::nullopt if the LQP contains nodes that we cannot
+   *         estimate statistics for (e.g., Unions, Semi Joins or any non-query nodes)
+   */
+  std::optional<Cost> estimate_plan_cost(const std::shared_ptr<AbstractLQPNode>& lqp) const;
+
  protected:
   /**
    * Override to implement the actual cost model
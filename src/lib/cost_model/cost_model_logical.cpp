@@ -1,5 +1,8 @@
 #include "cost_model_logical.hpp"
 
+#include <algorithm>
+#include <cmath>
+
 #include "abstract_cost_feature_proxy.hpp"
 #include "operators/abstract_operator.hpp"
 
@@ -26,12 +29,31 @@ Cost CostModelLogical::_cost_model_impl(const OperatorType operator_type,
       return feature_proxy.extract_feature(CostFeature::LeftInputRowCountLogN).scalar() +
              feature_proxy.extract_feature(CostFeature::RightInputRowCountLogN).scalar();
 
+    case OperatorType::JoinMPSM:
+      // Same amount of work as the JoinSortMerge, it is only distributed differently among NUMA nodes
+      return feature_proxy.extract_feature(CostFeature::LeftInputRowCountLogN).scalar() +
+             feature_proxy.extract_feature(CostFeature::RightInputRowCountLogN).scalar();
+
+    case OperatorType::JoinIndex: {
+      // One index lookup per row of the left input, plus the matches. The right input is never materialized.
+      const auto left_input_row_count = feature_proxy.extract_feature(CostFeature::LeftInputRowCount).scalar();
+      const auto right_input_row_count = feature_proxy.extract_feature(CostFeature::RightInputRowCount).scalar();
+      return left_input_row_count * std::max(1.0f, std::log(right_input_row_count)) +
+             feature_proxy.extract_feature(CostFeature::OutputRowCount).scalar();
+    }
+
     case OperatorType::Product:
       return feature_proxy.extract_feature(CostFeature::InputRowCountProduct).scalar();
 
     case OperatorType::JoinNestedLoop:
       return feature_proxy.extract_feature(CostFeature::InputRowCountProduct).scalar();
 
+    case OperatorType::Aggregate:
+      return feature_proxy.extract_feature(CostFeature::LeftInputRowCount).scalar();
+
+    case OperatorType::Sort:
+      return feature_proxy.extract_feature(CostFeature::LeftInputRowCountLogN).scalar();
+
     case OperatorType::UnionPositions:
       // Model the cost of the sorting as the dominant cost
       return feature_proxy.extract_feature(CostFeature::LeftInputRowCountLogN).scalar() +
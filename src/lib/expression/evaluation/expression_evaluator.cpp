@@ -15,6 +15,7 @@
 #include "expression/cast_expression.hpp"
 #include "expression/exists_expression.hpp"
 #include "expression/expression_functional.hpp"
+#include "expression/expression_utils.hpp"
 #include "expression/extract_expression.hpp"
 #include "expression/function_expression.hpp"
 #include "expression/in_expression.hpp"
@@ -47,6 +48,41 @@ ExpressionEvaluator::ExpressionEvaluator(const std::shared_ptr<const Table>& tab
 template <typename Result>
 std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::evaluate_expression_to_result(
     const AbstractExpression& expression) {
+  // Only Expressions owned by a shared_ptr can be cached, as the cache keeps them alive
+  auto cache_key = std::shared_ptr<AbstractExpression>{};
+  if (expression.requires_computation()) {
+    cache_key = std::const_pointer_cast<AbstractExpression>(expression.weak_from_this().lock());
+  }
+
+  // PQPSelectExpressions can't be hashed, so Expressions containing them are not cached
+  if (cache_key) {
+    auto contains_select = false;
+    visit_expression(cache_key, [&](const auto& sub_expression) {
+      if (sub_expression->type == ExpressionType::PQPSelect) contains_select = true;
+      return contains_select ? ExpressionVisitation::DoNotVisitArguments : ExpressionVisitation::VisitArguments;
+    });
+    if (contains_select) cache_key = nullptr;
+  }
+
+  if (cache_key) {
+    const auto cached_result_iter = _cached_results.find(cache_key);
+    if (cached_result_iter != _cached_results.end()) {
+      // An Expression might be evaluated to different Result types (e.g., the arguments of a FunctionExpression)
+      if (auto cached_result = std::dynamic_pointer_cast<ExpressionResult<Result>>(cached_result_iter->second)) {
+        return cached_result;
+      }
+    }
+  }
+
+  const auto result = _evaluate_expression_to_result<Result>(expression);
+  if (cache_key) _cached_results[cache_key] = result;
+
+  return result;
+}
+
+template <typename Result>
+std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_expression_to_result(
+    const AbstractExpression& expression) {
   switch (expression.type) {
     case ExpressionType::Arithmetic:
       return _evaluate_arithmetic_expression<Result>(static_cast<const ArithmeticExpression&>(expression));
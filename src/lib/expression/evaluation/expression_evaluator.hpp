@@ -6,6 +6,7 @@
 #include "boost/variant.hpp"
 
 #include "all_type_variant.hpp"
+#include "expression/abstract_expression.hpp"
 #include "expression/logical_expression.hpp"
 #include "expression_result.hpp"
 #include "null_value.hpp"
@@ -13,7 +14,6 @@
 
 namespace opossum {
 
-class AbstractExpression;
 class AbstractPredicateExpression;
 class ArithmeticExpression;
 class BaseColumn;
@@ -35,6 +35,10 @@ class PQPSelectExpression;
  * Operates either
  *      - ...on a Chunk, thus returning a value for each row in it
  *      - ...without a Chunk, thus returning a single value (and failing if Columns are encountered in the Expression)
+ *
+ * The results of (sub)expressions are cached, so that an Expression that occurs multiple times in the Expressions
+ * evaluated by the same ExpressionEvaluator (e.g., `a * (1 - b)` in `a * (1 - b)` and `a * (1 - b) * (1 + c)`) is
+ * only computed once.
  */
 class ExpressionEvaluator final {
  public:
@@ -55,6 +59,9 @@ class ExpressionEvaluator final {
   std::shared_ptr<ExpressionResult<Result>> evaluate_expression_to_result(const AbstractExpression& expression);
 
  private:
+  template <typename Result>
+  std::shared_ptr<ExpressionResult<Result>> _evaluate_expression_to_result(const AbstractExpression& expression);
+
   template <typename Result>
   std::shared_ptr<ExpressionResult<Result>> _evaluate_arithmetic_expression(const ArithmeticExpression& expression);
 
@@ -172,6 +179,9 @@ class ExpressionEvaluator final {
 
   // One entry for each column in the _chunk, may be nullptr if the column hasn't been materialized
   std::vector<std::shared_ptr<BaseExpressionResult>> _column_materializations;
+
+  // The results of the Expressions that require computation and have already been evaluated
+  ExpressionUnorderedMap<std::shared_ptr<BaseExpressionResult>> _cached_results;
 };
 
 }  // namespace opossum
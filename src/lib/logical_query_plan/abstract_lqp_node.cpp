@@ -55,6 +55,21 @@ namespace opossum {
 
 AbstractLQPNode::AbstractLQPNode(LQPNodeType node_type) : type(node_type) {}
 
+AbstractLQPNode::~AbstractLQPNode() {
+  /**
+   * Plans that are built and discarded (e.g., candidate plans during join ordering) would otherwise leave expired
+   * output pointers in their inputs. We can't lock() a weak_ptr to ourselves in the destructor, so all expired output
+   * pointers of the inputs are removed instead.
+   */
+  for (const auto& input : _inputs) {
+    if (!input) continue;
+    auto& input_outputs = input->_outputs;
+    input_outputs.erase(std::remove_if(input_outputs.begin(), input_outputs.end(),
+                                       [](const auto& output) { return output.expired(); }),
+                        input_outputs.end());
+  }
+}
+
 std::shared_ptr<AbstractLQPNode> AbstractLQPNode::left_input() const { return _inputs[0]; }
 
 std::shared_ptr<AbstractLQPNode> AbstractLQPNode::right_input() const { return _inputs[1]; }
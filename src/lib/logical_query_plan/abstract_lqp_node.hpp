@@ -46,7 +46,7 @@ struct LQPOutputRelation {
 class AbstractLQPNode : public std::enable_shared_from_this<AbstractLQPNode> {
  public:
   explicit AbstractLQPNode(const LQPNodeType node_type);
-  virtual ~AbstractLQPNode() = default;
+  virtual ~AbstractLQPNode();
 
   /**
    * @return a string describing this node, but nothing about its inputs.
@@ -1,13 +1,16 @@
 #include "lqp_translator.hpp"
 
+#include <algorithm>
 #include <iostream>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
 #include "abstract_lqp_node.hpp"
 #include "aggregate_node.hpp"
 #include "alias_node.hpp"
+#include "cost_model/abstract_cost_model.hpp"
 #include "create_view_node.hpp"
 #include "delete_node.hpp"
 #include "drop_view_node.hpp"
@@ -21,6 +24,7 @@
 #include "expression/list_expression.hpp"
 #include "expression/lqp_column_expression.hpp"
 #include "expression/lqp_select_expression.hpp"
+#include "expression/parameter_expression.hpp"
 #include "expression/pqp_column_expression.hpp"
 #include "expression/pqp_select_expression.hpp"
 #include "expression/value_expression.hpp"
@@ -34,6 +38,8 @@
 #include "operators/index_scan.hpp"
 #include "operators/insert.hpp"
 #include "operators/join_hash.hpp"
+#include "operators/join_index.hpp"
+#include "operators/join_mpsm.hpp"
 #include "operators/join_sort_merge.hpp"
 #include "operators/limit.hpp"
 #include "operators/maintenance/create_view.hpp"
@@ -52,8 +58,10 @@
 #include "operators/validate.hpp"
 #include "predicate_node.hpp"
 #include "projection_node.hpp"
+#include "scheduler/topology.hpp"
 #include "show_columns_node.hpp"
 #include "sort_node.hpp"
+#include "storage/index/primary_key/primary_key_index.hpp"
 #include "storage/storage_manager.hpp"
 #include "stored_table_node.hpp"
 #include "union_node.hpp"
@@ -64,6 +72,8 @@ using namespace std::string_literals;  // NOLINT
 
 namespace opossum {
 
+LQPTranslator::LQPTranslator(const std::shared_ptr<AbstractCostModel>& cost_model) : _cost_model(cost_model) {}
+
 std::shared_ptr<AbstractOperator> LQPTranslator::translate_node(const std::shared_ptr<AbstractLQPNode>& node) const {
   /**
    * Translate a node (i.e. call `_translate_by_node_type`) only if it hasn't been translated before, otherwise just
@@ -133,9 +143,23 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_stored_table_node(
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto predicate_node = std::static_pointer_cast<PredicateNode>(node);
+  if (predicate_node->scan_type == ScanType::IndexOnlyScan && _is_index_only_scan_possible(predicate_node)) {
+    return _translate_predicate_node_to_index_only_scan(predicate_node);
+  }
+
+  if (const auto join_operator = _translate_predicate_node_to_composite_key_join(predicate_node)) {
+    return join_operator;
+  }
+
+  if (predicate_node->scan_type == ScanType::IndexScan) {
+    if (const auto index_scan = _translate_predicate_nodes_to_primary_key_index_scan(predicate_node)) {
+      return index_scan;
+    }
+  }
+
   const auto input_node = node->left_input();
   const auto input_operator = translate_node(input_node);
-  const auto predicate_node = std::static_pointer_cast<PredicateNode>(node);
   const auto operator_scan_predicates =
       OperatorScanPredicate::from_expression(*predicate_node->predicate, *predicate_node);
 
@@ -145,6 +169,8 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node(
   auto output_operator = input_operator;
 
   switch (predicate_node->scan_type) {
+    // If an IndexOnlyScan is not possible (anymore), the TableScan reads the column from the ProjectionNode below
+    case ScanType::IndexOnlyScan:
     case ScanType::TableScan:
       for (const auto& operator_scan_predicate : *operator_scan_predicates) {
         output_operator = _translate_predicate_node_to_table_scan(operator_scan_predicate, output_operator);
@@ -169,6 +195,61 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_ta
   return std::make_shared<TableScan>(input_operator, column_id, predicate_condition, operator_scan_predicate.value);
 }
 
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_composite_key_join(
+    const std::shared_ptr<PredicateNode>& node) const {
+  /**
+   * Equality predicates between the two inputs of an inner join (e.g., the second and third column of a
+   * (w_id, d_id, o_id) key) end up in PredicateNodes above the JoinNode. If the join is executed by a JoinHash or by a
+   * JoinIndex probing a composite PrimaryKeyIndex, these predicates are passed to it as additional join columns, so
+   * that rows only matching on the first column are dropped while probing instead of being scanned from the join
+   * result.
+   * The PredicateNodes between `node` and the JoinNode and the JoinNode itself are not translated on their own, so
+   * they must not have other outputs. Returns nullptr if any of the predicates cannot be added to the join.
+   */
+  auto predicate_nodes = std::vector<std::shared_ptr<PredicateNode>>{node};
+  auto input_node = node->left_input();
+  while (input_node->type == LQPNodeType::Predicate && input_node->output_count() == 1) {
+    predicate_nodes.emplace_back(std::static_pointer_cast<PredicateNode>(input_node));
+    input_node = input_node->left_input();
+  }
+
+  if (input_node->type != LQPNodeType::Join || input_node->output_count() != 1) return nullptr;
+
+  const auto join_node = std::static_pointer_cast<JoinNode>(input_node);
+  if (join_node->join_mode != JoinMode::Inner) return nullptr;
+
+  const auto operator_join_predicate = OperatorJoinPredicate::from_expression(
+      *join_node->join_predicate, *join_node->left_input(), *join_node->right_input());
+  if (!operator_join_predicate || operator_join_predicate->predicate_condition != PredicateCondition::Equals) {
+    return nullptr;
+  }
+
+  auto additional_column_ids = std::vector<ColumnIDPair>{};
+  for (const auto& predicate_node : predicate_nodes) {
+    if (predicate_node->scan_type != ScanType::TableScan) return nullptr;
+
+    const auto additional_join_predicate = OperatorJoinPredicate::from_expression(
+        *predicate_node->predicate, *join_node->left_input(), *join_node->right_input());
+    if (!additional_join_predicate || additional_join_predicate->predicate_condition != PredicateCondition::Equals) {
+      return nullptr;
+    }
+
+    additional_column_ids.emplace_back(additional_join_predicate->column_ids);
+  }
+
+  switch (_choose_join_operator_type(join_node, *operator_join_predicate, additional_column_ids)) {
+    case OperatorType::JoinHash:
+      return std::make_shared<JoinHash>(translate_node(join_node->left_input()),
+                                        translate_node(join_node->right_input()), JoinMode::Inner,
+                                        operator_join_predicate->column_ids, PredicateCondition::Equals,
+                                        additional_column_ids);
+    case OperatorType::JoinIndex:
+      return _translate_join_node_to_join_index(join_node, *operator_join_predicate, additional_column_ids);
+    default:
+      return nullptr;
+  }
+}
+
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_index_scan(
     const std::shared_ptr<PredicateNode>& node, const std::shared_ptr<AbstractOperator>& input_operator) const {
   /**
@@ -176,45 +257,29 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_in
    * in two doesn't work as you can only do a single IndexScan per Table.
    */
 
-  auto column_id = ColumnID{0};
-  auto value_variant = AllTypeVariant{NullValue{}};
-  auto value2_variant = std::optional<AllTypeVariant>{};
-
   // Currently, we will only use IndexScans if the predicate node directly follows a StoredTableNode.
   // Our IndexScan implementation does not work on reference columns yet.
   Assert(node->left_input()->type == LQPNodeType::StoredTable, "IndexScan must follow a StoredTableNode.");
 
-  const auto predicate = std::dynamic_pointer_cast<AbstractPredicateExpression>(node->predicate);
-  Assert(predicate, "Expected predicate");
-  Assert(!predicate->arguments.empty(), "Expected arguments");
-
-  column_id = node->left_input()->get_column_id(*predicate->arguments[0]);
-  if (predicate->arguments.size() > 1) {
-    const auto value_expression = std::dynamic_pointer_cast<ValueExpression>(predicate->arguments[1]);
-    // This is necessary because we currently support single column indexes only
-    Assert(value_expression, "Expected value as second argument for IndexScan");
-    value_variant = value_expression->value;
-  }
-  if (predicate->arguments.size() > 2) {
-    const auto value_expression = std::dynamic_pointer_cast<ValueExpression>(predicate->arguments[2]);
-    // This is necessary because we currently support single column indexes only
-    Assert(value_expression, "Expected value as third argument for IndexScan");
-    value2_variant = value_expression->value;
-  }
+  auto stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(node->left_input());
+  const auto index_scan_predicate = _index_scan_predicate(*node, *stored_table_node);
+  const auto column_id = index_scan_predicate.column_id;
+  const auto predicate_condition = index_scan_predicate.predicate_condition;
+  const auto& right_values = index_scan_predicate.right_values;
+  const auto& right_values2 = index_scan_predicate.right_values2;
 
   const std::vector<ColumnID> column_ids = {column_id};
-  const std::vector<AllTypeVariant> right_values = {value_variant};
-  std::vector<AllTypeVariant> right_values2 = {};
-  if (value2_variant) right_values2.emplace_back(*value2_variant);
 
-  auto stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(node->left_input());
   const auto table_name = stored_table_node->table_name;
   const auto table = StorageManager::get().get_table(table_name);
+
   std::vector<ChunkID> indexed_chunks;
 
   for (ChunkID chunk_id{0u}; chunk_id < table->chunk_count(); ++chunk_id) {
     const auto chunk = table->get_chunk(chunk_id);
-    if (chunk->get_index(ColumnIndexType::GroupKey, column_ids)) {
+    // Mutable chunks have a DeltaIndex, which the IndexScan uses instead (see Table::create_index())
+    if (chunk->get_index(ColumnIndexType::GroupKey, column_ids) ||
+        chunk->get_index(ColumnIndexType::Delta, column_ids)) {
       indexed_chunks.emplace_back(chunk_id);
     }
   }
@@ -222,20 +287,19 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_in
   // All chunks that have an index on column_ids are handled by an IndexScan. All other chunks are handled by
   // TableScan(s).
   auto index_scan = std::make_shared<IndexScan>(input_operator, ColumnIndexType::GroupKey, column_ids,
-                                                predicate->predicate_condition, right_values, right_values2);
+                                                predicate_condition, right_values, right_values2);
 
   // See explanation for BETWEEN handling in _translate_predicate_node above.
   std::shared_ptr<TableScan> table_scan;
-  if (predicate->predicate_condition == PredicateCondition::Between) {
-    Assert(value2_variant, "Need value2 for Between");
-    auto table_scan_gt =
-        std::make_shared<TableScan>(input_operator, column_id, PredicateCondition::GreaterThanEquals, value_variant);
+  if (predicate_condition == PredicateCondition::Between) {
+    auto table_scan_gt = std::make_shared<TableScan>(input_operator, column_id, PredicateCondition::GreaterThanEquals,
+                                                     right_values[0]);
     table_scan_gt->set_excluded_chunk_ids(indexed_chunks);
 
     table_scan =
-        std::make_shared<TableScan>(table_scan_gt, column_id, PredicateCondition::LessThanEquals, *value2_variant);
+        std::make_shared<TableScan>(table_scan_gt, column_id, PredicateCondition::LessThanEquals, right_values2[0]);
   } else {
-    table_scan = std::make_shared<TableScan>(input_operator, column_id, predicate->predicate_condition, value_variant);
+    table_scan = std::make_shared<TableScan>(input_operator, column_id, predicate_condition, right_values[0]);
   }
 
   index_scan->set_included_chunk_ids(indexed_chunks);
@@ -244,6 +308,158 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_in
   return std::make_shared<UnionPositions>(index_scan, table_scan);
 }
 
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_nodes_to_primary_key_index_scan(
+    const std::shared_ptr<PredicateNode>& node) const {
+  /**
+   * The IndexScanRule places an Equals PredicateNode for each column of the PrimaryKeyIndex directly above the
+   * StoredTableNode (see IndexScanRule::_apply_primary_key_index()). `node` is the topmost of them. They are translated
+   * into a single lookup, the PredicateNodes below `node` are not translated on their own. Returns nullptr if the
+   * chain of PredicateNodes does not consist of exactly these predicates.
+   */
+  auto predicate_nodes = std::vector<std::shared_ptr<PredicateNode>>{node};
+  auto input_node = node->left_input();
+  while (input_node->type == LQPNodeType::Predicate && input_node->output_count() == 1) {
+    predicate_nodes.emplace_back(std::static_pointer_cast<PredicateNode>(input_node));
+    input_node = input_node->left_input();
+  }
+
+  if (input_node->type != LQPNodeType::StoredTable) return nullptr;
+  const auto stored_table_node = std::static_pointer_cast<StoredTableNode>(input_node);
+
+  const auto primary_key_index = StorageManager::get().get_table(stored_table_node->table_name)->primary_key_index();
+  if (!primary_key_index) return nullptr;
+
+  const auto& key_column_ids = primary_key_index->column_ids();
+  if (predicate_nodes.size() != key_column_ids.size()) return nullptr;
+
+  auto key_values = std::vector<std::optional<AllTypeVariant>>(key_column_ids.size());
+  for (const auto& predicate_node : predicate_nodes) {
+    const auto predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(predicate_node->predicate);
+    if (!predicate || predicate->predicate_condition != PredicateCondition::Equals) return nullptr;
+
+    auto column_id = stored_table_node->find_column_id(*predicate->left_operand());
+    auto value_expression = predicate->right_operand();
+    if (!column_id) {
+      column_id = stored_table_node->find_column_id(*predicate->right_operand());
+      value_expression = predicate->left_operand();
+    }
+    if (!column_id) return nullptr;
+
+    auto value = std::optional<AllTypeVariant>{};
+    if (value_expression->type == ExpressionType::Value) {
+      value = std::static_pointer_cast<ValueExpression>(value_expression)->value;
+    } else if (value_expression->type == ExpressionType::Parameter) {
+      value = std::static_pointer_cast<ParameterExpression>(value_expression)->value();
+    }
+    if (!value) return nullptr;
+
+    const auto key_column_iter = std::find(key_column_ids.begin(), key_column_ids.end(), *column_id);
+    if (key_column_iter == key_column_ids.end()) return nullptr;
+
+    auto& key_value = key_values[std::distance(key_column_ids.begin(), key_column_iter)];
+    if (key_value) return nullptr;
+    key_value = value;
+  }
+
+  auto right_values = std::vector<AllTypeVariant>{};
+  for (const auto& key_value : key_values) {
+    right_values.emplace_back(*key_value);
+  }
+
+  // The PrimaryKeyIndex covers all chunks, so no TableScan is needed for unindexed ones. If the ChunkPruningRule
+  // excluded chunks, the GetTable translated from the StoredTableNode outputs a copy of the table without the
+  // PrimaryKeyIndex and with different ChunkIDs. Thus, the IndexScan reads the whole table and drops the pruned chunks.
+  const auto get_table = std::make_shared<GetTable>(stored_table_node->table_name);
+  const auto index_scan = std::make_shared<IndexScan>(get_table, ColumnIndexType::PrimaryKey, key_column_ids,
+                                                      PredicateCondition::Equals, right_values);
+  index_scan->set_excluded_chunk_ids(stored_table_node->excluded_chunk_ids());
+  return index_scan;
+}
+
+LQPTranslator::IndexScanPredicate LQPTranslator::_index_scan_predicate(
+    const PredicateNode& node, const AbstractLQPNode& stored_table_node) const {
+  // The columns are resolved on the StoredTableNode, which the IndexScan reads, even if a ProjectionNode is in between
+  // (see _translate_predicate_node_to_index_only_scan()). OperatorScanPredicates always have the column on the left,
+  // e.g., `5 < a` becomes `a > 5`.
+  const auto operator_scan_predicates = OperatorScanPredicate::from_expression(*node.predicate, stored_table_node);
+  Assert(operator_scan_predicates && !operator_scan_predicates->empty() && operator_scan_predicates->size() <= 2,
+         "Couldn't translate to IndexScan: "s + node.predicate->as_column_name());
+
+  const auto& operator_scan_predicate = operator_scan_predicates->front();
+  auto index_scan_predicate =
+      IndexScanPredicate{operator_scan_predicate.column_id, operator_scan_predicate.predicate_condition,
+                         {_index_scan_value(operator_scan_predicate.value, *node.predicate)}, {}};
+
+  // BETWEEN was split into a GreaterThanEquals and a LessThanEquals predicate
+  if (operator_scan_predicates->size() == 2) {
+    const auto& upper_bound_predicate = operator_scan_predicates->back();
+    Assert(upper_bound_predicate.column_id == operator_scan_predicate.column_id,
+           "Expected BETWEEN on a single column for IndexScan");
+    index_scan_predicate.predicate_condition = PredicateCondition::Between;
+    index_scan_predicate.right_values2.emplace_back(_index_scan_value(upper_bound_predicate.value, *node.predicate));
+  }
+
+  return index_scan_predicate;
+}
+
+AllTypeVariant LQPTranslator::_index_scan_value(const AllParameterVariant& value,
+                                                const AbstractExpression& predicate) const {
+  if (is_variant(value)) return boost::get<AllTypeVariant>(value);
+
+  // This is necessary because we currently support single column indexes only
+  Assert(is_parameter_id(value), "Expected value as argument for IndexScan");
+
+  // The IndexScanRule only chooses IndexScans for parameters whose value is known
+  const auto parameter_id = boost::get<ParameterID>(value);
+  for (const auto& argument : predicate.arguments) {
+    const auto parameter_expression = std::dynamic_pointer_cast<ParameterExpression>(argument);
+    if (parameter_expression && parameter_expression->parameter_id == parameter_id && parameter_expression->value()) {
+      return *parameter_expression->value();
+    }
+  }
+  Fail("Expected bound parameter as argument for IndexScan");
+}
+
+bool LQPTranslator::_is_index_only_scan_possible(const std::shared_ptr<PredicateNode>& node) const {
+  const auto projection_node = node->left_input();
+  if (projection_node->type != LQPNodeType::Projection) return false;
+  const auto stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(projection_node->left_input());
+  if (!stored_table_node) return false;
+
+  const auto operator_scan_predicates = OperatorScanPredicate::from_expression(*node->predicate, *stored_table_node);
+  if (!operator_scan_predicates || operator_scan_predicates->empty()) return false;
+
+  const auto column_ids = std::vector<ColumnID>{operator_scan_predicates->front().column_id};
+  const auto table = StorageManager::get().get_table(stored_table_node->table_name);
+
+  // Chunks might have been added or encoded since the LQP was optimized. All of them need an index on the column that
+  // supports index-only scans. Mutable chunks have a DeltaIndex (see Table::create_index()).
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    auto index = chunk->get_index(ColumnIndexType::GroupKey, column_ids);
+    if (!index) index = chunk->get_index(ColumnIndexType::Delta, column_ids);
+    if (!index || !index->supports_index_only_scans()) return false;
+  }
+
+  return true;
+}
+
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_index_only_scan(
+    const std::shared_ptr<PredicateNode>& node) const {
+  // The IndexScan reads the StoredTable directly, it does not need the ProjectionNode that selects the column
+  const auto stored_table_node = std::static_pointer_cast<StoredTableNode>(node->left_input()->left_input());
+  const auto input_operator = translate_node(stored_table_node);
+
+  const auto index_scan_predicate = _index_scan_predicate(*node, *stored_table_node);
+  const auto column_ids = std::vector<ColumnID>{index_scan_predicate.column_id};
+
+  const auto index_scan = std::make_shared<IndexScan>(
+      input_operator, ColumnIndexType::GroupKey, column_ids, index_scan_predicate.predicate_condition,
+      index_scan_predicate.right_values, index_scan_predicate.right_values2);
+  index_scan->set_index_only(true);
+  return index_scan;
+}
+
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_alias_node(
     const std::shared_ptr<opossum::AbstractLQPNode>& node) const {
   const auto alias_node = std::dynamic_pointer_cast<AliasNode>(node);
@@ -305,13 +521,12 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_sort_node(
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
   const auto input_left_operator = translate_node(node->left_input());
-  const auto input_right_operator = translate_node(node->right_input());
 
   auto join_node = std::dynamic_pointer_cast<JoinNode>(node);
 
   if (join_node->join_mode == JoinMode::Cross) {
     PerformanceWarning("CROSS join used");
-    return std::make_shared<Product>(input_left_operator, input_right_operator);
+    return std::make_shared<Product>(input_left_operator, translate_node(node->right_input()));
   }
 
   Assert(join_node->join_predicate, "Need predicate for non Cross Join");
@@ -326,13 +541,135 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
 
   const auto predicate_condition = operator_join_predicate->predicate_condition;
 
-  if (predicate_condition == PredicateCondition::Equals && join_node->join_mode != JoinMode::Outer) {
-    return std::make_shared<JoinHash>(input_left_operator, input_right_operator, join_node->join_mode,
-                                      operator_join_predicate->column_ids, predicate_condition);
+  const auto join_operator_type = _choose_join_operator_type(join_node, *operator_join_predicate);
+  // The JoinIndex might not use the translated right input (see _translate_join_node_to_join_index())
+  if (join_operator_type == OperatorType::JoinIndex) {
+    return _translate_join_node_to_join_index(join_node, *operator_join_predicate);
+  }
+
+  const auto input_right_operator = translate_node(node->right_input());
+
+  switch (join_operator_type) {
+    case OperatorType::JoinHash:
+      return std::make_shared<JoinHash>(input_left_operator, input_right_operator, join_node->join_mode,
+                                        operator_join_predicate->column_ids, predicate_condition);
+    case OperatorType::JoinMPSM:
+      return std::make_shared<JoinMPSM>(input_left_operator, input_right_operator, join_node->join_mode,
+                                        operator_join_predicate->column_ids, predicate_condition);
+    case OperatorType::JoinSortMerge:
+      return std::make_shared<JoinSortMerge>(input_left_operator, input_right_operator, join_node->join_mode,
+                                             operator_join_predicate->column_ids, predicate_condition);
+    default:
+      Fail("Unexpected join operator type");
+  }
+}
+
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node_to_join_index(
+    const std::shared_ptr<JoinNode>& join_node, const OperatorJoinPredicate& operator_join_predicate,
+    const std::vector<ColumnIDPair>& additional_column_ids) const {
+  // The output of a Validate has no indexes, so the JoinIndex probes the stored table and validates the matches itself
+  auto right_input = join_node->right_input();
+  const auto validate_right_input = right_input->type == LQPNodeType::Validate;
+  if (validate_right_input) right_input = right_input->left_input();
+
+  auto join_index = std::make_shared<JoinIndex>(translate_node(join_node->left_input()), translate_node(right_input),
+                                                join_node->join_mode, operator_join_predicate.column_ids,
+                                                operator_join_predicate.predicate_condition, additional_column_ids);
+  join_index->set_validate_right_input(validate_right_input);
+  return join_index;
+}
+
+OperatorType LQPTranslator::_choose_join_operator_type(const std::shared_ptr<JoinNode>& join_node,
+                                                       const OperatorJoinPredicate& operator_join_predicate,
+                                                       const std::vector<ColumnIDPair>& additional_column_ids) const {
+  const auto join_mode = join_node->join_mode;
+  const auto predicate_condition = operator_join_predicate.predicate_condition;
+
+  /**
+   * Collect the join operators able to execute this JoinNode. If there are multiple, the first one is used unless the
+   * CostModel finds another one to be cheaper. Only JoinHash and JoinIndex (with a PrimaryKeyIndex) support
+   * additional join columns. If neither of them can execute the join, JoinSortMerge is returned.
+   */
+  auto candidates = std::vector<OperatorType>{};
+
+  if (predicate_condition == PredicateCondition::Equals && join_mode != JoinMode::Outer) {
+    candidates.emplace_back(OperatorType::JoinHash);
+  }
+
+  if (!_cost_model) {
+    return candidates.empty() ? OperatorType::JoinSortMerge : candidates.front();
+  }
+
+  // JoinSortMerge, JoinIndex and JoinMPSM do not support Semi and Anti joins
+  const auto mode_supported = join_mode == JoinMode::Inner || join_mode == JoinMode::Left ||
+                              join_mode == JoinMode::Right || join_mode == JoinMode::Outer;
+  // Outer joins are not implemented for not-equals joins
+  const auto condition_supported = predicate_condition != PredicateCondition::NotEquals || join_mode == JoinMode::Inner;
+
+  if (mode_supported && condition_supported) {
+    if (additional_column_ids.empty()) {
+      if (predicate_condition == PredicateCondition::Equals && Topology::get().nodes().size() > 1) {
+        candidates.emplace_back(OperatorType::JoinMPSM);
+      }
+
+      candidates.emplace_back(OperatorType::JoinSortMerge);
+    }
+
+    /**
+     * JoinIndex falls back to a nested loop for chunks of the right input that don't have an index. Only use it if
+     * the right input is a stored table with a PrimaryKeyIndex on the join columns or with an index on the join column
+     * in every chunk. A pruned table (i.e., the output of GetTable) has no PrimaryKeyIndex.
+     * With MVCC, the stored table is the input of a ValidateNode. The JoinIndex validates the right input itself (see
+     * JoinIndex::set_validate_right_input()), which is only supported for inner joins.
+     */
+    auto right_input = join_node->right_input();
+    if (right_input->type == LQPNodeType::Validate && join_mode == JoinMode::Inner) {
+      right_input = right_input->left_input();
+    }
+
+    if (right_input->type == LQPNodeType::StoredTable) {
+      const auto stored_table_node = std::static_pointer_cast<StoredTableNode>(right_input);
+      const auto table = StorageManager::get().get_table(stored_table_node->table_name);
+
+      auto right_column_ids = std::vector<ColumnID>{operator_join_predicate.column_ids.second};
+      for (const auto& column_ids : additional_column_ids) {
+        right_column_ids.emplace_back(column_ids.second);
+      }
+
+      const auto primary_key_index = table->primary_key_index();
+      auto primary_key_usable = primary_key_index && predicate_condition == PredicateCondition::Equals &&
+                                stored_table_node->excluded_chunk_ids().empty();
+      if (primary_key_usable) {
+        auto key_column_ids = primary_key_index->column_ids();
+        std::sort(key_column_ids.begin(), key_column_ids.end());
+        std::sort(right_column_ids.begin(), right_column_ids.end());
+        primary_key_usable = key_column_ids == right_column_ids;
+      }
+
+      auto all_chunks_indexed = table->chunk_count() > 0 && additional_column_ids.empty();
+      for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count() && all_chunks_indexed; ++chunk_id) {
+        all_chunks_indexed = !table->get_chunk(chunk_id)->get_indices(right_column_ids).empty();
+      }
+
+      if (primary_key_usable || all_chunks_indexed) candidates.emplace_back(OperatorType::JoinIndex);
+    }
+  }
+
+  if (candidates.empty()) return OperatorType::JoinSortMerge;
+  if (candidates.size() == 1) return candidates.front();
+
+  auto best_operator_type = candidates.front();
+  auto best_cost = _cost_model->estimate_lqp_node_cost(join_node, best_operator_type);
+
+  for (auto candidate_iter = candidates.begin() + 1; candidate_iter != candidates.end(); ++candidate_iter) {
+    const auto cost = _cost_model->estimate_lqp_node_cost(join_node, *candidate_iter);
+    if (cost < best_cost) {
+      best_cost = cost;
+      best_operator_type = *candidate_iter;
+    }
   }
 
-  return std::make_shared<JoinSortMerge>(input_left_operator, input_right_operator, join_node->join_mode,
-                                         operator_join_predicate->column_ids, predicate_condition);
+  return best_operator_type;
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_aggregate_node(
@@ -2,16 +2,21 @@
 
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include "abstract_lqp_node.hpp"
+#include "all_parameter_variant.hpp"
 #include "all_type_variant.hpp"
 #include "operators/abstract_operator.hpp"
 
 namespace opossum {
 
+class AbstractCostModel;
 class AbstractOperator;
 class TransactionContext;
 class AbstractExpression;
+class AbstractPredicateExpression;
+class JoinNode;
 class PredicateNode;
 struct OperatorScanPredicate;
 struct OperatorJoinPredicate;
@@ -19,9 +24,16 @@ struct OperatorJoinPredicate;
 /**
  * Translates an LQP (Logical Query Plan), represented by its root node, into an Operator tree for the execution
  * engine, which in return is represented by its root Operator.
+ *
+ * If a CostModel is passed, it is used to choose the cheapest of the join Operators that can execute a JoinNode (i.e.,
+ * JoinHash, JoinSortMerge, JoinIndex if the right input is a table with an index on the join column, and JoinMPSM on
+ * NUMA systems). Otherwise, equi-joins are translated to JoinHash and all other joins to JoinSortMerge.
  */
 class LQPTranslator {
  public:
+  LQPTranslator() = default;
+  explicit LQPTranslator(const std::shared_ptr<AbstractCostModel>& cost_model);
+
   virtual ~LQPTranslator() = default;
 
   virtual std::shared_ptr<AbstractOperator> translate_node(const std::shared_ptr<AbstractLQPNode>& node) const;
@@ -34,13 +46,37 @@ class LQPTranslator {
   std::shared_ptr<AbstractOperator> _translate_predicate_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_predicate_node_to_index_scan(
       const std::shared_ptr<PredicateNode>& node, const std::shared_ptr<AbstractOperator>& input_operator) const;
+  std::shared_ptr<AbstractOperator> _translate_predicate_nodes_to_primary_key_index_scan(
+      const std::shared_ptr<PredicateNode>& node) const;
+  std::shared_ptr<AbstractOperator> _translate_predicate_node_to_index_only_scan(
+      const std::shared_ptr<PredicateNode>& node) const;
+  bool _is_index_only_scan_possible(const std::shared_ptr<PredicateNode>& node) const;
+
+  // The column, condition, and values of an IndexScan. Other than OperatorScanPredicates, it keeps BETWEEN as a single
+  // predicate, as only a single IndexScan can be executed per table.
+  struct IndexScanPredicate {
+    ColumnID column_id;
+    PredicateCondition predicate_condition;
+    std::vector<AllTypeVariant> right_values;
+    std::vector<AllTypeVariant> right_values2;
+  };
+  IndexScanPredicate _index_scan_predicate(const PredicateNode& node, const AbstractLQPNode& stored_table_node) const;
+  AllTypeVariant _index_scan_value(const AllParameterVariant& value, const AbstractExpression& predicate) const;
   std::shared_ptr<AbstractOperator> _translate_predicate_node_to_table_scan(
       const OperatorScanPredicate& operator_scan_predicate,
       const std::shared_ptr<AbstractOperator>& input_operator) const;
+  std::shared_ptr<AbstractOperator> _translate_predicate_node_to_composite_key_join(
+      const std::shared_ptr<PredicateNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_alias_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_projection_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_sort_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_join_node(const std::shared_ptr<AbstractLQPNode>& node) const;
+  std::shared_ptr<AbstractOperator> _translate_join_node_to_join_index(
+      const std::shared_ptr<JoinNode>& join_node, const OperatorJoinPredicate& operator_join_predicate,
+      const std::vector<ColumnIDPair>& additional_column_ids = {}) const;
+  OperatorType _choose_join_operator_type(const std::shared_ptr<JoinNode>& join_node,
+                                          const OperatorJoinPredicate& operator_join_predicate,
+                                          const std::vector<ColumnIDPair>& additional_column_ids = {}) const;
   std::shared_ptr<AbstractOperator> _translate_aggregate_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_limit_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_insert_node(const std::shared_ptr<AbstractLQPNode>& node) const;
@@ -74,6 +110,8 @@ class LQPTranslator {
   static AllParameterVariant _translate_to_all_parameter_variant(const AbstractLQPNode& input_node,
                                                                  const AbstractExpression& expression);
 
+  const std::shared_ptr<AbstractCostModel> _cost_model;
+
   // Cache operator subtrees by LQP node to avoid executing operators below a diamond shape multiple times
   mutable std::unordered_map<std::shared_ptr<const AbstractLQPNode>, std::shared_ptr<AbstractOperator>>
       _operator_by_lqp_node;
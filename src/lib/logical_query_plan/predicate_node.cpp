@@ -4,6 +4,7 @@
 #include <optional>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 
 #include "constant_mappings.hpp"
 #include "expression/between_expression.hpp"
@@ -43,18 +44,40 @@ std::shared_ptr<TableStatistics> PredicateNode::derive_statistics_from(
   const auto operator_predicates = OperatorScanPredicate::from_expression(*predicate, *left_input);
   if (!operator_predicates) return left_input->get_statistics();
 
+  // Parameters that already have a value (e.g., literals parameterized by the ParameterizedPlanCache) are estimated
+  // like the value
+  auto parameter_values = std::unordered_map<ParameterID, AllTypeVariant>{};
+  visit_expression(predicate, [&](const auto& sub_expression) {
+    if (sub_expression->type != ExpressionType::Parameter) return ExpressionVisitation::VisitArguments;
+
+    const auto parameter_expression = std::static_pointer_cast<ParameterExpression>(sub_expression);
+    if (parameter_expression->value()) {
+      parameter_values.emplace(parameter_expression->parameter_id, *parameter_expression->value());
+    }
+    return ExpressionVisitation::DoNotVisitArguments;
+  });
+
   auto output_statistics = left_input->get_statistics();
 
   for (const auto& operator_predicate : *operator_predicates) {
+    auto value = operator_predicate.value;
+    if (is_parameter_id(value)) {
+      const auto parameter_value_iter = parameter_values.find(boost::get<ParameterID>(value));
+      if (parameter_value_iter != parameter_values.end()) value = parameter_value_iter->second;
+    }
+
     output_statistics = std::make_shared<TableStatistics>(output_statistics->estimate_predicate(
-        operator_predicate.column_id, operator_predicate.predicate_condition, operator_predicate.value));
+        operator_predicate.column_id, operator_predicate.predicate_condition, value));
   }
 
   return output_statistics;
 }
 
 std::shared_ptr<AbstractLQPNode> PredicateNode::_on_shallow_copy(LQPNodeMapping& node_mapping) const {
-  return std::make_shared<PredicateNode>(expression_copy_and_adapt_to_different_lqp(*predicate, node_mapping));
+  const auto copy =
+      std::make_shared<PredicateNode>(expression_copy_and_adapt_to_different_lqp(*predicate, node_mapping));
+  copy->scan_type = scan_type;
+  return copy;
 }
 
 bool PredicateNode::_on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const {
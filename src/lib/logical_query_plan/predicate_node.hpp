@@ -15,7 +15,11 @@ namespace opossum {
 class AbstractExpression;
 class TableStatistics;
 
-enum class ScanType : uint8_t { TableScan, IndexScan };
+/**
+ * An IndexOnlyScan takes the values of the predicate's column from the index and outputs only this column. Its input
+ * is a ProjectionNode that selects the column from a StoredTableNode (see IndexScanRule).
+ */
+enum class ScanType : uint8_t { TableScan, IndexScan, IndexOnlyScan };
 
 /**
  * This node type represents a filter.
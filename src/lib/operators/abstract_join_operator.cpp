@@ -3,6 +3,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "constant_mappings.hpp"
 
@@ -39,6 +40,26 @@ const std::string AbstractJoinOperator::description(DescriptionMode description_
          predicate_condition_to_string.left.at(_predicate_condition) + " " + column_name_right + ")";
 }
 
+const std::string AbstractJoinOperator::_description_with_additional_column_ids(
+    DescriptionMode description_mode, const std::vector<ColumnIDPair>& additional_column_ids) const {
+  auto description = AbstractJoinOperator::description(description_mode);
+  if (additional_column_ids.empty()) return description;
+
+  // Add the additional predicates before the closing bracket
+  description.pop_back();
+  for (const auto& [left_column_id, right_column_id] : additional_column_ids) {
+    auto column_name_left = std::string("Col #") + std::to_string(left_column_id);
+    auto column_name_right = std::string("Col #") + std::to_string(right_column_id);
+
+    if (input_table_left()) column_name_left = input_table_left()->column_name(left_column_id);
+    if (input_table_right()) column_name_right = input_table_right()->column_name(right_column_id);
+
+    description += " AND " + column_name_left + " " +
+                   predicate_condition_to_string.left.at(PredicateCondition::Equals) + " " + column_name_right;
+  }
+  return description + ")";
+}
+
 void AbstractJoinOperator::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
 
 }  // namespace opossum
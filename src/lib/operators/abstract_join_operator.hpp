@@ -42,6 +42,10 @@ class AbstractJoinOperator : public AbstractReadOnlyOperator {
 
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
 
+  // Returns the description with the further Equals conditions of joins on multiple columns appended
+  const std::string _description_with_additional_column_ids(
+      DescriptionMode description_mode, const std::vector<ColumnIDPair>& additional_column_ids) const;
+
   // Some operators need an internal implementation class, mostly in cases where
   // their execute method depends on a template parameter. An example for this is
   // found in join_hash.hpp.
@@ -1,13 +1,26 @@
 #include "index_scan.hpp"
 
 #include <algorithm>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "table_scan.hpp"
 
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
 
+#include "storage/base_column.hpp"
 #include "storage/index/base_index.hpp"
+#include "storage/index/primary_key/primary_key_index.hpp"
+#include "storage/materialize.hpp"
 #include "storage/reference_column.hpp"
+#include "storage/value_column.hpp"
 
 #include "utils/assert.hpp"
 
@@ -27,25 +40,70 @@ const std::string IndexScan::name() const { return "IndexScan"; }
 
 void IndexScan::set_included_chunk_ids(const std::vector<ChunkID>& chunk_ids) { _included_chunk_ids = chunk_ids; }
 
+void IndexScan::set_excluded_chunk_ids(const std::vector<ChunkID>& chunk_ids) { _excluded_chunk_ids = chunk_ids; }
+
+void IndexScan::set_index_only(const bool index_only) { _index_only = index_only; }
+
+bool IndexScan::is_index_only() const { return _index_only; }
+
 std::shared_ptr<const Table> IndexScan::_on_execute() {
   _in_table = input_table_left();
 
   _validate_input();
 
-  _out_table = std::make_shared<Table>(_in_table->column_definitions(), TableType::References);
+  if (_index_only) {
+    // Indexes do not contain NULLs
+    const auto& column_definition = _in_table->column_definitions()[_left_column_ids[0]];
+    _out_table = std::make_shared<Table>(
+        TableColumnDefinitions{{column_definition.name, column_definition.data_type, false}}, TableType::Data);
+  } else {
+    _out_table = std::make_shared<Table>(_in_table->column_definitions(), TableType::References);
+  }
+
+  if (_index_type == ColumnIndexType::PrimaryKey) {
+    const auto matches_out = std::make_shared<PosList>(_scan_primary_key_index());
+
+    ChunkColumns columns;
+    for (ColumnID column_id{0u}; column_id < _in_table->column_count(); ++column_id) {
+      columns.push_back(std::make_shared<ReferenceColumn>(_in_table, column_id, matches_out));
+    }
+    _out_table->append_chunk(columns);
+
+    return _out_table;
+  }
+
+  auto chunk_ids = _included_chunk_ids;
+  if (chunk_ids.empty()) {
+    chunk_ids.resize(_in_table->chunk_count());
+    std::iota(chunk_ids.begin(), chunk_ids.end(), ChunkID{0u});
+  }
 
   std::mutex output_mutex;
 
+  // Chunks can lack the index, e.g., because it was dropped when the chunk was encoded (see Chunk::replace_column())
+  auto chunk_ids_without_index = std::vector<ChunkID>{};
   auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
-  if (_included_chunk_ids.empty()) {
-    jobs.reserve(_in_table->chunk_count());
-    for (auto chunk_id = ChunkID{0u}; chunk_id < _in_table->chunk_count(); ++chunk_id) {
-      jobs.push_back(_create_job_and_schedule(chunk_id, output_mutex));
+  jobs.reserve(chunk_ids.size());
+  for (const auto chunk_id : chunk_ids) {
+    const auto index = _get_index(chunk_id);
+    if (index) {
+      jobs.push_back(_create_job_and_schedule(chunk_id, index, output_mutex));
+    } else {
+      chunk_ids_without_index.push_back(chunk_id);
     }
-  } else {
-    jobs.reserve(_included_chunk_ids.size());
-    for (auto chunk_id : _included_chunk_ids) {
-      jobs.push_back(_create_job_and_schedule(chunk_id, output_mutex));
+  }
+
+  if (!chunk_ids_without_index.empty()) {
+    const auto scanned_table = _scan_chunks_without_index(chunk_ids_without_index);
+
+    std::lock_guard<std::mutex> lock(output_mutex);
+    for (auto chunk_id = ChunkID{0u}; chunk_id < scanned_table->chunk_count(); ++chunk_id) {
+      const auto chunk = scanned_table->get_chunk(chunk_id);
+      if (_index_only) {
+        _out_table->append_chunk(ChunkColumns{_materialize_sorted_values(*chunk->get_column(_left_column_ids[0]))});
+      } else {
+        _out_table->append_chunk(chunk->columns(), chunk->get_allocator(), chunk->access_counter());
+      }
     }
   }
 
@@ -57,15 +115,31 @@ std::shared_ptr<const Table> IndexScan::_on_execute() {
 std::shared_ptr<AbstractOperator> IndexScan::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
-  return std::make_shared<IndexScan>(copied_input_left, _index_type, _left_column_ids, _predicate_condition,
-                                     _right_values, _right_values2);
+  auto copy = std::make_shared<IndexScan>(copied_input_left, _index_type, _left_column_ids, _predicate_condition,
+                                          _right_values, _right_values2);
+  copy->set_included_chunk_ids(_included_chunk_ids);
+  copy->set_excluded_chunk_ids(_excluded_chunk_ids);
+  copy->set_index_only(_index_only);
+  return copy;
 }
 
 void IndexScan::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
 
-std::shared_ptr<AbstractTask> IndexScan::_create_job_and_schedule(const ChunkID chunk_id, std::mutex& output_mutex) {
+std::shared_ptr<AbstractTask> IndexScan::_create_job_and_schedule(const ChunkID chunk_id,
+                                                                  const std::shared_ptr<const BaseIndex>& index,
+                                                                  std::mutex& output_mutex) {
   auto job_task = std::make_shared<JobTask>([=, &output_mutex]() {
-    const auto matches_out = std::make_shared<PosList>(_scan_chunk(chunk_id));
+    if (_index_only) {
+      const auto values_columns = _scan_chunk_index_only(*index);
+
+      std::lock_guard<std::mutex> lock(output_mutex);
+      for (const auto& values_column : values_columns) {
+        _out_table->append_chunk(ChunkColumns{values_column});
+      }
+      return;
+    }
+
+    const auto matches_out = std::make_shared<PosList>(_scan_chunk(chunk_id, *index));
 
     const auto chunk = _in_table->get_chunk(chunk_id);
     // The output chunk is allocated on the same NUMA node as the input chunk. Also, the ChunkAccessCounter is
@@ -88,6 +162,7 @@ std::shared_ptr<AbstractTask> IndexScan::_create_job_and_schedule(const ChunkID
 }
 
 void IndexScan::_validate_input() {
+  Assert(_index_type != ColumnIndexType::Invalid, "Invalid index type.");
   Assert(_predicate_condition != PredicateCondition::Like, "Predicate condition not supported by index scan.");
   Assert(_predicate_condition != PredicateCondition::NotLike, "Predicate condition not supported by index scan.");
 
@@ -99,70 +174,155 @@ void IndexScan::_validate_input() {
   }
 
   Assert(_in_table->type() == TableType::Data, "IndexScan only supports persistent tables right now.");
+
+  if (_index_type == ColumnIndexType::PrimaryKey) {
+    Assert(_predicate_condition == PredicateCondition::Equals, "PrimaryKeyIndex only supports Equals.");
+    Assert(!_index_only, "PrimaryKeyIndex does not support index-only scans.");
+  } else {
+    Assert(_excluded_chunk_ids.empty(), "Excluded chunks are only supported for the PrimaryKeyIndex.");
+  }
+
+  if (_index_only) {
+    Assert(_left_column_ids.size() == 1, "Index-only scans are only supported for single-column indexes.");
+  }
 }
 
-PosList IndexScan::_scan_chunk(const ChunkID chunk_id) {
+PosList IndexScan::_scan_chunk(const ChunkID chunk_id, const BaseIndex& index) {
   const auto to_row_id = [chunk_id](ChunkOffset chunk_offset) { return RowID{chunk_id, chunk_offset}; };
 
-  auto range_begin = BaseIndex::Iterator{};
-  auto range_end = BaseIndex::Iterator{};
+  const auto index_lock = index.lock_for_reading();
+
+  const auto ranges = _get_matching_ranges(index);
+
+  auto match_count = size_t{0};
+  for (const auto& range : ranges) {
+    match_count += std::distance(range.first, range.second);
+  }
 
-  const auto chunk = _in_table->get_chunk_with_access_counting(chunk_id);
   auto matches_out = PosList{};
+  matches_out.reserve(match_count);
+  for (const auto& range : ranges) {
+    std::transform(range.first, range.second, std::back_inserter(matches_out), to_row_id);
+  }
 
-  const auto index = chunk->get_index(_index_type, _left_column_ids);
-  Assert(index != nullptr, "Index of specified type not found for column (vector).");
+  return matches_out;
+}
 
-  switch (_predicate_condition) {
-    case PredicateCondition::Equals: {
-      range_begin = index->lower_bound(_right_values);
-      range_end = index->upper_bound(_right_values);
-      break;
-    }
-    case PredicateCondition::NotEquals: {
-      // first, get all values less than the search value
-      range_begin = index->cbegin();
-      range_end = index->lower_bound(_right_values);
-
-      matches_out.reserve(std::distance(range_begin, range_end));
-      std::transform(range_begin, range_end, std::back_inserter(matches_out), to_row_id);
-
-      // set range for second half to all values greater than the search value
-      range_begin = index->upper_bound(_right_values);
-      range_end = index->cend();
-      break;
-    }
-    case PredicateCondition::LessThan: {
-      range_begin = index->cbegin();
-      range_end = index->lower_bound(_right_values);
-      break;
-    }
-    case PredicateCondition::LessThanEquals: {
-      range_begin = index->cbegin();
-      range_end = index->upper_bound(_right_values);
-      break;
-    }
-    case PredicateCondition::GreaterThan: {
-      range_begin = index->upper_bound(_right_values);
-      range_end = index->cend();
-      break;
-    }
-    case PredicateCondition::GreaterThanEquals: {
-      range_begin = index->lower_bound(_right_values);
-      range_end = index->cend();
-      break;
-    }
-    case PredicateCondition::Between: {
-      range_begin = index->lower_bound(_right_values);
-      range_end = index->upper_bound(_right_values2);
-      break;
+std::vector<std::shared_ptr<BaseColumn>> IndexScan::_scan_chunk_index_only(const BaseIndex& index) {
+  Assert(index.supports_index_only_scans(), "Index does not support index-only scans.");
+  const auto index_lock = index.lock_for_reading();
+
+  auto values_columns = std::vector<std::shared_ptr<BaseColumn>>{};
+  for (const auto& range : _get_matching_ranges(index)) {
+    values_columns.emplace_back(index.values(range.first, range.second));
+  }
+
+  return values_columns;
+}
+
+std::shared_ptr<const Table> IndexScan::_scan_chunks_without_index(const std::vector<ChunkID>& chunk_ids) const {
+  const auto scanned_chunk_ids = std::unordered_set<ChunkID>{chunk_ids.begin(), chunk_ids.end()};
+  auto excluded_chunk_ids = std::vector<ChunkID>{};
+  for (auto chunk_id = ChunkID{0u}; chunk_id < _in_table->chunk_count(); ++chunk_id) {
+    if (!scanned_chunk_ids.count(chunk_id)) excluded_chunk_ids.emplace_back(chunk_id);
+  }
+
+  // The first TableScan only scans the given chunks, the following ones filter its output
+  auto scan_input = input_left();
+  const auto add_table_scan = [&](const ColumnID column_id, const PredicateCondition predicate_condition,
+                                  const AllTypeVariant& value) {
+    const auto table_scan = std::make_shared<TableScan>(scan_input, column_id, predicate_condition, value);
+    if (scan_input == input_left()) table_scan->set_excluded_chunk_ids(excluded_chunk_ids);
+    table_scan->execute();
+    scan_input = table_scan;
+  };
+
+  if (_predicate_condition == PredicateCondition::Between) {
+    Assert(_left_column_ids.size() == 1, "Chunks without index can only be scanned for Between on a single column.");
+    add_table_scan(_left_column_ids[0], PredicateCondition::GreaterThanEquals, _right_values[0]);
+    add_table_scan(_left_column_ids[0], PredicateCondition::LessThanEquals, _right_values2[0]);
+  } else if (_predicate_condition == PredicateCondition::Equals) {
+    for (auto column_idx = size_t{0}; column_idx < _left_column_ids.size(); ++column_idx) {
+      add_table_scan(_left_column_ids[column_idx], PredicateCondition::Equals, _right_values[column_idx]);
     }
+  } else {
+    // Multi-column indexes compare the values lexicographically, which a chain of TableScans cannot express
+    Assert(_left_column_ids.size() == 1, "Chunks without index can only be scanned for Equals on multiple columns.");
+    add_table_scan(_left_column_ids[0], _predicate_condition, _right_values[0]);
+  }
+
+  return scan_input->get_output();
+}
+
+std::shared_ptr<BaseColumn> IndexScan::_materialize_sorted_values(const BaseColumn& column) const {
+  auto values_column = std::shared_ptr<BaseColumn>{};
+
+  resolve_data_type(_in_table->column_data_type(_left_column_ids[0]), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    // The scanned values are never NULL, as NULLs do not match any predicate condition supported by the IndexScan
+    auto values = std::vector<ColumnDataType>{};
+    materialize_values(column, values);
+    std::sort(values.begin(), values.end());
+    values_column = std::make_shared<ValueColumn<ColumnDataType>>(values);
+  });
+
+  return values_column;
+}
+
+std::shared_ptr<const BaseIndex> IndexScan::_get_index(const ChunkID chunk_id) const {
+  const auto chunk = _in_table->get_chunk_with_access_counting(chunk_id);
+
+  auto index = chunk->get_index(_index_type, _left_column_ids);
+
+  // Mutable chunks have a DeltaIndex instead of the requested one (see Table::create_index())
+  if (!index) index = chunk->get_index(ColumnIndexType::Delta, _left_column_ids);
+
+  return index;
+}
+
+std::vector<std::pair<BaseIndex::Iterator, BaseIndex::Iterator>> IndexScan::_get_matching_ranges(
+    const BaseIndex& index) const {
+  switch (_predicate_condition) {
+    case PredicateCondition::Equals:
+      return {{index.lower_bound(_right_values), index.upper_bound(_right_values)}};
+    case PredicateCondition::NotEquals:
+      // all values less than the search value and all values greater than the search value
+      return {{index.cbegin(), index.lower_bound(_right_values)}, {index.upper_bound(_right_values), index.cend()}};
+    case PredicateCondition::LessThan:
+      return {{index.cbegin(), index.lower_bound(_right_values)}};
+    case PredicateCondition::LessThanEquals:
+      return {{index.cbegin(), index.upper_bound(_right_values)}};
+    case PredicateCondition::GreaterThan:
+      return {{index.upper_bound(_right_values), index.cend()}};
+    case PredicateCondition::GreaterThanEquals:
+      return {{index.lower_bound(_right_values), index.cend()}};
+    case PredicateCondition::Between:
+      return {{index.lower_bound(_right_values), index.upper_bound(_right_values2)}};
     default:
       Fail("Unsupported comparison type encountered");
   }
+}
+
+PosList IndexScan::_scan_primary_key_index() const {
+  const auto index = _in_table->primary_key_index();
+  Assert(index && index->column_ids() == _left_column_ids, "PrimaryKeyIndex not found for column (vector).");
 
-  matches_out.reserve(matches_out.size() + std::distance(range_begin, range_end));
-  std::transform(range_begin, range_end, std::back_inserter(matches_out), to_row_id);
+  auto matches_out = index->lookup(_right_values);
+
+  if (!_included_chunk_ids.empty()) {
+    const auto included_chunk_ids = std::unordered_set<ChunkID>{_included_chunk_ids.begin(), _included_chunk_ids.end()};
+    matches_out.erase(std::remove_if(matches_out.begin(), matches_out.end(),
+                                     [&](const auto& row_id) { return !included_chunk_ids.count(row_id.chunk_id); }),
+                      matches_out.end());
+  }
+
+  if (!_excluded_chunk_ids.empty()) {
+    const auto excluded_chunk_ids = std::unordered_set<ChunkID>{_excluded_chunk_ids.begin(), _excluded_chunk_ids.end()};
+    matches_out.erase(std::remove_if(matches_out.begin(), matches_out.end(),
+                                     [&](const auto& row_id) { return excluded_chunk_ids.count(row_id.chunk_id); }),
+                      matches_out.end());
+  }
 
   return matches_out;
 }
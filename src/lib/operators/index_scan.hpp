@@ -1,10 +1,13 @@
 #pragma once
 
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "abstract_read_only_operator.hpp"
 
 #include "all_type_variant.hpp"
+#include "storage/index/base_index.hpp"
 #include "storage/index/column_index_type.hpp"
 #include "types.hpp"
 
@@ -17,6 +20,17 @@ class AbstractTask;
  * Operator that performs a predicate search using indices
  *
  * Note: Scans only the set of chunks passed to the constructor
+ *
+ * With ColumnIndexType::PrimaryKey, the table's PrimaryKeyIndex is used instead of the chunks' indexes. It covers all
+ * chunks, so a single lookup suffices. Only PredicateCondition::Equals is supported for it.
+ *
+ * By default, the output references all columns of the input. An index-only scan (see set_index_only()) instead outputs
+ * a single data column with the values of the indexed column, which it takes from the indexes. Thus, it does not access
+ * the (encoded) input columns at all. This is used if all operators consuming the scan only need the indexed column,
+ * e.g., for SELECT COUNT(*), MIN(a) FROM t WHERE a > 5 (see IndexScanRule).
+ *
+ * Chunks that have no index on the column(s) (e.g., because it was dropped when the chunk was encoded) are scanned with
+ * TableScans instead.
  */
 class IndexScan : public AbstractReadOnlyOperator {
   friend class LQPTranslatorTest;
@@ -35,6 +49,23 @@ class IndexScan : public AbstractReadOnlyOperator {
    */
   void set_included_chunk_ids(const std::vector<ChunkID>& chunk_ids);
 
+  /**
+   * @brief Matches in the specified chunks are dropped from the output of a ColumnIndexType::PrimaryKey scan.
+   *
+   * The PrimaryKeyIndex only exists for the stored table, not for the pruned copy that GetTable outputs for a
+   * StoredTableNode with excluded chunks. Thus, the scan operates on the whole table and filters the pruned chunks
+   * itself.
+   */
+  void set_excluded_chunk_ids(const std::vector<ChunkID>& chunk_ids);
+
+  /**
+   * @brief If set, the values of the indexed column are taken from the indexes and output instead of references.
+   *
+   * The values are sorted within each output chunk. All scanned indexes need to support index-only scans.
+   */
+  void set_index_only(const bool index_only);
+  bool is_index_only() const;
+
  protected:
   std::shared_ptr<const Table> _on_execute() final;
 
@@ -44,8 +75,22 @@ class IndexScan : public AbstractReadOnlyOperator {
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
 
   void _validate_input();
-  std::shared_ptr<AbstractTask> _create_job_and_schedule(const ChunkID chunk_id, std::mutex& output_mutex);
-  PosList _scan_chunk(const ChunkID chunk_id);
+  std::shared_ptr<AbstractTask> _create_job_and_schedule(const ChunkID chunk_id,
+                                                         const std::shared_ptr<const BaseIndex>& index,
+                                                         std::mutex& output_mutex);
+  PosList _scan_chunk(const ChunkID chunk_id, const BaseIndex& index);
+  // Returns one column with the values of each matching range
+  std::vector<std::shared_ptr<BaseColumn>> _scan_chunk_index_only(const BaseIndex& index);
+  // Scans the chunks that lack the index with TableScans, returns their output
+  std::shared_ptr<const Table> _scan_chunks_without_index(const std::vector<ChunkID>& chunk_ids) const;
+  // Materializes the values of a column scanned without index for index-only scans
+  std::shared_ptr<BaseColumn> _materialize_sorted_values(const BaseColumn& column) const;
+  // nullptr if the chunk has neither the index nor a DeltaIndex for it
+  std::shared_ptr<const BaseIndex> _get_index(const ChunkID chunk_id) const;
+
+  // Returns the ranges of index entries that match the predicate. NotEquals is the only condition with two ranges.
+  std::vector<std::pair<BaseIndex::Iterator, BaseIndex::Iterator>> _get_matching_ranges(const BaseIndex& index) const;
+  PosList _scan_primary_key_index() const;
 
  private:
   const ColumnIndexType _index_type;
@@ -55,6 +100,8 @@ class IndexScan : public AbstractReadOnlyOperator {
   const std::vector<AllTypeVariant> _right_values2;
 
   std::vector<ChunkID> _included_chunk_ids;
+  std::vector<ChunkID> _excluded_chunk_ids;
+  bool _index_only{false};
 
   std::shared_ptr<const Table> _in_table;
   std::shared_ptr<Table> _out_table;
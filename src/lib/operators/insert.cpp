@@ -7,7 +7,9 @@
 
 #include "concurrency/transaction_context.hpp"
 #include "resolve_type.hpp"
+#include "statistics/table_statistics.hpp"
 #include "storage/base_encoded_column.hpp"
+#include "storage/index/primary_key/primary_key_index.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/value_column.hpp"
 #include "type_cast.hpp"
@@ -160,6 +162,7 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
   // TODO(all): make compress chunk thread-safe; if it gets called here by another thread, things will likely break.
 
   // Then, actually insert the data.
+  const auto primary_key_index = _target_table->primary_key_index();
   auto input_offset = 0u;
   auto source_chunk_id = ChunkID{0};
   auto source_chunk_start_index = 0u;
@@ -195,6 +198,12 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
       }
     }
 
+    // The inserted rows are not visible to other transactions before the commit, so they can be indexed right away
+    if (primary_key_index) {
+      primary_key_index->insert(*target_chunk, target_chunk_id, start_index, start_index + current_num_rows_to_insert);
+    }
+    target_chunk->update_delta_indexes(start_index, start_index + current_num_rows_to_insert);
+
     for (auto i = start_index; i < start_index + current_num_rows_to_insert; i++) {
       // we do not need to check whether other operators have locked the rows, we have just created them
       // and they are not visible for other operators.
@@ -222,6 +231,15 @@ void Insert::_on_commit_records(const CommitID cid) {
   }
 }
 
+void Insert::_finish_commit() {
+  const auto table_statistics = _target_table->table_statistics();
+  if (table_statistics) {
+    _target_table->set_table_statistics(std::make_shared<TableStatistics>(
+        table_statistics->table_type(), table_statistics->row_count() + _inserted_rows.size(),
+        table_statistics->column_statistics()));
+  }
+}
+
 void Insert::_on_rollback_records() {
   for (auto row_id : _inserted_rows) {
     auto chunk = _target_table->get_chunk(row_id.chunk_id);
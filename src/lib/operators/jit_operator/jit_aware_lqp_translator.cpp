@@ -9,10 +9,12 @@
 #include "constant_mappings.hpp"
 #include "expression/abstract_predicate_expression.hpp"
 #include "expression/arithmetic_expression.hpp"
+#include "expression/binary_predicate_expression.hpp"
 #include "expression/logical_expression.hpp"
 #include "expression/lqp_column_expression.hpp"
 #include "expression/value_expression.hpp"
 #include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/join_node.hpp"
 #include "logical_query_plan/lqp_utils.hpp"
 #include "logical_query_plan/predicate_node.hpp"
 #include "logical_query_plan/projection_node.hpp"
@@ -20,9 +22,12 @@
 #include "operators/jit_aggregate.hpp"
 #include "operators/jit_compute.hpp"
 #include "operators/jit_filter.hpp"
+#include "operators/jit_hash_join_probe.hpp"
 #include "operators/jit_read_tuples.hpp"
 #include "operators/jit_write_tuples.hpp"
+#include "operators/operator_join_predicate.hpp"
 #include "operators/operator_scan_predicate.hpp"
+#include "storage/base_dictionary_column.hpp"
 #include "storage/storage_manager.hpp"
 #include "types.hpp"
 
@@ -59,7 +64,7 @@ const std::unordered_map<LogicalOperator, JitExpressionType> logical_operator_to
 
 namespace opossum {
 
-JitAwareLQPTranslator::JitAwareLQPTranslator() {
+JitAwareLQPTranslator::JitAwareLQPTranslator(const JitExecutionMode execution_mode) : _execution_mode{execution_mode} {
 #if !HYRISE_JIT_SUPPORT
   Fail("Query translation with JIT operators requested, but jitting is not available");
 #else
@@ -79,10 +84,20 @@ std::shared_ptr<JitOperatorWrapper> JitAwareLQPTranslator::_try_translate_sub_pl
 
   auto input_nodes = std::unordered_set<std::shared_ptr<AbstractLQPNode>>{};
 
+  // At most one join is integrated into the operator chain. Its right input is the build side, which is translated
+  // separately.
+  std::shared_ptr<JoinNode> join_node;
+
   // Traverse query tree until a non-jittable nodes is found in each branch
   _visit(node, [&](auto& current_node) {
+    if (join_node && current_node == join_node->right_input()) return false;
+
     const auto is_root_node = current_node == node;
-    if (_node_is_jittable(current_node, is_root_node)) {
+    if (!join_node && _join_node_is_jittable(current_node)) {
+      join_node = std::static_pointer_cast<JoinNode>(current_node);
+      ++jittable_node_count;
+      return true;
+    } else if (_node_is_jittable(current_node, is_root_node)) {
       ++jittable_node_count;
       return true;
     } else {
@@ -94,38 +109,79 @@ std::shared_ptr<JitOperatorWrapper> JitAwareLQPTranslator::_try_translate_sub_pl
   // We use a really simple heuristic to decide when to introduce jittable operators:
   //   - If there is more than one input node, don't JIT
   //   - Always JIT AggregateNodes, as the JitAggregate is significantly faster than the Aggregate operator
+  //   - Don't JIT a single join, since the JitWriteTuples would materialize the join result
   //   - Otherwise, JIT if there are two or more jittable nodes
   if (input_nodes.size() != 1 || jittable_node_count < 1) return nullptr;
-  if (jittable_node_count == 1 && node->type == LQPNodeType::Projection) return nullptr;
+  if (jittable_node_count == 1 && (node->type == LQPNodeType::Projection || node->type == LQPNodeType::Join)) {
+    return nullptr;
+  }
 
   // The input_node is not being integrated into the operator chain, but instead serves as the input to the JitOperators
   const auto input_node = *input_nodes.begin();
+  const auto build_input_node = join_node ? join_node->right_input() : nullptr;
 
-  const auto jit_operator = std::make_shared<JitOperatorWrapper>(translate_node(input_node));
+  const auto jit_operator =
+      std::make_shared<JitOperatorWrapper>(translate_node(input_node),
+                                           build_input_node ? translate_node(build_input_node) : nullptr,
+                                           _execution_mode);
   const auto read_tuples = std::make_shared<JitReadTuples>();
   jit_operator->add_jit_operator(read_tuples);
 
-  // "filter_node". The root node of the subplan computed by a JitFilter.
-  auto filter_node = node;
-  while (filter_node != input_node && filter_node->type != LQPNodeType::Predicate &&
-         filter_node->type != LQPNodeType::Union) {
-    filter_node = filter_node->left_input();
-  }
+  const auto join_probe = join_node ? std::make_shared<JitHashJoinProbe>() : nullptr;
+
+  // Adds a JitCompute and a JitFilter operator for the UnionNodes and PredicateNodes between from_node and until_node
+  const auto add_filter_operators = [&](const std::shared_ptr<AbstractLQPNode>& from_node,
+                                        const std::shared_ptr<AbstractLQPNode>& until_node) {
+    // "filter_node". The root node of the subplan computed by a JitFilter.
+    auto filter_node = from_node;
+    while (filter_node != until_node && filter_node->type != LQPNodeType::Predicate &&
+           filter_node->type != LQPNodeType::Union) {
+      filter_node = filter_node->left_input();
+    }
+
+    // If we can reach the until_node without encountering a UnionNode or PredicateNode,
+    // there is no need to filter any tuples
+    if (filter_node == until_node) return true;
 
-  // If we can reach the input node without encountering a UnionNode or PredicateNode,
-  // there is no need to filter any tuples
-  if (filter_node != input_node) {
     const auto boolean_expression = lqp_subplan_to_boolean_expression(filter_node);
-    if (!boolean_expression) return nullptr;
+    if (!boolean_expression) return false;
 
-    const auto jit_boolean_expression =
-        _try_translate_expression_to_jit_expression(*boolean_expression, *read_tuples, input_node);
-    if (!jit_boolean_expression) return nullptr;
+    const auto jit_boolean_expression = _try_translate_expression_to_jit_expression(
+        *boolean_expression, *read_tuples, input_node, build_input_node, join_probe);
+    if (!jit_boolean_expression) return false;
 
     // make sure that the expression gets computed ...
     jit_operator->add_jit_operator(std::make_shared<JitCompute>(jit_boolean_expression));
     // and then filter on the resulting boolean.
     jit_operator->add_jit_operator(std::make_shared<JitFilter>(jit_boolean_expression->result()));
+    return true;
+  };
+
+  if (join_node) {
+    // Tuples of the probe side are filtered before they are joined, and the join result after the join. The subplan of
+    // a boolean expression ends at the join (see lqp_subplan_to_boolean_expression), so the filters do not overlap.
+    if (!add_filter_operators(join_node->left_input(), input_node)) return nullptr;
+
+    const auto join_predicate = OperatorJoinPredicate::from_expression(
+        *join_node->join_predicate, *join_node->left_input(), *join_node->right_input());
+    DebugAssert(join_predicate, "Join predicate should have been checked by _join_node_is_jittable.");
+    const auto& probe_key_expression = *join_node->left_input()->column_expressions()[join_predicate->column_ids.first];
+    const auto& build_key_expression =
+        *join_node->right_input()->column_expressions()[join_predicate->column_ids.second];
+
+    const auto jit_probe_key = _try_translate_expression_to_jit_expression(probe_key_expression, *read_tuples,
+                                                                           input_node);
+    if (!jit_probe_key) return nullptr;
+    if (jit_probe_key->expression_type() != JitExpressionType::Column) {
+      jit_operator->add_jit_operator(std::make_shared<JitCompute>(jit_probe_key));
+    }
+    join_probe->add_key_column(jit_probe_key->result(), join_predicate->column_ids.second,
+                               build_key_expression.is_nullable());
+    jit_operator->add_jit_operator(join_probe);
+
+    if (!add_filter_operators(node, join_node)) return nullptr;
+  } else {
+    if (!add_filter_operators(node, input_node)) return nullptr;
   }
 
   if (node->type == LQPNodeType::Aggregate) {
@@ -137,8 +193,8 @@ std::shared_ptr<JitOperatorWrapper> JitAwareLQPTranslator::_try_translate_sub_pl
     auto aggregate = std::make_shared<JitAggregate>();
 
     for (const auto& groupby_expression : aggregate_node->group_by_expressions) {
-      const auto jit_expression =
-          _try_translate_expression_to_jit_expression(*groupby_expression, *read_tuples, input_node);
+      const auto jit_expression = _try_translate_expression_to_jit_expression(
+          *groupby_expression, *read_tuples, input_node, build_input_node, join_probe);
       if (!jit_expression) return nullptr;
       // Create a JitCompute operator for each computed groupby column ...
       if (jit_expression->expression_type() != JitExpressionType::Column) {
@@ -152,8 +208,8 @@ std::shared_ptr<JitOperatorWrapper> JitAwareLQPTranslator::_try_translate_sub_pl
       const auto aggregate_expression = std::dynamic_pointer_cast<AggregateExpression>(expression);
       DebugAssert(aggregate_expression, "Expression is not a function.");
 
-      const auto jit_expression =
-          _try_translate_expression_to_jit_expression(*aggregate_expression->arguments[0], *read_tuples, input_node);
+      const auto jit_expression = _try_translate_expression_to_jit_expression(
+          *aggregate_expression->arguments[0], *read_tuples, input_node, build_input_node, join_probe);
       if (!jit_expression) return nullptr;
       // Create a JitCompute operator for each aggregate expression on a computed value ...
       if (jit_expression->expression_type() != JitExpressionType::Column) {
@@ -169,8 +225,8 @@ std::shared_ptr<JitOperatorWrapper> JitAwareLQPTranslator::_try_translate_sub_pl
     // Add a compute operator for each computed output column (i.e., a column that is not from a stored table).
     auto write_table = std::make_shared<JitWriteTuples>();
     for (const auto& column_expression : node->column_expressions()) {
-      const auto jit_expression =
-          _try_translate_expression_to_jit_expression(*column_expression, *read_tuples, input_node);
+      const auto jit_expression = _try_translate_expression_to_jit_expression(
+          *column_expression, *read_tuples, input_node, build_input_node, join_probe);
       if (!jit_expression) return nullptr;
       // If the JitExpression is of type JitExpressionType::Column, there is no need to add a compute node, since it
       // would not compute anything anyway
@@ -183,12 +239,20 @@ std::shared_ptr<JitOperatorWrapper> JitAwareLQPTranslator::_try_translate_sub_pl
     jit_operator->add_jit_operator(write_table);
   }
 
+  // The build operators can only be created once all build columns used by the operators above are known
+  if (join_probe) {
+    for (const auto& build_operator : join_probe->create_build_operators()) {
+      jit_operator->add_build_jit_operator(build_operator);
+    }
+  }
+
   return jit_operator;
 }
 
 std::shared_ptr<const JitExpression> JitAwareLQPTranslator::_try_translate_expression_to_jit_expression(
-    const AbstractExpression& expression, JitReadTuples& jit_source,
-    const std::shared_ptr<AbstractLQPNode>& input_node) const {
+    const AbstractExpression& expression, JitReadTuples& jit_source, const std::shared_ptr<AbstractLQPNode>& input_node,
+    const std::shared_ptr<AbstractLQPNode>& build_input_node,
+    const std::shared_ptr<JitHashJoinProbe>& join_probe) const {
   const auto input_node_column_id = input_node->find_column_id(expression);
   if (input_node_column_id) {
     const auto tuple_value =
@@ -196,6 +260,16 @@ std::shared_ptr<const JitExpression> JitAwareLQPTranslator::_try_translate_expre
     return std::make_shared<JitExpression>(tuple_value);
   }
 
+  // Columns of the build side of a join are provided by the JitHashJoinProbe
+  if (join_probe) {
+    const auto build_input_node_column_id = build_input_node->find_column_id(expression);
+    if (build_input_node_column_id) {
+      const auto tuple_value = join_probe->add_build_column(expression.data_type(), expression.is_nullable(),
+                                                            *build_input_node_column_id, jit_source);
+      return std::make_shared<JitExpression>(tuple_value);
+    }
+  }
+
   std::shared_ptr<const JitExpression> left, right;
   switch (expression.type) {
     case ExpressionType::Value: {
@@ -209,11 +283,17 @@ std::shared_ptr<const JitExpression> JitAwareLQPTranslator::_try_translate_expre
       Fail("Column doesn't exist in input_node");
 
     case ExpressionType::Predicate:
+      if (const auto input_comparison =
+              _try_translate_predicate_to_input_comparison(expression, jit_source, input_node)) {
+        return input_comparison;
+      }
+      [[fallthrough]];
     case ExpressionType::Arithmetic:
     case ExpressionType::Logical: {
       std::vector<std::shared_ptr<const JitExpression>> jit_expression_arguments;
       for (const auto& argument : expression.arguments) {
-        const auto jit_expression = _try_translate_expression_to_jit_expression(*argument, jit_source, input_node);
+        const auto jit_expression = _try_translate_expression_to_jit_expression(*argument, jit_source, input_node,
+                                                                                build_input_node, join_probe);
         if (!jit_expression) return nullptr;
         jit_expression_arguments.emplace_back(jit_expression);
       }
@@ -236,6 +316,58 @@ std::shared_ptr<const JitExpression> JitAwareLQPTranslator::_try_translate_expre
   }
 }
 
+std::shared_ptr<const JitExpression> JitAwareLQPTranslator::_try_translate_predicate_to_input_comparison(
+    const AbstractExpression& expression, JitReadTuples& jit_source,
+    const std::shared_ptr<AbstractLQPNode>& input_node) const {
+  // ValueIDs only exist for the columns of stored tables. With MVCC, the input is a ValidateNode on the stored table.
+  // Its output references a single chunk of the stored table for each of its chunks, so JitReadTuples can still read
+  // the ValueIDs (see JitReadTuples::before_chunk).
+  auto stored_table_input_node = input_node;
+  if (stored_table_input_node->type == LQPNodeType::Validate) stored_table_input_node = input_node->left_input();
+  if (stored_table_input_node->type != LQPNodeType::StoredTable) return nullptr;
+
+  const auto* predicate_expression = dynamic_cast<const BinaryPredicateExpression*>(&expression);
+  if (!predicate_expression) return nullptr;
+
+  auto predicate_condition = predicate_expression->predicate_condition;
+  if (predicate_condition != PredicateCondition::Equals && predicate_condition != PredicateCondition::NotEquals &&
+      predicate_condition != PredicateCondition::LessThan &&
+      predicate_condition != PredicateCondition::LessThanEquals &&
+      predicate_condition != PredicateCondition::GreaterThan &&
+      predicate_condition != PredicateCondition::GreaterThanEquals) {
+    return nullptr;
+  }
+
+  // The column can be on either side of the comparison
+  auto column_expression = predicate_expression->left_operand();
+  auto value_expression = std::dynamic_pointer_cast<const ValueExpression>(predicate_expression->right_operand());
+  if (!value_expression) {
+    column_expression = predicate_expression->right_operand();
+    value_expression = std::dynamic_pointer_cast<const ValueExpression>(predicate_expression->left_operand());
+    predicate_condition = flip_predicate_condition(predicate_condition);
+  }
+  if (!value_expression || variant_is_null(value_expression->value)) return nullptr;
+
+  // Literals of other data types would have to be converted to the column's data type, which might change the result
+  const auto column_id = input_node->find_column_id(*column_expression);
+  if (!column_id || column_expression->data_type() != value_expression->data_type()) return nullptr;
+
+  // Without a dictionary-encoded chunk, the comparison is not evaluated on ValueIDs anyway
+  const auto stored_table_node = std::static_pointer_cast<const StoredTableNode>(stored_table_input_node);
+  const auto table = StorageManager::get().get_table(stored_table_node->table_name);
+  auto has_dictionary_column = false;
+  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count() && !has_dictionary_column; ++chunk_id) {
+    has_dictionary_column = static_cast<bool>(
+        std::dynamic_pointer_cast<const BaseDictionaryColumn>(table->get_chunk(chunk_id)->get_column(*column_id)));
+  }
+  if (!has_dictionary_column) return nullptr;
+
+  const auto tuple_value =
+      jit_source.add_input_comparison(column_expression->data_type(), column_expression->is_nullable(), *column_id,
+                                      predicate_condition, value_expression->value);
+  return std::make_shared<JitExpression>(tuple_value);
+}
+
 bool JitAwareLQPTranslator::_node_is_jittable(const std::shared_ptr<AbstractLQPNode>& node,
                                               const bool allow_aggregate_node) const {
   if (node->type == LQPNodeType::Aggregate) {
@@ -270,6 +402,23 @@ bool JitAwareLQPTranslator::_node_is_jittable(const std::shared_ptr<AbstractLQPN
   return node->type == LQPNodeType::Projection || node->type == LQPNodeType::Union;
 }
 
+bool JitAwareLQPTranslator::_join_node_is_jittable(const std::shared_ptr<AbstractLQPNode>& node) const {
+  if (node->type != LQPNodeType::Join) return false;
+
+  // The JitHashJoinProbe only supports inner equi-joins
+  const auto join_node = std::static_pointer_cast<JoinNode>(node);
+  if (join_node->join_mode != JoinMode::Inner) return false;
+
+  const auto join_predicate =
+      OperatorJoinPredicate::from_expression(*join_node->join_predicate, *node->left_input(), *node->right_input());
+  if (!join_predicate || join_predicate->predicate_condition != PredicateCondition::Equals) return false;
+
+  // Equal values of different data types do not produce equal hashes
+  const auto& left_expression = *node->left_input()->column_expressions()[join_predicate->column_ids.first];
+  const auto& right_expression = *node->right_input()->column_expressions()[join_predicate->column_ids.second];
+  return left_expression.data_type() == right_expression.data_type();
+}
+
 void JitAwareLQPTranslator::_visit(const std::shared_ptr<AbstractLQPNode>& node,
                                    const std::function<bool(const std::shared_ptr<AbstractLQPNode>&)>& func) const {
   std::unordered_set<std::shared_ptr<const AbstractLQPNode>> visited;
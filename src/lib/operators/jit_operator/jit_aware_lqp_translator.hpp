@@ -3,6 +3,7 @@
 #include "../jit_operator_wrapper.hpp"
 #include "logical_query_plan/lqp_translator.hpp"
 #include "operators/jit_expression.hpp"
+#include "operators/jit_hash_join_probe.hpp"
 
 namespace opossum {
 
@@ -33,29 +34,56 @@ namespace opossum {
  *    can in turn reference a LQPExpression in a ProjectionNode) is encountered, it is converted to an JitExpression
  *    by a helper method first. We then add a JitCompute operator to our chain and use its result value instead of the
  *    original non-primitive value.
+ *    An inner equi-join in the subplan becomes a JitHashJoinProbe operator. The BFS does not descend into the right
+ *    input of the join (the build side), which is translated separately and becomes the right input of the
+ *    JitOperatorWrapper. Predicates between the input node and the join are evaluated before the probe, all other
+ *    predicates after it. The build operators read all columns of the build side that are used above the join.
+ *    Comparisons of a dictionary-encoded column of a stored table with a literal are not translated to a JitExpression
+ *    that compares the two values, but registered with the JitReadTuples operator as an input comparison. This way, the
+ *    comparison is evaluated on the ValueIDs of all dictionary-encoded chunks.
+ *
+ * By default, the created JitOperatorWrappers use the adaptive execution mode, so that the decision whether compiling
+ * the operator chain pays off is made at runtime rather than here.
  */
 class JitAwareLQPTranslator final : public LQPTranslator {
  public:
-  JitAwareLQPTranslator();
+  explicit JitAwareLQPTranslator(const JitExecutionMode execution_mode = JitExecutionMode::Adaptive);
   std::shared_ptr<AbstractOperator> translate_node(const std::shared_ptr<AbstractLQPNode>& node) const final;
 
  private:
   std::shared_ptr<JitOperatorWrapper> _try_translate_sub_plan_to_jit_operators(
       const std::shared_ptr<AbstractLQPNode>& node) const;
 
+  // Columns are read from the input_node or, if the operator chain contains a join, taken from the matching tuple of
+  // the build_input_node by the join_probe.
   std::shared_ptr<const JitExpression> _try_translate_expression_to_jit_expression(
       const AbstractExpression& expression, JitReadTuples& jit_source,
-      const std::shared_ptr<AbstractLQPNode>& input_node) const;
+      const std::shared_ptr<AbstractLQPNode>& input_node,
+      const std::shared_ptr<AbstractLQPNode>& build_input_node = nullptr,
+      const std::shared_ptr<JitHashJoinProbe>& join_probe = nullptr) const;
 
   // Returns whether an LQP node with its current configuration can be part of an operator pipeline.
   bool _node_is_jittable(const std::shared_ptr<AbstractLQPNode>& node, const bool allow_aggregate_node) const;
 
+  // Returns a JitExpression for the result of an input comparison (see JitReadTuples::add_input_comparison) if the
+  // expression compares a dictionary-encoded column of a stored table with a literal of the same data type. The stored
+  // table can be the input_node itself or the input of a ValidateNode. Otherwise, nullptr is returned.
+  std::shared_ptr<const JitExpression> _try_translate_predicate_to_input_comparison(
+      const AbstractExpression& expression, JitReadTuples& jit_source,
+      const std::shared_ptr<AbstractLQPNode>& input_node) const;
+
+  // Returns whether an LQP node is a join that can be executed by a JitHashJoinProbe, i.e., an inner equi-join on
+  // columns of the same data type.
+  bool _join_node_is_jittable(const std::shared_ptr<AbstractLQPNode>& node) const;
+
   // Traverses the LQP in a breadth-first fashion and passes all visited nodes to a lambda. The boolean returned
   // from the lambda determines whether the current node should be explored further.
   void _visit(const std::shared_ptr<AbstractLQPNode>& node,
               const std::function<bool(const std::shared_ptr<AbstractLQPNode>&)>& func) const;
 
   static JitExpressionType _expression_to_jit_expression_type(const AbstractExpression& expression);
+
+  const JitExecutionMode _execution_mode;
 };
 
 }  // namespace opossum
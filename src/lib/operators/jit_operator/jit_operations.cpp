@@ -21,6 +21,16 @@ namespace opossum {
   case JIT_GET_ENUM_VALUE(0, types): \
     return to.set<JIT_GET_DATA_TYPE(0, types)>(from.get<JIT_GET_DATA_TYPE(0, types)>(context), to_index, context);
 
+#define JIT_JOIN_EQUALS_CASE(r, types)                      \
+  case JIT_GET_ENUM_VALUE(0, types):                        \
+    return lhs.get<JIT_GET_DATA_TYPE(0, types)>(context) == \
+           context.join_hashmap->columns[rhs.column_index()].get<JIT_GET_DATA_TYPE(0, types)>(rhs_index);
+
+#define JIT_JOIN_ASSIGN_CASE(r, types)          \
+  case JIT_GET_ENUM_VALUE(0, types):            \
+    return to.set<JIT_GET_DATA_TYPE(0, types)>( \
+        context.join_hashmap->columns[from.column_index()].get<JIT_GET_DATA_TYPE(0, types)>(from_index), context);
+
 #define JIT_GROW_BY_ONE_CASE(r, types) \
   case JIT_GET_ENUM_VALUE(0, types):   \
     return context.hashmap.columns[value.column_index()].grow_by_one<JIT_GET_DATA_TYPE(0, types)>(initial_value);
@@ -132,6 +142,38 @@ void jit_assign(const JitTupleValue& from, const JitHashmapValue& to, const size
   }
 }
 
+bool jit_join_equals(const JitTupleValue& lhs, const JitHashmapValue& rhs, const size_t rhs_index,
+                     JitRuntimeContext& context) {
+  DebugAssert(lhs.data_type() == rhs.data_type(), "Data types don't match in jit_join_equals.");
+
+  switch (lhs.data_type()) {
+    BOOST_PP_SEQ_FOR_EACH_PRODUCT(JIT_JOIN_EQUALS_CASE, (JIT_DATA_TYPE_INFO))
+    default:
+      Fail("unreachable");
+  }
+}
+
+void jit_join_assign(const JitHashmapValue& from, const size_t from_index, const JitTupleValue& to,
+                     JitRuntimeContext& context) {
+  DebugAssert(from.data_type() == to.data_type(), "Data types don't match in jit_join_assign.");
+
+  if (to.is_nullable()) {
+    // Values in non-nullable hashmap columns are never NULL, regardless of their is_null flag
+    const bool is_null = from.is_nullable() && context.join_hashmap->columns[from.column_index()].is_null(from_index);
+    to.set_is_null(is_null, context);
+    // The value is NULL - our work is done here.
+    if (is_null) {
+      return;
+    }
+  }
+
+  switch (from.data_type()) {
+    BOOST_PP_SEQ_FOR_EACH_PRODUCT(JIT_JOIN_ASSIGN_CASE, (JIT_DATA_TYPE_INFO))
+    default:
+      break;
+  }
+}
+
 size_t jit_grow_by_one(const JitHashmapValue& value, const JitVariantVector::InitialValue initial_value,
                        JitRuntimeContext& context) {
   switch (value.data_type()) {
@@ -147,6 +189,8 @@ size_t jit_grow_by_one(const JitHashmapValue& value, const JitVariantVector::Ini
 #undef JIT_HASH_CASE
 #undef JIT_AGGREGATE_EQUALS_CASE
 #undef JIT_ASSIGN_CASE
+#undef JIT_JOIN_EQUALS_CASE
+#undef JIT_JOIN_ASSIGN_CASE
 #undef JIT_GROW_BY_ONE_CASE
 
 }  // namespace opossum
@@ -195,6 +195,15 @@ __attribute__((noinline)) bool jit_aggregate_equals(const JitTupleValue& lhs, co
 __attribute__((noinline)) void jit_assign(const JitTupleValue& from, const JitHashmapValue& to, const size_t to_index,
                                           JitRuntimeContext& context);
 
+// Compares a JitTupleValue to a value in the hash table of a hash join (i.e., JitRuntimeContext::join_hashmap). NULL
+// values have to be filtered out before, since they never match in a join.
+__attribute__((noinline)) bool jit_join_equals(const JitTupleValue& lhs, const JitHashmapValue& rhs,
+                                               const size_t rhs_index, JitRuntimeContext& context);
+
+// Copies a value from the hash table of a hash join to a JitTupleValue. Both values MUST be of the same data type.
+__attribute__((noinline)) void jit_join_assign(const JitHashmapValue& from, const size_t from_index,
+                                               const JitTupleValue& to, JitRuntimeContext& context);
+
 // Adds an element to a column represented by some JitHashmapValue
 __attribute__((noinline)) size_t jit_grow_by_one(const JitHashmapValue& value,
                                                  const JitVariantVector::InitialValue initial_value,
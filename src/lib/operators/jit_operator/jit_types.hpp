@@ -101,7 +101,7 @@ class JitVariantVector {
 class BaseJitColumnReader;
 class BaseJitColumnWriter;
 
-// The JitAggregate operator (and possibly future hashing based operators) require an efficient way to hash tuples
+// The JitAggregate operator and the hash join operators require an efficient way to hash tuples
 // across multiple columns (i.e., the key-type of the hashmap spans multiple columns).
 // Since the number / data types of the columns are not known at compile time, we use a regular
 // hashmap in combination with some JitVariantVectors to build the foundation for more flexible hashing.
@@ -121,6 +121,10 @@ struct JitRuntimeContext {
   std::vector<std::shared_ptr<BaseJitColumnReader>> inputs;
   std::vector<std::shared_ptr<BaseJitColumnWriter>> outputs;
   JitRuntimeHashmap hashmap;
+  // The hash table probed by a JitHashJoinProbe. It is built by the JitHashJoinBuild operator in the hashmap of a
+  // separate context before the probe side is processed. It is only read afterwards and thus shared by the contexts of
+  // all morsels (see JitOperatorWrapper).
+  std::shared_ptr<JitRuntimeHashmap> join_hashmap;
   ChunkColumns out_chunk;
 };
 
@@ -33,6 +33,13 @@ class AbstractJittableSink : public AbstractJittable {
   // This function is called by the JitOperatorWrapper after each Chunk that has been pushed through the pipeline.
   // It is used to create a new chunk in the output table for each input chunk.
   virtual void after_chunk(Table& out_table, JitRuntimeContext& context) const {}
+
+  // This function is called by the JitOperatorWrapper if the chunks have been processed in several morsels, each with
+  // its own runtime context and output table (see JitOperatorWrapper). It merges the output of a later morsel into the
+  // output of the first morsel. The morsels are merged in the order of their chunks before after_query() is called
+  // with the context of the first morsel.
+  virtual void merge_morsel(Table& out_table, JitRuntimeContext& context, const Table& morsel_table,
+                            JitRuntimeContext& morsel_context) const = 0;
 };
 
 }  // namespace opossum
@@ -1,5 +1,7 @@
 #include "jit_aggregate.hpp"
 
+#include <algorithm>
+
 #include "constant_mappings.hpp"
 #include "operators/jit_operator/jit_operations.hpp"
 #include "resolve_type.hpp"
@@ -167,6 +169,122 @@ void JitAggregate::after_query(Table& out_table, JitRuntimeContext& context) con
   out_table.append_chunk(chunk_columns);
 }
 
+void JitAggregate::merge_morsel(Table& out_table, JitRuntimeContext& context, const Table& morsel_table,
+                                JitRuntimeContext& morsel_context) const {
+  // Merging happens outside of the specialized code, so there is no need for index-based loops here.
+
+  // Compares a groupby value of both hashmaps using NULL == NULL semantics (see jit_aggregate_equals)
+  const auto values_equal = [&](const JitHashmapValue& value, const size_t row_index, const size_t morsel_row_index) {
+    const auto is_null = value.is_null(row_index, context);
+    const auto morsel_is_null = value.is_null(morsel_row_index, morsel_context);
+    if (is_null || morsel_is_null) {
+      return is_null && morsel_is_null;
+    }
+
+    auto equal = false;
+    resolve_data_type(value.data_type(), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      equal = value.get<ColumnDataType>(row_index, context) ==
+              value.get<ColumnDataType>(morsel_row_index, morsel_context);
+    });
+    return equal;
+  };
+
+  // Appends a value of the morsel's hashmap to the hashmap and returns its row index
+  const auto append_value = [&](const JitHashmapValue& value, const size_t morsel_row_index) {
+    const auto row_index = jit_grow_by_one(value, JitVariantVector::InitialValue::Zero, context);
+    const auto is_null = value.is_null(morsel_row_index, morsel_context);
+    if (value.is_nullable()) {
+      value.set_is_null(is_null, row_index, context);
+    }
+    if (!is_null) {
+      resolve_data_type(value.data_type(), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        value.set<ColumnDataType>(value.get<ColumnDataType>(morsel_row_index, morsel_context), row_index, context);
+      });
+    }
+    return row_index;
+  };
+
+  // Combines an aggregate of the morsel's hashmap with the aggregate of the same group in the hashmap. As in
+  // jit_aggregate_compute, NULL values are ignored.
+  const auto merge_value = [&](const JitHashmapValue& value, const size_t row_index, const size_t morsel_row_index,
+                               const auto& merge_func) {
+    if (value.is_null(morsel_row_index, morsel_context)) {
+      return;
+    }
+
+    resolve_data_type(value.data_type(), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      const auto morsel_aggregate = value.get<ColumnDataType>(morsel_row_index, morsel_context);
+      if (value.is_null(row_index, context)) {
+        value.set_is_null(false, row_index, context);
+        value.set<ColumnDataType>(morsel_aggregate, row_index, context);
+      } else {
+        value.set<ColumnDataType>(merge_func(value.get<ColumnDataType>(row_index, context), morsel_aggregate),
+                                  row_index, context);
+      }
+    });
+  };
+
+  const auto add = [](const auto& lhs, const auto& rhs) { return lhs + rhs; };
+  const auto minimum = [](const auto& lhs, const auto& rhs) { return std::min(lhs, rhs); };
+  const auto maximum = [](const auto& lhs, const auto& rhs) { return std::max(lhs, rhs); };
+
+  // Both operators use the same hash function, so a group of the morsel can only match a group in the same bucket
+  for (const auto& [hash_value, morsel_bucket] : morsel_context.hashmap.indices) {
+    auto& hash_bucket = context.hashmap.indices[hash_value];
+
+    for (const auto morsel_row_index : morsel_bucket) {
+      const auto match = std::find_if(hash_bucket.cbegin(), hash_bucket.cend(), [&](const auto row_index) {
+        return std::all_of(_groupby_columns.cbegin(), _groupby_columns.cend(), [&](const auto& groupby_column) {
+          return values_equal(groupby_column.hashmap_value, row_index, morsel_row_index);
+        });
+      });
+
+      // The group only exists in the morsel, so all of its values are copied
+      if (match == hash_bucket.cend()) {
+        uint64_t row_index = 0;
+        for (const auto& groupby_column : _groupby_columns) {
+          row_index = append_value(groupby_column.hashmap_value, morsel_row_index);
+        }
+        for (const auto& aggregate_column : _aggregate_columns) {
+          row_index = append_value(aggregate_column.hashmap_value, morsel_row_index);
+          if (aggregate_column.hashmap_count_for_avg) {
+            append_value(*aggregate_column.hashmap_count_for_avg, morsel_row_index);
+          }
+        }
+        hash_bucket.emplace_back(row_index);
+        continue;
+      }
+
+      const auto row_index = *match;
+      for (const auto& aggregate_column : _aggregate_columns) {
+        switch (aggregate_column.function) {
+          case AggregateFunction::Count:
+          case AggregateFunction::Sum:
+            merge_value(aggregate_column.hashmap_value, row_index, morsel_row_index, add);
+            break;
+          case AggregateFunction::Max:
+            merge_value(aggregate_column.hashmap_value, row_index, morsel_row_index, maximum);
+            break;
+          case AggregateFunction::Min:
+            merge_value(aggregate_column.hashmap_value, row_index, morsel_row_index, minimum);
+            break;
+          case AggregateFunction::Avg:
+            // Both auxiliary aggregates (SUM and COUNT) are merged
+            DebugAssert(aggregate_column.hashmap_count_for_avg, "Invalid avg aggregate column.");
+            merge_value(aggregate_column.hashmap_value, row_index, morsel_row_index, add);
+            merge_value(*aggregate_column.hashmap_count_for_avg, row_index, morsel_row_index, add);
+            break;
+          case AggregateFunction::CountDistinct:
+            Fail("Not supported");
+        }
+      }
+    }
+  }
+}
+
 void JitAggregate::add_aggregate_column(const std::string& column_name, const JitTupleValue& value,
                                         const AggregateFunction function) {
   auto column_position = _aggregate_columns.size() + _groupby_columns.size();
@@ -70,6 +70,12 @@ class JitAggregate : public AbstractJittableSink {
   // This is used to perform the post-processing for average aggregates and to build the final output table.
   void after_query(Table& out_table, JitRuntimeContext& context) const final;
 
+  // Is called by the JitOperatorWrapper for each additional morsel if the tuples have been consumed in parallel.
+  // This is used to merge the groups of the morsel into the hashmap of the first morsel, combining the aggregates of
+  // groups that occur in both.
+  void merge_morsel(Table& out_table, JitRuntimeContext& context, const Table& morsel_table,
+                    JitRuntimeContext& morsel_context) const final;
+
   // Adds an aggregate to the operator that is to be computed on tuple groups.
   void add_aggregate_column(const std::string& column_name, const JitTupleValue& value,
                             const AggregateFunction function);
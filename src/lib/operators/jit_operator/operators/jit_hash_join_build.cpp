@@ -0,0 +1,76 @@
+#include "jit_hash_join_build.hpp"
+
+#include <algorithm>
+
+#include "operators/jit_operator/jit_operations.hpp"
+
+namespace opossum {
+
+std::string JitHashJoinBuild::description() const {
+  std::stringstream desc;
+  desc << "[HashJoinBuild] Keys: ";
+  for (const auto& key_column : _key_columns) {
+    desc << "h" << key_column.hashmap_value.column_index() << " = x" << key_column.tuple_value.tuple_index() << ", ";
+  }
+  desc << " Payload: ";
+  for (const auto& payload_column : _payload_columns) {
+    desc << "h" << payload_column.hashmap_value.column_index() << " = x" << payload_column.tuple_value.tuple_index()
+         << ", ";
+  }
+  return desc.str();
+}
+
+void JitHashJoinBuild::before_query(JitRuntimeContext& context) const {
+  // Resize the hashmap data structure.
+  context.hashmap.columns.resize(_num_hashmap_columns);
+}
+
+void JitHashJoinBuild::add_key_column(const JitTupleValue& tuple_value, const JitHashmapValue& hashmap_value) {
+  DebugAssert(tuple_value.data_type() == hashmap_value.data_type(), "Data types of key column don't match.");
+  _key_columns.push_back({tuple_value, hashmap_value});
+  _num_hashmap_columns = std::max(_num_hashmap_columns, static_cast<uint32_t>(hashmap_value.column_index() + 1));
+}
+
+void JitHashJoinBuild::add_payload_column(const JitTupleValue& tuple_value, const JitHashmapValue& hashmap_value) {
+  DebugAssert(tuple_value.data_type() == hashmap_value.data_type(), "Data types of payload column don't match.");
+  _payload_columns.push_back({tuple_value, hashmap_value});
+  _num_hashmap_columns = std::max(_num_hashmap_columns, static_cast<uint32_t>(hashmap_value.column_index() + 1));
+}
+
+const std::vector<JitHashJoinBuildColumn> JitHashJoinBuild::key_columns() const { return _key_columns; }
+
+const std::vector<JitHashJoinBuildColumn> JitHashJoinBuild::payload_columns() const { return _payload_columns; }
+
+void JitHashJoinBuild::_consume(JitRuntimeContext& context) const {
+  // We use index-based for loops in this function, since the LLVM optimizer is not able to properly unroll range-based
+  // loops, and we need the unrolling for proper specialization.
+
+  const auto num_key_columns = _key_columns.size();
+  const auto num_payload_columns = _payload_columns.size();
+
+  // Step 1: Skip tuples with NULL keys and compute the hash value across all key columns.
+  uint64_t hash_value = 0;
+  for (uint32_t i = 0; i < num_key_columns; ++i) {
+    if (_key_columns[i].tuple_value.is_null(context)) {
+      return;
+    }
+    hash_value = (hash_value << 5u) ^ jit_hash(_key_columns[i].tuple_value, context);
+  }
+
+  // Step 2: Append the key and payload values to the columns of the hash table. All columns grow by one, so they all
+  // return the same row index.
+  uint64_t row_index = 0;
+  for (uint32_t i = 0; i < num_key_columns; ++i) {
+    row_index = jit_grow_by_one(_key_columns[i].hashmap_value, JitVariantVector::InitialValue::Zero, context);
+    jit_assign(_key_columns[i].tuple_value, _key_columns[i].hashmap_value, row_index, context);
+  }
+  for (uint32_t i = 0; i < num_payload_columns; ++i) {
+    row_index = jit_grow_by_one(_payload_columns[i].hashmap_value, JitVariantVector::InitialValue::Zero, context);
+    jit_assign(_payload_columns[i].tuple_value, _payload_columns[i].hashmap_value, row_index, context);
+  }
+
+  // Step 3: Add the new row to the hashmap.
+  context.hashmap.indices[hash_value].emplace_back(row_index);
+}
+
+}  // namespace opossum
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "abstract_jittable.hpp"
+
+namespace opossum {
+
+// Represents a value that the operator stores in the hash table.
+// The tuple_value provides the value of the current tuple, the hashmap_value is the column of the hash table that
+// the value is copied to.
+struct JitHashJoinBuildColumn {
+  JitTupleValue tuple_value;
+  JitHashmapValue hashmap_value;
+};
+
+/* The JitHashJoinBuild operator is the last operator of the operator chain that processes the build side (i.e., the
+ * right input) of a hash join. Like the JitAggregate, it is a pipeline breaker: The probe side can only be processed
+ * once all build tuples have been consumed.
+ * The operator does not produce an output table. Instead, it inserts each incoming tuple into a hash table in the
+ * hashmap of the runtime context, which the JitOperatorWrapper then passes on to the JitHashJoinProbe operator:
+ * - The tuple is skipped if any of its key values is NULL, since NULL never matches in a join.
+ * - A hash across all key columns is computed.
+ * - The key and payload values are appended to the columns of the hash table (i.e., every tuple gets its own row, in
+ *   contrast to the JitAggregate, which combines equal keys).
+ * - The index of the new row is added to the hashmap entry of the computed hash.
+ *
+ * The layout of the hash table (i.e., which hashmap column holds which key or payload value) is defined by the
+ * JitHashJoinProbe operator, which creates the build operators via JitHashJoinProbe::create_build_operators().
+ */
+class JitHashJoinBuild : public AbstractJittable {
+ public:
+  std::string description() const final;
+
+  // Is called by the JitOperatorWrapper before any build tuple is consumed.
+  // This is used to initialize the internal hashmap data structure to the correct size.
+  void before_query(JitRuntimeContext& context) const;
+
+  void add_key_column(const JitTupleValue& tuple_value, const JitHashmapValue& hashmap_value);
+  void add_payload_column(const JitTupleValue& tuple_value, const JitHashmapValue& hashmap_value);
+
+  const std::vector<JitHashJoinBuildColumn> key_columns() const;
+  const std::vector<JitHashJoinBuildColumn> payload_columns() const;
+
+ private:
+  void _consume(JitRuntimeContext& context) const final;
+
+  uint32_t _num_hashmap_columns{0};
+  std::vector<JitHashJoinBuildColumn> _key_columns;
+  std::vector<JitHashJoinBuildColumn> _payload_columns;
+};
+
+}  // namespace opossum
@@ -0,0 +1,120 @@
+#include "jit_hash_join_probe.hpp"
+
+#include <algorithm>
+
+#include "constant_mappings.hpp"
+#include "jit_hash_join_build.hpp"
+#include "operators/jit_operator/jit_operations.hpp"
+
+namespace opossum {
+
+std::string JitHashJoinProbe::description() const {
+  // The data types of the build columns are not implied by the other operators of the chain. They are part of the
+  // description, so that the JitPipelineCache does not confuse chains that differ only in these types.
+  std::stringstream desc;
+  desc << "[HashJoinProbe] Keys: ";
+  for (const auto& key_column : _key_columns) {
+    desc << "x" << key_column.tuple_value.tuple_index() << " = h" << key_column.hashmap_value.column_index() << ", ";
+  }
+  desc << " Build columns: ";
+  for (const auto& build_column : _build_columns) {
+    const auto& tuple_value = build_column.tuple_value;
+    desc << "x" << tuple_value.tuple_index() << " = h" << build_column.hashmap_value.column_index() << " "
+         << data_type_to_string.left.at(tuple_value.data_type()) << (tuple_value.is_nullable() ? " NULL, " : ", ");
+  }
+  return desc.str();
+}
+
+void JitHashJoinProbe::add_key_column(const JitTupleValue& probe_value, const ColumnID build_column_id,
+                                      const bool build_is_nullable) {
+  // The nullability of the build column is needed to skip NULL keys while building the hash table
+  _key_columns.push_back(
+      {build_column_id, JitHashmapValue(probe_value.data_type(), build_is_nullable, _num_hashmap_columns++),
+       probe_value});
+}
+
+JitTupleValue JitHashJoinProbe::add_build_column(const DataType data_type, const bool is_nullable,
+                                                 const ColumnID build_column_id, JitReadTuples& jit_source) {
+  const auto it =
+      std::find_if(_build_columns.begin(), _build_columns.end(),
+                   [&](const auto& build_column) { return build_column.build_column_id == build_column_id; });
+  if (it != _build_columns.end()) {
+    return it->tuple_value;
+  }
+
+  const auto tuple_value = JitTupleValue(data_type, is_nullable, jit_source.add_temporary_value());
+  _build_columns.push_back(
+      {build_column_id, JitHashmapValue(data_type, is_nullable, _num_hashmap_columns++), tuple_value});
+  return tuple_value;
+}
+
+const std::vector<JitHashJoinProbeColumn> JitHashJoinProbe::key_columns() const { return _key_columns; }
+
+const std::vector<JitHashJoinProbeColumn> JitHashJoinProbe::build_columns() const { return _build_columns; }
+
+std::vector<std::shared_ptr<AbstractJittable>> JitHashJoinProbe::create_build_operators() const {
+  const auto read_tuples = std::make_shared<JitReadTuples>();
+  const auto hash_join_build = std::make_shared<JitHashJoinBuild>();
+
+  for (const auto& key_column : _key_columns) {
+    const auto& hashmap_value = key_column.hashmap_value;
+    hash_join_build->add_key_column(read_tuples->add_input_column(hashmap_value.data_type(),
+                                                                  hashmap_value.is_nullable(),
+                                                                  key_column.build_column_id),
+                                    hashmap_value);
+  }
+  for (const auto& build_column : _build_columns) {
+    const auto& hashmap_value = build_column.hashmap_value;
+    hash_join_build->add_payload_column(read_tuples->add_input_column(hashmap_value.data_type(),
+                                                                      hashmap_value.is_nullable(),
+                                                                      build_column.build_column_id),
+                                        hashmap_value);
+  }
+
+  return {read_tuples, hash_join_build};
+}
+
+void JitHashJoinProbe::_consume(JitRuntimeContext& context) const {
+  // We use index-based for loops in this function, since the LLVM optimizer is not able to properly unroll range-based
+  // loops, and we need the unrolling for proper specialization.
+
+  const auto num_key_columns = _key_columns.size();
+  const auto num_build_columns = _build_columns.size();
+
+  // Step 1: Drop tuples with NULL keys and compute the hash value across all key columns.
+  uint64_t hash_value = 0;
+  for (uint32_t i = 0; i < num_key_columns; ++i) {
+    if (_key_columns[i].tuple_value.is_null(context)) {
+      return;
+    }
+    hash_value = (hash_value << 5u) ^ jit_hash(_key_columns[i].tuple_value, context);
+  }
+
+  // Step 2: Look up the build rows with this hash in the hash table.
+  const auto bucket = context.join_hashmap->indices.find(hash_value);
+  if (bucket == context.join_hashmap->indices.end()) {
+    return;
+  }
+
+  // Step 3: Emit the tuple once for each matching build row. We do not need an index-based for loop here, since the
+  // number of rows in a bucket is only known at runtime.
+  for (const auto row_index : bucket->second) {
+    bool all_values_equal = true;
+    for (uint32_t i = 0; i < num_key_columns; ++i) {
+      if (!jit_join_equals(_key_columns[i].tuple_value, _key_columns[i].hashmap_value, row_index, context)) {
+        all_values_equal = false;
+        break;
+      }
+    }
+    if (!all_values_equal) {
+      continue;
+    }
+
+    for (uint32_t i = 0; i < num_build_columns; ++i) {
+      jit_join_assign(_build_columns[i].hashmap_value, row_index, _build_columns[i].tuple_value, context);
+    }
+    _emit(context);
+  }
+}
+
+}  // namespace opossum
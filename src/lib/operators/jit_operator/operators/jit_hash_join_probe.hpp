@@ -0,0 +1,66 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_jittable.hpp"
+#include "jit_read_tuples.hpp"
+
+namespace opossum {
+
+// Represents a column of the hash table that the operator accesses.
+// For key columns, the tuple_value is the probe value that is compared to the hashmap_value. For build columns, the
+// tuple_value receives the value of the matching build tuple. The build_column_id refers to the column of the build
+// input the hashmap_value is filled from.
+struct JitHashJoinProbeColumn {
+  ColumnID build_column_id;
+  JitHashmapValue hashmap_value;
+  JitTupleValue tuple_value;
+};
+
+/* The JitHashJoinProbe operator joins the tuples of the probe side (i.e., the left input of the JitOperatorWrapper)
+ * with a hash table built from the build side (i.e., the right input) in an inner equi-join. Since the operator
+ * emits the joined tuples one by one, the operators before and after it (e.g., filters on either side of the join and
+ * an aggregation of the join result) run in the same loop and no intermediate result is materialized.
+ *
+ * Each incoming tuple is processed in the following way:
+ * - The tuple is dropped if any of its key values is NULL.
+ * - A hash across all key values is computed and looked up in the hash table (JitRuntimeContext::join_hashmap).
+ * - For each build row with this hash, all key values are compared to the row (to rule out hash collisions). If they
+ *   match, the values of the build columns are copied from the row to their tuple values and the tuple is emitted.
+ *
+ * The operator defines the layout of the hash table: Each key column and each build column that is used by later
+ * operators gets a column in the hash table. The operators that fill the hash table accordingly are created by
+ * create_build_operators().
+ */
+class JitHashJoinProbe : public AbstractJittable {
+ public:
+  std::string description() const final;
+
+  // Adds an equality condition between a probe value and a column of the build input. Both have to be of the same
+  // data type, as equal values of different types would not produce the same hash.
+  void add_key_column(const JitTupleValue& probe_value, const ColumnID build_column_id, const bool build_is_nullable);
+
+  // Makes a column of the build input available to the operators after the probe. Returns the tuple value that holds
+  // the value of the matching build tuple. A column that is requested twice is only added once.
+  JitTupleValue add_build_column(const DataType data_type, const bool is_nullable, const ColumnID build_column_id,
+                                 JitReadTuples& jit_source);
+
+  const std::vector<JitHashJoinProbeColumn> key_columns() const;
+  const std::vector<JitHashJoinProbeColumn> build_columns() const;
+
+  // Creates the operator chain that fills the hash table from the build input: A JitReadTuples operator that reads all
+  // key and build columns and a JitHashJoinBuild operator that stores them in the layout expected by this operator.
+  // Must be called after all key and build columns have been added.
+  std::vector<std::shared_ptr<AbstractJittable>> create_build_operators() const;
+
+ private:
+  void _consume(JitRuntimeContext& context) const final;
+
+  uint32_t _num_hashmap_columns{0};
+  std::vector<JitHashJoinProbeColumn> _key_columns;
+  std::vector<JitHashJoinProbeColumn> _build_columns;
+};
+
+}  // namespace opossum
@@ -1,8 +1,15 @@
 #include "jit_read_tuples.hpp"
 
+#include <algorithm>
+#include <memory>
+
 #include "constant_mappings.hpp"
 #include "resolve_type.hpp"
+#include "storage/base_dictionary_column.hpp"
+#include "storage/column_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/create_iterable_from_column.hpp"
+#include "storage/reference_column.hpp"
+#include "type_comparison.hpp"
 
 namespace opossum {
 
@@ -15,6 +22,11 @@ std::string JitReadTuples::description() const {
   for (const auto& input_literal : _input_literals) {
     desc << "x" << input_literal.tuple_value.tuple_index() << " = " << input_literal.value << ", ";
   }
+  for (const auto& input_comparison : _input_comparisons) {
+    desc << "x" << input_comparison.tuple_value.tuple_index() << " = Col#" << input_comparison.column_id << " "
+         << predicate_condition_to_string.left.at(input_comparison.predicate_condition) << " "
+         << input_comparison.value << ", ";
+  }
   return desc.str();
 }
 
@@ -56,6 +68,112 @@ void JitReadTuples::before_chunk(const Table& in_table, const Chunk& in_chunk, J
       });
     });
   }
+
+  // Create a column reader that evaluates the comparison for each input comparison
+  for (const auto& input_comparison : _input_comparisons) {
+    const auto column = in_chunk.get_column(input_comparison.column_id);
+    const auto is_nullable = in_table.column_is_nullable(input_comparison.column_id);
+
+    auto dictionary_column = std::dynamic_pointer_cast<const BaseDictionaryColumn>(column);
+
+    // The chunks of a Validate's output reference a single chunk of the stored table each. If that chunk is
+    // dictionary-encoded, its ValueIDs are read through the position list.
+    auto referenced_pos_list = std::shared_ptr<const PosList>{};
+    if (const auto reference_column = std::dynamic_pointer_cast<const ReferenceColumn>(column)) {
+      const auto pos_list = reference_column->pos_list();
+      if (!pos_list->empty() && pos_list->front().chunk_id != INVALID_CHUNK_ID) {
+        const auto referenced_chunk_id = pos_list->front().chunk_id;
+        const auto references_single_chunk = std::all_of(pos_list->cbegin(), pos_list->cend(), [&](const auto& row_id) {
+          return row_id.chunk_id == referenced_chunk_id;
+        });
+        if (references_single_chunk) {
+          const auto referenced_chunk = reference_column->referenced_table()->get_chunk(referenced_chunk_id);
+          dictionary_column = std::dynamic_pointer_cast<const BaseDictionaryColumn>(
+              referenced_chunk->get_column(reference_column->referenced_column_id()));
+          if (dictionary_column) referenced_pos_list = pos_list;
+        }
+      }
+    }
+
+    if (dictionary_column) {
+      // The comparison of the values with the literal is translated to an equivalent comparison of the ValueIDs with a
+      // search ValueID (see SingleColumnTableScanImpl). INVALID_VALUE_ID is greater than all ValueIDs of the column
+      // (including its NULL ValueID) and is used as the search ValueID if the literal is not in the dictionary.
+      auto predicate_condition = input_comparison.predicate_condition;
+      auto search_value_id = INVALID_VALUE_ID;
+      switch (predicate_condition) {
+        case PredicateCondition::Equals:
+        case PredicateCondition::NotEquals: {
+          const auto lower_bound = dictionary_column->lower_bound(input_comparison.value);
+          if (lower_bound != dictionary_column->upper_bound(input_comparison.value)) {
+            search_value_id = lower_bound;
+          }
+          break;
+        }
+        case PredicateCondition::LessThan:
+        case PredicateCondition::GreaterThanEquals:
+          search_value_id = dictionary_column->lower_bound(input_comparison.value);
+          break;
+        case PredicateCondition::LessThanEquals:
+          predicate_condition = PredicateCondition::LessThan;
+          search_value_id = dictionary_column->upper_bound(input_comparison.value);
+          break;
+        case PredicateCondition::GreaterThan:
+          predicate_condition = PredicateCondition::GreaterThanEquals;
+          search_value_id = dictionary_column->upper_bound(input_comparison.value);
+          break;
+        default:
+          Fail("Unsupported predicate condition.");
+      }
+
+      with_comparator(predicate_condition, [&](auto comparator) {
+        using ComparatorType = decltype(comparator);
+        const auto add_comparison_reader = [&](const auto& it) {
+          using IteratorType = std::decay_t<decltype(it)>;
+          if (is_nullable) {
+            context.inputs.push_back(std::make_shared<JitComparisonReader<IteratorType, ValueID, ComparatorType, true>>(
+                it, search_value_id, input_comparison.tuple_value));
+          } else {
+            context.inputs.push_back(
+                std::make_shared<JitComparisonReader<IteratorType, ValueID, ComparatorType, false>>(
+                    it, search_value_id, input_comparison.tuple_value));
+          }
+        };
+
+        if (referenced_pos_list) {
+          const auto attribute_decoder =
+              std::shared_ptr<BaseVectorDecompressor>{dictionary_column->attribute_vector()->create_base_decoder()};
+          add_comparison_reader(
+              ReferencedValueIDIterator{referenced_pos_list, attribute_decoder, dictionary_column->null_value_id()});
+        } else {
+          create_iterable_from_attribute_vector(*dictionary_column).with_iterators([&](auto it, auto end) {
+            add_comparison_reader(it);
+          });
+        }
+      });
+      continue;
+    }
+
+    resolve_data_and_column_type(*column, [&](auto type, auto& typed_column) {
+      using ColumnDataType = typename decltype(type)::type;
+      const auto search_value = boost::get<ColumnDataType>(input_comparison.value);
+      with_comparator(input_comparison.predicate_condition, [&](auto comparator) {
+        using ComparatorType = decltype(comparator);
+        create_iterable_from_column<ColumnDataType>(typed_column).with_iterators([&](auto it, auto end) {
+          using IteratorType = decltype(it);
+          if (is_nullable) {
+            context.inputs.push_back(
+                std::make_shared<JitComparisonReader<IteratorType, ColumnDataType, ComparatorType, true>>(
+                    it, search_value, input_comparison.tuple_value));
+          } else {
+            context.inputs.push_back(
+                std::make_shared<JitComparisonReader<IteratorType, ColumnDataType, ComparatorType, false>>(
+                    it, search_value, input_comparison.tuple_value));
+          }
+        });
+      });
+    });
+  }
 }
 
 void JitReadTuples::execute(JitRuntimeContext& context) const {
@@ -98,10 +216,31 @@ size_t JitReadTuples::add_temporary_value() {
   return _num_tuple_values++;
 }
 
+JitTupleValue JitReadTuples::add_input_comparison(const DataType data_type, const bool is_nullable,
+                                                  const ColumnID column_id,
+                                                  const PredicateCondition predicate_condition,
+                                                  const AllTypeVariant& value) {
+  DebugAssert(data_type_from_all_type_variant(value) == data_type, "Literal must be of the column's data type.");
+  DebugAssert(predicate_condition == PredicateCondition::Equals ||
+                  predicate_condition == PredicateCondition::NotEquals ||
+                  predicate_condition == PredicateCondition::LessThan ||
+                  predicate_condition == PredicateCondition::LessThanEquals ||
+                  predicate_condition == PredicateCondition::GreaterThan ||
+                  predicate_condition == PredicateCondition::GreaterThanEquals,
+              "Unsupported predicate condition.");
+
+  // The result is NULL if the column value is NULL
+  const auto tuple_value = JitTupleValue(DataType::Bool, is_nullable, _num_tuple_values++);
+  _input_comparisons.push_back({column_id, predicate_condition, value, tuple_value});
+  return tuple_value;
+}
+
 std::vector<JitInputColumn> JitReadTuples::input_columns() const { return _input_columns; }
 
 std::vector<JitInputLiteral> JitReadTuples::input_literals() const { return _input_literals; }
 
+std::vector<JitInputComparison> JitReadTuples::input_comparisons() const { return _input_comparisons; }
+
 std::optional<ColumnID> JitReadTuples::find_input_column(const JitTupleValue& tuple_value) const {
   const auto it = std::find_if(_input_columns.begin(), _input_columns.end(), [&tuple_value](const auto& input_column) {
     return input_column.tuple_value == tuple_value;
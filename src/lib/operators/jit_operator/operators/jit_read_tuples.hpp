@@ -2,7 +2,9 @@
 
 #include "abstract_jittable.hpp"
 #include "storage/chunk.hpp"
+#include "storage/column_iterables/base_column_iterators.hpp"
 #include "storage/table.hpp"
+#include "storage/vector_compression/base_vector_decompressor.hpp"
 
 namespace opossum {
 
@@ -26,12 +28,24 @@ struct JitInputLiteral {
   JitTupleValue tuple_value;
 };
 
+// A comparison of an input column with a literal value that JitReadTuples evaluates while reading the column (see
+// JitReadTuples::add_input_comparison). The tuple_value receives the boolean result.
+struct JitInputComparison {
+  ColumnID column_id;
+  PredicateCondition predicate_condition;
+  AllTypeVariant value;
+  JitTupleValue tuple_value;
+};
+
 /* JitReadTuples must be the first operator in any chain of jit operators.
  * It is responsible for:
  * 1) storing literal values to the runtime tuple before the query is executed
  * 2) reading data from the the input table to the runtime tuple
  * 3) advancing the column iterators
- * 4) keeping track of the number of values in the runtime tuple. Whenever
+ * 4) evaluating comparisons of input columns with literals. On dictionary-encoded chunks and on reference columns
+ *    that reference a single dictionary-encoded chunk, these are evaluated on the ValueIDs of the attribute vector
+ *    instead of the values.
+ * 5) keeping track of the number of values in the runtime tuple. Whenever
  *    another operator needs to store a temporary value in the runtime tuple,
  *    it can request a slot in the tuple from JitReadTuples.
  */
@@ -83,6 +97,73 @@ class JitReadTuples : public AbstractJittable {
     JitTupleValue _tuple_value;
   };
 
+  /* JitComparisonReaders evaluate a comparison of an input column with a search value while reading the column and
+   * store the boolean result in their JitTupleValue. The column value itself is never written to the runtime tuple.
+   * On dictionary-encoded chunks, the Iterator iterates over the attribute vector and the search value is a ValueID
+   * (see JitReadTuples::before_chunk). This way, neither the attribute vector needs to be decoded nor the dictionary
+   * accessed for any tuple.
+   */
+  template <typename Iterator, typename SearchValueType, typename Comparator, bool Nullable>
+  class JitComparisonReader : public BaseJitColumnReader {
+   public:
+    JitComparisonReader(const Iterator& iterator, const SearchValueType& search_value,
+                        const JitTupleValue& tuple_value)
+        : _iterator{iterator}, _search_value{search_value}, _tuple_value{tuple_value} {}
+
+    // Reads a value from the _iterator, stores the result of the comparison in the _tuple_value and increments the
+    // _iterator.
+    void read_value(JitRuntimeContext& context) {
+      const auto& value = *_iterator;
+      ++_iterator;
+      // clang-format off
+      if constexpr (Nullable) {
+        context.tuple.set_is_null(_tuple_value.tuple_index(), value.is_null());
+        if (!value.is_null()) {
+          context.tuple.set<bool>(_tuple_value.tuple_index(), Comparator{}(value.value(), _search_value));
+        }
+      } else {
+        context.tuple.set<bool>(_tuple_value.tuple_index(), Comparator{}(value.value(), _search_value));
+      }
+      // clang-format on
+    }
+
+   private:
+    Iterator _iterator;
+    const SearchValueType _search_value;
+    JitTupleValue _tuple_value;
+  };
+
+  /* Iterates over the ValueIDs of a dictionary-encoded column through the position list of a reference column (e.g.,
+   * the output of a Validate). All positions must reference the same chunk. Unlike the iterators of the column
+   * iterables, the iterator shares the ownership of the position list and the decoder, because JitComparisonReaders
+   * keep their iterator beyond the scope of with_iterators.
+   */
+  class ReferencedValueIDIterator
+      : public BaseColumnIterator<ReferencedValueIDIterator, ColumnIteratorValue<ValueID>> {
+   public:
+    ReferencedValueIDIterator(const std::shared_ptr<const PosList>& pos_list,
+                              const std::shared_ptr<BaseVectorDecompressor>& attribute_decoder,
+                              const ValueID null_value_id)
+        : _pos_list{pos_list}, _attribute_decoder{attribute_decoder}, _null_value_id{null_value_id} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    void increment() { ++_chunk_offset; }
+
+    bool equal(const ReferencedValueIDIterator& other) const { return _chunk_offset == other._chunk_offset; }
+
+    ColumnIteratorValue<ValueID> dereference() const {
+      const auto value_id = static_cast<ValueID>(_attribute_decoder->get((*_pos_list)[_chunk_offset].chunk_offset));
+      return {value_id, value_id == _null_value_id, _chunk_offset};
+    }
+
+    std::shared_ptr<const PosList> _pos_list;
+    std::shared_ptr<BaseVectorDecompressor> _attribute_decoder;
+    ValueID _null_value_id;
+    ChunkOffset _chunk_offset{0};
+  };
+
  public:
   std::string description() const final;
 
@@ -93,8 +174,15 @@ class JitReadTuples : public AbstractJittable {
   JitTupleValue add_literal_value(const AllTypeVariant& value);
   size_t add_temporary_value();
 
+  // Adds a comparison of the input column with a (non-NULL) literal of the column's data type and returns the tuple
+  // value that holds its result. Unlike a JitExpression comparing an input column with a literal, the comparison can
+  // be evaluated on the ValueIDs of dictionary-encoded chunks.
+  JitTupleValue add_input_comparison(const DataType data_type, const bool is_nullable, const ColumnID column_id,
+                                     const PredicateCondition predicate_condition, const AllTypeVariant& value);
+
   std::vector<JitInputColumn> input_columns() const;
   std::vector<JitInputLiteral> input_literals() const;
+  std::vector<JitInputComparison> input_comparisons() const;
 
   std::optional<ColumnID> find_input_column(const JitTupleValue& tuple_value) const;
   std::optional<AllTypeVariant> find_literal_value(const JitTupleValue& tuple_value) const;
@@ -105,6 +193,7 @@ class JitReadTuples : public AbstractJittable {
   uint32_t _num_tuple_values{0};
   std::vector<JitInputColumn> _input_columns;
   std::vector<JitInputLiteral> _input_literals;
+  std::vector<JitInputComparison> _input_comparisons;
 
  private:
   void _consume(JitRuntimeContext& context) const final {}
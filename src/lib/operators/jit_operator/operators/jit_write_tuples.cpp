@@ -38,6 +38,14 @@ void JitWriteTuples::after_chunk(Table& out_table, JitRuntimeContext& context) c
   }
 }
 
+void JitWriteTuples::merge_morsel(Table& out_table, JitRuntimeContext& context, const Table& morsel_table,
+                                  JitRuntimeContext& morsel_context) const {
+  // The output chunks of each morsel have been created in the order of the input chunks
+  for (ChunkID chunk_id{0}; chunk_id < morsel_table.chunk_count(); ++chunk_id) {
+    out_table.append_chunk(morsel_table.get_chunk(chunk_id)->columns());
+  }
+}
+
 void JitWriteTuples::add_output_column(const std::string& column_name, const JitTupleValue& value) {
   _output_columns.push_back({column_name, value});
 }
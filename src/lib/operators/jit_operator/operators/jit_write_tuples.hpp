@@ -24,6 +24,7 @@ struct JitOutputColumn {
  * 1) adding column definitions to the output table
  * 2) appending the current tuple to the current output chunk
  * 3) creating a new output chunks and adding output chunks to the output table
+ * 4) appending the output chunks of later morsels to the output table, if the input chunks were processed in parallel
  */
 class JitWriteTuples : public AbstractJittableSink {
   /* JitColumnWriters provide a template-free interface to store tuple values in ValueColumns in the output table.
@@ -65,6 +66,8 @@ class JitWriteTuples : public AbstractJittableSink {
   std::shared_ptr<Table> create_output_table(const ChunkOffset input_table_chunk_size) const final;
   void before_query(Table& out_table, JitRuntimeContext& context) const override;
   void after_chunk(Table& out_table, JitRuntimeContext& context) const override;
+  void merge_morsel(Table& out_table, JitRuntimeContext& context, const Table& morsel_table,
+                    JitRuntimeContext& morsel_context) const override;
 
   void add_output_column(const std::string& column_name, const JitTupleValue& value);
 
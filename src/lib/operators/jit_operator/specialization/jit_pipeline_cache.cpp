@@ -0,0 +1,114 @@
+#include "jit_pipeline_cache.hpp"
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "constant_mappings.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+JitPipelineCache& JitPipelineCache::get() {
+  static JitPipelineCache instance;
+  return instance;
+}
+
+JitPipelineCache::JitPipelineCache() : _cache(DefaultCapacity) {}
+
+std::string JitPipelineCache::fingerprint(const std::vector<std::shared_ptr<AbstractJittable>>& jit_operators) {
+  std::stringstream fingerprint;
+  for (const auto& jit_operator : jit_operators) {
+    // The description of JitReadTuples contains the values of literals, but not the data types of the tuple values.
+    // The data types of all other tuple values follow from those of the input columns and literals.
+    if (const auto read_tuples = std::dynamic_pointer_cast<const JitReadTuples>(jit_operator)) {
+      fingerprint << "[ReadTuple] ";
+      for (const auto& input_column : read_tuples->input_columns()) {
+        const auto& tuple_value = input_column.tuple_value;
+        fingerprint << "x" << tuple_value.tuple_index() << " = Col#" << input_column.column_id << " "
+                    << data_type_to_string.left.at(tuple_value.data_type())
+                    << (tuple_value.is_nullable() ? " NULL, " : ", ");
+      }
+      for (const auto& input_literal : read_tuples->input_literals()) {
+        const auto& tuple_value = input_literal.tuple_value;
+        fingerprint << "x" << tuple_value.tuple_index() << " = "
+                    << data_type_to_string.left.at(tuple_value.data_type()) << " literal, ";
+      }
+      // The readers of input comparisons are created in JitReadTuples::before_chunk() and do not depend on the
+      // compiled code
+      for (const auto& input_comparison : read_tuples->input_comparisons()) {
+        const auto& tuple_value = input_comparison.tuple_value;
+        fingerprint << "x" << tuple_value.tuple_index() << " = Col#" << input_comparison.column_id << " comparison"
+                    << (tuple_value.is_nullable() ? " NULL, " : ", ");
+      }
+    } else {
+      fingerprint << jit_operator->description();
+    }
+    fingerprint << "\n";
+  }
+  return fingerprint.str();
+}
+
+std::shared_ptr<const JitCompiledPipeline> JitPipelineCache::get_or_compile(
+    const std::vector<std::shared_ptr<AbstractJittable>>& jit_operators, const bool two_specialization_passes) {
+  DebugAssert(!jit_operators.empty() && std::dynamic_pointer_cast<JitReadTuples>(jit_operators.front()),
+              "Operator chain must start with a JitReadTuples operator.");
+
+  const auto pipeline_fingerprint = fingerprint(jit_operators);
+  if (const auto cached_pipeline = _cache.try_get(pipeline_fingerprint)) {
+    ++_hit_count;
+    _saved_compile_time_micros += (*cached_pipeline)->compile_time.count();
+    return *cached_pipeline;
+  }
+  ++_miss_count;
+
+  const auto started = std::chrono::high_resolution_clock::now();
+
+  auto pipeline = std::make_shared<JitCompiledPipeline>();
+  pipeline->jit_operators = jit_operators;
+  pipeline->code_specializer = std::make_shared<JitCodeSpecializer>();
+  // this corresponds to "opossum::JitReadTuples::execute(opossum::JitRuntimeContext&) const"
+  pipeline->execute_func =
+      pipeline->code_specializer->specialize_and_compile_function<void(const JitReadTuples*, JitRuntimeContext&)>(
+          "_ZNK7opossum13JitReadTuples7executeERNS_17JitRuntimeContextE",
+          std::make_shared<JitConstantRuntimePointer>(jit_operators.front().get()), two_specialization_passes);
+
+  const auto done = std::chrono::high_resolution_clock::now();
+  pipeline->compile_time = std::chrono::duration_cast<std::chrono::microseconds>(done - started);
+
+  // If another query compiled the same pipeline concurrently, the entry is simply refreshed
+  _cache.set(pipeline_fingerprint, pipeline);
+  return pipeline;
+}
+
+std::shared_ptr<const JitCompiledPipeline> JitPipelineCache::try_get(
+    const std::vector<std::shared_ptr<AbstractJittable>>& jit_operators) {
+  const auto cached_pipeline = _cache.try_get(fingerprint(jit_operators));
+  if (!cached_pipeline) return nullptr;
+
+  ++_hit_count;
+  _saved_compile_time_micros += (*cached_pipeline)->compile_time.count();
+  return *cached_pipeline;
+}
+
+void JitPipelineCache::resize(const size_t capacity) { _cache.resize(capacity); }
+
+void JitPipelineCache::clear() {
+  _cache.clear();
+  _hit_count = 0;
+  _miss_count = 0;
+  _saved_compile_time_micros = 0;
+}
+
+size_t JitPipelineCache::size() const { return _cache.size(); }
+
+size_t JitPipelineCache::hit_count() const { return _hit_count; }
+
+size_t JitPipelineCache::miss_count() const { return _miss_count; }
+
+std::chrono::microseconds JitPipelineCache::saved_compile_time() const {
+  return std::chrono::microseconds{_saved_compile_time_micros};
+}
+
+}  // namespace opossum
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "jit_code_specializer.hpp"
+#include "operators/jit_operator/operators/jit_read_tuples.hpp"
+#include "sql/sql_query_cache.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+using JitExecuteFunction = std::function<void(const JitReadTuples*, JitRuntimeContext&)>;
+
+// The machine code of a specialized operator chain together with everything it references
+struct JitCompiledPipeline {
+  // The specialized code accesses these operators directly (their addresses are compiled into it), so they have to be
+  // kept alive for as long as the code is used.
+  std::vector<std::shared_ptr<AbstractJittable>> jit_operators;
+
+  // Owns the compiled machine code
+  std::shared_ptr<JitCodeSpecializer> code_specializer;
+
+  // Executes the operator chain for the current chunk of the JitRuntimeContext. Has to be called with
+  // jit_operators.front() as the source.
+  JitExecuteFunction execute_func;
+
+  std::chrono::microseconds compile_time{0};
+};
+
+/* Specializing and compiling an operator chain with LLVM easily takes longer than executing a short query. The
+ * JitPipelineCache keeps the code compiled for an operator chain, so that a structurally equal chain of a later query
+ * (or of another execution of the same prepared statement) does not have to be compiled again.
+ *
+ * Two chains are structurally equal if their fingerprints match. The fingerprint describes the operators, the
+ * expressions they evaluate and the positions and data types of all values in the runtime tuple, but not the values of
+ * literals: These are written to the runtime tuple by JitReadTuples::before_query() and are not part of the
+ * specialized code. The column readers are dispatched at runtime, so neither the encoding of the input columns nor
+ * the literals of input comparisons (which the readers evaluate) change the code.
+ *
+ * Entries are evicted with the GDFS policy of the SQLQueryCache.
+ */
+class JitPipelineCache : private Noncopyable {
+ public:
+  static constexpr size_t DefaultCapacity = 128;
+
+  static JitPipelineCache& get();
+
+  static std::string fingerprint(const std::vector<std::shared_ptr<AbstractJittable>>& jit_operators);
+
+  // Returns the pipeline compiled for a structurally equal operator chain, or specializes and compiles jit_operators,
+  // which have to be connected to a chain already.
+  std::shared_ptr<const JitCompiledPipeline> get_or_compile(
+      const std::vector<std::shared_ptr<AbstractJittable>>& jit_operators, const bool two_specialization_passes);
+
+  // Returns the pipeline compiled for a structurally equal operator chain, or nullptr if there is none. A failed lookup
+  // is not counted as a miss, as it does not cause a compilation.
+  std::shared_ptr<const JitCompiledPipeline> try_get(
+      const std::vector<std::shared_ptr<AbstractJittable>>& jit_operators);
+
+  void resize(const size_t capacity);
+
+  // Removes all entries and resets the metrics
+  void clear();
+
+  size_t size() const;
+  size_t hit_count() const;
+  size_t miss_count() const;
+
+  // The sum of the compile times of all pipelines taken from the cache
+  std::chrono::microseconds saved_compile_time() const;
+
+ private:
+  JitPipelineCache();
+
+  SQLQueryCache<std::shared_ptr<const JitCompiledPipeline>> _cache;
+
+  std::atomic<size_t> _hit_count{0};
+  std::atomic<size_t> _miss_count{0};
+  std::atomic<int64_t> _saved_compile_time_micros{0};
+};
+
+}  // namespace opossum
@@ -1,15 +1,35 @@
 #include "jit_operator_wrapper.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
 #include "operators/jit_operator/operators/jit_aggregate.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/topology.hpp"
+#include "utils/performance_warning.hpp"
 
 namespace opossum {
 
 JitOperatorWrapper::JitOperatorWrapper(const std::shared_ptr<const AbstractOperator>& left,
                                        const JitExecutionMode execution_mode,
                                        const std::vector<std::shared_ptr<AbstractJittable>>& jit_operators)
-    : AbstractReadOnlyOperator{OperatorType::JitOperatorWrapper, left},
+    : JitOperatorWrapper{left, nullptr, execution_mode, jit_operators} {}
+
+JitOperatorWrapper::JitOperatorWrapper(const std::shared_ptr<const AbstractOperator>& left,
+                                       const std::shared_ptr<const AbstractOperator>& right,
+                                       const JitExecutionMode execution_mode,
+                                       const std::vector<std::shared_ptr<AbstractJittable>>& jit_operators,
+                                       const std::vector<std::shared_ptr<AbstractJittable>>& build_jit_operators)
+    : AbstractReadOnlyOperator{OperatorType::JitOperatorWrapper, left, right},
       _execution_mode{execution_mode},
-      _jit_operators{jit_operators} {}
+      _jit_operators{jit_operators},
+      _build_jit_operators{build_jit_operators} {}
 
 const std::string JitOperatorWrapper::name() const { return "JitOperatorWrapper"; }
 
@@ -17,6 +37,13 @@ const std::string JitOperatorWrapper::description(DescriptionMode description_mo
   std::stringstream desc;
   const auto separator = description_mode == DescriptionMode::MultiLine ? "\n" : " ";
   desc << "[JitOperatorWrapper]" << separator;
+  if (!_build_jit_operators.empty()) {
+    desc << "Build:" << separator;
+    for (const auto& op : _build_jit_operators) {
+      desc << op->description() << separator;
+    }
+    desc << "Probe:" << separator;
+  }
   for (const auto& op : _jit_operators) {
     desc << op->description() << separator;
   }
@@ -29,6 +56,14 @@ const std::vector<std::shared_ptr<AbstractJittable>>& JitOperatorWrapper::jit_op
   return _jit_operators;
 }
 
+void JitOperatorWrapper::add_build_jit_operator(const std::shared_ptr<AbstractJittable>& op) {
+  _build_jit_operators.push_back(op);
+}
+
+const std::vector<std::shared_ptr<AbstractJittable>>& JitOperatorWrapper::build_jit_operators() const {
+  return _build_jit_operators;
+}
+
 const std::shared_ptr<JitReadTuples> JitOperatorWrapper::_source() const {
   return std::dynamic_pointer_cast<JitReadTuples>(_jit_operators.front());
 }
@@ -46,46 +81,194 @@ std::shared_ptr<const Table> JitOperatorWrapper::_on_execute() {
   auto out_table = _sink()->create_output_table(in_table.max_chunk_size());
 
   JitRuntimeContext context;
+  if (!_build_jit_operators.empty()) {
+    _build_join_hashmap(context);
+  }
   _source()->before_query(in_table, context);
-  _sink()->before_query(*out_table, context);
 
   // Connect operators to a chain
   for (auto it = _jit_operators.begin(); it != _jit_operators.end() && it + 1 != _jit_operators.end(); ++it) {
     (*it)->set_next_operator(*(it + 1));
   }
 
-  std::function<void(const JitReadTuples*, JitRuntimeContext&)> execute_func;
   // We want to perform two specialization passes if the operator chain contains a JitAggregate operator, since the
   // JitAggregate operator contains multiple loops that need unrolling.
   auto two_specialization_passes = static_cast<bool>(std::dynamic_pointer_cast<JitAggregate>(_sink()));
+  std::shared_ptr<const JitCompiledPipeline> initial_compiled_pipeline;
   switch (_execution_mode) {
     case JitExecutionMode::Compile:
-      // this corresponds to "opossum::JitReadTuples::execute(opossum::JitRuntimeContext&) const"
-      execute_func = _module.specialize_and_compile_function<void(const JitReadTuples*, JitRuntimeContext&)>(
-          "_ZNK7opossum13JitReadTuples7executeERNS_17JitRuntimeContextE",
-          std::make_shared<JitConstantRuntimePointer>(_source().get()), two_specialization_passes);
+      initial_compiled_pipeline = JitPipelineCache::get().get_or_compile(_jit_operators, two_specialization_passes);
+      break;
+    case JitExecutionMode::Adaptive:
+      initial_compiled_pipeline = JitPipelineCache::get().try_get(_jit_operators);
       break;
     case JitExecutionMode::Interpret:
-      execute_func = &JitReadTuples::execute;
       break;
   }
 
-  for (opossum::ChunkID chunk_id{0}; chunk_id < in_table.chunk_count(); ++chunk_id) {
-    const auto& in_chunk = *in_table.get_chunk(chunk_id);
-    _source()->before_chunk(in_table, in_chunk, context);
-    execute_func(_source().get(), context);
-    _sink()->after_chunk(*out_table, context);
+  // The chunks are split into contiguous ranges (morsels), one per worker. Each morsel is processed by a JobTask with
+  // its own copy of the runtime context and its own output table. The outputs of all morsels are merged into the
+  // output of the first one by the sink afterwards. Without a scheduler, all chunks form a single morsel.
+  const auto chunk_count = in_table.chunk_count();
+  auto morsel_count = size_t{1};
+  if (CurrentScheduler::is_set()) {
+    morsel_count = std::max(size_t{1}, std::min(static_cast<size_t>(chunk_count), Topology::get().num_cpus()));
+  }
+
+  std::vector<JitRuntimeContext> contexts(morsel_count, context);
+  std::vector<std::shared_ptr<Table>> out_tables{out_table};
+  for (auto morsel_id = size_t{1}; morsel_id < morsel_count; ++morsel_id) {
+    out_tables.push_back(_sink()->create_output_table(in_table.max_chunk_size()));
   }
 
-  _sink()->after_query(*out_table, context);
+  // Set by the compile task in adaptive mode and shared by all morsels. The task is not waited for: If the query
+  // finishes first, the compiled pipeline still ends up in the JitPipelineCache for later queries.
+  std::mutex compiled_pipeline_mutex;
+  std::shared_future<std::shared_ptr<const JitCompiledPipeline>> compiled_pipeline_future;
+
+  const auto process_morsel = [&](const ChunkID begin_chunk_id, const ChunkID end_chunk_id, Table& morsel_table,
+                                  JitRuntimeContext& morsel_context) {
+    _sink()->before_query(morsel_table, morsel_context);
+
+    // The source the execute function was compiled for. Compiled code taken from the JitPipelineCache works on the
+    // operators of the cached pipeline, which are structurally equal to ours.
+    const JitReadTuples* execute_source = _source().get();
+    JitExecuteFunction execute_func = &JitReadTuples::execute;
+    std::shared_ptr<const JitCompiledPipeline> compiled_pipeline;
+    const auto use_compiled_pipeline = [&](const std::shared_ptr<const JitCompiledPipeline>& pipeline) {
+      compiled_pipeline = pipeline;
+      execute_source = static_cast<const JitReadTuples*>(compiled_pipeline->jit_operators.front().get());
+      execute_func = compiled_pipeline->execute_func;
+    };
+    if (initial_compiled_pipeline) {
+      use_compiled_pipeline(initial_compiled_pipeline);
+    }
+    auto compilation_failed = false;
+
+    for (auto chunk_id = begin_chunk_id; chunk_id < end_chunk_id; ++chunk_id) {
+      if (_execution_mode == JitExecutionMode::Adaptive && !compiled_pipeline && !compilation_failed) {
+        std::shared_future<std::shared_ptr<const JitCompiledPipeline>> future;
+        {
+          std::lock_guard<std::mutex> lock(compiled_pipeline_mutex);
+          future = compiled_pipeline_future;
+        }
+        if (future.valid() && future.wait_for(std::chrono::seconds{0}) == std::future_status::ready) {
+          // If the compilation failed, the remaining chunks are interpreted. The JitPipelineCache only stores
+          // successfully compiled pipelines, so later queries try to compile the chain again.
+          try {
+            use_compiled_pipeline(future.get());
+          } catch (const std::exception& exception) {
+            compilation_failed = true;
+            PerformanceWarning(std::string("JIT compilation failed, interpreting instead: ") + exception.what());
+          }
+        }
+      }
+
+      const auto& in_chunk = *in_table.get_chunk(chunk_id);
+      _source()->before_chunk(in_table, in_chunk, morsel_context);
+      execute_func(execute_source, morsel_context);
+      _sink()->after_chunk(morsel_table, morsel_context);
+
+      // The first morsel that finishes a chunk starts the compilation, if there is any chunk left to profit from it
+      if (_execution_mode == JitExecutionMode::Adaptive && !compiled_pipeline && chunk_id + 1 < chunk_count) {
+        std::lock_guard<std::mutex> lock(compiled_pipeline_mutex);
+        if (!compiled_pipeline_future.valid()) {
+          compiled_pipeline_future = _compile_in_background(two_specialization_passes);
+        }
+      }
+    }
+  };
+
+  if (morsel_count == 1) {
+    process_morsel(ChunkID{0}, chunk_count, *out_table, contexts[0]);
+  } else {
+    std::vector<std::shared_ptr<AbstractTask>> jobs;
+    jobs.reserve(morsel_count);
+    for (auto morsel_id = size_t{0}; morsel_id < morsel_count; ++morsel_id) {
+      const auto begin_chunk_id = static_cast<ChunkID>(morsel_id * chunk_count / morsel_count);
+      const auto end_chunk_id = static_cast<ChunkID>((morsel_id + 1) * chunk_count / morsel_count);
+      jobs.push_back(std::make_shared<JobTask>([&, morsel_id, begin_chunk_id, end_chunk_id]() {
+        process_morsel(begin_chunk_id, end_chunk_id, *out_tables[morsel_id], contexts[morsel_id]);
+      }));
+      jobs.back()->schedule();
+    }
+    CurrentScheduler::wait_for_tasks(jobs);
+
+    for (auto morsel_id = size_t{1}; morsel_id < morsel_count; ++morsel_id) {
+      _sink()->merge_morsel(*out_table, contexts[0], *out_tables[morsel_id], contexts[morsel_id]);
+    }
+  }
+
+  _sink()->after_query(*out_table, contexts[0]);
 
   return out_table;
 }
 
+void JitOperatorWrapper::_build_join_hashmap(JitRuntimeContext& context) const {
+  Assert(input_right(), "JitOperatorWrapper with build operators requires a right input.");
+  const auto build_source = std::dynamic_pointer_cast<JitReadTuples>(_build_jit_operators.front());
+  const auto build_sink = std::dynamic_pointer_cast<JitHashJoinBuild>(_build_jit_operators.back());
+  Assert(build_source && build_sink, "Build operators must start with JitReadTuples and end with JitHashJoinBuild.");
+
+  const auto& build_table = *input_right()->get_output();
+
+  JitRuntimeContext build_context;
+  build_source->before_query(build_table, build_context);
+  build_sink->before_query(build_context);
+
+  for (auto it = _build_jit_operators.begin(); it + 1 != _build_jit_operators.end(); ++it) {
+    (*it)->set_next_operator(*(it + 1));
+  }
+
+  // The build side is not compiled in the background: In the adaptive mode, it is only executed by compiled code if
+  // that is cached already.
+  const JitReadTuples* execute_source = build_source.get();
+  JitExecuteFunction execute_func = &JitReadTuples::execute;
+  std::shared_ptr<const JitCompiledPipeline> compiled_pipeline;
+  if (_execution_mode == JitExecutionMode::Compile) {
+    compiled_pipeline = JitPipelineCache::get().get_or_compile(_build_jit_operators, false);
+  } else if (_execution_mode == JitExecutionMode::Adaptive) {
+    compiled_pipeline = JitPipelineCache::get().try_get(_build_jit_operators);
+  }
+  if (compiled_pipeline) {
+    execute_source = static_cast<const JitReadTuples*>(compiled_pipeline->jit_operators.front().get());
+    execute_func = compiled_pipeline->execute_func;
+  }
+
+  for (ChunkID chunk_id{0}; chunk_id < build_table.chunk_count(); ++chunk_id) {
+    const auto& build_chunk = *build_table.get_chunk(chunk_id);
+    build_source->before_chunk(build_table, build_chunk, build_context);
+    execute_func(execute_source, build_context);
+  }
+
+  context.join_hashmap = std::make_shared<JitRuntimeHashmap>(std::move(build_context.hashmap));
+}
+
+std::shared_future<std::shared_ptr<const JitCompiledPipeline>> JitOperatorWrapper::_compile_in_background(
+    const bool two_specialization_passes) const {
+  // std::function requires a copyable callable, so the promise is shared with the task
+  const auto promise = std::make_shared<std::promise<std::shared_ptr<const JitCompiledPipeline>>>();
+  auto future = promise->get_future().share();
+
+  // Without a scheduler, the task is executed right away, i.e., the remaining chunks are processed by compiled code
+  const auto compile_task = std::make_shared<JobTask>([promise, jit_operators = _jit_operators,
+                                                       two_specialization_passes]() {
+    try {
+      promise->set_value(JitPipelineCache::get().get_or_compile(jit_operators, two_specialization_passes));
+    } catch (...) {
+      promise->set_exception(std::current_exception());
+    }
+  });
+  compile_task->schedule();
+
+  return future;
+}
+
 std::shared_ptr<AbstractOperator> JitOperatorWrapper::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
-  return std::make_shared<JitOperatorWrapper>(copied_input_left, _execution_mode, _jit_operators);
+  return std::make_shared<JitOperatorWrapper>(copied_input_left, copied_input_right, _execution_mode, _jit_operators,
+                                              _build_jit_operators);
 }
 
 void JitOperatorWrapper::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
@@ -1,15 +1,26 @@
 #pragma once
 
+#include <future>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "abstract_read_only_operator.hpp"
 #include "jit_operator/operators/abstract_jittable_sink.hpp"
+#include "jit_operator/operators/jit_hash_join_build.hpp"
 #include "jit_operator/operators/jit_read_tuples.hpp"
-#include "operators/jit_operator/specialization/jit_code_specializer.hpp"
+#include "operators/jit_operator/specialization/jit_pipeline_cache.hpp"
 
 namespace opossum {
 
-enum class JitExecutionMode { Interpret, Compile };
+/* Interpret: The operators are executed through virtual calls without specialization.
+ * Compile: The operator chain is specialized and compiled before the first chunk is processed.
+ * Adaptive: The first chunk is interpreted. If more chunks remain, the chain is compiled by a JobTask while the
+ *           interpretation continues, and the remaining chunks are processed by the compiled code once it is ready.
+ *           Short queries thus do not pay for the compilation, while long ones still profit from it. A chain that is
+ *           already in the JitPipelineCache is executed by the compiled code from the start.
+ */
+enum class JitExecutionMode { Interpret, Compile, Adaptive };
 
 /* The JitOperatorWrapper wraps a number of jittable operators and exposes them through Hyrise's default
  * operator interface. This allows a number of jit operators to be seamlessly integrated with
@@ -17,6 +28,16 @@ enum class JitExecutionMode { Interpret, Compile };
  * The JitOperatorWrapper is responsible for chaining the operators it contains, compiling code for the operators at
  * runtime, creating and managing the runtime context and calling hooks (before/after processing a chunk or the entire
  * query) on the its operators.
+ * Compiled code is shared between structurally equal operator chains via the JitPipelineCache.
+ *
+ * If a scheduler is active, the chunks of the input table are split into contiguous ranges (morsels) - one per CPU -
+ * that are processed in parallel by JobTasks. Each morsel has its own runtime context and output table. Afterwards,
+ * the sink merges the outputs of the later morsels into those of the first one (see AbstractJittableSink), so the
+ * order of the output chunks matches that of the input chunks.
+ *
+ * For a hash join, the wrapper gets a right input and a second operator chain (the build operators) that ends in a
+ * JitHashJoinBuild operator. The build chain is executed on the right input first. The resulting hash table is then
+ * probed by a JitHashJoinProbe operator within the main chain, which processes the left input.
  */
 class JitOperatorWrapper : public AbstractReadOnlyOperator {
  public:
@@ -24,6 +45,12 @@ class JitOperatorWrapper : public AbstractReadOnlyOperator {
                               const JitExecutionMode execution_mode = JitExecutionMode::Compile,
                               const std::vector<std::shared_ptr<AbstractJittable>>& jit_operators = {});
 
+  JitOperatorWrapper(const std::shared_ptr<const AbstractOperator>& left,
+                     const std::shared_ptr<const AbstractOperator>& right,
+                     const JitExecutionMode execution_mode = JitExecutionMode::Compile,
+                     const std::vector<std::shared_ptr<AbstractJittable>>& jit_operators = {},
+                     const std::vector<std::shared_ptr<AbstractJittable>>& build_jit_operators = {});
+
   const std::string name() const final;
   const std::string description(DescriptionMode description_mode) const final;
 
@@ -33,6 +60,11 @@ class JitOperatorWrapper : public AbstractReadOnlyOperator {
 
   const std::vector<std::shared_ptr<AbstractJittable>>& jit_operators() const;
 
+  // Adds a jittable operator to the end of the operator pipeline that builds the hash table from the right input.
+  void add_build_jit_operator(const std::shared_ptr<AbstractJittable>& op);
+
+  const std::vector<std::shared_ptr<AbstractJittable>>& build_jit_operators() const;
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
 
@@ -45,9 +77,16 @@ class JitOperatorWrapper : public AbstractReadOnlyOperator {
   const std::shared_ptr<JitReadTuples> _source() const;
   const std::shared_ptr<AbstractJittableSink> _sink() const;
 
+  // Executes the build operators on the right input and moves the resulting hash table to the runtime context
+  void _build_join_hashmap(JitRuntimeContext& context) const;
+
+  // Compiles the (already chained) operators in a JobTask for the adaptive execution mode
+  std::shared_future<std::shared_ptr<const JitCompiledPipeline>> _compile_in_background(
+      const bool two_specialization_passes) const;
+
   const JitExecutionMode _execution_mode;
-  JitCodeSpecializer _module;
   std::vector<std::shared_ptr<AbstractJittable>> _jit_operators;
+  std::vector<std::shared_ptr<AbstractJittable>> _build_jit_operators;
 };
 
 }  // namespace opossum
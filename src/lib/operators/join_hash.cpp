@@ -3,20 +3,24 @@
 #include <boost/lexical_cast.hpp>
 #include <boost/variant.hpp>
 
+#include <algorithm>
 #include <cmath>
 #include <memory>
 #include <numeric>
 #include <string>
+#include <tuple>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "join_hash/composite_key.hpp"
 #include "join_hash/hash_traits.hpp"
 #include "resolve_type.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
+#include "scheduler/topology.hpp"
 #include "storage/abstract_column_visitor.hpp"
 #include "storage/create_iterable_from_column.hpp"
 #include "type_cast.hpp"
@@ -30,18 +34,26 @@ namespace opossum {
 JoinHash::JoinHash(const std::shared_ptr<const AbstractOperator>& left,
                    const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
                    const ColumnIDPair& column_ids, const PredicateCondition predicate_condition,
-                   const size_t radix_bits)
+                   const std::vector<ColumnIDPair>& additional_column_ids, const std::optional<size_t>& radix_bits)
     : AbstractJoinOperator(OperatorType::JoinHash, left, right, mode, column_ids, predicate_condition),
+      _additional_column_ids(additional_column_ids),
       _radix_bits(radix_bits) {
   DebugAssert(predicate_condition == PredicateCondition::Equals, "Operator not supported by Hash Join.");
 }
 
 const std::string JoinHash::name() const { return "JoinHash"; }
 
+const std::string JoinHash::description(DescriptionMode description_mode) const {
+  return _description_with_additional_column_ids(description_mode, _additional_column_ids);
+}
+
+const std::vector<ColumnIDPair>& JoinHash::additional_column_ids() const { return _additional_column_ids; }
+
 std::shared_ptr<AbstractOperator> JoinHash::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
-  return std::make_shared<JoinHash>(copied_input_left, copied_input_right, _mode, _column_ids, _predicate_condition);
+  return std::make_shared<JoinHash>(copied_input_left, copied_input_right, _mode, _column_ids, _predicate_condition,
+                                    _additional_column_ids, _radix_bits);
 }
 
 void JoinHash::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
@@ -80,9 +92,27 @@ std::shared_ptr<const Table> JoinHash::_on_execute() {
   auto build_input = build_operator->get_output();
   auto probe_input = probe_operator->get_output();
 
+  auto build_key_data_type = build_input->column_data_type(build_column_id);
+  auto probe_key_data_type = probe_input->column_data_type(probe_column_id);
+
+  // With additional join columns, the hash table is built on and probed with composite keys
+  std::shared_ptr<const Table> build_key_table;
+  std::shared_ptr<const Table> probe_key_table;
+  if (!_additional_column_ids.empty()) {
+    auto key_column_ids = std::vector<ColumnIDPair>{adjusted_column_ids};
+    for (const auto& [left_column_id, right_column_id] : _additional_column_ids) {
+      key_column_ids.emplace_back(inputs_swapped ? std::make_pair(right_column_id, left_column_id)
+                                                 : std::make_pair(left_column_id, right_column_id));
+    }
+
+    std::tie(build_key_table, probe_key_table) = create_composite_key_tables(build_input, probe_input, key_column_ids);
+    build_key_data_type = build_key_table->column_data_type(ColumnID{0});
+    probe_key_data_type = probe_key_table->column_data_type(ColumnID{0});
+  }
+
   _impl = make_unique_by_data_types<AbstractReadOnlyOperatorImpl, JoinHashImpl>(
-      build_input->column_data_type(build_column_id), probe_input->column_data_type(probe_column_id), build_operator,
-      probe_operator, _mode, adjusted_column_ids, _predicate_condition, inputs_swapped, _radix_bits);
+      build_key_data_type, probe_key_data_type, build_operator, probe_operator, _mode, adjusted_column_ids,
+      _predicate_condition, inputs_swapped, _radix_bits, build_key_table, probe_key_table);
   return _impl->_on_execute();
 }
 
@@ -121,6 +151,72 @@ struct RadixContainer {
   std::vector<size_t> partition_offsets;
 };
 
+/*
+A range of a probe partition that is probed by a single JobTask. Usually, a range covers a whole partition.
+*/
+struct ProbeRange {
+  size_t partition_id;
+  size_t begin;
+  size_t end;
+};
+
+/*
+Radix partitioning assumes that the join keys are distributed roughly uniformly. A heavy-hitter key (e.g., a default
+value) puts most of the probe rows into a single partition, so that the JobTask probing this partition would serialize
+the probe phase. We detect such skewed partitions by comparing their size (i.e., the sum of their histogram counts) to
+the average size of the non-empty partitions. A skewed partition is split into ranges of about the average size that
+are probed by separate JobTasks. The hash table of the partition is read-only during the probe phase and thus shared
+by all of these tasks, i.e., the build entries of the hot partition are broadcast to each of them.
+Empty partitions are skipped, so that the probe phase does not create empty output chunks.
+*/
+template <typename T>
+std::vector<ProbeRange> split_skewed_partitions(const RadixContainer<T>& radix_container) {
+  // A partition is skewed if it holds more than skew_factor times the rows of an average partition. To keep the
+  // overhead of scheduling small, ranges are not smaller than min_range_size.
+  constexpr auto skew_factor = size_t{2};
+  constexpr auto min_range_size = size_t{10'000};
+
+  const auto& partition_offsets = radix_container.partition_offsets;
+  const auto partition_count = partition_offsets.size() - 1;
+
+  auto non_empty_partition_count = size_t{0};
+  for (size_t partition_id = 0; partition_id < partition_count; ++partition_id) {
+    if (partition_offsets[partition_id + 1] > partition_offsets[partition_id]) {
+      ++non_empty_partition_count;
+    }
+  }
+
+  std::vector<ProbeRange> probe_ranges;
+  probe_ranges.reserve(partition_count);
+  if (non_empty_partition_count == 0) {
+    return probe_ranges;
+  }
+
+  const auto row_count = partition_offsets[partition_count] - partition_offsets[0];
+  const auto range_size = std::max(min_range_size, row_count / non_empty_partition_count);
+
+  for (size_t partition_id = 0; partition_id < partition_count; ++partition_id) {
+    const auto partition_begin = partition_offsets[partition_id];
+    const auto partition_end = partition_offsets[partition_id + 1];
+    const auto partition_size = partition_end - partition_begin;
+
+    if (partition_size == 0) {
+      continue;
+    }
+
+    if (partition_size <= skew_factor * range_size) {
+      probe_ranges.push_back({partition_id, partition_begin, partition_end});
+      continue;
+    }
+
+    for (auto range_begin = partition_begin; range_begin < partition_end; range_begin += range_size) {
+      probe_ranges.push_back({partition_id, range_begin, std::min(range_begin + range_size, partition_end)});
+    }
+  }
+
+  return probe_ranges;
+}
+
 /*
 Build all the hash tables for the partitions of Left. We parallelize this process for all partitions of Left
 */
@@ -212,7 +308,7 @@ std::shared_ptr<Partition<T>> materialize_input(const std::shared_ptr<const Tabl
   // fan-out
   const size_t num_partitions = 1ull << radix_bits;
 
-  // currently, we just do one pass
+  // this is the first pass, a second one is done by partition_radix_second_pass() if necessary
   size_t pass = 0;
   size_t mask = static_cast<uint32_t>(pow(2, radix_bits * (pass + 1)) - 1);
 
@@ -292,7 +388,7 @@ RadixContainer<T> partition_radix_parallel(const std::shared_ptr<Partition<T>>&
   // fan-out
   const size_t num_partitions = 1ull << radix_bits;
 
-  // currently, we just do one pass
+  // this is the first pass, a second one is done by partition_radix_second_pass() if necessary
   size_t pass = 0;
   size_t mask = static_cast<uint32_t>(pow(2, radix_bits * (pass + 1)) - 1);
 
@@ -354,17 +450,91 @@ RadixContainer<T> partition_radix_parallel(const std::shared_ptr<Partition<T>>&
   return radix_output;
 }
 
+/*
+A partitioning pass writes to one output location per partition. If there are more partitions than the TLB has entries,
+most of these writes cause a TLB miss. Thus, large fan-outs are split into two passes: The first pass partitions on the
+lower bits of the hash (see partition_radix_parallel). The second pass refines each of these partitions on the next
+bits, so that partition p of the first pass becomes the partitions p * 2^second_pass_radix_bits to
+(p + 1) * 2^second_pass_radix_bits - 1. As both relations are partitioned in the same way, equal values still end up in
+partitions with the same index. Each partition of the first pass is refined by its own job.
+*/
+template <typename T>
+RadixContainer<T> partition_radix_second_pass(const RadixContainer<T>& first_pass_output,
+                                              const size_t first_pass_radix_bits, const size_t second_pass_radix_bits) {
+  const auto first_pass_partition_count = first_pass_output.partition_offsets.size() - 1;
+
+  // fan-out of this pass
+  const size_t num_partitions = 1ull << second_pass_radix_bits;
+  const Hash mask = static_cast<Hash>(num_partitions - 1);
+
+  // allocate new (shared) output
+  auto output = std::make_shared<Partition<T>>();
+  output->resize(first_pass_output.elements->size());
+
+  RadixContainer<T> radix_output;
+  radix_output.elements = output;
+  radix_output.partition_offsets.resize(first_pass_partition_count * num_partitions + 1);
+  radix_output.partition_offsets.back() = first_pass_output.partition_offsets.back();
+
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  jobs.reserve(first_pass_partition_count);
+
+  for (size_t first_pass_partition_id = 0; first_pass_partition_id < first_pass_partition_count;
+       ++first_pass_partition_id) {
+    const auto partition_begin = first_pass_output.partition_offsets[first_pass_partition_id];
+    const auto partition_end = first_pass_output.partition_offsets[first_pass_partition_id + 1];
+    const auto output_partition_offsets =
+        radix_output.partition_offsets.begin() + first_pass_partition_id * num_partitions;
+
+    // Empty partitions of the first pass only result in empty partitions
+    if (partition_begin == partition_end) {
+      std::fill(output_partition_offsets, output_partition_offsets + num_partitions, partition_begin);
+      continue;
+    }
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition_begin, partition_end, output_partition_offsets]() {
+      const auto& input = *first_pass_output.elements;
+      auto& out = *output;
+
+      // Create the histogram of this partition and use it to calculate the offsets of the refined partitions
+      std::vector<size_t> output_offsets(num_partitions);
+      for (auto input_offset = partition_begin; input_offset < partition_end; ++input_offset) {
+        ++output_offsets[(input[input_offset].partition_hash >> first_pass_radix_bits) & mask];
+      }
+
+      auto offset = partition_begin;
+      for (size_t partition_id = 0; partition_id < num_partitions; ++partition_id) {
+        const auto partition_size = output_offsets[partition_id];
+        output_partition_offsets[partition_id] = offset;
+        output_offsets[partition_id] = offset;
+        offset += partition_size;
+      }
+
+      for (auto input_offset = partition_begin; input_offset < partition_end; ++input_offset) {
+        const auto& element = input[input_offset];
+        out[output_offsets[(element.partition_hash >> first_pass_radix_bits) & mask]++] = element;
+      }
+    }));
+    jobs.back()->schedule();
+  }
+
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  return radix_output;
+}
+
 /*
   In the probe phase we take all partitions from the right partition, iterate over them and compare each join candidate
   with the values in the hash table. Since Left and Right are hashed using the same hash function, we can reduce the
   number of hash tables that need to be looked into to just 1.
+  Each probe range (see split_skewed_partitions) is probed by its own job and writes to the pos lists of the same index.
   */
 template <typename RightType, typename HashedType>
-void probe(const RadixContainer<RightType>& radix_container,
+void probe(const RadixContainer<RightType>& radix_container, const std::vector<ProbeRange>& probe_ranges,
            const std::vector<std::optional<HashTable<HashedType>>>& hashtables, std::vector<PosList>& pos_lists_left,
            std::vector<PosList>& pos_lists_right, const JoinMode mode) {
   std::vector<std::shared_ptr<AbstractTask>> jobs;
-  jobs.reserve(radix_container.partition_offsets.size() - 1);
+  jobs.reserve(probe_ranges.size());
 
   /*
     NUMA notes:
@@ -374,17 +544,13 @@ void probe(const RadixContainer<RightType>& radix_container,
     and the job that probes that partition should also be on that NUMA node.
     */
 
-  for (size_t current_partition_id = 0; current_partition_id < (radix_container.partition_offsets.size() - 1);
-       ++current_partition_id) {
-    const auto partition_begin = radix_container.partition_offsets[current_partition_id];
-    const auto partition_end = radix_container.partition_offsets[current_partition_id + 1];
+  for (size_t probe_range_id = 0; probe_range_id < probe_ranges.size(); ++probe_range_id) {
+    const auto current_partition_id = probe_ranges[probe_range_id].partition_id;
+    const auto partition_begin = probe_ranges[probe_range_id].begin;
+    const auto partition_end = probe_ranges[probe_range_id].end;
 
-    // Skip empty partitions to avoid empty output chunks
-    if (partition_begin == partition_end) {
-      continue;
-    }
-
-    jobs.emplace_back(std::make_shared<JobTask>([&, partition_begin, partition_end, current_partition_id]() {
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition_begin, partition_end, current_partition_id,
+                                                 probe_range_id]() {
       // Get information from work queue
       auto& partition = static_cast<Partition<RightType>&>(*radix_container.elements);
       PosList pos_list_left_local;
@@ -455,8 +621,8 @@ void probe(const RadixContainer<RightType>& radix_container,
       }
 
       if (!pos_list_left_local.empty()) {
-        pos_lists_left[current_partition_id] = std::move(pos_list_left_local);
-        pos_lists_right[current_partition_id] = std::move(pos_list_right_local);
+        pos_lists_left[probe_range_id] = std::move(pos_list_left_local);
+        pos_lists_right[probe_range_id] = std::move(pos_list_right_local);
       }
     }));
     jobs.back()->schedule();
@@ -466,23 +632,19 @@ void probe(const RadixContainer<RightType>& radix_container,
 }
 
 template <typename RightType, typename HashedType>
-void probe_semi_anti(const RadixContainer<RightType>& radix_container,
+void probe_semi_anti(const RadixContainer<RightType>& radix_container, const std::vector<ProbeRange>& probe_ranges,
                      const std::vector<std::optional<HashTable<HashedType>>>& hashtables,
                      std::vector<PosList>& pos_lists, const JoinMode mode) {
   std::vector<std::shared_ptr<AbstractTask>> jobs;
-  jobs.reserve(radix_container.partition_offsets.size() - 1);
+  jobs.reserve(probe_ranges.size());
 
-  for (size_t current_partition_id = 0; current_partition_id < (radix_container.partition_offsets.size() - 1);
-       ++current_partition_id) {
-    const auto partition_begin = radix_container.partition_offsets[current_partition_id];
-    const auto partition_end = radix_container.partition_offsets[current_partition_id + 1];
+  for (size_t probe_range_id = 0; probe_range_id < probe_ranges.size(); ++probe_range_id) {
+    const auto current_partition_id = probe_ranges[probe_range_id].partition_id;
+    const auto partition_begin = probe_ranges[probe_range_id].begin;
+    const auto partition_end = probe_ranges[probe_range_id].end;
 
-    // Skip empty partitions to avoid empty output chunks
-    if (partition_begin == partition_end) {
-      continue;
-    }
-
-    jobs.emplace_back(std::make_shared<JobTask>([&, partition_begin, partition_end, current_partition_id]() {
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition_begin, partition_end, current_partition_id,
+                                                 probe_range_id]() {
       // Get information from work queue
       auto& partition = static_cast<Partition<RightType>&>(*radix_container.elements);
 
@@ -517,7 +679,7 @@ void probe_semi_anti(const RadixContainer<RightType>& radix_container,
       }
 
       if (!pos_list_local.empty()) {
-        pos_lists[current_partition_id] = std::move(pos_list_local);
+        pos_lists[probe_range_id] = std::move(pos_list_local);
       }
     }));
     jobs.back()->schedule();
@@ -527,44 +689,55 @@ void probe_semi_anti(const RadixContainer<RightType>& radix_container,
 }
 
 using PosLists = std::vector<std::shared_ptr<const PosList>>;
-using PosListsByColumn = std::vector<std::shared_ptr<PosLists>>;
+
+/*
+The columns of a reference table often reference the same pos lists in every chunk (e.g., all columns that stem from
+the same input of an earlier join). The join output only needs one resolved pos list per group of such columns, which
+is shared by the ReferenceColumns of all columns in the group.
+The groups are determined once per input table, so that writing an output chunk only needs to look up the group of a
+column by its index.
+*/
+struct ReferencedPosLists {
+  // The index of the group of each column
+  std::vector<size_t> group_by_column;
+  // The pos lists of each group, one per chunk of the input table
+  std::vector<PosLists> pos_lists_by_group;
+};
 
 // See usage in _on_execute() for doc.
-PosListsByColumn setup_pos_lists_by_column(const std::shared_ptr<const Table>& input_table) {
+ReferencedPosLists group_referenced_pos_lists(const std::shared_ptr<const Table>& input_table) {
   DebugAssert(input_table->type() == TableType::References, "Function only works for reference tables");
 
-  std::map<PosLists, std::shared_ptr<PosLists>> shared_pos_lists_by_pos_lists;
-
-  PosListsByColumn pos_lists_by_column(input_table->column_count());
-  auto pos_lists_by_column_it = pos_lists_by_column.begin();
+  ReferencedPosLists referenced_pos_lists;
+  referenced_pos_lists.group_by_column.reserve(input_table->column_count());
 
   const auto& input_chunks = input_table->chunks();
 
   for (ColumnID column_id{0}; column_id < input_table->column_count(); ++column_id) {
     // Get all the input pos lists so that we only have to pointer cast the columns once
-    auto pos_list_ptrs = std::make_shared<PosLists>(input_table->chunk_count());
-    auto pos_lists_iter = pos_list_ptrs->begin();
-
+    auto pos_lists = PosLists(input_table->chunk_count());
     for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); chunk_id++) {
       const auto& ref_column_uncasted = input_chunks[chunk_id]->columns()[column_id];
-      const auto ref_column = std::static_pointer_cast<const ReferenceColumn>(ref_column_uncasted);
-      *pos_lists_iter = ref_column->pos_list();
-      ++pos_lists_iter;
+      pos_lists[chunk_id] = std::static_pointer_cast<const ReferenceColumn>(ref_column_uncasted)->pos_list();
     }
 
-    auto iter = shared_pos_lists_by_pos_lists.emplace(*pos_list_ptrs, pos_list_ptrs).first;
-
-    *pos_lists_by_column_it = iter->second;
-    ++pos_lists_by_column_it;
+    // There are usually only a few groups. Comparing the pos lists of different groups usually stops at the first
+    // chunk, so a linear search is cheaper than a map.
+    auto& pos_lists_by_group = referenced_pos_lists.pos_lists_by_group;
+    const auto group_it = std::find(pos_lists_by_group.cbegin(), pos_lists_by_group.cend(), pos_lists);
+    referenced_pos_lists.group_by_column.emplace_back(std::distance(pos_lists_by_group.cbegin(), group_it));
+    if (group_it == pos_lists_by_group.cend()) {
+      pos_lists_by_group.emplace_back(std::move(pos_lists));
+    }
   }
 
-  return pos_lists_by_column;
+  return referenced_pos_lists;
 }
 
 void write_output_columns(ChunkColumns& output_columns, const std::shared_ptr<const Table>& input_table,
-                          const PosListsByColumn& input_pos_list_ptrs_sptrs_by_column,
-                          std::shared_ptr<PosList> pos_list) {
-  std::map<std::shared_ptr<PosLists>, std::shared_ptr<PosList>> output_pos_list_cache;
+                          const ReferencedPosLists& referenced_pos_lists, std::shared_ptr<PosList> pos_list) {
+  // The pos list of a group is resolved when the first column of the group is written
+  std::vector<std::shared_ptr<PosList>> resolved_pos_lists(referenced_pos_lists.pos_lists_by_group.size());
 
   // We might use this later, but want to have it outside of the for loop
   std::shared_ptr<Table> dummy_table;
@@ -573,31 +746,29 @@ void write_output_columns(ChunkColumns& output_columns, const std::shared_ptr<co
   for (ColumnID column_id{0}; column_id < input_table->column_count(); ++column_id) {
     if (input_table->type() == TableType::References) {
       if (input_table->chunk_count() > 0) {
-        std::shared_ptr<BaseColumn> column;
-        const auto& input_table_pos_lists = input_pos_list_ptrs_sptrs_by_column[column_id];
+        const auto group = referenced_pos_lists.group_by_column[column_id];
+        auto& resolved_pos_list = resolved_pos_lists[group];
 
-        auto iter = output_pos_list_cache.find(input_table_pos_lists);
-        if (iter == output_pos_list_cache.end()) {
+        if (!resolved_pos_list) {
           // Get the row ids that are referenced
-          auto new_pos_list = std::make_shared<PosList>(pos_list->size());
-          auto new_pos_list_iter = new_pos_list->begin();
+          const auto& input_table_pos_lists = referenced_pos_lists.pos_lists_by_group[group];
+          resolved_pos_list = std::make_shared<PosList>(pos_list->size());
+          auto resolved_pos_list_iter = resolved_pos_list->begin();
           for (const auto& row : *pos_list) {
             if (row.chunk_offset == INVALID_CHUNK_OFFSET) {
-              *new_pos_list_iter = row;
+              *resolved_pos_list_iter = row;
             } else {
-              const auto& referenced_pos_list = *(*input_table_pos_lists)[row.chunk_id];
-              *new_pos_list_iter = referenced_pos_list[row.chunk_offset];
+              const auto& referenced_pos_list = *input_table_pos_lists[row.chunk_id];
+              *resolved_pos_list_iter = referenced_pos_list[row.chunk_offset];
             }
-            ++new_pos_list_iter;
+            ++resolved_pos_list_iter;
           }
-
-          iter = output_pos_list_cache.emplace(input_table_pos_lists, new_pos_list).first;
         }
 
         auto ref_col =
             std::static_pointer_cast<const ReferenceColumn>(input_table->get_chunk(ChunkID{0})->get_column(column_id));
         output_columns.push_back(std::make_shared<ReferenceColumn>(ref_col->referenced_table(),
-                                                                   ref_col->referenced_column_id(), iter->second));
+                                                                   ref_col->referenced_column_id(), resolved_pos_list));
       } else {
         // If there are no Chunks in the input_table, we can't deduce the Table that input_table is referencING to
         // pos_list will contain only NULL_ROW_IDs anyway, so it doesn't matter which Table the ReferenceColumn that
@@ -618,25 +789,16 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
   JoinHashImpl(const std::shared_ptr<const AbstractOperator>& left,
                const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
                const ColumnIDPair& column_ids, const PredicateCondition predicate_condition, const bool inputs_swapped,
-               const size_t radix_bits)
+               const std::optional<size_t>& radix_bits, const std::shared_ptr<const Table>& left_key_table,
+               const std::shared_ptr<const Table>& right_key_table)
       : _left(left),
         _right(right),
         _mode(mode),
         _column_ids(column_ids),
         _predicate_condition(predicate_condition),
-        _inputs_swapped(inputs_swapped) {
-    /*
-      Setting number of bits for radix clustering:
-      The number of bits is used to create probe partitions with a size that can
-      be expected to fit into the L2 cache.
-      This should incorporate hardware knowledge, once available in Hyrise.
-      As of now, we assume a L2 cache size of 256 KB.
-      We estimate the size the following way:
-        - we assume each key appears once (that is an overestimation space-wise, but we
-        aim rather for a hash map that is slightly smaller than L2 than slightly larger)
-        - each entry in the hash map is a data structure holding the actual value
-        and the RowID
-    */
+        _inputs_swapped(inputs_swapped),
+        _left_key_table(left_key_table),
+        _right_key_table(right_key_table) {
     const auto build_relation_size = _left->get_output()->row_count();
     const auto probe_relation_size = _right->get_output()->row_count();
 
@@ -651,21 +813,38 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
       PerformanceWarning(warning);
     }
 
-    const auto l2_cache_size = 256'000;  // bytes
+    if (radix_bits) {
+      _radix_bits = *radix_bits;
+    } else {
+      /*
+        Setting number of bits for radix clustering:
+        The number of bits is used to create probe partitions with a size that can
+        be expected to fit into the L2 cache, whose size is detected by the Topology.
+        We estimate the size the following way:
+          - we assume each key appears once (that is an overestimation space-wise, but we
+          aim rather for a hash map that is slightly smaller than L2 than slightly larger)
+          - each entry in the hash map is a data structure holding the actual value
+          and the RowID
+      */
+      const auto l2_cache_size = Topology::get().l2_cache_size();  // bytes
 
-    // We assume an std::unordered_map with a linked list within the buckets.
-    // To get a pessimistic estimation (ensure that the hash table fits within the cache), we assume
-    // that each value maps to two RowIDs (thus, no single value optimizatio via boost::variant).
-    const auto complete_hash_map_size =
-        // hash map
-        build_relation_size * (sizeof(LeftType) + sizeof(void*)) +
-        // PosLists
-        (build_relation_size / 2) * (sizeof(PosList) + 2 * sizeof(RowID));
+      // We assume an std::unordered_map with a linked list within the buckets.
+      // To get a pessimistic estimation (ensure that the hash table fits within the cache), we assume
+      // that each value maps to two RowIDs (thus, no single value optimizatio via boost::variant).
+      const auto complete_hash_map_size =
+          // hash map
+          build_relation_size * (sizeof(LeftType) + sizeof(void*)) +
+          // PosLists
+          (build_relation_size / 2) * (sizeof(PosList) + 2 * sizeof(RowID));
 
-    const auto adaption_factor = 2.0f;  // don't occupy the whole L2 cache
-    const auto cluster_count = std::max(1.0f, (adaption_factor * complete_hash_map_size) / l2_cache_size);
+      const auto adaption_factor = 2.0f;  // don't occupy the whole L2 cache
+      const auto cluster_count = std::max(1.0f, (adaption_factor * complete_hash_map_size) / l2_cache_size);
 
-    _radix_bits = std::ceil(std::log2(cluster_count));
+      _radix_bits = std::ceil(std::log2(cluster_count));
+    }
+
+    // At most two passes are done (see partition_radix_second_pass)
+    _radix_bits = std::min(_radix_bits, 2 * MAX_RADIX_BITS_PER_PASS);
   }
 
  protected:
@@ -675,11 +854,19 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
   const PredicateCondition _predicate_condition;
   const bool _inputs_swapped;
 
+  // The composite keys of multi-column joins (see create_composite_key_tables()). If they are set, they are joined
+  // instead of the columns in _column_ids.
+  const std::shared_ptr<const Table> _left_key_table, _right_key_table;
+
   std::shared_ptr<Table> _output_table;
 
   const unsigned int _partitioning_seed = 17;
   size_t _radix_bits;
 
+  // The fan-out of a single partitioning pass is limited, so that each output location of the pass can be expected to
+  // have an entry in the TLB. If more radix bits are needed, the partitioning is done in two passes.
+  static constexpr size_t MAX_RADIX_BITS_PER_PASS = 8;
+
   // Determine correct type for hashing
   using HashedType = typename JoinHashTraits<LeftType, RightType>::HashType;
 
@@ -748,12 +935,23 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     However, it would be a good idea to keep each materialized vector on one node if possible.
     This helps choosing a scheduler node for the radix phase (see below).
     */
+    // The histograms of the materialization are used by the first partitioning pass
+    const auto first_pass_radix_bits = std::min(_radix_bits, MAX_RADIX_BITS_PER_PASS);
+    const auto second_pass_radix_bits = _radix_bits - first_pass_radix_bits;
+
+    // The RowIDs of the key tables are the same as those of the input tables, so that the join result can reference
+    // the input tables.
+    const auto left_key_table = _left_key_table ? _left_key_table : left_in_table;
+    const auto right_key_table = _right_key_table ? _right_key_table : right_in_table;
+    const auto left_key_column_id = _left_key_table ? ColumnID{0} : _column_ids.first;
+    const auto right_key_column_id = _right_key_table ? ColumnID{0} : _column_ids.second;
+
     // Scheduler note: parallelize this at some point. Currently, the amount of jobs would be too high
-    auto materialized_left = materialize_input<LeftType, HashedType>(left_in_table, _column_ids.first, histograms_left,
-                                                                     _radix_bits, _partitioning_seed);
+    auto materialized_left = materialize_input<LeftType, HashedType>(
+        left_key_table, left_key_column_id, histograms_left, first_pass_radix_bits, _partitioning_seed);
     // 'keep_nulls' makes sure that the relation on the right materializes NULL values when executing an OUTER join.
     auto materialized_right = materialize_input<RightType, HashedType>(
-        right_in_table, _column_ids.second, histograms_right, _radix_bits, _partitioning_seed, keep_nulls);
+        right_key_table, right_key_column_id, histograms_right, first_pass_radix_bits, _partitioning_seed, keep_nulls);
 
     // Radix Partitioning phase
     /*
@@ -766,27 +964,35 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     partitions leftB and leftB should also be on the same node.
     */
     // Scheduler note: parallelize this at some point. Currently, the amount of jobs would be too high
-    auto radix_left =
-        partition_radix_parallel<LeftType>(materialized_left, left_chunk_offsets, histograms_left, _radix_bits);
+    auto radix_left = partition_radix_parallel<LeftType>(materialized_left, left_chunk_offsets, histograms_left,
+                                                         first_pass_radix_bits);
     // 'keep_nulls' makes sure that the relation on the right keeps NULL values when executing an OUTER join.
     auto radix_right = partition_radix_parallel<RightType>(materialized_right, right_chunk_offsets, histograms_right,
-                                                           _radix_bits, keep_nulls);
+                                                           first_pass_radix_bits, keep_nulls);
+
+    if (second_pass_radix_bits > 0) {
+      radix_left = partition_radix_second_pass(radix_left, first_pass_radix_bits, second_pass_radix_bits);
+      radix_right = partition_radix_second_pass(radix_right, first_pass_radix_bits, second_pass_radix_bits);
+    }
 
     // Build phase
     auto hashtables = build<LeftType, HashedType>(radix_left);
 
     // Probe phase
+    // Skewed partitions of the probe relation are split, so that they are probed by multiple jobs
+    const auto probe_ranges = split_skewed_partitions<RightType>(radix_right);
+
     std::vector<PosList> left_pos_lists;
     std::vector<PosList> right_pos_lists;
-    const size_t partition_count = radix_right.partition_offsets.size() - 1;
-    left_pos_lists.resize(partition_count);
-    right_pos_lists.resize(partition_count);
-    for (size_t i = 0; i < partition_count; i++) {
-      // simple heuristic: half of the rows of the right relation will match
-      const size_t result_rows_per_partition = _right->get_output()->row_count() / partition_count / 2;
-
-      left_pos_lists[i].reserve(result_rows_per_partition);
-      right_pos_lists[i].reserve(result_rows_per_partition);
+    const size_t probe_range_count = probe_ranges.size();
+    left_pos_lists.resize(probe_range_count);
+    right_pos_lists.resize(probe_range_count);
+    for (size_t i = 0; i < probe_range_count; i++) {
+      // simple heuristic: half of the rows of the probe range will match
+      const size_t result_rows_per_probe_range = (probe_ranges[i].end - probe_ranges[i].begin) / 2;
+
+      left_pos_lists[i].reserve(result_rows_per_probe_range);
+      right_pos_lists[i].reserve(result_rows_per_probe_range);
     }
     /*
     NUMA notes:
@@ -794,43 +1000,43 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     leftP, rightP and hashtableP.
     */
     if (_mode == JoinMode::Semi || _mode == JoinMode::Anti) {
-      probe_semi_anti<RightType, HashedType>(radix_right, hashtables, right_pos_lists, _mode);
+      probe_semi_anti<RightType, HashedType>(radix_right, probe_ranges, hashtables, right_pos_lists, _mode);
     } else {
-      probe<RightType, HashedType>(radix_right, hashtables, left_pos_lists, right_pos_lists, _mode);
+      probe<RightType, HashedType>(radix_right, probe_ranges, hashtables, left_pos_lists, right_pos_lists, _mode);
     }
 
     auto only_output_right_input = _inputs_swapped && (_mode == JoinMode::Semi || _mode == JoinMode::Anti);
 
     /**
-     * Two Caches to avoid redundant reference materialization for Reference input tables. As there might be
-     *  quite a lot Partitions (>500 seen), input Chunks (>500 seen), and columns (>50 seen), this speeds up
-     *  write_output_chunks a lot.
+     * The groups of columns that reference the same pos lists (see ReferencedPosLists) avoid redundant reference
+     *  materialization for Reference input tables. As there might be quite a lot Partitions (>500 seen), input Chunks
+     *  (>500 seen), and columns (>50 seen), this speeds up write_output_chunks a lot.
      *
      * They do two things:
      *      - Make it possible to re-use output pos lists if two columns in the input table have exactly the same
      *          PosLists Chunk by Chunk
-     *      - Avoid creating the std::vector<const PosList*> for each Partition over and over again.
+     *      - Avoid collecting the input pos lists of each column for each Partition over and over again.
      *
-     * They hold one entry per column in the table, not per BaseColumn in a single chunk
+     * The groups are determined once per table, not per BaseColumn in a single chunk
      */
-    PosListsByColumn left_pos_lists_by_column;
-    PosListsByColumn right_pos_lists_by_column;
+    ReferencedPosLists left_referenced_pos_lists;
+    ReferencedPosLists right_referenced_pos_lists;
 
-    // left_pos_lists_by_column will only be needed if left is a reference table and being output
+    // left_referenced_pos_lists will only be needed if left is a reference table and being output
     if (left_in_table->type() == TableType::References && !only_output_right_input) {
-      left_pos_lists_by_column = setup_pos_lists_by_column(left_in_table);
+      left_referenced_pos_lists = group_referenced_pos_lists(left_in_table);
     }
 
-    // right_pos_lists_by_column will only be needed if right is a reference table
+    // right_referenced_pos_lists will only be needed if right is a reference table
     if (right_in_table->type() == TableType::References) {
-      right_pos_lists_by_column = setup_pos_lists_by_column(right_in_table);
+      right_referenced_pos_lists = group_referenced_pos_lists(right_in_table);
     }
 
-    for (size_t partition_id = 0; partition_id < left_pos_lists.size(); ++partition_id) {
+    for (size_t probe_range_id = 0; probe_range_id < left_pos_lists.size(); ++probe_range_id) {
       // moving the values into a shared pos list saves us some work in write_output_columns. We know that
       // left_pos_lists and right_pos_lists will not be used again.
-      auto left = std::make_shared<PosList>(std::move(left_pos_lists[partition_id]));
-      auto right = std::make_shared<PosList>(std::move(right_pos_lists[partition_id]));
+      auto left = std::make_shared<PosList>(std::move(left_pos_lists[probe_range_id]));
+      auto right = std::make_shared<PosList>(std::move(right_pos_lists[probe_range_id]));
 
       if (left->empty() && right->empty()) {
         continue;
@@ -840,15 +1046,15 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
 
       // we need to swap back the inputs, so that the order of the output columns is not harmed
       if (_inputs_swapped) {
-        write_output_columns(output_columns, right_in_table, right_pos_lists_by_column, right);
+        write_output_columns(output_columns, right_in_table, right_referenced_pos_lists, right);
 
         // Semi/Anti joins are always swapped but do not need the outer relation
         if (!only_output_right_input) {
-          write_output_columns(output_columns, left_in_table, left_pos_lists_by_column, left);
+          write_output_columns(output_columns, left_in_table, left_referenced_pos_lists, left);
         }
       } else {
-        write_output_columns(output_columns, left_in_table, left_pos_lists_by_column, left);
-        write_output_columns(output_columns, right_in_table, right_pos_lists_by_column, right);
+        write_output_columns(output_columns, left_in_table, left_referenced_pos_lists, left);
+        write_output_columns(output_columns, right_in_table, right_referenced_pos_lists, right);
       }
 
       _output_table->append_chunk(output_columns);
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -14,20 +15,31 @@ namespace opossum {
 /**
  * This operator joins two tables using one column of each table.
  * The output is a new table with referenced columns for all columns of the two inputs and filtered pos_lists.
- * If you want to filter by multiple criteria, you can chain this operator.
+ * Further equality conditions between the two tables can be passed as additional_column_ids. In that case, the join
+ * columns are combined into a single composite key per row (see create_composite_key_tables()), which is hashed and
+ * compared instead of the first column pair. Thus, rows that only match on some of the columns are dropped while
+ * probing instead of being filtered from the join result.
  *
  * As with most operators, we do not guarantee a stable operation with regards to positions -
  * i.e., your sorting order might be disturbed.
  *
  * Find more information in our Wiki: https://github.com/hyrise/hyrise/wiki/Radix-Partitioned-and-Hash-Based-Join
+ *
+ * If radix_bits is not given, the number of radix bits is chosen based on the size of the build relation, so that the
+ * hash table of each partition fits into the L2 cache (see Topology::l2_cache_size()). Large fan-outs are partitioned
+ * in two passes.
  */
 class JoinHash : public AbstractJoinOperator {
  public:
   JoinHash(const std::shared_ptr<const AbstractOperator>& left, const std::shared_ptr<const AbstractOperator>& right,
            const JoinMode mode, const ColumnIDPair& column_ids, const PredicateCondition predicate_condition,
-           const size_t radix_bits = 9);
+           const std::vector<ColumnIDPair>& additional_column_ids = {},
+           const std::optional<size_t>& radix_bits = std::nullopt);
 
   const std::string name() const override;
+  const std::string description(DescriptionMode description_mode) const override;
+
+  const std::vector<ColumnIDPair>& additional_column_ids() const;
 
  protected:
   std::shared_ptr<const Table> _on_execute() override;
@@ -38,7 +50,8 @@ class JoinHash : public AbstractJoinOperator {
   void _on_cleanup() override;
 
   std::unique_ptr<AbstractReadOnlyOperatorImpl> _impl;
-  const size_t _radix_bits;
+  const std::vector<ColumnIDPair> _additional_column_ids;
+  const std::optional<size_t> _radix_bits;
 
   template <typename LeftType, typename RightType>
   class JoinHashImpl;
@@ -0,0 +1,198 @@
+#include "composite_key.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/create_iterable_from_column.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// The keys of one input, i.e., the values and NULL flags of each chunk
+template <typename KeyType>
+struct KeyChunks {
+  explicit KeyChunks(const Table& table) : values(table.chunk_count()), null_values(table.chunk_count()) {
+    for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto chunk_size = table.get_chunk(chunk_id)->size();
+      values[chunk_id].resize(chunk_size);
+      null_values[chunk_id].resize(chunk_size);
+    }
+  }
+
+  std::shared_ptr<const Table> to_table() {
+    const auto data_type = std::is_same_v<KeyType, std::string> ? DataType::String : DataType::Long;
+    const auto table = std::make_shared<Table>(TableColumnDefinitions{{"key", data_type, true}}, TableType::Data);
+
+    for (ChunkID chunk_id{0}; chunk_id < values.size(); ++chunk_id) {
+      table->append_chunk(
+          {std::make_shared<ValueColumn<KeyType>>(std::move(values[chunk_id]), std::move(null_values[chunk_id]))});
+    }
+
+    return table;
+  }
+
+  std::vector<pmr_concurrent_vector<KeyType>> values;
+  std::vector<pmr_concurrent_vector<bool>> null_values;
+};
+
+// Calls functor(chunk_id, chunk_offset, is_null, value) for each row of a column, with the value converted to T. The
+// chunk_offset is the position in the column, which for ReferenceColumns is not the offset in the referenced column.
+template <typename T, typename Functor>
+void for_each_key_value(const Table& table, const ColumnID column_id, const Functor& functor) {
+  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto column = table.get_chunk(chunk_id)->get_column(column_id);
+
+    resolve_data_and_column_type(*column, [&](auto type, auto& typed_column) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      // clang-format off
+      if constexpr (std::is_same_v<ColumnDataType, std::string> != std::is_same_v<T, std::string>) {
+        Fail("Cannot join string and numeric columns");
+      } else {
+        auto chunk_offset = ChunkOffset{0};
+        create_iterable_from_column<ColumnDataType>(typed_column).for_each([&](const auto& value) {
+          functor(chunk_id, chunk_offset++, value.is_null(), static_cast<T>(value.value()));
+        });
+      }
+      // clang-format on
+    });
+  }
+}
+
+bool is_integral(const DataType data_type) { return data_type == DataType::Int || data_type == DataType::Long; }
+
+// Packs the values of all key columns into Long keys. Returns std::nullopt if the normalized values need more than 64
+// bits.
+std::optional<std::pair<std::shared_ptr<const Table>, std::shared_ptr<const Table>>> pack_keys(
+    const Table& left, const Table& right, const std::vector<ColumnIDPair>& column_ids) {
+  std::vector<uint64_t> minimums;
+  std::vector<size_t> shifts;
+  std::vector<size_t> column_bit_counts;
+  auto bit_count = size_t{0};
+
+  for (const auto& [left_column_id, right_column_id] : column_ids) {
+    auto minimum = std::numeric_limits<int64_t>::max();
+    auto maximum = std::numeric_limits<int64_t>::min();
+    const auto update_range = [&](const ChunkID, const ChunkOffset, const bool is_null, const int64_t value) {
+      if (is_null) return;
+      minimum = std::min(minimum, value);
+      maximum = std::max(maximum, value);
+    };
+    for_each_key_value<int64_t>(left, left_column_id, update_range);
+    for_each_key_value<int64_t>(right, right_column_id, update_range);
+
+    // Columns without non-NULL values don't need any bits, as all of their keys are NULL
+    const auto range = minimum <= maximum ? static_cast<uint64_t>(maximum) - static_cast<uint64_t>(minimum) : 0;
+    auto column_bit_count = size_t{0};
+    while (column_bit_count < 64 && (range >> column_bit_count) != 0) ++column_bit_count;
+
+    minimums.emplace_back(static_cast<uint64_t>(minimum));
+    shifts.emplace_back(bit_count);
+    column_bit_counts.emplace_back(column_bit_count);
+    bit_count += column_bit_count;
+    if (bit_count > 64) return std::nullopt;
+  }
+
+  const auto pack = [&](const Table& table, const auto get_column_id) {
+    auto key_chunks = KeyChunks<int64_t>{table};
+
+    for (size_t key_column_id = 0; key_column_id < column_ids.size(); ++key_column_id) {
+      const auto minimum = minimums[key_column_id];
+      const auto shift = shifts[key_column_id];
+      const auto column_bit_count = column_bit_counts[key_column_id];
+      for_each_key_value<int64_t>(table, get_column_id(column_ids[key_column_id]),
+                                  [&](const ChunkID chunk_id, const ChunkOffset chunk_offset, const bool is_null,
+                                      const int64_t value) {
+                                    if (is_null) {
+                                      key_chunks.null_values[chunk_id][chunk_offset] = true;
+                                      return;
+                                    }
+                                    // All non-NULL values of a zero-width column are equal. Its shift may be 64, so
+                                    // shifting by it would be undefined.
+                                    if (column_bit_count == 0) return;
+                                    auto& key = key_chunks.values[chunk_id][chunk_offset];
+                                    key = static_cast<int64_t>(static_cast<uint64_t>(key) |
+                                                               (static_cast<uint64_t>(value) - minimum) << shift);
+                                  });
+    }
+
+    return key_chunks.to_table();
+  };
+
+  return std::make_pair(pack(left, [](const auto& pair) { return pair.first; }),
+                        pack(right, [](const auto& pair) { return pair.second; }));
+}
+
+// Appends the binary representation of each value of a column (converted to T) to the String keys
+template <typename T>
+void serialize_key_column(const Table& table, const ColumnID column_id, KeyChunks<std::string>& key_chunks) {
+  for_each_key_value<T>(table, column_id, [&](const ChunkID chunk_id, const ChunkOffset chunk_offset,
+                                              const bool is_null, T value) {
+    if (is_null) {
+      key_chunks.null_values[chunk_id][chunk_offset] = true;
+      return;
+    }
+
+    auto& key = key_chunks.values[chunk_id][chunk_offset];
+    if constexpr (std::is_same_v<T, std::string>) {
+      // The length makes sure that the boundaries between strings are part of the key
+      const auto length = value.size();
+      key.append(reinterpret_cast<const char*>(&length), sizeof(length));
+      key.append(value);
+    } else {
+      // 0.0 and -0.0 are equal, but have different representations
+      if (value == 0) value = 0;
+      key.append(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+  });
+}
+
+}  // namespace
+
+std::pair<std::shared_ptr<const Table>, std::shared_ptr<const Table>> create_composite_key_tables(
+    const std::shared_ptr<const Table>& left, const std::shared_ptr<const Table>& right,
+    const std::vector<ColumnIDPair>& column_ids) {
+  DebugAssert(!column_ids.empty(), "Need at least one key column");
+
+  const auto all_integral = std::all_of(column_ids.begin(), column_ids.end(), [&](const auto& pair) {
+    return is_integral(left->column_data_type(pair.first)) && is_integral(right->column_data_type(pair.second));
+  });
+
+  if (all_integral) {
+    if (auto packed_keys = pack_keys(*left, *right, column_ids)) return *packed_keys;
+  }
+
+  auto left_key_chunks = KeyChunks<std::string>{*left};
+  auto right_key_chunks = KeyChunks<std::string>{*right};
+
+  for (const auto& [left_column_id, right_column_id] : column_ids) {
+    const auto left_data_type = left->column_data_type(left_column_id);
+    const auto right_data_type = right->column_data_type(right_column_id);
+
+    if (left_data_type == DataType::String || right_data_type == DataType::String) {
+      serialize_key_column<std::string>(*left, left_column_id, left_key_chunks);
+      serialize_key_column<std::string>(*right, right_column_id, right_key_chunks);
+    } else if (is_integral(left_data_type) && is_integral(right_data_type)) {
+      serialize_key_column<int64_t>(*left, left_column_id, left_key_chunks);
+      serialize_key_column<int64_t>(*right, right_column_id, right_key_chunks);
+    } else {
+      serialize_key_column<double>(*left, left_column_id, left_key_chunks);
+      serialize_key_column<double>(*right, right_column_id, right_key_chunks);
+    }
+  }
+
+  return {left_key_chunks.to_table(), right_key_chunks.to_table()};
+}
+
+}  // namespace opossum
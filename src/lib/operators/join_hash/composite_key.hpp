@@ -0,0 +1,33 @@
+#pragma once
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * Combines the values of multiple join columns of the two inputs of an equi join into a single key column per input,
+ * so that JoinHash can hash and compare them like a single join column. Equal tuples of the original columns result
+ * in equal keys, and a key is NULL if any of its values is NULL.
+ *
+ * If all key columns are integral, each column is normalized to the range of its values in both inputs (i.e., the
+ * minimum is subtracted). If the normalized values of all columns fit into 64 bits, they are packed into a single
+ * Long key. Otherwise, the values are serialized into a String key. Ints and Longs are serialized as Longs, Floats and
+ * Doubles (and integral columns compared with them) as Doubles.
+ *
+ * The key tables have one chunk for each chunk of their input, so that a RowID of a key table refers to the same row
+ * as in the input table (or, for reference tables, the same position in the ReferenceColumns).
+ *
+ * @param column_ids  the pairs of key columns, `.first` in the left input, `.second` in the right input
+ * @return the key tables of the left and the right input
+ */
+std::pair<std::shared_ptr<const Table>, std::shared_ptr<const Table>> create_composite_key_tables(
+    const std::shared_ptr<const Table>& left, const std::shared_ptr<const Table>& right,
+    const std::vector<ColumnIDPair>& column_ids);
+
+}  // namespace opossum
@@ -1,44 +1,71 @@
 #include "join_index.hpp"
 
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <numeric>
 #include <set>
+#include <shared_mutex>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "all_type_variant.hpp"
+#include "concurrency/transaction_context.hpp"
 #include "join_nested_loop.hpp"
 #include "resolve_type.hpp"
 #include "storage/create_iterable_from_column.hpp"
 #include "storage/index/base_index.hpp"
+#include "storage/index/primary_key/primary_key_index.hpp"
 #include "type_comparison.hpp"
 #include "utils/assert.hpp"
 #include "utils/performance_warning.hpp"
+#include "validate.hpp"
 
 namespace opossum {
 
 /*
  * This is an index join implementation. It expects to find an index on the right column.
  * It can be used for all join modes except JoinMode::Cross.
+ * For Equals joins, a PrimaryKeyIndex of the right input table on the right column(s) is preferred over chunk indexes.
+ * Joins on additional columns are only supported with a PrimaryKeyIndex.
  * For the remaining join types or if no index is found it falls back to a nested loop join.
  */
 
 JoinIndex::JoinIndex(const std::shared_ptr<const AbstractOperator>& left,
                      const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
-                     const std::pair<ColumnID, ColumnID>& column_ids, const PredicateCondition predicate_condition)
+                     const std::pair<ColumnID, ColumnID>& column_ids, const PredicateCondition predicate_condition,
+                     const std::vector<ColumnIDPair>& additional_column_ids)
     : AbstractJoinOperator(OperatorType::JoinIndex, left, right, mode, column_ids, predicate_condition,
-                           std::make_unique<JoinIndex::PerformanceData>()) {
+                           std::make_unique<JoinIndex::PerformanceData>()),
+      _additional_column_ids(additional_column_ids) {
   DebugAssert(mode != JoinMode::Cross, "Cross Join is not supported by index join.");
+  DebugAssert(_additional_column_ids.empty() || predicate_condition == PredicateCondition::Equals,
+              "Additional join columns are only supported for Equals joins.");
 }
 
 const std::string JoinIndex::name() const { return "JoinIndex"; }
 
+const std::string JoinIndex::description(DescriptionMode description_mode) const {
+  return _description_with_additional_column_ids(description_mode, _additional_column_ids);
+}
+
+const std::vector<ColumnIDPair>& JoinIndex::additional_column_ids() const { return _additional_column_ids; }
+
+void JoinIndex::set_validate_right_input(const bool validate_right_input) {
+  DebugAssert(!validate_right_input || _mode == JoinMode::Inner, "Only inner joins can validate the right input.");
+  _validate_right_input = validate_right_input;
+}
+
+bool JoinIndex::validates_right_input() const { return _validate_right_input; }
+
 std::shared_ptr<AbstractOperator> JoinIndex::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
-  return std::make_shared<JoinIndex>(copied_input_left, copied_input_right, _mode, _column_ids, _predicate_condition);
+  auto copy = std::make_shared<JoinIndex>(copied_input_left, copied_input_right, _mode, _column_ids,
+                                          _predicate_condition, _additional_column_ids);
+  copy->set_validate_right_input(_validate_right_input);
+  return copy;
 }
 
 void JoinIndex::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
@@ -101,58 +128,85 @@ void JoinIndex::_perform_join() {
 
   auto& performance_data = static_cast<PerformanceData&>(*_performance_data);
 
-  // Scan all chunks for right input
-  for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < _right_in_table->chunk_count(); ++chunk_id_right) {
-    const auto chunk_right = _right_in_table->get_chunk(chunk_id_right);
-    const auto column_right = chunk_right->get_column(_right_column_id);
-    const auto indices = chunk_right->get_indices(std::vector<ColumnID>{_right_column_id});
-    if (track_right_matches) _right_matches[chunk_id_right].resize(chunk_right->size());
-
-    std::shared_ptr<BaseIndex> index = nullptr;
+  // A PrimaryKeyIndex covers all chunks of the right input, so each left value is looked up only once
+  const auto [primary_key_index, primary_key_left_column_ids] = _right_primary_key_index();
+  Assert(primary_key_index || _additional_column_ids.empty(),
+         "JoinIndex on multiple columns requires a PrimaryKeyIndex on the right columns.");
+  if (primary_key_index) {
+    if (track_right_matches) {
+      for (ChunkID chunk_id_right{0}; chunk_id_right < _right_in_table->chunk_count(); ++chunk_id_right) {
+        _right_matches[chunk_id_right].resize(_right_in_table->get_chunk(chunk_id_right)->size());
+      }
+    }
 
-    if (!indices.empty()) {
-      // We assume the first index to be efficient for our join
-      // as we do not want to spend time on evaluating the best index inside of this join loop
-      index = indices.front();
+    for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < _left_in_table->chunk_count(); ++chunk_id_left) {
+      _join_chunk_using_primary_key_index(chunk_id_left, primary_key_left_column_ids, *primary_key_index);
     }
+    performance_data.chunks_scanned_with_index += _right_in_table->chunk_count();
+  } else {
+    // Scan all chunks for right input
+    for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < _right_in_table->chunk_count(); ++chunk_id_right) {
+      const auto chunk_right = _right_in_table->get_chunk(chunk_id_right);
+      const auto column_right = chunk_right->get_column(_right_column_id);
+      const auto indices = chunk_right->get_indices(std::vector<ColumnID>{_right_column_id});
+
+      std::shared_ptr<BaseIndex> index = nullptr;
+      auto index_lock = std::shared_lock<std::shared_mutex>{};
+
+      if (!indices.empty()) {
+        // We assume the first index to be efficient for our join
+        // as we do not want to spend time on evaluating the best index inside of this join loop
+        index = indices.front();
+
+        // Rows cannot be added to the index before the size of the chunk is read, so all chunk offsets it returns
+        // can be tracked in _right_matches
+        index_lock = index->lock_for_reading();
+      }
+
+      if (track_right_matches) _right_matches[chunk_id_right].resize(chunk_right->size());
 
-    // Scan all chunks from left input
-    if (index != nullptr) {
-      for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < _left_in_table->chunk_count(); ++chunk_id_left) {
-        const auto chunk_column_left = _left_in_table->get_chunk(chunk_id_left)->get_column(_left_column_id);
+      // Scan all chunks from left input
+      if (index != nullptr) {
+        for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < _left_in_table->chunk_count(); ++chunk_id_left) {
+          const auto chunk_column_left = _left_in_table->get_chunk(chunk_id_left)->get_column(_left_column_id);
 
-        resolve_data_and_column_type(*chunk_column_left, [&](auto left_type, auto& typed_left_column) {
-          using LeftType = typename decltype(left_type)::type;
+          resolve_data_and_column_type(*chunk_column_left, [&](auto left_type, auto& typed_left_column) {
+            using LeftType = typename decltype(left_type)::type;
 
-          auto iterable_left = create_iterable_from_column<LeftType>(typed_left_column);
+            auto iterable_left = create_iterable_from_column<LeftType>(typed_left_column);
 
-          // utilize index for join
-          iterable_left.with_iterators([&](auto left_it, auto left_end) {
-            _join_two_columns_using_index(left_it, left_end, chunk_id_left, chunk_id_right, index);
+            // utilize index for join
+            iterable_left.with_iterators([&](auto left_it, auto left_end) {
+              _join_two_columns_using_index(left_it, left_end, chunk_id_left, chunk_id_right, index);
+            });
           });
-        });
-      }
-      performance_data.chunks_scanned_with_index++;
-    } else {
-      // Fall back to NestedLoopJoin
-      const auto chunk_column_right = _right_in_table->get_chunk(chunk_id_right)->get_column(_right_column_id);
-      for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < _left_in_table->chunk_count(); ++chunk_id_left) {
-        const auto chunk_column_left = _left_in_table->get_chunk(chunk_id_left)->get_column(_left_column_id);
-        JoinNestedLoop::JoinParams params{*_pos_list_left,
-                                          *_pos_list_right,
-                                          _left_matches[chunk_id_left],
-                                          _right_matches[chunk_id_right],
-                                          track_left_matches,
-                                          track_right_matches,
-                                          _mode,
-                                          _predicate_condition};
-        JoinNestedLoop::_join_two_untyped_columns(chunk_column_left, chunk_column_right, chunk_id_left, chunk_id_right,
-                                                  params);
+        }
+        performance_data.chunks_scanned_with_index++;
+      } else {
+        // Fall back to NestedLoopJoin
+        const auto chunk_column_right = _right_in_table->get_chunk(chunk_id_right)->get_column(_right_column_id);
+        for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < _left_in_table->chunk_count(); ++chunk_id_left) {
+          const auto chunk_column_left = _left_in_table->get_chunk(chunk_id_left)->get_column(_left_column_id);
+          JoinNestedLoop::JoinParams params{*_pos_list_left,
+                                            *_pos_list_right,
+                                            _left_matches[chunk_id_left],
+                                            _right_matches[chunk_id_right],
+                                            track_left_matches,
+                                            track_right_matches,
+                                            _mode,
+                                            _predicate_condition};
+          JoinNestedLoop::_join_two_untyped_columns(chunk_column_left, chunk_column_right, chunk_id_left,
+                                                    chunk_id_right, params);
+        }
+        performance_data.chunks_scanned_without_index++;
       }
-      performance_data.chunks_scanned_without_index++;
     }
+
   }
 
+  // Unmatched rows are only added for outer joins, which do not validate the right input
+  if (_validate_right_input) _remove_invisible_right_matches();
+
   // For Full Outer and Left Join we need to add all unmatched rows for the left side
   if (_mode == JoinMode::Left || _mode == JoinMode::Outer) {
     for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < _left_in_table->chunk_count(); ++chunk_id_left) {
@@ -253,6 +307,51 @@ void JoinIndex::_join_two_columns_using_index(LeftIterator left_it, LeftIterator
   }
 }
 
+// join loop that joins a chunk of the left input with all rows of the right input, using its PrimaryKeyIndex
+void JoinIndex::_join_chunk_using_primary_key_index(const ChunkID chunk_id_left,
+                                                    const std::vector<ColumnID>& left_column_ids,
+                                                    const PrimaryKeyIndex& primary_key_index) {
+  const auto chunk_left = _left_in_table->get_chunk(chunk_id_left);
+
+  // Materialize the keys of the chunk column by column. Rows with a NULL in one of the key columns never match.
+  auto keys = std::vector<std::vector<AllTypeVariant>>(chunk_left->size());
+  auto key_is_null = std::vector<bool>(chunk_left->size());
+  for (const auto left_column_id : left_column_ids) {
+    resolve_data_and_column_type(*chunk_left->get_column(left_column_id), [&](auto left_type, auto& typed_left_column) {
+      using LeftType = typename decltype(left_type)::type;
+
+      create_iterable_from_column<LeftType>(typed_left_column).for_each([&](const auto& left_value) {
+        if (left_value.is_null()) {
+          key_is_null[left_value.chunk_offset()] = true;
+        } else {
+          keys[left_value.chunk_offset()].emplace_back(left_value.value());
+        }
+      });
+    });
+  }
+
+  for (ChunkOffset chunk_offset_left{0}; chunk_offset_left < keys.size(); ++chunk_offset_left) {
+    if (key_is_null[chunk_offset_left]) continue;
+
+    const auto right_row_ids = primary_key_index.lookup(keys[chunk_offset_left]);
+    if (right_row_ids.empty()) continue;
+
+    // Remember the matches for outer joins
+    if (_mode == JoinMode::Left || _mode == JoinMode::Outer) {
+      _left_matches[chunk_id_left][chunk_offset_left] = true;
+    }
+
+    for (const auto& right_row_id : right_row_ids) {
+      _pos_list_left->emplace_back(RowID{chunk_id_left, chunk_offset_left});
+      _pos_list_right->emplace_back(right_row_id);
+
+      if (_mode == JoinMode::Outer || _mode == JoinMode::Right) {
+        _right_matches[right_row_id.chunk_id][right_row_id.chunk_offset] = true;
+      }
+    }
+  }
+}
+
 // join loop that joins two chunks of two columns via their iterators
 template <typename BinaryFunctor, typename LeftIterator, typename RightIterator>
 void JoinIndex::_join_two_columns_nested_loop(const BinaryFunctor& func, LeftIterator left_it, LeftIterator left_end,
@@ -315,6 +414,56 @@ void JoinIndex::_append_matches(const BaseIndex::Iterator& range_begin, const Ba
   }
 }
 
+void JoinIndex::_remove_invisible_right_matches() {
+  Assert(_mode == JoinMode::Inner, "Only inner joins can validate the right input.");
+  Assert(_right_in_table->type() == TableType::Data && _right_in_table->has_mvcc() == UseMvcc::Yes,
+         "Validating the right input requires a data table with MVCC columns.");
+
+  const auto transaction_context = this->transaction_context();
+  Assert(transaction_context, "Validating the right input requires a transaction context.");
+  const auto our_tid = transaction_context->transaction_id();
+  const auto snapshot_commit_id = transaction_context->snapshot_commit_id();
+
+  auto visible_match_count = size_t{0};
+  for (auto match_idx = size_t{0}; match_idx < _pos_list_right->size(); ++match_idx) {
+    const auto right_row_id = (*_pos_list_right)[match_idx];
+    const auto mvcc_columns = _right_in_table->get_chunk(right_row_id.chunk_id)->get_scoped_mvcc_columns_lock();
+    if (!Validate::is_row_visible(our_tid, snapshot_commit_id, right_row_id.chunk_offset, *mvcc_columns)) continue;
+
+    (*_pos_list_left)[visible_match_count] = (*_pos_list_left)[match_idx];
+    (*_pos_list_right)[visible_match_count] = right_row_id;
+    ++visible_match_count;
+  }
+
+  _pos_list_left->resize(visible_match_count);
+  _pos_list_right->resize(visible_match_count);
+}
+
+std::pair<std::shared_ptr<PrimaryKeyIndex>, std::vector<ColumnID>> JoinIndex::_right_primary_key_index() const {
+  // Only the rows of a data table are covered by its PrimaryKeyIndex
+  if (_predicate_condition != PredicateCondition::Equals || _right_in_table->type() != TableType::Data) return {};
+
+  const auto primary_key_index = _right_in_table->primary_key_index();
+  if (!primary_key_index) return {};
+
+  // Each key column has to be joined with a left column
+  auto column_ids = std::vector<ColumnIDPair>{_column_ids};
+  column_ids.insert(column_ids.end(), _additional_column_ids.begin(), _additional_column_ids.end());
+
+  const auto& key_column_ids = primary_key_index->column_ids();
+  if (key_column_ids.size() != column_ids.size()) return {};
+
+  auto left_column_ids = std::vector<ColumnID>{};
+  for (const auto key_column_id : key_column_ids) {
+    const auto column_ids_iter = std::find_if(column_ids.begin(), column_ids.end(),
+                                              [&](const auto& pair) { return pair.second == key_column_id; });
+    if (column_ids_iter == column_ids.end()) return {};
+    left_column_ids.emplace_back(column_ids_iter->first);
+  }
+
+  return {primary_key_index, left_column_ids};
+}
+
 void JoinIndex::_write_output_columns(ChunkColumns& output_columns, const std::shared_ptr<const Table>& input_table,
                                       std::shared_ptr<PosList> pos_list) {
   // Add columns from table to output chunk
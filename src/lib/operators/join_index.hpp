@@ -11,21 +11,41 @@
 #include "types.hpp"
 
 namespace opossum {
+
+class PrimaryKeyIndex;
+
 /**
    * This operator joins two tables using one column of each table.
    * A speedup compared to the Nested Loop Join is achieved by avoiding the inner loop, and instead
    * finding the right values utilizing the index.
    *
-   * Note: An index needs to be present on the right table in order to execute an index join.
+   * Note: An index needs to be present on the right table in order to execute an index join. This is either a chunk
+ *       index or, for Equals joins, the PrimaryKeyIndex of the right table (see Table::create_primary_key_index()).
    * Note: Cross joins are not supported. Use the product operator instead.
+ *
+ * Further Equals conditions between the two tables can be passed as additional_column_ids, so that the join can
+ * probe a composite PrimaryKeyIndex (e.g., the (w_id, d_id, o_id) key of a TPC-C table). The right columns of all
+ * column pairs have to be the key columns of the PrimaryKeyIndex of the right table.
+ *
+ * The output of a Validate has no indexes. Thus, for an inner join with a stored table that has to be validated, the
+ * stored table itself is passed as the right input and the JoinIndex drops the matches that are not visible for its
+ * transaction (see set_validate_right_input()).
    */
 class JoinIndex : public AbstractJoinOperator {
  public:
   JoinIndex(const std::shared_ptr<const AbstractOperator>& left, const std::shared_ptr<const AbstractOperator>& right,
             const JoinMode mode, const std::pair<ColumnID, ColumnID>& column_ids,
-            const PredicateCondition predicate_condition);
+            const PredicateCondition predicate_condition, const std::vector<ColumnIDPair>& additional_column_ids = {});
 
   const std::string name() const override;
+  const std::string description(DescriptionMode description_mode) const override;
+
+  const std::vector<ColumnIDPair>& additional_column_ids() const;
+
+  // If set, matches of rows of the right input that are not visible for the transaction context are dropped. Only
+  // supported for inner joins on a data table with MVCC columns.
+  void set_validate_right_input(const bool validate_right_input);
+  bool validates_right_input() const;
 
   struct PerformanceData : public OperatorPerformanceData {
     size_t chunks_scanned_with_index{0};
@@ -53,16 +73,29 @@ class JoinIndex : public AbstractJoinOperator {
                                      RightIterator right_begin, RightIterator right_end, const ChunkID chunk_id_left,
                                      const ChunkID chunk_id_right);
 
+  void _join_chunk_using_primary_key_index(const ChunkID chunk_id_left, const std::vector<ColumnID>& left_column_ids,
+                                           const PrimaryKeyIndex& primary_key_index);
+
   void _append_matches(const BaseIndex::Iterator& range_begin, const BaseIndex::Iterator& range_end,
                        const ChunkOffset chunk_offset_left, const ChunkID chunk_id_left, const ChunkID chunk_id_right);
 
+  // The PrimaryKeyIndex of the right input table, if it can be used for this join. Its key columns are joined with
+  // the returned columns of the left input table.
+  std::pair<std::shared_ptr<PrimaryKeyIndex>, std::vector<ColumnID>> _right_primary_key_index() const;
+
   void _create_table_structure();
 
+  // Removes the matches of right rows that are not visible, see set_validate_right_input()
+  void _remove_invisible_right_matches();
+
   void _write_output_columns(ChunkColumns& output_columns, const std::shared_ptr<const Table>& input_table,
                              std::shared_ptr<PosList> pos_list);
 
   void _on_cleanup() override;
 
+  const std::vector<ColumnIDPair> _additional_column_ids;
+  bool _validate_right_input{false};
+
   std::shared_ptr<Table> _output_table;
   std::shared_ptr<const Table> _left_in_table;
   std::shared_ptr<const Table> _right_in_table;
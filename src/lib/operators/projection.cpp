@@ -4,6 +4,7 @@
 #include <functional>
 #include <memory>
 #include <numeric>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -12,6 +13,9 @@
 #include "expression/expression_utils.hpp"
 #include "expression/pqp_column_expression.hpp"
 #include "expression/value_expression.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
@@ -60,27 +64,52 @@ std::shared_ptr<const Table> Projection::_on_execute() {
       std::make_shared<Table>(column_definitions, output_table_type, input_table_left()->max_chunk_size());
 
   /**
-   * Perform the projection
+   * Perform the projection. The output chunks are appended afterwards, so that they are in the same order as the input
+   * chunks.
    */
-  for (auto chunk_id = ChunkID{0}; chunk_id < input_table_left()->chunk_count(); ++chunk_id) {
-    ChunkColumns output_columns;
+  const auto chunk_count = input_table_left()->chunk_count();
+  auto output_columns_by_chunk = std::vector<ChunkColumns>(chunk_count);
+
+  const auto project_chunk = [&](const ChunkID chunk_id) {
+    auto& output_columns = output_columns_by_chunk[chunk_id];
     output_columns.reserve(expressions.size());
 
     const auto input_chunk = input_table_left()->get_chunk(chunk_id);
 
-    ExpressionEvaluator evaluator(input_table_left(), chunk_id);
+    // The evaluator is shared by all expressions, so that their common subexpressions are evaluated only once
+    auto evaluator = std::optional<ExpressionEvaluator>{};
     for (const auto& expression : expressions) {
       // Forward input column if possible
       if (expression->type == ExpressionType::PQPColumn && forward_columns) {
         const auto pqp_column_expression = std::dynamic_pointer_cast<PQPColumnExpression>(expression);
         output_columns.emplace_back(input_chunk->get_column(pqp_column_expression->column_id));
       } else {
-        output_columns.emplace_back(evaluator.evaluate_expression_to_column(*expression));
+        if (!evaluator) evaluator.emplace(input_table_left(), chunk_id);
+        output_columns.emplace_back(evaluator->evaluate_expression_to_column(*expression));
       }
     }
+  };
+
+  // Forwarding columns is cheap, so only chunks with expressions to evaluate are projected by jobs, one per chunk
+  if (chunk_count <= ChunkID{1} || (only_projects_columns && forward_columns)) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      project_chunk(chunk_id);
+    }
+  } else {
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    jobs.reserve(chunk_count);
+
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() { project_chunk(chunk_id); }));
+      jobs.back()->schedule();
+    }
+
+    CurrentScheduler::wait_for_tasks(jobs);
+  }
 
-    output_table->append_chunk(output_columns);
-    output_table->get_chunk(chunk_id)->set_mvcc_columns(input_chunk->mvcc_columns());
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    output_table->append_chunk(output_columns_by_chunk[chunk_id]);
+    output_table->get_chunk(chunk_id)->set_mvcc_columns(input_table_left()->get_chunk(chunk_id)->mvcc_columns());
   }
 
   return output_table;
@@ -10,6 +10,8 @@
 
 namespace opossum {
 
+class MvccColumns;
+
 /**
  * Validates visibility of records of a table
  * within the context of a given transaction
@@ -22,6 +24,10 @@ class Validate : public AbstractReadOnlyOperator {
 
   const std::string name() const override;
 
+  // Whether the row at chunk_offset is visible for the transaction our_tid with the given snapshot
+  static bool is_row_visible(CommitID our_tid, CommitID snapshot_commit_id, ChunkOffset chunk_offset,
+                             const MvccColumns& columns);
+
  protected:
   std::shared_ptr<const Table> _on_execute(std::shared_ptr<TransactionContext> transaction_context) override;
   std::shared_ptr<const Table> _on_execute() override;
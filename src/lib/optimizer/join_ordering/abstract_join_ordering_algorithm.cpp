@@ -0,0 +1,82 @@
+#include "abstract_join_ordering_algorithm.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "cost_model/abstract_cost_model.hpp"
+#include "expression/abstract_predicate_expression.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "operators/operator_join_predicate.hpp"
+#include "statistics/table_statistics.hpp"
+
+namespace opossum {
+
+AbstractJoinOrderingAlgorithm::AbstractJoinOrderingAlgorithm(const std::shared_ptr<AbstractCostModel>& cost_model)
+    : _cost_model(cost_model) {}
+
+AbstractJoinOrderingAlgorithm::CostedPlan AbstractJoinOrderingAlgorithm::_add_predicates_to_plan(
+    const CostedPlan& plan, const std::vector<std::shared_ptr<AbstractExpression>>& predicates) const {
+  if (predicates.empty()) return plan;
+
+  // Estimate the output row count of each predicate on its own and apply the most selective predicates first
+  auto predicate_nodes_and_row_counts = std::vector<std::pair<std::shared_ptr<PredicateNode>, float>>{};
+  predicate_nodes_and_row_counts.reserve(predicates.size());
+
+  for (const auto& predicate : predicates) {
+    const auto predicate_node = PredicateNode::make(predicate);
+    const auto row_count = predicate_node->derive_statistics_from(plan.lqp)->row_count();
+    predicate_nodes_and_row_counts.emplace_back(predicate_node, row_count);
+  }
+
+  std::stable_sort(predicate_nodes_and_row_counts.begin(), predicate_nodes_and_row_counts.end(),
+                   [&](const auto& lhs, const auto& rhs) { return lhs.second < rhs.second; });
+
+  auto result_plan = plan;
+  for (const auto& predicate_node_and_row_count : predicate_nodes_and_row_counts) {
+    const auto& predicate_node = predicate_node_and_row_count.first;
+    predicate_node->set_left_input(result_plan.lqp);
+    result_plan.lqp = predicate_node;
+    result_plan.cost += _cost_model->estimate_lqp_node_cost(predicate_node);
+  }
+
+  return result_plan;
+}
+
+AbstractJoinOrderingAlgorithm::CostedPlan AbstractJoinOrderingAlgorithm::_add_join_to_plan(
+    const CostedPlan& left_plan, const CostedPlan& right_plan,
+    std::vector<std::shared_ptr<AbstractExpression>> predicates) const {
+  /**
+   * Pick the join predicate. Equi-predicates are preferred, since they allow for a JoinHash to be used. All other
+   * predicates are applied as PredicateNodes on top of the JoinNode.
+   */
+  auto join_predicate_iter = predicates.end();
+  for (auto predicate_iter = predicates.begin(); predicate_iter != predicates.end(); ++predicate_iter) {
+    const auto operator_join_predicate =
+        OperatorJoinPredicate::from_expression(**predicate_iter, *left_plan.lqp, *right_plan.lqp);
+    if (!operator_join_predicate) continue;
+
+    if (operator_join_predicate->predicate_condition == PredicateCondition::Equals) {
+      join_predicate_iter = predicate_iter;
+      break;
+    }
+
+    if (join_predicate_iter == predicates.end()) join_predicate_iter = predicate_iter;
+  }
+
+  auto join_node = std::shared_ptr<JoinNode>{};
+  if (join_predicate_iter != predicates.end()) {
+    join_node = JoinNode::make(JoinMode::Inner, *join_predicate_iter, left_plan.lqp, right_plan.lqp);
+    predicates.erase(join_predicate_iter);
+  } else {
+    join_node = JoinNode::make(JoinMode::Cross, left_plan.lqp, right_plan.lqp);
+  }
+
+  const auto join_cost = left_plan.cost + right_plan.cost + _cost_model->estimate_lqp_node_cost(join_node);
+
+  return _add_predicates_to_plan(CostedPlan{join_node, join_cost}, predicates);
+}
+
+}  // namespace opossum
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "cost_model/cost.hpp"
+
+namespace opossum {
+
+class AbstractCostModel;
+class AbstractExpression;
+class AbstractLQPNode;
+class JoinGraph;
+
+/**
+ * Base class for algorithms that create a join plan from a JoinGraph.
+ *
+ * Provides utilities to place predicates and joins on top of partial plans that concrete algorithms can use to build
+ * and cost their candidate plans.
+ */
+class AbstractJoinOrderingAlgorithm {
+ public:
+  explicit AbstractJoinOrderingAlgorithm(const std::shared_ptr<AbstractCostModel>& cost_model);
+  virtual ~AbstractJoinOrderingAlgorithm() = default;
+
+  /**
+   * @return    an LQP that joins all vertices of @param join_graph and applies all of its predicates
+   */
+  virtual std::shared_ptr<AbstractLQPNode> operator()(const JoinGraph& join_graph) = 0;
+
+ protected:
+  // A partial plan and the Cost of all the nodes that were added to it by the algorithm (i.e., excluding the vertices)
+  struct CostedPlan {
+    std::shared_ptr<AbstractLQPNode> lqp;
+    Cost cost{0};
+  };
+
+  /**
+   * Put PredicateNodes with @param predicates on top of @param plan. The most selective predicates are placed first.
+   */
+  CostedPlan _add_predicates_to_plan(const CostedPlan& plan,
+                                     const std::vector<std::shared_ptr<AbstractExpression>>& predicates) const;
+
+  /**
+   * Join @param left_plan and @param right_plan. The first of @param predicates that the join operators can process
+   * becomes the join predicate, the others are placed as PredicateNodes on top of the JoinNode. If there is no such
+   * predicate, a cross join is created.
+   */
+  CostedPlan _add_join_to_plan(const CostedPlan& left_plan, const CostedPlan& right_plan,
+                               std::vector<std::shared_ptr<AbstractExpression>> predicates) const;
+
+  const std::shared_ptr<AbstractCostModel> _cost_model;
+};
+
+}  // namespace opossum
@@ -0,0 +1,95 @@
+#include "dp_ccp.hpp"
+
+#include <map>
+#include <memory>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "enumerate_ccp.hpp"
+#include "join_graph.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+std::shared_ptr<AbstractLQPNode> DpCcp::operator()(const JoinGraph& join_graph) {
+  const auto num_vertices = join_graph.vertices.size();
+  Assert(num_vertices > 0, "Need at least one vertex to build a join plan");
+
+  /**
+   * EnumerateCcp only needs to know which vertices are connected by binary predicates. Predicates between more than
+   * two vertices are placed as soon as all of their vertices are joined.
+   */
+  auto enumeration_edges = std::vector<std::pair<size_t, size_t>>{};
+  for (const auto& edge : join_graph.edges) {
+    if (edge.vertex_set.count() != 2) continue;
+    const auto first_vertex_idx = edge.vertex_set.find_first();
+    enumeration_edges.emplace_back(first_vertex_idx, edge.vertex_set.find_next(first_vertex_idx));
+  }
+
+  /**
+   * EnumerateCcp requires a connected graph. Connect the components of the graph by adding edges without predicates,
+   * which will result in cross joins.
+   */
+  auto component_ids = std::vector<size_t>(num_vertices);
+  std::iota(component_ids.begin(), component_ids.end(), 0);
+  const auto find_component = [&](size_t vertex_idx) {
+    while (component_ids[vertex_idx] != vertex_idx) vertex_idx = component_ids[vertex_idx];
+    return vertex_idx;
+  };
+  for (const auto& enumeration_edge : enumeration_edges) {
+    component_ids[find_component(enumeration_edge.first)] = find_component(enumeration_edge.second);
+  }
+  for (auto vertex_idx = size_t{1}; vertex_idx < num_vertices; ++vertex_idx) {
+    const auto component_id = find_component(vertex_idx);
+    if (component_id == find_component(0)) continue;
+    enumeration_edges.emplace_back(0, vertex_idx);
+    component_ids[component_id] = find_component(0);
+  }
+
+  /**
+   * Initialise the plans for single vertices with the vertices and their local predicates
+   */
+  auto best_plan = std::map<JoinGraphVertexSet, CostedPlan>{};
+  for (auto vertex_idx = size_t{0}; vertex_idx < num_vertices; ++vertex_idx) {
+    auto single_vertex_set = JoinGraphVertexSet{num_vertices};
+    single_vertex_set.set(vertex_idx);
+
+    const auto vertex_plan = CostedPlan{join_graph.vertices[vertex_idx], Cost{0}};
+    const auto local_predicates = join_graph.find_local_predicates(vertex_idx);
+    best_plan.emplace(single_vertex_set, _add_predicates_to_plan(vertex_plan, local_predicates));
+  }
+
+  /**
+   * Build the best plan for each connected subgraph from the best plans of the csg-cmp-pairs it can be composed of.
+   */
+  const auto csg_cmp_pairs = EnumerateCcp{num_vertices, enumeration_edges}();
+  for (const auto& csg_cmp_pair : csg_cmp_pairs) {
+    const auto best_plan_left_iter = best_plan.find(csg_cmp_pair.first);
+    const auto best_plan_right_iter = best_plan.find(csg_cmp_pair.second);
+    DebugAssert(best_plan_left_iter != best_plan.end() && best_plan_right_iter != best_plan.end(),
+                "Subplan missing: either the JoinGraph is invalid or EnumerateCcp is buggy");
+
+    const auto join_predicates = join_graph.find_join_predicates(csg_cmp_pair.first, csg_cmp_pair.second);
+    auto candidate_plan = _add_join_to_plan(best_plan_left_iter->second, best_plan_right_iter->second, join_predicates);
+
+    const auto joined_vertex_set = csg_cmp_pair.first | csg_cmp_pair.second;
+    const auto best_plan_iter = best_plan.find(joined_vertex_set);
+    if (best_plan_iter == best_plan.end()) {
+      best_plan.emplace(joined_vertex_set, std::move(candidate_plan));
+    } else if (candidate_plan.cost < best_plan_iter->second.cost) {
+      best_plan_iter->second = std::move(candidate_plan);
+    }
+  }
+
+  auto all_vertices_set = JoinGraphVertexSet{num_vertices};
+  all_vertices_set.set();
+
+  const auto best_plan_iter = best_plan.find(all_vertices_set);
+  Assert(best_plan_iter != best_plan.end(), "No plan for all vertices generated. Maybe JoinGraph isn't connected?");
+
+  return best_plan_iter->second.lqp;
+}
+
+}  // namespace opossum
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <memory>
+
+#include "abstract_join_ordering_algorithm.hpp"
+
+namespace opossum {
+
+/**
+ * Optimal bushy join ordering without cross products (as long as the JoinGraph is connected) by dynamic programming
+ * over the csg-cmp-pairs enumerated by EnumerateCcp. See "Analysis of Two Existing and One New Dynamic Programming
+ * Algorithm for the Generation of Optimal Bushy Join Trees without Cross Products" by Moerkotte and Neumann, 2006.
+ *
+ * If the JoinGraph is not connected, its connected components are joined by cross joins, so that the components are
+ * still ordered optimally, but the order of the cross joins is determined by the component order.
+ *
+ * The number of csg-cmp-pairs grows exponentially with the number of vertices (for cliques), so this algorithm should
+ * only be used for JoinGraphs with a moderate number of vertices (see JoinOrderingRule).
+ */
+class DpCcp final : public AbstractJoinOrderingAlgorithm {
+ public:
+  using AbstractJoinOrderingAlgorithm::AbstractJoinOrderingAlgorithm;
+
+  std::shared_ptr<AbstractLQPNode> operator()(const JoinGraph& join_graph) override;
+};
+
+}  // namespace opossum
@@ -0,0 +1,136 @@
+#include "enumerate_ccp.hpp"
+
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+EnumerateCcp::EnumerateCcp(const size_t num_vertices, const std::vector<std::pair<size_t, size_t>>& edges)
+    : _num_vertices(num_vertices), _edges(edges) {
+  // Subset enumeration works on unsigned longs, see _non_empty_subsets()
+  Assert(num_vertices <= sizeof(unsigned long) * 8, "Too many vertices, EnumerateCcp will not terminate anyway");
+
+  _vertex_neighbourhoods.resize(_num_vertices, JoinGraphVertexSet{_num_vertices});
+  for (const auto& edge : _edges) {
+    DebugAssert(edge.first < _num_vertices && edge.second < _num_vertices, "Edge references non-existing vertex");
+    _vertex_neighbourhoods[edge.first].set(edge.second);
+    _vertex_neighbourhoods[edge.second].set(edge.first);
+  }
+}
+
+std::vector<std::pair<JoinGraphVertexSet, JoinGraphVertexSet>> EnumerateCcp::operator()() {
+  _csg_cmp_pairs.clear();
+
+  /**
+   * For each vertex, starting with the one with the highest index, enumerate all connected subgraphs (csgs) that
+   * contain it and only vertices with a higher index. For each of these csgs, enumerate the complements (cmps).
+   */
+  for (auto reverse_vertex_idx = size_t{0}; reverse_vertex_idx < _num_vertices; ++reverse_vertex_idx) {
+    const auto vertex_idx = _num_vertices - reverse_vertex_idx - 1;
+    const auto start_vertex_set = _single_vertex_set(vertex_idx);
+
+    _enumerate_cmp(start_vertex_set);
+
+    auto csgs = std::vector<JoinGraphVertexSet>{};
+    _enumerate_csg_recursive(csgs, start_vertex_set, _exclusion_set(vertex_idx));
+
+    for (const auto& csg : csgs) {
+      _enumerate_cmp(csg);
+    }
+  }
+
+  return _csg_cmp_pairs;
+}
+
+void EnumerateCcp::_enumerate_csg_recursive(std::vector<JoinGraphVertexSet>& csgs,
+                                            const JoinGraphVertexSet& vertex_set,
+                                            const JoinGraphVertexSet& exclusion_set) {
+  const auto neighbourhood = _neighbourhood(vertex_set, exclusion_set);
+  const auto neighbourhood_subsets = _non_empty_subsets(neighbourhood);
+  const auto extended_exclusion_set = exclusion_set | neighbourhood;
+
+  for (const auto& subset : neighbourhood_subsets) {
+    csgs.emplace_back(vertex_set | subset);
+  }
+
+  for (const auto& subset : neighbourhood_subsets) {
+    _enumerate_csg_recursive(csgs, vertex_set | subset, extended_exclusion_set);
+  }
+}
+
+void EnumerateCcp::_enumerate_cmp(const JoinGraphVertexSet& primary_vertex_set) {
+  const auto exclusion_set = _exclusion_set(primary_vertex_set.find_first()) | primary_vertex_set;
+  const auto neighbourhood = _neighbourhood(primary_vertex_set, exclusion_set);
+
+  if (neighbourhood.none()) return;
+
+  // Iterate the neighbourhood in descending order of the vertex indices
+  auto neighbourhood_indices = std::vector<size_t>{};
+  for (auto vertex_idx = neighbourhood.find_first(); vertex_idx != JoinGraphVertexSet::npos;
+       vertex_idx = neighbourhood.find_next(vertex_idx)) {
+    neighbourhood_indices.emplace_back(vertex_idx);
+  }
+
+  for (auto iter = neighbourhood_indices.rbegin(); iter != neighbourhood_indices.rend(); ++iter) {
+    const auto cmp_vertex_set = _single_vertex_set(*iter);
+    _csg_cmp_pairs.emplace_back(primary_vertex_set, cmp_vertex_set);
+
+    // Extend the complement with vertices connected to it, excluding those neighbours that are processed later
+    auto cmps = std::vector<JoinGraphVertexSet>{};
+    _enumerate_csg_recursive(cmps, cmp_vertex_set, exclusion_set | (_exclusion_set(*iter) & neighbourhood));
+
+    for (const auto& cmp : cmps) {
+      _csg_cmp_pairs.emplace_back(primary_vertex_set, cmp);
+    }
+  }
+}
+
+JoinGraphVertexSet EnumerateCcp::_exclusion_set(const size_t vertex_idx) const {
+  auto exclusion_set = JoinGraphVertexSet{_num_vertices};
+  for (auto exclusion_vertex_idx = size_t{0}; exclusion_vertex_idx <= vertex_idx; ++exclusion_vertex_idx) {
+    exclusion_set.set(exclusion_vertex_idx);
+  }
+  return exclusion_set;
+}
+
+JoinGraphVertexSet EnumerateCcp::_neighbourhood(const JoinGraphVertexSet& vertex_set,
+                                                const JoinGraphVertexSet& exclusion_set) const {
+  auto neighbourhood = JoinGraphVertexSet{_num_vertices};
+
+  for (auto vertex_idx = vertex_set.find_first(); vertex_idx != JoinGraphVertexSet::npos;
+       vertex_idx = vertex_set.find_next(vertex_idx)) {
+    neighbourhood |= _vertex_neighbourhoods[vertex_idx];
+  }
+
+  return neighbourhood - vertex_set - exclusion_set;
+}
+
+std::vector<JoinGraphVertexSet> EnumerateCcp::_non_empty_subsets(const JoinGraphVertexSet& vertex_set) const {
+  auto subsets = std::vector<JoinGraphVertexSet>{};
+
+  if (vertex_set.none()) return subsets;
+
+  /**
+   * Enumerate the subsets in ascending order of their integer representation using the (subset - set) & set trick,
+   * see e.g. https://www.chessprogramming.org/Traversing_Subsets_of_a_Set
+   */
+  const auto set_ulong = vertex_set.to_ulong();
+  auto subset_ulong = (0ul - set_ulong) & set_ulong;
+
+  while (subset_ulong != 0) {
+    subsets.emplace_back(_num_vertices, subset_ulong);
+    subset_ulong = (subset_ulong - set_ulong) & set_ulong;
+  }
+
+  return subsets;
+}
+
+JoinGraphVertexSet EnumerateCcp::_single_vertex_set(const size_t vertex_idx) const {
+  auto vertex_set = JoinGraphVertexSet{_num_vertices};
+  vertex_set.set(vertex_idx);
+  return vertex_set;
+}
+
+}  // namespace opossum
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include "join_graph.hpp"
+
+namespace opossum {
+
+/**
+ * Enumerates all csg-cmp-pairs (pairs of connected subgraphs that are connected to each other, but don't overlap) of a
+ * connected graph, as described in "Analysis of Two Existing and One New Dynamic Programming Algorithm for the
+ * Generation of Optimal Bushy Join Trees without Cross Products" by Moerkotte and Neumann, 2006.
+ *
+ * The pairs are emitted in an order suitable for dynamic programming, i.e., when the pair (S1, S2) is emitted, all
+ * csg-cmp-pairs that S1 and S2 can be composed of have already been emitted.
+ *
+ * Each pair is emitted only once, i.e., if (S1, S2) is emitted, (S2, S1) is not.
+ */
+class EnumerateCcp final {
+ public:
+  /**
+   * @param num_vertices    the number of vertices in the graph
+   * @param edges           pairs of vertex indices that are connected. The graph must be connected.
+   */
+  EnumerateCcp(const size_t num_vertices, const std::vector<std::pair<size_t, size_t>>& edges);
+
+  std::vector<std::pair<JoinGraphVertexSet, JoinGraphVertexSet>> operator()();
+
+ private:
+  const size_t _num_vertices;
+  const std::vector<std::pair<size_t, size_t>> _edges;
+
+  std::vector<std::pair<JoinGraphVertexSet, JoinGraphVertexSet>> _csg_cmp_pairs;
+
+  // For each vertex, the set of vertices it is directly connected to
+  std::vector<JoinGraphVertexSet> _vertex_neighbourhoods;
+
+  void _enumerate_csg_recursive(std::vector<JoinGraphVertexSet>& csgs, const JoinGraphVertexSet& vertex_set,
+                                const JoinGraphVertexSet& exclusion_set);
+  void _enumerate_cmp(const JoinGraphVertexSet& primary_vertex_set);
+
+  // All vertices with an index smaller than or equal to @param vertex_idx
+  JoinGraphVertexSet _exclusion_set(const size_t vertex_idx) const;
+  JoinGraphVertexSet _neighbourhood(const JoinGraphVertexSet& vertex_set,
+                                    const JoinGraphVertexSet& exclusion_set) const;
+
+  // All non-empty subsets of @param vertex_set
+  std::vector<JoinGraphVertexSet> _non_empty_subsets(const JoinGraphVertexSet& vertex_set) const;
+  JoinGraphVertexSet _single_vertex_set(const size_t vertex_idx) const;
+};
+
+}  // namespace opossum
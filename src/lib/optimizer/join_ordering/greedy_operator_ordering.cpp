@@ -0,0 +1,75 @@
+#include "greedy_operator_ordering.hpp"
+
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "join_graph.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "statistics/table_statistics.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+std::shared_ptr<AbstractLQPNode> GreedyOperatorOrdering::operator()(const JoinGraph& join_graph) {
+  const auto num_vertices = join_graph.vertices.size();
+  Assert(num_vertices > 0, "Need at least one vertex to build a join plan");
+
+  // The plans that still need to be joined and the vertices they contain
+  auto vertex_sets_and_plans = std::vector<std::pair<JoinGraphVertexSet, CostedPlan>>{};
+  vertex_sets_and_plans.reserve(num_vertices);
+
+  for (auto vertex_idx = size_t{0}; vertex_idx < num_vertices; ++vertex_idx) {
+    auto single_vertex_set = JoinGraphVertexSet{num_vertices};
+    single_vertex_set.set(vertex_idx);
+
+    const auto vertex_plan = CostedPlan{join_graph.vertices[vertex_idx], Cost{0}};
+    const auto local_predicates = join_graph.find_local_predicates(vertex_idx);
+    vertex_sets_and_plans.emplace_back(single_vertex_set, _add_predicates_to_plan(vertex_plan, local_predicates));
+  }
+
+  while (vertex_sets_and_plans.size() > 1) {
+    struct Candidate {
+      size_t left_idx;
+      size_t right_idx;
+      CostedPlan plan;
+      float row_count;
+      bool has_predicates;
+    };
+    auto best_candidate = std::optional<Candidate>{};
+
+    for (auto left_idx = size_t{0}; left_idx < vertex_sets_and_plans.size(); ++left_idx) {
+      for (auto right_idx = left_idx + 1; right_idx < vertex_sets_and_plans.size(); ++right_idx) {
+        const auto& left = vertex_sets_and_plans[left_idx];
+        const auto& right = vertex_sets_and_plans[right_idx];
+
+        const auto join_predicates = join_graph.find_join_predicates(left.first, right.first);
+        const auto has_predicates = !join_predicates.empty();
+
+        // Avoid cross joins as long as there are plans that can be joined via a predicate
+        if (best_candidate && best_candidate->has_predicates && !has_predicates) continue;
+
+        auto plan = _add_join_to_plan(left.second, right.second, join_predicates);
+        const auto row_count = plan.lqp->get_statistics()->row_count();
+
+        if (!best_candidate || (has_predicates && !best_candidate->has_predicates) ||
+            row_count < best_candidate->row_count) {
+          best_candidate = Candidate{left_idx, right_idx, std::move(plan), row_count, has_predicates};
+        }
+      }
+    }
+
+    DebugAssert(best_candidate, "Expected a candidate when there is more than one plan left");
+
+    // right_idx > left_idx, so erasing the right plan doesn't invalidate left_idx
+    auto& left = vertex_sets_and_plans[best_candidate->left_idx];
+    left.first |= vertex_sets_and_plans[best_candidate->right_idx].first;
+    left.second = best_candidate->plan;
+    vertex_sets_and_plans.erase(vertex_sets_and_plans.begin() + best_candidate->right_idx);
+  }
+
+  return vertex_sets_and_plans.front().second.lqp;
+}
+
+}  // namespace opossum
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <memory>
+
+#include "abstract_join_ordering_algorithm.hpp"
+
+namespace opossum {
+
+/**
+ * Greedy Operator Ordering (GOO), see "A New Heuristic for Optimizing Large Queries" by Leonidas Fegaras, 1998.
+ *
+ * Starts with one plan per vertex and repeatedly joins the two plans that produce the smallest (estimated)
+ * intermediate result, until a single plan is left. Plans connected by a predicate are preferred over cross joins.
+ *
+ * Produces bushy plans in polynomial time and is thus used for JoinGraphs that are too large for DpCcp.
+ */
+class GreedyOperatorOrdering final : public AbstractJoinOrderingAlgorithm {
+ public:
+  using AbstractJoinOrderingAlgorithm::AbstractJoinOrderingAlgorithm;
+
+  std::shared_ptr<AbstractLQPNode> operator()(const JoinGraph& join_graph) override;
+};
+
+}  // namespace opossum
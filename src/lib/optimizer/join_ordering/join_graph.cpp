@@ -0,0 +1,174 @@
+#include "join_graph.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <unordered_set>
+#include <vector>
+
+#include "expression/abstract_expression.hpp"
+#include "expression/expression_utils.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+/**
+ * Traverse the PredicateNodes and inner/cross JoinNodes starting at @param node and collect all other nodes as vertices
+ * and the predicates of the traversed nodes.
+ */
+void build_join_graph_recursively(const std::shared_ptr<AbstractLQPNode>& node, const bool is_root,
+                                  std::vector<std::shared_ptr<AbstractLQPNode>>& vertices,
+                                  std::vector<std::shared_ptr<AbstractExpression>>& predicates) {
+  // Nodes with multiple outputs are used elsewhere in the LQP as well, we must not reorder anything below them
+  if (!is_root && node->output_count() > 1) {
+    vertices.emplace_back(node);
+    return;
+  }
+
+  if (node->type == LQPNodeType::Predicate) {
+    const auto predicate_node = std::static_pointer_cast<PredicateNode>(node);
+    const auto flattened_predicates = expression_flatten_conjunction(predicate_node->predicate);
+    predicates.insert(predicates.end(), flattened_predicates.begin(), flattened_predicates.end());
+
+    build_join_graph_recursively(node->left_input(), false, vertices, predicates);
+    return;
+  }
+
+  if (node->type == LQPNodeType::Join) {
+    const auto join_node = std::static_pointer_cast<JoinNode>(node);
+
+    if (join_node->join_mode == JoinMode::Inner || join_node->join_mode == JoinMode::Cross) {
+      if (join_node->join_predicate) {
+        const auto flattened_predicates = expression_flatten_conjunction(join_node->join_predicate);
+        predicates.insert(predicates.end(), flattened_predicates.begin(), flattened_predicates.end());
+      }
+
+      build_join_graph_recursively(node->left_input(), false, vertices, predicates);
+      build_join_graph_recursively(node->right_input(), false, vertices, predicates);
+      return;
+    }
+  }
+
+  vertices.emplace_back(node);
+}
+
+/**
+ * @return the set of vertices that produce the columns referenced by @param predicate. If the predicate references no
+ *         vertex at all (e.g. `5 > 3` or an uncorrelated subselect), all vertices are returned, so the predicate is
+ *         placed on top of the join plan.
+ */
+JoinGraphVertexSet get_referenced_vertices(const std::shared_ptr<AbstractExpression>& predicate,
+                                           const std::vector<std::shared_ptr<AbstractLQPNode>>& vertices) {
+  auto vertex_set = JoinGraphVertexSet{vertices.size()};
+
+  visit_expression(predicate, [&](const auto& sub_expression) {
+    for (auto vertex_idx = size_t{0}; vertex_idx < vertices.size(); ++vertex_idx) {
+      if (vertices[vertex_idx]->find_column_id(*sub_expression)) {
+        vertex_set.set(vertex_idx);
+        return ExpressionVisitation::DoNotVisitArguments;
+      }
+    }
+    return ExpressionVisitation::VisitArguments;
+  });
+
+  if (vertex_set.none()) vertex_set.set();
+
+  return vertex_set;
+}
+
+}  // namespace
+
+namespace opossum {
+
+JoinGraphEdge::JoinGraphEdge(const JoinGraphVertexSet& vertex_set,
+                             const std::vector<std::shared_ptr<AbstractExpression>>& predicates)
+    : vertex_set(vertex_set), predicates(predicates) {}
+
+std::optional<JoinGraph> JoinGraph::from_lqp(const std::shared_ptr<AbstractLQPNode>& lqp) {
+  auto vertices = std::vector<std::shared_ptr<AbstractLQPNode>>{};
+  auto predicates = std::vector<std::shared_ptr<AbstractExpression>>{};
+
+  build_join_graph_recursively(lqp, true, vertices, predicates);
+
+  if (vertices.size() < 2) return std::nullopt;
+
+  // A node that is used as an input multiple times within the subplan (e.g., self-join on the same node) would make
+  // the mapping of columns to vertices ambiguous
+  const auto unique_vertices = std::unordered_set<std::shared_ptr<AbstractLQPNode>>{vertices.begin(), vertices.end()};
+  if (unique_vertices.size() != vertices.size()) return std::nullopt;
+
+  // Group the predicates by the vertices they reference
+  auto edges = std::vector<JoinGraphEdge>{};
+  for (const auto& predicate : predicates) {
+    const auto vertex_set = get_referenced_vertices(predicate, vertices);
+
+    auto edge_iter =
+        std::find_if(edges.begin(), edges.end(), [&](const auto& edge) { return edge.vertex_set == vertex_set; });
+    if (edge_iter == edges.end()) {
+      edges.emplace_back(vertex_set);
+      edge_iter = std::prev(edges.end());
+    }
+
+    edge_iter->predicates.emplace_back(predicate);
+  }
+
+  return JoinGraph{vertices, edges};
+}
+
+JoinGraph::JoinGraph(const std::vector<std::shared_ptr<AbstractLQPNode>>& vertices,
+                     const std::vector<JoinGraphEdge>& edges)
+    : vertices(vertices), edges(edges) {}
+
+std::vector<std::shared_ptr<AbstractExpression>> JoinGraph::find_local_predicates(const size_t vertex_idx) const {
+  DebugAssert(vertex_idx < vertices.size(), "Vertex index out of range");
+
+  auto predicates = std::vector<std::shared_ptr<AbstractExpression>>{};
+
+  for (const auto& edge : edges) {
+    if (edge.vertex_set.count() != 1 || !edge.vertex_set.test(vertex_idx)) continue;
+    predicates.insert(predicates.end(), edge.predicates.begin(), edge.predicates.end());
+  }
+
+  return predicates;
+}
+
+std::vector<std::shared_ptr<AbstractExpression>> JoinGraph::find_join_predicates(
+    const JoinGraphVertexSet& vertex_set_a, const JoinGraphVertexSet& vertex_set_b) const {
+  DebugAssert(!vertex_set_a.intersects(vertex_set_b), "Vertex sets must be disjoint");
+
+  const auto joined_vertex_set = vertex_set_a | vertex_set_b;
+
+  auto predicates = std::vector<std::shared_ptr<AbstractExpression>>{};
+
+  for (const auto& edge : edges) {
+    if (!edge.vertex_set.is_subset_of(joined_vertex_set)) continue;
+    if (edge.vertex_set.is_subset_of(vertex_set_a) || edge.vertex_set.is_subset_of(vertex_set_b)) continue;
+    predicates.insert(predicates.end(), edge.predicates.begin(), edge.predicates.end());
+  }
+
+  return predicates;
+}
+
+void JoinGraph::print(std::ostream& stream) const {
+  stream << "==== Vertices ====" << std::endl;
+  for (auto vertex_idx = size_t{0}; vertex_idx < vertices.size(); ++vertex_idx) {
+    stream << vertex_idx << ": " << vertices[vertex_idx]->description() << std::endl;
+  }
+
+  stream << "==== Edges ====" << std::endl;
+  for (const auto& edge : edges) {
+    stream << edge.vertex_set << ":";
+    for (const auto& predicate : edge.predicates) {
+      stream << " " << predicate->as_column_name();
+    }
+    stream << std::endl;
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "boost/dynamic_bitset.hpp"
+
+namespace opossum {
+
+class AbstractExpression;
+class AbstractLQPNode;
+
+/**
+ * Each bit represents one vertex of a JoinGraph, i.e., bit i is set if JoinGraph::vertices[i] is part of the set.
+ */
+using JoinGraphVertexSet = boost::dynamic_bitset<>;
+
+/**
+ * An edge of the JoinGraph. Connects all vertices in `vertex_set` via `predicates`.
+ *  - An edge with a single vertex holds the "local" predicates of that vertex (e.g., `a.x > 5`)
+ *  - An edge with two vertices holds the join predicates between them (e.g., `a.x = b.y`)
+ *  - An edge with more than two vertices holds predicates that can only be evaluated once all of these vertices are
+ *    joined (e.g., `a.x + b.y = c.z`, or predicates that reference no vertex at all)
+ */
+struct JoinGraphEdge final {
+  JoinGraphEdge(const JoinGraphVertexSet& vertex_set,
+                const std::vector<std::shared_ptr<AbstractExpression>>& predicates = {});
+
+  JoinGraphVertexSet vertex_set;
+  std::vector<std::shared_ptr<AbstractExpression>> predicates;
+};
+
+/**
+ * A JoinGraph is a representation of a subplan of an LQP consisting only of inner and cross JoinNodes and
+ * PredicateNodes. The nodes below these (i.e., StoredTableNodes, Aggregates, Outer Joins, ...) become the vertices of
+ * the graph, the predicates of the JoinNodes and PredicateNodes become its edges. Since the JoinGraph contains no
+ * information on the order of the joins, it is the input to join ordering algorithms
+ * (see AbstractJoinOrderingAlgorithm).
+ *
+ * Subplans that are referenced multiple times (i.e., have multiple outputs) are not traversed and become vertices.
+ */
+class JoinGraph final {
+ public:
+  /**
+   * @return    The JoinGraph of the subplan rooted in @param lqp, or std::nullopt if @param lqp is not the root of a
+   *            subplan with at least two distinct vertices.
+   */
+  static std::optional<JoinGraph> from_lqp(const std::shared_ptr<AbstractLQPNode>& lqp);
+
+  JoinGraph(const std::vector<std::shared_ptr<AbstractLQPNode>>& vertices, const std::vector<JoinGraphEdge>& edges);
+
+  /**
+   * @return    the predicates that reference only the vertex @param vertex_idx
+   */
+  std::vector<std::shared_ptr<AbstractExpression>> find_local_predicates(const size_t vertex_idx) const;
+
+  /**
+   * @return    the predicates that can be evaluated on the join of @param vertex_set_a and @param vertex_set_b but on
+   *            neither of them alone
+   */
+  std::vector<std::shared_ptr<AbstractExpression>> find_join_predicates(const JoinGraphVertexSet& vertex_set_a,
+                                                                        const JoinGraphVertexSet& vertex_set_b) const;
+
+  void print(std::ostream& stream = std::cout) const;
+
+  std::vector<std::shared_ptr<AbstractLQPNode>> vertices;
+  std::vector<JoinGraphEdge> edges;
+};
+
+}  // namespace opossum
@@ -3,6 +3,7 @@
 #include <memory>
 #include <unordered_set>
 
+#include "cost_model/cost_model_logical.hpp"
 #include "expression/expression_utils.hpp"
 #include "expression/lqp_select_expression.hpp"
 #include "logical_query_plan/logical_plan_root_node.hpp"
@@ -12,6 +13,7 @@
 #include "strategy/constant_calculation_rule.hpp"
 #include "strategy/index_scan_rule.hpp"
 #include "strategy/join_detection_rule.hpp"
+#include "strategy/join_ordering_rule.hpp"
 #include "strategy/predicate_pushdown_rule.hpp"
 #include "strategy/predicate_reordering_rule.hpp"
 #include "utils/performance_warning.hpp"
@@ -92,6 +94,11 @@ std::shared_ptr<Optimizer> Optimizer::create_default_optimizer() {
   main_batch.add_rule(std::make_shared<JoinDetectionRule>());
   optimizer->add_rule_batch(main_batch);
 
+  // Join ordering works on the result of predicate pushdown and join detection and places the predicates itself
+  RuleBatch join_ordering_batch(RuleBatchExecutionPolicy::Once);
+  join_ordering_batch.add_rule(std::make_shared<JoinOrderingRule>(std::make_shared<CostModelLogical>()));
+  optimizer->add_rule_batch(join_ordering_batch);
+
   RuleBatch final_batch(RuleBatchExecutionPolicy::Once);
   final_batch.add_rule(std::make_shared<ChunkPruningRule>());
   final_batch.add_rule(std::make_shared<ConstantCalculationRule>());
@@ -8,11 +8,16 @@
 
 #include "all_parameter_variant.hpp"
 #include "constant_mappings.hpp"
+#include "expression/expression_utils.hpp"
+#include "expression/parameter_expression.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
 #include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
 #include "operators/operator_scan_predicate.hpp"
 #include "statistics/table_statistics.hpp"
+#include "storage/index/primary_key/primary_key_index.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
@@ -32,15 +37,28 @@ std::string IndexScanRule::name() const { return "Index Scan Rule"; }
 
 bool IndexScanRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) const {
   if (node->type == LQPNodeType::Predicate) {
-    const auto& child = node->left_input();
+    const auto predicate_node = std::dynamic_pointer_cast<PredicateNode>(node);
+
+    // The PredicateNodes of the primary key lookup are moved directly above the StoredTableNode, which has no inputs
+    if (_apply_primary_key_index(predicate_node)) return true;
+
+    const auto child = node->left_input();
 
     if (child->type == LQPNodeType::StoredTable) {
-      const auto predicate_node = std::dynamic_pointer_cast<PredicateNode>(node);
       const auto stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(child);
       const auto table = StorageManager::get().get_table(stored_table_node->table_name);
 
       const auto index_infos = table->get_indexes();
       for (const auto& index_info : index_infos) {
+        if (_is_index_only_scan_applicable(index_info, predicate_node, stored_table_node)) {
+          // The IndexOnlyScan outputs only the indexed column. The ProjectionNode makes the LQP reflect that.
+          const auto& indexed_column = stored_table_node->column_expressions()[index_info.column_ids[0]];
+          const auto column_expressions = std::vector<std::shared_ptr<AbstractExpression>>{indexed_column};
+          lqp_insert_node(predicate_node, LQPInputSide::Left, ProjectionNode::make(column_expressions));
+          predicate_node->scan_type = ScanType::IndexOnlyScan;
+          break;
+        }
+
         if (_is_index_scan_applicable(index_info, predicate_node)) {
           predicate_node->scan_type = ScanType::IndexScan;
         }
@@ -51,22 +69,89 @@ bool IndexScanRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) const
   return _apply_to_inputs(node);
 }
 
-bool IndexScanRule::_is_index_scan_applicable(const IndexInfo& index_info,
-                                              const std::shared_ptr<PredicateNode>& predicate_node) const {
-  if (!_is_single_column_index(index_info)) return false;
+bool IndexScanRule::_apply_primary_key_index(const std::shared_ptr<PredicateNode>& predicate_node) const {
+  /**
+   * Collect the chain of PredicateNodes starting at predicate_node and the StoredTableNode below it. The chain may
+   * contain one ValidateNode. All of these nodes only remove rows, so their order can be changed. Nodes below
+   * predicate_node with other outputs end the chain, as they cannot be moved.
+   */
+  auto chain = std::vector<std::shared_ptr<AbstractLQPNode>>{predicate_node};
+  auto validate_node = std::shared_ptr<AbstractLQPNode>{};
+  auto input_node = predicate_node->left_input();
+  const auto is_chain_node = [&](const auto& node) {
+    return node->type == LQPNodeType::Predicate || (node->type == LQPNodeType::Validate && !validate_node);
+  };
+  while (input_node->output_count() == 1 && is_chain_node(input_node)) {
+    if (input_node->type == LQPNodeType::Validate) validate_node = input_node;
+    chain.emplace_back(input_node);
+    input_node = input_node->left_input();
+  }
 
-  if (index_info.type != ColumnIndexType::GroupKey) return false;
+  if (input_node->type != LQPNodeType::StoredTable) return false;
+  const auto stored_table_node = std::static_pointer_cast<StoredTableNode>(input_node);
+  const auto primary_key_index = StorageManager::get().get_table(stored_table_node->table_name)->primary_key_index();
+  if (!primary_key_index) return false;
+
+  // Find an Equals predicate on a value for each key column. As the PrimaryKeyIndex is a hash index, all key columns
+  // are needed for a lookup.
+  auto key_nodes = std::vector<std::shared_ptr<AbstractLQPNode>>{};
+  for (const auto column_id : primary_key_index->column_ids()) {
+    const auto key_node_iter = std::find_if(chain.begin(), chain.end(), [&](const auto& node) {
+      return node->type == LQPNodeType::Predicate &&
+             _is_primary_key_predicate(std::static_pointer_cast<PredicateNode>(node), column_id);
+    });
+    if (key_node_iter == chain.end()) return false;
+    key_nodes.emplace_back(*key_node_iter);
+  }
 
+  // Rearrange the chain: The other PredicateNodes stay on top, followed by the ValidateNode and the key PredicateNodes,
+  // so that the IndexScan directly follows the StoredTableNode.
+  auto rearranged_chain = std::vector<std::shared_ptr<AbstractLQPNode>>{};
+  for (const auto& node : chain) {
+    if (node->type == LQPNodeType::Predicate &&
+        std::find(key_nodes.begin(), key_nodes.end(), node) == key_nodes.end()) {
+      rearranged_chain.emplace_back(node);
+    }
+  }
+  if (validate_node) rearranged_chain.emplace_back(validate_node);
+  rearranged_chain.insert(rearranged_chain.end(), key_nodes.begin(), key_nodes.end());
+
+  const auto outputs = predicate_node->outputs();
+  const auto input_sides = predicate_node->get_input_sides();
+  for (const auto& node : chain) {
+    node->set_left_input(nullptr);
+  }
+  for (size_t output_idx = 0; output_idx < outputs.size(); ++output_idx) {
+    outputs[output_idx]->set_input(input_sides[output_idx], rearranged_chain.front());
+  }
+  for (size_t chain_idx = 0; chain_idx + 1 < rearranged_chain.size(); ++chain_idx) {
+    rearranged_chain[chain_idx]->set_left_input(rearranged_chain[chain_idx + 1]);
+  }
+  rearranged_chain.back()->set_left_input(stored_table_node);
+
+  // The LQPTranslator translates the topmost key PredicateNode and the ones below it into a single IndexScan
+  std::static_pointer_cast<PredicateNode>(key_nodes.front())->scan_type = ScanType::IndexScan;
+
+  return true;
+}
+
+bool IndexScanRule::_is_primary_key_predicate(const std::shared_ptr<PredicateNode>& predicate_node,
+                                              const ColumnID column_id) const {
   const auto operator_predicates = OperatorScanPredicate::from_expression(*predicate_node->predicate, *predicate_node);
-  if (!operator_predicates) return false;
-  if (operator_predicates->size() != 1) return false;
+  if (!operator_predicates || operator_predicates->size() != 1) return false;
 
   const auto& operator_predicate = (*operator_predicates)[0];
+  if (operator_predicate.predicate_condition != PredicateCondition::Equals ||
+      operator_predicate.column_id != column_id || is_column_id(operator_predicate.value)) {
+    return false;
+  }
 
-  // Currently, we do not support two-column predicates
-  if (is_column_id(operator_predicate.value)) return false;
+  return !_has_unbound_parameter(predicate_node);
+}
 
-  if (index_info.column_ids[0] != operator_predicate.column_id) return false;
+bool IndexScanRule::_is_index_scan_applicable(const IndexInfo& index_info,
+                                              const std::shared_ptr<PredicateNode>& predicate_node) const {
+  if (!_is_predicate_supported_by_index(index_info, predicate_node)) return false;
 
   const auto row_count_table = predicate_node->left_input()->derive_statistics_from(nullptr, nullptr)->row_count();
   if (row_count_table < INDEX_SCAN_ROW_COUNT_THRESHOLD) return false;
@@ -78,6 +163,80 @@ bool IndexScanRule::_is_index_scan_applicable(const IndexInfo& index_info,
   return selectivity <= INDEX_SCAN_SELECTIVITY_THRESHOLD;
 }
 
+bool IndexScanRule::_is_index_only_scan_applicable(const IndexInfo& index_info,
+                                                   const std::shared_ptr<PredicateNode>& predicate_node,
+                                                   const std::shared_ptr<StoredTableNode>& stored_table_node) const {
+  if (index_info.type != ColumnIndexType::GroupKey) return false;
+  if (!_is_predicate_supported_by_index(index_info, predicate_node)) return false;
+
+  // The nodes consuming the PredicateNode's output must only need the indexed column. ProjectionNodes and
+  // AggregateNodes (e.g., for COUNT(*), MIN(a), or MAX(a)) do not forward any other columns. All other nodes, including
+  // the ValidateNode, which needs the MVCC columns, do.
+  const auto& indexed_column = *stored_table_node->column_expressions()[index_info.column_ids[0]];
+  const auto outputs = predicate_node->outputs();
+  if (outputs.empty()) return false;
+
+  for (const auto& output : outputs) {
+    if (output->type != LQPNodeType::Projection && output->type != LQPNodeType::Aggregate) return false;
+
+    auto is_covered = true;
+    for (const auto& expression : output->node_expressions()) {
+      visit_expression(expression, [&](const auto& sub_expression) {
+        if (sub_expression->type == ExpressionType::LQPColumn && *sub_expression != indexed_column) is_covered = false;
+        return is_covered ? ExpressionVisitation::VisitArguments : ExpressionVisitation::DoNotVisitArguments;
+      });
+    }
+    if (!is_covered) return false;
+  }
+
+  // An index-only scan reads the matching values sequentially from the index, while a TableScan has to read the whole
+  // column. Thus, it is used regardless of the selectivity.
+  return true;
+}
+
+bool IndexScanRule::_is_predicate_supported_by_index(const IndexInfo& index_info,
+                                                     const std::shared_ptr<PredicateNode>& predicate_node) const {
+  if (!_is_single_column_index(index_info)) return false;
+
+  // The PrimaryKeyIndex is handled by _apply_primary_key_index()
+  if (index_info.type != ColumnIndexType::GroupKey) return false;
+
+  // BETWEEN is split into two OperatorScanPredicates, which the IndexScan executes as one
+  const auto operator_predicates = OperatorScanPredicate::from_expression(*predicate_node->predicate, *predicate_node);
+  if (!operator_predicates || operator_predicates->empty() || operator_predicates->size() > 2) return false;
+
+  for (const auto& operator_predicate : *operator_predicates) {
+    // Currently, we do not support two-column predicates
+    if (is_column_id(operator_predicate.value)) return false;
+
+    if (index_info.column_ids[0] != operator_predicate.column_id) return false;
+
+    // The IndexScan only supports comparisons with a value, e.g., no IS NULL or LIKE
+    switch (operator_predicate.predicate_condition) {
+      case PredicateCondition::Equals:
+      case PredicateCondition::NotEquals:
+      case PredicateCondition::LessThan:
+      case PredicateCondition::LessThanEquals:
+      case PredicateCondition::GreaterThan:
+      case PredicateCondition::GreaterThanEquals:
+        break;
+      default:
+        return false;
+    }
+  }
+
+  return !_has_unbound_parameter(predicate_node);
+}
+
+bool IndexScanRule::_has_unbound_parameter(const std::shared_ptr<PredicateNode>& predicate_node) const {
+  // The LQPTranslator needs to know the values of parameters (e.g., of prepared statements) to create an IndexScan
+  const auto& arguments = predicate_node->predicate->arguments;
+  return std::any_of(arguments.begin(), arguments.end(), [](const auto& argument) {
+    return argument->type == ExpressionType::Parameter &&
+           !std::static_pointer_cast<ParameterExpression>(argument)->value();
+  });
+}
+
 inline bool IndexScanRule::_is_single_column_index(const IndexInfo& index_info) const {
   return index_info.column_ids.size() == 1;
 }
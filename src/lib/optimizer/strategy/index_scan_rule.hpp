@@ -12,6 +12,7 @@ namespace opossum {
 
 class AbstractLQPNode;
 class PredicateNode;
+class StoredTableNode;
 
 /**
  * This optimizer rule finds PredicateNodes whose inputs are StoredTableNodes. These PredicateNodes are candidates
@@ -19,10 +20,23 @@ class PredicateNode;
  * ScanType of the PredicateNode is set to IndexScan.
  *
  * Note:
- * For now this rule is only applicable to single-column indexes. Multi-column predicates (i.e. WHERE a < b) are also
- * not supported. We also assume that if chunks have an index, all of them are of the same type, we do not mix GroupKey
- * and ART indexes. In addition, chains of IndexScans are not possible since an IndexScan's input must be a GetTable.
- * Currently, only GroupKeyIndexes are supported.
+ * For now this rule is only applicable to single-column chunk indexes. Multi-column predicates (i.e. WHERE a < b) are
+ * also not supported. We also assume that if chunks have an index, all of them are of the same type, we do not mix
+ * GroupKey and ART indexes. In addition, chains of IndexScans are not possible since an IndexScan's input must be a
+ * GetTable. Currently, only GroupKeyIndexes are supported.
+ *
+ * The table-wide PrimaryKeyIndex is used, independent of the selectivity, if a chain of PredicateNodes above the
+ * StoredTableNode has an Equals predicate on a value for each of its (possibly multiple) key columns, e.g., for
+ * WHERE c_w_id = 1 AND c_d_id = 2 AND c_id = 3. As it is a hash index, a prefix of the key is not sufficient. The key
+ * PredicateNodes are moved directly above the StoredTableNode (i.e., below the other PredicateNodes and a ValidateNode
+ * in the chain), and the topmost of them gets the ScanType IndexScan. The LQPTranslator translates all of them into a
+ * single lookup.
+ *
+ * If the nodes consuming the PredicateNode only need the indexed column (e.g., SELECT MAX(a) FROM t WHERE a < 10), the
+ * ScanType is set to IndexOnlyScan, independent of the selectivity. An IndexOnlyScan takes the values from the index
+ * and does not access the column. A ProjectionNode that only selects the indexed column is inserted below the
+ * PredicateNode, so that the LQP describes the output of the IndexOnlyScan. Since the IndexOnlyScan does not output
+ * MVCC data, plans that validate the rows cannot use it.
  */
 
 class IndexScanRule : public AbstractRule {
@@ -33,7 +47,16 @@ class IndexScanRule : public AbstractRule {
  protected:
   bool _is_index_scan_applicable(const IndexInfo& index_info,
                                  const std::shared_ptr<PredicateNode>& predicate_node) const;
+  bool _is_index_only_scan_applicable(const IndexInfo& index_info, const std::shared_ptr<PredicateNode>& predicate_node,
+                                      const std::shared_ptr<StoredTableNode>& stored_table_node) const;
+  bool _is_predicate_supported_by_index(const IndexInfo& index_info,
+                                        const std::shared_ptr<PredicateNode>& predicate_node) const;
   inline bool _is_single_column_index(const IndexInfo& index_info) const;
+  bool _has_unbound_parameter(const std::shared_ptr<PredicateNode>& predicate_node) const;
+
+  // Returns whether the PrimaryKeyIndex of the table below a chain of PredicateNodes starting at predicate_node is used
+  bool _apply_primary_key_index(const std::shared_ptr<PredicateNode>& predicate_node) const;
+  bool _is_primary_key_predicate(const std::shared_ptr<PredicateNode>& predicate_node, const ColumnID column_id) const;
 };
 
 }  // namespace opossum
@@ -0,0 +1,77 @@
+#include "join_ordering_rule.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "cost_model/abstract_cost_model.hpp"
+#include "expression/expression_utils.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "optimizer/join_ordering/dp_ccp.hpp"
+#include "optimizer/join_ordering/greedy_operator_ordering.hpp"
+#include "optimizer/join_ordering/join_graph.hpp"
+
+namespace opossum {
+
+JoinOrderingRule::JoinOrderingRule(const std::shared_ptr<AbstractCostModel>& cost_model) : _cost_model(cost_model) {}
+
+std::string JoinOrderingRule::name() const { return "Join Ordering Rule"; }
+
+bool JoinOrderingRule::apply_to(const std::shared_ptr<AbstractLQPNode>& root) const {
+  // The LogicalPlanRootNode is never part of a JoinGraph, so start with its inputs
+  auto lqp_changed = false;
+  _recurse_to_inputs(root, lqp_changed);
+  return lqp_changed;
+}
+
+std::shared_ptr<AbstractLQPNode> JoinOrderingRule::_perform_join_ordering_recursively(
+    const std::shared_ptr<AbstractLQPNode>& lqp, bool& lqp_changed) const {
+  /**
+   * If the root of the subplan is used by multiple outputs, replacing it for one of them would disconnect the others.
+   */
+  if (lqp->output_count() > 1) {
+    _recurse_to_inputs(lqp, lqp_changed);
+    return lqp;
+  }
+
+  const auto join_graph = JoinGraph::from_lqp(lqp);
+  if (!join_graph) {
+    _recurse_to_inputs(lqp, lqp_changed);
+    return lqp;
+  }
+
+  // Reordering the joins might change the column order, so remember it
+  const auto column_expressions = lqp->column_expressions();
+
+  // Optimize the subplans below the vertices first
+  for (const auto& vertex : join_graph->vertices) {
+    _recurse_to_inputs(vertex, lqp_changed);
+  }
+
+  auto result_lqp = std::shared_ptr<AbstractLQPNode>{};
+  if (join_graph->vertices.size() <= MAX_VERTEX_COUNT_FOR_DP_CCP) {
+    result_lqp = DpCcp{_cost_model}(*join_graph);
+  } else {
+    result_lqp = GreedyOperatorOrdering{_cost_model}(*join_graph);
+  }
+
+  if (!expressions_equal(result_lqp->column_expressions(), column_expressions)) {
+    result_lqp = ProjectionNode::make(column_expressions, result_lqp);
+  }
+
+  lqp_changed = true;
+
+  return result_lqp;
+}
+
+void JoinOrderingRule::_recurse_to_inputs(const std::shared_ptr<AbstractLQPNode>& lqp, bool& lqp_changed) const {
+  if (lqp->left_input()) {
+    lqp->set_left_input(_perform_join_ordering_recursively(lqp->left_input(), lqp_changed));
+  }
+  if (lqp->right_input()) {
+    lqp->set_right_input(_perform_join_ordering_recursively(lqp->right_input(), lqp_changed));
+  }
+}
+
+}  // namespace opossum
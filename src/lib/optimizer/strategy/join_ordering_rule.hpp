@@ -0,0 +1,47 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_rule.hpp"
+
+namespace opossum {
+
+class AbstractCostModel;
+class AbstractLQPNode;
+
+/**
+ * Reorders the inner and cross joins (and the predicates around them) of an LQP based on the estimated cost of the
+ * resulting plans.
+ *
+ * For each maximal subplan consisting of inner/cross JoinNodes and PredicateNodes, a JoinGraph is built and handed to
+ * a join ordering algorithm:
+ *  - DpCcp, which finds the cheapest bushy plan, for JoinGraphs with up to MAX_VERTEX_COUNT_FOR_DP_CCP vertices
+ *  - GreedyOperatorOrdering for larger JoinGraphs, where DpCcp would take too long
+ *
+ * Since reordering the joins can change the order of the output columns, a ProjectionNode restoring the original
+ * column order is placed on top of the reordered subplan if necessary.
+ *
+ * This rule is intended to run after the PredicatePushdownRule and the JoinDetectionRule, so that cross joins with
+ * predicates above them have already been turned into inner joins. The vertices of the JoinGraph are optimized
+ * recursively.
+ */
+class JoinOrderingRule : public AbstractRule {
+ public:
+  // Beyond this, the number of csg-cmp-pairs of densely connected JoinGraphs makes DpCcp too expensive
+  static constexpr auto MAX_VERTEX_COUNT_FOR_DP_CCP = size_t{12};
+
+  explicit JoinOrderingRule(const std::shared_ptr<AbstractCostModel>& cost_model);
+
+  std::string name() const override;
+  bool apply_to(const std::shared_ptr<AbstractLQPNode>& root) const override;
+
+ private:
+  std::shared_ptr<AbstractLQPNode> _perform_join_ordering_recursively(const std::shared_ptr<AbstractLQPNode>& lqp,
+                                                                      bool& lqp_changed) const;
+  void _recurse_to_inputs(const std::shared_ptr<AbstractLQPNode>& lqp, bool& lqp_changed) const;
+
+  const std::shared_ptr<AbstractCostModel> _cost_model;
+};
+
+}  // namespace opossum
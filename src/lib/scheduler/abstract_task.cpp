@@ -24,6 +24,8 @@ bool AbstractTask::is_ready() const { return _pending_predecessors == 0; }
 
 bool AbstractTask::is_done() const { return _done; }
 
+SchedulePriority AbstractTask::priority() const { return _priority; }
+
 bool AbstractTask::is_stealable() const { return _stealable; }
 
 bool AbstractTask::is_scheduled() const { return _is_scheduled; }
@@ -122,7 +124,11 @@ void AbstractTask::_on_predecessor_done() {
       auto worker = Worker::get_this_thread_worker();
       DebugAssert(static_cast<bool>(worker), "No worker");
 
-      worker->queue()->push(shared_from_this(), static_cast<uint32_t>(SchedulePriority::Highest));
+      // Tasks whose predecessors are done are put in front of new tasks so that started queries finish first. Tasks
+      // with the lowest priority (e.g., those of heavy queries) must not overtake other work, though.
+      const auto priority =
+          _priority == SchedulePriority::Lowest ? SchedulePriority::Lowest : SchedulePriority::Highest;
+      worker->queue()->push(shared_from_this(), static_cast<uint32_t>(priority));
     } else {
       if (_is_scheduled) execute();
       // Otherwise it will get execute()d once it is scheduled. It is entirely possible for Tasks to "become ready"
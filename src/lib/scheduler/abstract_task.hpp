@@ -42,6 +42,8 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
    */
   bool is_done() const;
 
+  SchedulePriority priority() const;
+
   /**
    * @return Workers are allowed to steal the task from another node
    */
@@ -23,7 +23,8 @@ class OperatorTask : public AbstractTask {
    * Create tasks recursively from result operator and set task dependencies automatically.
    */
   static const std::vector<std::shared_ptr<OperatorTask>> make_tasks_from_operator(
-      const std::shared_ptr<AbstractOperator>& op, CleanupTemporaries cleanup_temporaries);
+      const std::shared_ptr<AbstractOperator>& op, CleanupTemporaries cleanup_temporaries,
+      SchedulePriority priority = SchedulePriority::Default);
 
   const std::shared_ptr<AbstractOperator>& get_operator() const;
 
@@ -39,7 +40,7 @@ class OperatorTask : public AbstractTask {
   static std::shared_ptr<OperatorTask> _add_tasks_from_operator(
       std::shared_ptr<AbstractOperator> op, std::vector<std::shared_ptr<OperatorTask>>& tasks,
       std::unordered_map<std::shared_ptr<AbstractOperator>, std::shared_ptr<OperatorTask>>& task_by_op,
-      CleanupTemporaries cleanup_temporaries);
+      CleanupTemporaries cleanup_temporaries, SchedulePriority priority);
 
  private:
   std::shared_ptr<AbstractOperator> _op;
@@ -0,0 +1,117 @@
+#include "resource_group.hpp"
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+ResourceGroup::ResourceGroup(const std::string& name, const SchedulePriority priority,
+                             const size_t max_concurrent_query_count)
+    : _name(name), _priority(priority), _max_concurrent_query_count(max_concurrent_query_count) {
+  Assert(priority != SchedulePriority::JobTask, "Queries cannot be executed with the priority of JobTasks.");
+}
+
+const std::string& ResourceGroup::name() const { return _name; }
+
+SchedulePriority ResourceGroup::priority() const { return _priority; }
+
+size_t ResourceGroup::max_concurrent_query_count() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _max_concurrent_query_count;
+}
+
+void ResourceGroup::set_max_concurrent_query_count(const size_t max_concurrent_query_count) {
+  auto admitted_queries = std::vector<QueuedQuery>{};
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _max_concurrent_query_count = max_concurrent_query_count;
+
+    while (!_queued_queries.empty() && _can_admit()) {
+      admitted_queries.emplace_back(_queued_queries.front());
+      _queued_queries.pop_front();
+      admitted_queries.back().slot->admitted = true;
+      ++_running_query_count;
+    }
+  }
+
+  for (const auto& query : admitted_queries) {
+    _schedule_admission_task(query);
+  }
+}
+
+size_t ResourceGroup::running_query_count() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _running_query_count;
+}
+
+size_t ResourceGroup::queued_query_count() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _queued_queries.size();
+}
+
+ResourceGroup::QuerySlot::QuerySlot(const std::shared_ptr<ResourceGroup>& resource_group, const size_t root_count)
+    : resource_group(resource_group), pending_root_count(root_count) {}
+
+ResourceGroup::QuerySlot::~QuerySlot() { release(); }
+
+void ResourceGroup::QuerySlot::on_root_done() {
+  if (--pending_root_count == 0) release();
+}
+
+void ResourceGroup::QuerySlot::release() {
+  if (admitted.exchange(false)) resource_group->_on_query_done();
+}
+
+void ResourceGroup::_admit(const QueuedQuery& query) {
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (!_can_admit()) {
+      _queued_queries.emplace_back(query);
+      return;
+    }
+    query.slot->admitted = true;
+    ++_running_query_count;
+  }
+
+  _schedule_admission_task(query);
+}
+
+void ResourceGroup::_schedule_admission_task(const QueuedQuery& query) {
+  // Without a Scheduler, this executes the query. If one of its operators fails, the query never reaches its roots and
+  // its tasks might be kept alive by the caller, so the slot is released right away.
+  try {
+    query.admission_task->schedule();
+  } catch (...) {
+    query.slot->release();
+    throw;
+  }
+}
+
+void ResourceGroup::_on_query_done() {
+  auto next_query = std::optional<QueuedQuery>{};
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    DebugAssert(_running_query_count > 0, "No query of the ResourceGroup is running.");
+
+    // The next query takes over the slot of the query that is done, unless the limit was lowered in the meantime
+    if (!_queued_queries.empty() && _running_query_count <= _max_concurrent_query_count) {
+      next_query = _queued_queries.front();
+      _queued_queries.pop_front();
+      next_query->slot->admitted = true;
+    } else {
+      --_running_query_count;
+    }
+  }
+
+  if (next_query) _schedule_admission_task(*next_query);
+}
+
+bool ResourceGroup::_can_admit() const {
+  return _max_concurrent_query_count == 0 || _running_query_count < _max_concurrent_query_count;
+}
+
+}  // namespace opossum
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "job_task.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * A class of queries whose OperatorTasks are executed with the same SchedulePriority. Optionally, a ResourceGroup
+ * limits how many of its queries may execute at the same time. Queries exceeding this limit are queued until another
+ * query of the group is done.
+ *
+ * Queued queries do not block a thread (and thus possibly a Worker): All tasks of a query are scheduled right away, but
+ * the tasks without predecessors depend on an admission task. The group schedules the admission task once it admits
+ * the query. A query is done once the roots of all its operator trees are done. If one of its operators fails, a root
+ * is never done. The slot of the query is then released once its tasks are destroyed.
+ *
+ * SQLPipelineStatements execute in the ResourceGroup they were built with (see SQLPipelineBuilder) or in one of the
+ * default groups of the ResourceGroupManager.
+ */
+class ResourceGroup : public std::enable_shared_from_this<ResourceGroup>, private Noncopyable {
+ public:
+  // A max_concurrent_query_count of 0 does not limit the number of concurrently executing queries
+  ResourceGroup(const std::string& name, const SchedulePriority priority, const size_t max_concurrent_query_count = 0);
+
+  const std::string& name() const;
+  SchedulePriority priority() const;
+
+  size_t max_concurrent_query_count() const;
+  void set_max_concurrent_query_count(const size_t max_concurrent_query_count);
+
+  size_t running_query_count() const;
+  size_t queued_query_count() const;
+
+  /**
+   * Schedules the tasks of a query, which are executed once the group admits the query. A query may consist of
+   * several operator trees (see SQLQueryPlan::create_tasks()). It is done once the roots of all of them, i.e., the
+   * tasks without successors, are done.
+   */
+  template <typename TaskType>
+  void schedule_tasks(const std::vector<std::shared_ptr<TaskType>>& tasks);
+
+ private:
+  // Held by the done callbacks of the root tasks of a query. Thus, the slot of an admitted query is released when all
+  // roots are done or, if an operator failed, when the tasks of the query are destroyed.
+  struct QuerySlot {
+    QuerySlot(const std::shared_ptr<ResourceGroup>& resource_group, const size_t root_count);
+    ~QuerySlot();
+
+    // Releases the slot once the last root of the query is done.
+    void on_root_done();
+
+    // Releases the slot if the query was admitted. Only the first call has an effect.
+    void release();
+
+    const std::shared_ptr<ResourceGroup> resource_group;
+    std::atomic_size_t pending_root_count;
+    std::atomic_bool admitted{false};
+  };
+
+  struct QueuedQuery {
+    std::shared_ptr<AbstractTask> admission_task;
+    std::shared_ptr<QuerySlot> slot;
+  };
+
+  void _admit(const QueuedQuery& query);
+  void _schedule_admission_task(const QueuedQuery& query);
+  void _on_query_done();
+  bool _can_admit() const;
+
+  const std::string _name;
+  const SchedulePriority _priority;
+
+  mutable std::mutex _mutex;
+  size_t _max_concurrent_query_count;
+  size_t _running_query_count{0};
+  std::deque<QueuedQuery> _queued_queries;
+};
+
+template <typename TaskType>
+void ResourceGroup::schedule_tasks(const std::vector<std::shared_ptr<TaskType>>& tasks) {
+  if (tasks.empty()) return;
+
+  const auto admission_task = std::make_shared<JobTask>([]() {});
+  for (const auto& task : tasks) {
+    if (task->predecessors().empty()) admission_task->set_as_predecessor_of(task);
+  }
+  const auto root_count = static_cast<size_t>(
+      std::count_if(tasks.cbegin(), tasks.cend(), [](const auto& task) { return task->successors().empty(); }));
+  const auto slot = std::make_shared<QuerySlot>(shared_from_this(), root_count);
+  for (const auto& task : tasks) {
+    if (task->successors().empty()) task->set_done_callback([slot]() { slot->on_root_done(); });
+  }
+
+  // None of the tasks is ready yet, so this does not execute them
+  for (const auto& task : tasks) {
+    task->schedule();
+  }
+
+  _admit({admission_task, slot});
+}
+
+}  // namespace opossum
@@ -0,0 +1,56 @@
+#include "resource_group_manager.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <thread>
+
+#include "resource_group.hpp"
+
+namespace opossum {
+
+ResourceGroupManager& ResourceGroupManager::get() {
+  static ResourceGroupManager instance;
+  return instance;
+}
+
+void ResourceGroupManager::reset() {
+  auto& manager = get();
+  manager._short_query_group = _make_short_query_group();
+  manager._heavy_query_group = _make_heavy_query_group();
+  manager._heavy_query_cost_threshold = DEFAULT_HEAVY_QUERY_COST_THRESHOLD;
+}
+
+ResourceGroupManager::ResourceGroupManager()
+    : _short_query_group(_make_short_query_group()), _heavy_query_group(_make_heavy_query_group()) {}
+
+const std::shared_ptr<ResourceGroup>& ResourceGroupManager::short_query_group() const { return _short_query_group; }
+
+const std::shared_ptr<ResourceGroup>& ResourceGroupManager::heavy_query_group() const { return _heavy_query_group; }
+
+std::optional<Cost> ResourceGroupManager::heavy_query_cost_threshold() const { return _heavy_query_cost_threshold; }
+
+void ResourceGroupManager::set_heavy_query_cost_threshold(const std::optional<Cost>& heavy_query_cost_threshold) {
+  _heavy_query_cost_threshold = heavy_query_cost_threshold;
+}
+
+const std::shared_ptr<ResourceGroup>& ResourceGroupManager::resource_group_for_cost(
+    const std::optional<Cost>& estimated_cost) const {
+  const auto heavy_query_cost_threshold = _heavy_query_cost_threshold.load();
+  if (estimated_cost && heavy_query_cost_threshold && *estimated_cost > *heavy_query_cost_threshold) {
+    return _heavy_query_group;
+  }
+  return _short_query_group;
+}
+
+std::shared_ptr<ResourceGroup> ResourceGroupManager::_make_short_query_group() {
+  return std::make_shared<ResourceGroup>("short", SchedulePriority::Default);
+}
+
+std::shared_ptr<ResourceGroup> ResourceGroupManager::_make_heavy_query_group() {
+  // A few heavy queries suffice to keep all cores busy with their JobTasks
+  return std::make_shared<ResourceGroup>("heavy", SchedulePriority::Lowest,
+                                         std::max(1u, std::thread::hardware_concurrency() / 4));
+}
+
+}  // namespace opossum
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <optional>
+
+#include "cost_model/cost.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class ResourceGroup;
+
+/**
+ * Holds the ResourceGroups that queries are executed in if they were not built with one (see
+ * SQLPipelineBuilder::with_resource_group()). Queries whose estimated cost (see
+ * AbstractCostModel::estimate_plan_cost()) exceeds the heavy query cost threshold are executed in the heavy query
+ * group. Its tasks have the lowest priority and only a few heavy queries may execute at the same time, so that
+ * analytical queries cannot flood the TaskQueues and starve concurrent point queries. All other queries, including
+ * those whose cost cannot be estimated, are executed in the short query group with the default priority and without a
+ * limit.
+ *
+ * Estimating the cost of a query is not free. If the threshold is unset, the cost of queries is not estimated and all
+ * of them are executed in the short query group.
+ */
+class ResourceGroupManager : private Noncopyable {
+ public:
+  // The CostModelLogical estimates the number of tuple accesses
+  static constexpr auto DEFAULT_HEAVY_QUERY_COST_THRESHOLD = Cost{1'000'000};
+
+  static ResourceGroupManager& get();
+
+  // Restores the default groups and threshold. Only to be called when no queries are executing, e.g., in tests.
+  static void reset();
+
+  const std::shared_ptr<ResourceGroup>& short_query_group() const;
+  const std::shared_ptr<ResourceGroup>& heavy_query_group() const;
+
+  std::optional<Cost> heavy_query_cost_threshold() const;
+  void set_heavy_query_cost_threshold(const std::optional<Cost>& heavy_query_cost_threshold);
+
+  const std::shared_ptr<ResourceGroup>& resource_group_for_cost(const std::optional<Cost>& estimated_cost) const;
+
+ private:
+  ResourceGroupManager();
+
+  static std::shared_ptr<ResourceGroup> _make_short_query_group();
+  static std::shared_ptr<ResourceGroup> _make_heavy_query_group();
+
+  std::shared_ptr<ResourceGroup> _short_query_group;
+  std::shared_ptr<ResourceGroup> _heavy_query_group;
+  std::atomic<std::optional<Cost>> _heavy_query_cost_threshold{DEFAULT_HEAVY_QUERY_COST_THRESHOLD};
+};
+
+}  // namespace opossum
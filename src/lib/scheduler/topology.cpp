@@ -5,9 +5,11 @@
 #endif
 
 #include <algorithm>
+#include <fstream>
 #include <iomanip>
 #include <memory>
 #include <sstream>
+#include <string>
 #include <thread>
 #include <utility>
 #include <vector>
@@ -27,7 +29,10 @@ Topology& Topology::get() {
   return instance;
 }
 
-Topology::Topology() { _init_default_topology(); }
+Topology::Topology() {
+  _detect_cache_sizes();
+  _init_default_topology();
+}
 
 void TopologyNode::print(std::ostream& stream) const {
   stream << "Number of Node CPUs: " << cpus.size() << ", CPUIDs: [";
@@ -170,6 +175,8 @@ const std::vector<TopologyNode>& Topology::nodes() { return _nodes; }
 
 size_t Topology::num_cpus() const { return _num_cpus; }
 
+size_t Topology::l2_cache_size() const { return _l2_cache_size; }
+
 boost::container::pmr::memory_resource* Topology::get_memory_resource(int node_id) {
   DebugAssert(node_id >= 0 && node_id < static_cast<int>(_nodes.size()), "node_id is out of bounds");
   return &_memory_resources[static_cast<size_t>(node_id)];
@@ -177,6 +184,7 @@ boost::container::pmr::memory_resource* Topology::get_memory_resource(int node_i
 
 void Topology::print(std::ostream& stream) const {
   stream << "Number of CPUs: " << _num_cpus << std::endl;
+  stream << "L2 cache size: " << _l2_cache_size << " bytes" << std::endl;
   for (size_t node_idx = 0; node_idx < _nodes.size(); ++node_idx) {
     stream << "Node #" << node_idx << " - ";
     _nodes[node_idx].print(stream);
@@ -190,6 +198,39 @@ void Topology::_clear() {
   _num_cpus = 0;
 }
 
+void Topology::_detect_cache_sizes() {
+  // On Linux, each cache of a CPU is described by a directory index<N>, whose files contain the level, the type (Data,
+  // Instruction, or Unified), and the size (e.g., "256K") of the cache. We assume that all cores are alike.
+  const auto cache_path = std::string{"/sys/devices/system/cpu/cpu0/cache/index"};
+  for (auto index = 0;; ++index) {
+    std::ifstream level_file{cache_path + std::to_string(index) + "/level"};
+    std::ifstream type_file{cache_path + std::to_string(index) + "/type"};
+    std::ifstream size_file{cache_path + std::to_string(index) + "/size"};
+    if (!level_file || !type_file || !size_file) {
+      break;
+    }
+
+    auto level = 0;
+    auto type = std::string{};
+    auto size = size_t{0};
+    auto unit = char{0};
+    level_file >> level;
+    type_file >> type;
+    size_file >> size >> unit;
+
+    if (level != 2 || type == "Instruction" || size == 0) {
+      continue;
+    }
+
+    if (unit == 'K') {
+      size *= 1024;
+    } else if (unit == 'M') {
+      size *= 1024 * 1024;
+    }
+    _l2_cache_size = size;
+  }
+}
+
 void Topology::_create_memory_resources() {
   for (auto node_id = size_t{0}; node_id < _nodes.size(); node_id++) {
     auto memsource_name = std::stringstream();
@@ -84,6 +84,10 @@ class Topology final {
 
   size_t num_cpus() const;
 
+  // Size of the L2 cache of a core in bytes. It is read from sysfs once, when the Topology is created, and falls back
+  // to 256 KB if it cannot be determined. Replacing the topology (e.g., by a fake NUMA topology) does not change it.
+  size_t l2_cache_size() const;
+
   boost::container::pmr::memory_resource* get_memory_resource(int node_id);
 
   void print(std::ostream& stream = std::cout) const;
@@ -98,9 +102,11 @@ class Topology final {
 
   void _clear();
   void _create_memory_resources();
+  void _detect_cache_sizes();
 
   std::vector<TopologyNode> _nodes;
   size_t _num_cpus{0};
+  size_t _l2_cache_size{256'000};
   bool _fake_numa_topology{false};
 
   static const int _number_of_hardware_nodes;
@@ -0,0 +1,75 @@
+#include "admission_queue.hpp"
+
+#include <memory>
+#include <optional>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+AdmissionQueue::AdmissionQueue(const size_t max_running_task_count) : _max_running_task_count(max_running_task_count) {
+  Assert(_max_running_task_count > 0, "At least one task has to be able to run.");
+}
+
+void AdmissionQueue::submit(const std::shared_ptr<AbstractTask>& task, const SchedulePriority priority,
+                            const DoneCallback& done_callback) {
+  auto queued_task = QueuedTask{task, std::make_shared<std::chrono::steady_clock::time_point>()};
+
+  // The callback runs on the thread that executed the task, right after it is done
+  auto self = shared_from_this();
+  const auto admission_time = queued_task.admission_time;
+  task->set_done_callback([self, admission_time, done_callback]() {
+    if (done_callback) done_callback(std::chrono::steady_clock::now() - *admission_time);
+    self->_on_task_done();
+  });
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_running_task_count == _max_running_task_count) {
+      _queued_tasks.emplace(std::make_pair(priority, _next_sequence_number++), queued_task);
+      return;
+    }
+    ++_running_task_count;
+  }
+
+  // Schedule outside of the lock: Without a scheduler, the task is executed right away and calls _on_task_done()
+  _admit(queued_task);
+}
+
+size_t AdmissionQueue::max_running_task_count() const { return _max_running_task_count; }
+
+size_t AdmissionQueue::running_task_count() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _running_task_count;
+}
+
+size_t AdmissionQueue::queued_task_count() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _queued_tasks.size();
+}
+
+void AdmissionQueue::_admit(const QueuedTask& queued_task) {
+  *queued_task.admission_time = std::chrono::steady_clock::now();
+  queued_task.task->schedule();
+}
+
+void AdmissionQueue::_on_task_done() {
+  std::optional<QueuedTask> next_task;
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_queued_tasks.empty()) {
+      --_running_task_count;
+      return;
+    }
+
+    // The finished task hands its slot over to the next one, so _running_task_count does not change
+    const auto next_task_it = _queued_tasks.begin();
+    next_task = next_task_it->second;
+    _queued_tasks.erase(next_task_it);
+  }
+
+  _admit(*next_task);
+}
+
+}  // namespace opossum
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "scheduler/abstract_task.hpp"
+
+namespace opossum {
+
+/**
+ * Bounds the number of server tasks (i.e., the planning and execution of queries) that are handed to the scheduler at
+ * the same time. Without this, hundreds of concurrent clients would flood the TaskQueues and oversubscribe the cores.
+ *
+ * Tasks that exceed the bound wait in the queue until a running one is done. They are admitted by the priority of
+ * their session first and in the order of their submission second, so that the short queries of one session do not
+ * wait behind the long queries of others.
+ *
+ * The queue is shared by all sessions of a Server, see TaskRunner.
+ */
+class AdmissionQueue : public std::enable_shared_from_this<AdmissionQueue> {
+ public:
+  // Called with the time from the admission of a task until it was done
+  using DoneCallback = std::function<void(std::chrono::nanoseconds)>;
+
+  explicit AdmissionQueue(size_t max_running_task_count);
+
+  /**
+   * Schedules the task right away if fewer than max_running_task_count tasks are running, otherwise once it is the
+   * next one in the queue. Only tasks of the priorities Highest and Default are expected, lower values are admitted
+   * first. The task's done callback is used by the AdmissionQueue and must not be set.
+   */
+  void submit(const std::shared_ptr<AbstractTask>& task, SchedulePriority priority,
+              const DoneCallback& done_callback = {});
+
+  size_t max_running_task_count() const;
+  size_t running_task_count() const;
+  size_t queued_task_count() const;
+
+ protected:
+  struct QueuedTask {
+    std::shared_ptr<AbstractTask> task;
+    std::shared_ptr<std::chrono::steady_clock::time_point> admission_time;
+  };
+
+  void _admit(const QueuedTask& queued_task);
+  void _on_task_done();
+
+  const size_t _max_running_task_count;
+
+  mutable std::mutex _mutex;
+  size_t _running_task_count{0};
+  // Ordered by priority and then by the sequence number, i.e., the order of submission
+  std::map<std::pair<SchedulePriority, uint64_t>, QueuedTask> _queued_tasks;
+  uint64_t _next_sequence_number{0};
+};
+
+}  // namespace opossum
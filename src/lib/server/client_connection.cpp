@@ -61,7 +61,7 @@ boost::future<void> ClientConnection::receive_flush_packet_body(uint32_t size) {
   return _receive_bytes_async(size) >> then >> [](InputPacket packet) {};
 }
 
-boost::future<std::string> ClientConnection::receive_execute_packet_body(uint32_t size) {
+boost::future<ExecutePacket> ClientConnection::receive_execute_packet_body(uint32_t size) {
   return _receive_bytes_async(size) >> then >> PostgresWireHandler::handle_execute_packet;
 }
 
@@ -166,48 +166,27 @@ boost::future<void> ClientConnection::send_row_description(const std::vector<Col
     PostgresWireHandler::write_value(*output_packet, htonl(column_description.object_id));   // object id of type
     PostgresWireHandler::write_value(*output_packet, htons(column_description.type_width));  // regular int
     PostgresWireHandler::write_value(*output_packet, htonl(-1));                             // no modifier
-    PostgresWireHandler::write_value(*output_packet, htons(0u));                             // text format
+    PostgresWireHandler::write_value(*output_packet, htons(static_cast<int16_t>(column_description.format_code)));
   }
 
   return _send_bytes_async(output_packet) >> then >> ignore_sent_bytes;
 }
 
-boost::future<void> ClientConnection::send_data_row(const std::vector<std::string>& row_strings) {
-  auto output_packet = PostgresWireHandler::new_output_packet(NetworkMessageType::DataRow);
+boost::future<void> ClientConnection::send_data_rows(const std::shared_ptr<const ByteBuffer>& data) {
+  // Messages that are still buffered (e.g., the RowDescription) have to be sent first to keep the order of messages
+  auto flushed = _response_buffer.empty() ? boost::make_ready_future<uint64_t>(0) : _flush_async();
 
-  /*
-  DataRow (B)
-  Byte1('D')
-  Identifies the message as a data row.
-
-  Int32
-  Length of message contents in bytes, including self.
-
-  Int16
-  The number of column values that follow (possibly zero).
-
-  Next, the following pair of fields appear for each column:
-
-  Int32
-  The length of the column value, in bytes (this count does not include itself). Can be zero. As a special case,
-  -1 indicates a NULL column value. No value bytes follow in the NULL case.
-
-  Byte n
-  The value of the column, in the format indicated by the associated format code. n is the above length.
-  */
-
-  // Number of columns in row
-  PostgresWireHandler::write_value(*output_packet, htons(row_strings.size()));
-
-  for (const auto& value_string : row_strings) {
-    // Size of string representation of value, NOT of value type's size
-    PostgresWireHandler::write_value(*output_packet, htonl(value_string.length()));
-
-    // Text mode means that all values are sent as non-terminated strings
-    PostgresWireHandler::write_string(*output_packet, value_string, false);
-  }
-
-  return _send_bytes_async(output_packet) >> then >> ignore_sent_bytes;
+  // We need a copy of this client connection to outlive the async operation. data has to stay alive until all bytes
+  // are written, so it is captured by the last continuation.
+  auto self = shared_from_this();
+  return std::move(flushed) >> then >>
+         [self, data](uint64_t) {
+           return boost::asio::async_write(self->_socket, boost::asio::buffer(*data), boost::asio::use_boost_future);
+         } >>
+         then >> [data](uint64_t sent_bytes) {
+           // If this fails, the connection may be closed but the server will keep running.
+           Assert(sent_bytes == data->size(), "Could not send all data");
+         };
 }
 
 boost::future<void> ClientConnection::send_command_complete(const std::string& message) {
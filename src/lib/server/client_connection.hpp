@@ -13,12 +13,15 @@ struct OutputPacket;
 struct RequestHeader;
 struct ParsePacket;
 struct BindPacket;
+struct ExecutePacket;
 enum class NetworkMessageType : unsigned char;
+enum class FormatCode : int16_t;
 
 struct ColumnDescription {
   std::string column_name;
   uint64_t object_id;
   int64_t type_width;
+  FormatCode format_code;
 };
 
 // This class provides a wrapper over the TCP socket and (de)serializes
@@ -38,7 +41,7 @@ class ClientConnection : public std::enable_shared_from_this<ClientConnection> {
   boost::future<std::string> receive_describe_packet_body(uint32_t size);
   boost::future<void> receive_sync_packet_body(uint32_t size);
   boost::future<void> receive_flush_packet_body(uint32_t size);
-  boost::future<std::string> receive_execute_packet_body(uint32_t size);
+  boost::future<ExecutePacket> receive_execute_packet_body(uint32_t size);
 
   boost::future<void> send_ssl_denied();
   boost::future<void> send_auth();
@@ -48,7 +51,9 @@ class ClientConnection : public std::enable_shared_from_this<ClientConnection> {
   boost::future<void> send_notice(const std::string& notice);
   boost::future<void> send_status_message(const NetworkMessageType& type);
   boost::future<void> send_row_description(const std::vector<ColumnDescription>& row_description);
-  boost::future<void> send_data_row(const std::vector<std::string>& row_strings);
+  // Sends DataRow messages that were serialized by the QueryResponseBuilder. They are written at once, bypassing the
+  // response buffer, so that a batch of rows reaches the client right away and is not limited by _max_response_size.
+  boost::future<void> send_data_rows(const std::shared_ptr<const ByteBuffer>& data);
   boost::future<void> send_command_complete(const std::string& message);
 
  protected:
@@ -2,6 +2,7 @@
 
 #include <iostream>
 #include <iterator>
+#include <string>
 
 #include "sql/sql_pipeline.hpp"
 #include "types.hpp"
@@ -83,15 +84,24 @@ BindPacket PostgresWireHandler::handle_bind_packet(const InputPacket& packet) {
   }
 
   auto num_result_column_format_codes = ntohs(read_value<int16_t>(packet));
-  auto result_column_format_codes = read_values<int16_t>(packet, num_result_column_format_codes);
+  auto network_result_column_format_codes = read_values<int16_t>(packet, num_result_column_format_codes);
+
+  std::vector<FormatCode> result_column_format_codes;
+  for (const auto network_format_code : network_result_column_format_codes) {
+    const auto format_code = static_cast<FormatCode>(ntohs(network_format_code));
+    // The ServerSession sends the error to the client instead of executing the statement
+    AssertInput(format_code == FormatCode::Text || format_code == FormatCode::Binary,
+                "Unsupported format code " + std::to_string(static_cast<int16_t>(format_code)) + ".");
+    result_column_format_codes.emplace_back(format_code);
+  }
 
-  return BindPacket{statement_name, portal, std::move(parameter_values)};
+  return BindPacket{statement_name, portal, std::move(parameter_values), std::move(result_column_format_codes)};
 }
 
-std::string PostgresWireHandler::handle_execute_packet(const InputPacket& packet) {
-  const auto portal = read_string(packet);
-  /*const auto max_rows = */ read_value<int32_t>(packet);
-  return portal;
+ExecutePacket PostgresWireHandler::handle_execute_packet(const InputPacket& packet) {
+  auto portal = read_string(packet);
+  const auto max_rows = ntohl(read_value<uint32_t>(packet));
+  return ExecutePacket{std::move(portal), max_rows};
 }
 
 std::string PostgresWireHandler::handle_describe_packet(const InputPacket& packet) {
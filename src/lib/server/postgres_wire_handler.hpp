@@ -43,6 +43,14 @@ struct BindPacket {
   std::string statement_name;
   std::string destination_portal;
   std::vector<AllTypeVariant> params;
+  // Either empty (all columns use text), a single code for all columns, or one code per result column
+  std::vector<FormatCode> result_format_codes;
+};
+
+struct ExecutePacket {
+  std::string portal;
+  // Maximum number of rows to return, 0 means "no limit"
+  uint32_t max_rows;
 };
 
 class PostgresWireHandler {
@@ -59,7 +67,7 @@ class PostgresWireHandler {
   static ParsePacket handle_parse_packet(const InputPacket& packet);
   static BindPacket handle_bind_packet(const InputPacket& packet);
   static std::string handle_describe_packet(const InputPacket& packet);
-  static std::string handle_execute_packet(const InputPacket& packet);
+  static ExecutePacket handle_execute_packet(const InputPacket& packet);
 
   template <typename T>
   static T read_value(const InputPacket& packet);
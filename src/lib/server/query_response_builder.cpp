@@ -1,17 +1,120 @@
 #include "query_response_builder.hpp"
 
+#include <arpa/inet.h>
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "resolve_type.hpp"
 #include "server/postgres_wire_handler.hpp"
 #include "sql/sql_pipeline.hpp"
+#include "storage/create_iterable_from_column.hpp"
 
 #include "SQLParserResult.h"
 
 #include "then_operator.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+void write_int16(ByteBuffer& buffer, const int16_t value) {
+  const auto network_value = htons(static_cast<uint16_t>(value));
+  const auto chars = reinterpret_cast<const char*>(&network_value);
+  buffer.insert(buffer.end(), chars, chars + sizeof(network_value));
+}
+
+void write_int32(ByteBuffer& buffer, const int32_t value) {
+  const auto network_value = htonl(static_cast<uint32_t>(value));
+  const auto chars = reinterpret_cast<const char*>(&network_value);
+  buffer.insert(buffer.end(), chars, chars + sizeof(network_value));
+}
+
+void write_int64(ByteBuffer& buffer, const int64_t value) {
+  // There is no htonl for 64 bit values, so we write the bytes starting with the most significant one
+  for (auto shift = 56; shift >= 0; shift -= 8) {
+    buffer.push_back(static_cast<char>((static_cast<uint64_t>(value) >> shift) & 0xFF));
+  }
+}
+
+// Writes the length of the value followed by its binary representation, as described in the send functions of the
+// Postgres types (e.g., int4send and float8send)
+template <typename T>
+void write_binary_value(ByteBuffer& buffer, const T& value) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    write_int32(buffer, static_cast<int32_t>(value.size()));
+    buffer.insert(buffer.end(), value.cbegin(), value.cend());
+  } else if constexpr (std::is_same_v<T, int32_t>) {
+    write_int32(buffer, sizeof(int32_t));
+    write_int32(buffer, value);
+  } else if constexpr (std::is_same_v<T, int64_t>) {
+    write_int32(buffer, sizeof(int64_t));
+    write_int64(buffer, value);
+  } else if constexpr (std::is_same_v<T, float>) {
+    static_assert(sizeof(float) == sizeof(int32_t), "Floats are sent as IEEE 754 single precision values.");
+    int32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    write_int32(buffer, sizeof(int32_t));
+    write_int32(buffer, bits);
+  } else {
+    static_assert(std::is_same_v<T, double> && sizeof(double) == sizeof(int64_t),
+                  "Doubles are sent as IEEE 754 double precision values.");
+    int64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    write_int32(buffer, sizeof(int64_t));
+    write_int64(buffer, bits);
+  }
+}
+
+// Writes the length of the value followed by its text representation. Numbers are printed into a stack buffer, using
+// the same format as type_cast<std::string>.
+template <typename T>
+void write_text_value(ByteBuffer& buffer, const T& value) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    write_binary_value(buffer, value);
+  } else {
+    char chars[32];
+    auto length = 0;
+    if constexpr (std::is_same_v<T, int32_t>) {
+      length = std::snprintf(chars, sizeof(chars), "%" PRId32, value);
+    } else if constexpr (std::is_same_v<T, int64_t>) {
+      length = std::snprintf(chars, sizeof(chars), "%" PRId64, value);
+    } else {
+      length = std::snprintf(chars, sizeof(chars), "%g", static_cast<double>(value));
+    }
+    DebugAssert(length > 0 && static_cast<size_t>(length) < sizeof(chars), "Could not print value.");
+
+    write_int32(buffer, length);
+    buffer.insert(buffer.end(), chars, chars + length);
+  }
+}
+
+}  // namespace
+
 namespace opossum {
 
 using opossum::then_operator::then;
 
-std::vector<ColumnDescription> QueryResponseBuilder::build_row_description(const std::shared_ptr<const Table>& table) {
+std::vector<FormatCode> QueryResponseBuilder::build_format_codes(const std::vector<FormatCode>& requested_format_codes,
+                                                                 const size_t column_count) {
+  // No format code means that all columns use text, a single one applies to all columns
+  if (requested_format_codes.empty()) return std::vector<FormatCode>(column_count, FormatCode::Text);
+  if (requested_format_codes.size() == 1) return std::vector<FormatCode>(column_count, requested_format_codes.front());
+
+  // The ServerSession rejects Bind messages with a different number of format codes already
+  Assert(requested_format_codes.size() == column_count,
+         "The number of result format codes does not match the number of result columns.");
+  return requested_format_codes;
+}
+
+std::vector<ColumnDescription> QueryResponseBuilder::build_row_description(
+    const std::shared_ptr<const Table>& table, const std::vector<FormatCode>& format_codes) {
   std::vector<ColumnDescription> result;
 
   const auto& column_names = table->column_names();
@@ -46,7 +149,7 @@ std::vector<ColumnDescription> QueryResponseBuilder::build_row_description(const
         Fail("Bad DataType");
     }
 
-    result.emplace_back(ColumnDescription{column_names[column_id], object_id, type_id});
+    result.emplace_back(ColumnDescription{column_names[column_id], object_id, type_id, format_codes[column_id]});
   }
 
   return result;
@@ -82,38 +185,148 @@ std::string QueryResponseBuilder::build_execution_info_message(const std::shared
   return sql_pipeline->metrics().to_string();
 }
 
-boost::future<uint64_t> QueryResponseBuilder::send_query_response(const send_row_t& send_row, const Table& table) {
-  // Essentially we're iterating over every row in every chunk in the table, generating and sending
-  // its string representation. However, because of the asynchronous send_row call, we have to
-  // use this two-level recursion instead of two nested for-loops
+void QueryResponseBuilder::build_data_rows(const Chunk& chunk, const ChunkOffset begin_offset,
+                                           const ChunkOffset end_offset, const std::vector<FormatCode>& format_codes,
+                                           ByteBuffer& output) {
+  /*
+  DataRow (B)
+  Byte1('D')
+  Identifies the message as a data row.
 
-  return _send_query_response_chunks(send_row, table, ChunkID{0}) >> then >> [&]() { return table.row_count(); };
-}
+  Int32
+  Length of message contents in bytes, including self.
+
+  Int16
+  The number of column values that follow (possibly zero).
 
-boost::future<void> QueryResponseBuilder::_send_query_response_chunks(const send_row_t& send_row, const Table& table,
-                                                                      ChunkID current_chunk_id) {
-  if (current_chunk_id == table.chunk_count()) return boost::make_ready_future();
+  Next, the following pair of fields appear for each column:
 
-  const auto& chunk = table.get_chunk(current_chunk_id);
+  Int32
+  The length of the column value, in bytes (this count does not include itself). Can be zero. As a special case,
+  -1 indicates a NULL column value. No value bytes follow in the NULL case.
 
-  return _send_query_response_rows(send_row, *chunk, ChunkOffset{0}) >> then >>
-         std::bind(QueryResponseBuilder::_send_query_response_chunks, send_row, std::ref(table),
-                   ChunkID{current_chunk_id + 1});
+  Byte n
+  The value of the column, in the format indicated by the associated format code. n is the above length.
+  */
+
+  const auto column_count = chunk.column_count();
+  const auto row_count = size_t{end_offset - begin_offset};
+  DebugAssert(format_codes.size() == column_count, "Expected one format code per column.");
+
+  // The length and value fields of each column. The fields of the i-th row are [field_ends[i], field_ends[i + 1]).
+  auto fields = std::vector<ByteBuffer>(column_count);
+  auto field_ends = std::vector<std::vector<size_t>>(column_count);
+
+  for (ColumnID column_id{0}; column_id < column_count; ++column_id) {
+    auto& column_fields = fields[column_id];
+    auto& column_field_ends = field_ends[column_id];
+    column_field_ends.reserve(row_count + 1);
+    column_field_ends.emplace_back(0);
+
+    const auto format_code = format_codes[column_id];
+
+    resolve_data_and_column_type(*chunk.get_column(column_id), [&](auto type, const auto& typed_column) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      create_iterable_from_column<ColumnDataType>(typed_column).with_iterators([&](auto it, auto end) {
+        // The iterators of ReferenceColumns do not return the chunk offset of NULLs, so we count them ourselves
+        for (auto chunk_offset = ChunkOffset{0}; it != end && chunk_offset < end_offset; ++it, ++chunk_offset) {
+          if (chunk_offset < begin_offset) continue;
+
+          const auto value = *it;
+          if (value.is_null()) {
+            write_int32(column_fields, -1);
+          } else if (format_code == FormatCode::Binary) {
+            write_binary_value(column_fields, value.value());
+          } else {
+            write_text_value(column_fields, value.value());
+          }
+          column_field_ends.emplace_back(column_fields.size());
+        }
+      });
+    });
+  }
+
+  // Interleave the fields of the columns into one message per row
+  auto total_size = row_count * (sizeof(NetworkMessageType) + sizeof(int32_t) + sizeof(int16_t));
+  for (const auto& column_fields : fields) {
+    total_size += column_fields.size();
+  }
+  output.reserve(output.size() + total_size);
+
+  for (auto row = size_t{0}; row < row_count; ++row) {
+    auto message_size = sizeof(int32_t) + sizeof(int16_t);
+    for (ColumnID column_id{0}; column_id < column_count; ++column_id) {
+      message_size += field_ends[column_id][row + 1] - field_ends[column_id][row];
+    }
+
+    output.emplace_back(static_cast<char>(NetworkMessageType::DataRow));
+    write_int32(output, static_cast<int32_t>(message_size));
+    write_int16(output, static_cast<int16_t>(column_count));
+
+    for (ColumnID column_id{0}; column_id < column_count; ++column_id) {
+      const auto& column_fields = fields[column_id];
+      output.insert(output.end(), column_fields.cbegin() + field_ends[column_id][row],
+                    column_fields.cbegin() + field_ends[column_id][row + 1]);
+    }
+  }
+}
+
+boost::future<uint64_t> QueryResponseBuilder::send_query_response(const send_rows_t& send_rows,
+                                                                  const std::shared_ptr<const Table>& table,
+                                                                  const std::vector<FormatCode>& format_codes,
+                                                                  const std::shared_ptr<RowID>& position,
+                                                                  const uint64_t max_rows) {
+  // Essentially we're iterating over the chunks of the table, serializing and sending their rows. However, because of
+  // the asynchronous send_rows call, we have to use recursion instead of a for-loop
+  const auto remaining_row_count = max_rows == 0 ? std::numeric_limits<uint64_t>::max() : max_rows;
+  return _send_query_response_chunks(send_rows, table, format_codes, position, std::make_shared<ByteBuffer>(),
+                                     remaining_row_count);
+}
+
+bool QueryResponseBuilder::is_query_response_complete(const Table& table, const RowID& position) {
+  // Skip empty chunks, so that a portal is not suspended if only those are left
+  auto chunk_id = position.chunk_id;
+  auto chunk_offset = position.chunk_offset;
+  while (chunk_id < table.chunk_count() && chunk_offset == table.get_chunk(chunk_id)->size()) {
+    ++chunk_id;
+    chunk_offset = 0;
+  }
+  return chunk_id == table.chunk_count();
 }
 
-boost::future<void> QueryResponseBuilder::_send_query_response_rows(const send_row_t& send_row, const Chunk& chunk,
-                                                                    ChunkOffset current_chunk_offset) {
-  if (current_chunk_offset == chunk.size()) return boost::make_ready_future();
+boost::future<uint64_t> QueryResponseBuilder::_send_query_response_chunks(
+    const send_rows_t& send_rows, const std::shared_ptr<const Table>& table,
+    const std::vector<FormatCode>& format_codes, const std::shared_ptr<RowID>& position,
+    const std::shared_ptr<ByteBuffer>& buffer, const uint64_t remaining_row_count) {
+  if (position->chunk_id == table->chunk_count() || remaining_row_count == 0) {
+    return boost::make_ready_future<uint64_t>(0);
+  }
 
-  std::vector<std::string> row_strings(chunk.column_count());
+  const auto chunk = table->get_chunk(position->chunk_id);
+  const auto begin_offset = position->chunk_offset;
+  const auto row_count = std::min(static_cast<uint64_t>(chunk->size() - begin_offset), remaining_row_count);
+  const auto end_offset = static_cast<ChunkOffset>(begin_offset + row_count);
 
-  for (ColumnID column_id{0}; column_id < ColumnID{chunk.column_count()}; ++column_id) {
-    const auto& column = chunk.get_column(column_id);
-    row_strings[column_id] = type_cast<std::string>((*column)[current_chunk_offset]);
+  if (end_offset == chunk->size()) {
+    *position = RowID{ChunkID{position->chunk_id + 1}, ChunkOffset{0}};
+  } else {
+    position->chunk_offset = end_offset;
   }
 
-  return send_row(row_strings) >> then >> std::bind(QueryResponseBuilder::_send_query_response_rows, send_row,
-                                                    std::ref(chunk), ChunkOffset{current_chunk_offset + 1});
+  auto send_next_chunks = [=]() {
+    return _send_query_response_chunks(send_rows, table, format_codes, position, buffer,
+                                       remaining_row_count - row_count) >>
+           then >> [=](uint64_t sent_row_count) { return row_count + sent_row_count; };
+  };
+
+  if (row_count == 0) return send_next_chunks();
+
+  // The previous chunk was sent completely, so its buffer can be reused
+  buffer->clear();
+  build_data_rows(*chunk, begin_offset, end_offset, format_codes, *buffer);
+
+  return send_rows(buffer) >> then >> send_next_chunks;
 }
 
 }  // namespace opossum
@@ -3,6 +3,7 @@
 #include "sql/SQLStatement.h"
 
 #include "server/client_connection.hpp"
+#include "server/types.hpp"
 #include "storage/table.hpp"
 
 namespace opossum {
@@ -11,19 +12,47 @@ class SQLPipeline;
 
 class QueryResponseBuilder {
  public:
-  static std::vector<ColumnDescription> build_row_description(const std::shared_ptr<const Table>& table);
+  // Returns the format code of each column of the result, given the codes requested by a Bind message
+  static std::vector<FormatCode> build_format_codes(const std::vector<FormatCode>& requested_format_codes,
+                                                    size_t column_count);
+
+  static std::vector<ColumnDescription> build_row_description(const std::shared_ptr<const Table>& table,
+                                                              const std::vector<FormatCode>& format_codes);
   static std::string build_command_complete_message(hsql::StatementType statement_type, uint64_t row_count);
   static std::string build_execution_info_message(const std::shared_ptr<SQLPipeline>& sql_pipeline);
 
-  using send_row_t = std::function<boost::future<void>(const std::vector<std::string>&)>;
-
-  static boost::future<uint64_t> send_query_response(const send_row_t& send_row, const Table& table);
+  /**
+   * Appends one DataRow message for each of the rows [begin_offset, end_offset) of chunk to output, with the values of
+   * each column in the format given by format_codes. The type of a column is resolved once, the values are written into
+   * one buffer per column, and these are then interleaved into the rows. No value is converted to a std::string.
+   */
+  static void build_data_rows(const Chunk& chunk, ChunkOffset begin_offset, ChunkOffset end_offset,
+                              const std::vector<FormatCode>& format_codes, ByteBuffer& output);
+
+  using send_rows_t = std::function<boost::future<void>(const std::shared_ptr<const ByteBuffer>&)>;
+
+  /**
+   * Sends the rows of table, starting at position, in batches of one chunk. A chunk is only serialized once the
+   * previous batch was sent, so that the serialized form of at most one chunk is held at a time (in a buffer that is
+   * reused for all chunks) and the client receives the first rows before the rest of the result is serialized.
+   * At most max_rows rows are sent, 0 means all remaining rows. Afterwards, position points to the first row that was
+   * not sent, or to the end of the table. Returns the number of rows sent.
+   */
+  static boost::future<uint64_t> send_query_response(const send_rows_t& send_rows,
+                                                     const std::shared_ptr<const Table>& table,
+                                                     const std::vector<FormatCode>& format_codes,
+                                                     const std::shared_ptr<RowID>& position, uint64_t max_rows = 0);
+
+  // Returns true if all rows of table before position were sent
+  static bool is_query_response_complete(const Table& table, const RowID& position);
 
  protected:
-  static boost::future<void> _send_query_response_chunks(const send_row_t& send_row, const Table& table,
-                                                         ChunkID current_chunk_id);
-  static boost::future<void> _send_query_response_rows(const send_row_t& send_row, const Chunk& chunk,
-                                                       ChunkOffset current_chunk_offset);
+  static boost::future<uint64_t> _send_query_response_chunks(const send_rows_t& send_rows,
+                                                             const std::shared_ptr<const Table>& table,
+                                                             const std::vector<FormatCode>& format_codes,
+                                                             const std::shared_ptr<RowID>& position,
+                                                             const std::shared_ptr<ByteBuffer>& buffer,
+                                                             uint64_t remaining_row_count);
 };
 
 }  // namespace opossum
@@ -3,6 +3,9 @@
 #include <boost/asio/placeholders.hpp>
 #include <boost/bind.hpp>
 
+#include <algorithm>
+#include <thread>
+
 #include "client_connection.hpp"
 #include "server_session.hpp"
 #include "task_runner.hpp"
@@ -12,10 +15,15 @@ namespace opossum {
 
 using opossum::then_operator::then;
 
-Server::Server(boost::asio::io_service& io_service, uint16_t port)
+Server::Server(boost::asio::io_service& io_service, uint16_t port, size_t max_running_task_count)
     : _io_service(io_service),
       _acceptor(io_service, boost::asio::ip::tcp::endpoint(boost::asio::ip::tcp::v4(), port)),
       _socket(io_service) {
+  if (max_running_task_count == 0) {
+    max_running_task_count = std::max(1u, std::thread::hardware_concurrency());
+  }
+  _admission_queue = std::make_shared<AdmissionQueue>(max_running_task_count);
+
   _accept_next_connection();
 }
 
@@ -26,7 +34,7 @@ void Server::_accept_next_connection() {
 void Server::_start_session(boost::system::error_code error) {
   if (!error) {
     auto connection = std::make_shared<ClientConnection>(std::move(_socket));
-    auto task_runner = std::make_shared<TaskRunner>(_io_service);
+    auto task_runner = std::make_shared<TaskRunner>(_io_service, _admission_queue);
     auto session = std::make_shared<ServerSession>(connection, task_runner);
     // Start the session and release it once it has terminated
     session->start() >> then >> [=]() mutable { session.reset(); };
@@ -3,13 +3,19 @@
 #include <boost/asio/io_service.hpp>
 #include <boost/asio/ip/tcp.hpp>
 
+#include <memory>
+
+#include "admission_queue.hpp"
 #include "server_session.hpp"
 
 namespace opossum {
 
+// The Server accepts connections and handles the protocol of all sessions on the threads that run the io_service. The
+// queries are planned and executed by tasks on the scheduler, at most max_running_task_count at the same time (see
+// AdmissionQueue). By default, this is the number of cores.
 class Server {
  public:
-  Server(boost::asio::io_service& io_service, uint16_t port);
+  Server(boost::asio::io_service& io_service, uint16_t port, size_t max_running_task_count = 0);
 
   uint16_t get_port_number();
 
@@ -20,6 +26,7 @@ class Server {
   boost::asio::io_service& _io_service;
   boost::asio::ip::tcp::acceptor _acceptor;
   boost::asio::ip::tcp::socket _socket;
+  std::shared_ptr<AdmissionQueue> _admission_queue;
 };
 
 }  // namespace opossum
@@ -12,6 +12,7 @@
 #include "SQLParserResult.h"
 
 #include "concurrency/transaction_manager.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
 #include "sql/sql_pipeline.hpp"
 #include "sql/sql_translator.hpp"
 #include "tasks/server/bind_server_prepared_statement_task.hpp"
@@ -101,7 +102,7 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_client_
 
       case NetworkMessageType::ExecuteCommand: {
         return _connection->receive_execute_packet_body(request.payload_length) >> then >>
-               [=](std::string portal) { return _handle_execute_command(portal); };
+               [=](ExecutePacket execute_packet) { return _handle_execute_command(execute_packet); };
       }
 
       default:
@@ -150,11 +151,14 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_send_simple_qu
     // If there is no result table, e.g. after an INSERT command, we cannot send row data
     if (!result_table) return boost::make_ready_future<uint64_t>(0);
 
-    auto row_description = QueryResponseBuilder::build_row_description(sql_pipeline->get_result_table());
+    // The simple query protocol always uses the text format
+    const auto format_codes = QueryResponseBuilder::build_format_codes({}, result_table->column_count());
+    auto row_description = QueryResponseBuilder::build_row_description(result_table, format_codes);
 
     return _connection->send_row_description(row_description) >> then >> [=]() {
       return QueryResponseBuilder::send_query_response(
-          [=](const std::vector<std::string>& row) { return _connection->send_data_row(row); }, *result_table);
+          [=](const std::shared_ptr<const ByteBuffer>& data) { return _connection->send_data_rows(data); },
+          result_table, format_codes, std::make_shared<RowID>(ChunkID{0}, ChunkOffset{0}));
     };
   };
 
@@ -232,6 +236,7 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_bind_co
   if (packet.statement_name.empty()) _prepared_statements.erase(statement_it);
 
   auto portal_name = packet.destination_portal;
+  auto result_format_codes = packet.result_format_codes;
 
   // Named portals must be explicitly closed before they can be redefined by another Bind message,
   // but this is not required for the unnamed portal.
@@ -247,8 +252,17 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_bind_co
   auto task = std::make_shared<BindServerPreparedStatementTask>(sql_pipeline, packet.params);
   return _task_runner->dispatch_server_task(task) >> then >>
          [=](std::unique_ptr<SQLQueryPlan> query_plan) {
+           // More than one result format code requires one per result column (see build_format_codes()). The client
+           // is told now instead of when the portal is executed. The pipeline has planned the statement already.
+           if (statement_type == hsql::kStmtSelect && result_format_codes.size() > 1) {
+             const auto& lqp = sql_pipeline->get_optimized_logical_plans().front();
+             AssertInput(result_format_codes.size() == lqp->column_expressions().size(),
+                         "The number of result format codes does not match the number of result columns.");
+           }
+
            std::shared_ptr<SQLQueryPlan> shared_query_plan = std::move(query_plan);
-           auto portal = std::make_pair(statement_type, shared_query_plan);
+           auto portal = std::make_shared<Portal>(
+               Portal{statement_type, shared_query_plan, result_format_codes, nullptr, nullptr});
            _portals.insert(std::make_pair(portal_name, portal));
          } >>
          then >> [=]() { return _connection->send_status_message(NetworkMessageType::BindComplete); };
@@ -278,35 +292,63 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_flush_c
 }
 
 template <typename TConnection, typename TTaskRunner>
-boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_execute_command(
-    const std::string& portal_name) {
+boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_execute_command(const ExecutePacket& packet) {
+  const auto portal_name = packet.portal;
+  const auto max_rows = packet.max_rows;
+
   auto portal_it = _portals.find(portal_name);
   if (portal_it == _portals.end()) throw std::logic_error("The specified portal does not exist.");
 
-  auto statement_type = portal_it->second.first;
-  auto query_plan = portal_it->second.second;
+  auto portal = portal_it->second;
 
-  if (portal_name.empty()) _portals.erase(portal_it);
+  // A suspended portal continues with the rows that the previous Execute did not send
+  if (portal->result_table) return _send_portal_rows(portal_name, portal, max_rows);
 
   if (!_transaction) _transaction = TransactionManager::get().new_transaction_context();
 
-  query_plan->set_transaction_context(_transaction);
+  portal->query_plan->set_transaction_context(_transaction);
 
-  return _task_runner->dispatch_server_task(std::make_shared<ExecuteServerPreparedStatementTask>(query_plan)) >> then >>
-         [=](std::shared_ptr<const Table> result_table) {
+  return _task_runner->dispatch_server_task(std::make_shared<ExecuteServerPreparedStatementTask>(portal->query_plan)) >>
+         then >> [=](std::shared_ptr<const Table> result_table) {
            // The behavior is a little different compared to SimpleQueryCommand: Send a 'No Data' response
-           if (!result_table)
+           if (!result_table) {
+             if (portal_name.empty()) _portals.erase(portal_name);
+
+             auto complete_message = QueryResponseBuilder::build_command_complete_message(portal->statement_type, 0);
              return _connection->send_status_message(NetworkMessageType::NoDataResponse) >> then >>
-                    []() { return uint64_t(0); };
+                    [=]() { return _connection->send_command_complete(complete_message); };
+           }
 
-           const auto row_description = QueryResponseBuilder::build_row_description(result_table);
-           return _connection->send_row_description(row_description) >> then >> [=]() {
-             return QueryResponseBuilder::send_query_response(
-                 [=](const std::vector<std::string>& row) { return _connection->send_data_row(row); }, *result_table);
-           };
-         } >>
+           portal->result_table = result_table;
+           portal->position = std::make_shared<RowID>(ChunkID{0}, ChunkOffset{0});
+           portal->format_codes =
+               QueryResponseBuilder::build_format_codes(portal->format_codes, result_table->column_count());
+
+           const auto row_description = QueryResponseBuilder::build_row_description(result_table, portal->format_codes);
+           return _connection->send_row_description(row_description) >> then >>
+                  [=]() { return _send_portal_rows(portal_name, portal, max_rows); };
+         };
+}
+
+template <typename TConnection, typename TTaskRunner>
+boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_send_portal_rows(
+    const std::string& portal_name, const std::shared_ptr<Portal>& portal, const uint32_t max_rows) {
+  return QueryResponseBuilder::send_query_response(
+             [=](const std::shared_ptr<const ByteBuffer>& data) { return _connection->send_data_rows(data); },
+             portal->result_table, portal->format_codes, portal->position, max_rows) >>
          then >> [=](uint64_t row_count) {
-           auto complete_message = QueryResponseBuilder::build_command_complete_message(statement_type, row_count);
+           // The client has to send another Execute to fetch the remaining rows
+           if (!QueryResponseBuilder::is_query_response_complete(*portal->result_table, *portal->position)) {
+             return _connection->send_status_message(NetworkMessageType::PortalSuspended);
+           }
+
+           // Release the result table, it is not needed anymore
+           portal->result_table = nullptr;
+           portal->position = nullptr;
+           if (portal_name.empty()) _portals.erase(portal_name);
+
+           auto complete_message =
+               QueryResponseBuilder::build_command_complete_message(portal->statement_type, row_count);
            return _connection->send_command_complete(complete_message);
          };
 }
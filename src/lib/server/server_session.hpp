@@ -30,19 +30,33 @@ class ServerSessionImpl : public std::enable_shared_from_this<ServerSessionImpl<
   boost::future<void> _handle_parse_command(const ParsePacket& parse_info);
   boost::future<void> _handle_bind_command(const BindPacket& packet);
   boost::future<void> _handle_describe_command(const std::string& portal_name);
-  boost::future<void> _handle_execute_command(const std::string& portal_name);
+  boost::future<void> _handle_execute_command(const ExecutePacket& packet);
   boost::future<void> _handle_sync_command();
   boost::future<void> _handle_flush_command();
 
   boost::future<void> _send_simple_query_response(const std::shared_ptr<SQLPipeline>& sql_pipeline);
 
+  // A bound statement. After the first Execute, it holds the result table and the position of the next row to send,
+  // so that an Execute with a row limit can be continued by the next Execute on the same portal.
+  struct Portal {
+    hsql::StatementType statement_type;
+    std::shared_ptr<SQLQueryPlan> query_plan;
+    // As requested by the Bind message until the result table is known, then one format code per column
+    std::vector<FormatCode> format_codes;
+    std::shared_ptr<const Table> result_table;
+    std::shared_ptr<RowID> position;
+  };
+
+  boost::future<void> _send_portal_rows(const std::string& portal_name, const std::shared_ptr<Portal>& portal,
+                                        uint32_t max_rows);
+
   std::shared_ptr<TConnection> _connection;
   std::shared_ptr<TTaskRunner> _task_runner;
 
   std::shared_ptr<TransactionContext> _transaction;
   std::unordered_map<std::string, std::shared_ptr<SQLPipeline>> _prepared_statements;
   // TODO(lawben): The type of _portals will change when prepared statements are supported in the SQLPipeline
-  std::unordered_map<std::string, std::pair<hsql::StatementType, std::shared_ptr<SQLQueryPlan>>> _portals;
+  std::unordered_map<std::string, std::shared_ptr<Portal>> _portals;
 };
 
 // The corresponding template instantiation takes place in the .cpp
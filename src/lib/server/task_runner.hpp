@@ -3,9 +3,11 @@
 #include <boost/asio/io_service.hpp>
 #include <boost/thread/future.hpp>
 
+#include <atomic>
+#include <chrono>
 #include <memory>
 
-#include "scheduler/current_scheduler.hpp"
+#include "admission_queue.hpp"
 #include "tasks/server/abstract_server_task.hpp"
 #include "then_operator.hpp"
 #include "use_boost_future.hpp"
@@ -14,30 +16,45 @@ namespace opossum {
 
 // This class encapsulates the io_service and thus allows the ServerSession
 // to be easily tested with a mocked version of this class.
+// Each session has its own TaskRunner, which submits the session's tasks to the AdmissionQueue shared by all sessions.
+// Sessions start with the priority Highest. A session whose last task ran longer than LONG_RUNNING_TASK_THRESHOLD
+// gets the priority Default until one of its tasks is short again, so that interactive sessions are admitted first.
 class TaskRunner {
  public:
-  explicit TaskRunner(boost::asio::io_service& io_service) : _io_service(io_service) {}
+  static constexpr auto LONG_RUNNING_TASK_THRESHOLD = std::chrono::milliseconds{100};
+
+  TaskRunner(boost::asio::io_service& io_service, const std::shared_ptr<AdmissionQueue>& admission_queue)
+      : _io_service(io_service), _admission_queue(admission_queue) {}
 
   template <typename TResult>
   auto dispatch_server_task(std::shared_ptr<TResult> task) -> decltype(task->get_future());
 
  protected:
   boost::asio::io_service& _io_service;
+  std::shared_ptr<AdmissionQueue> _admission_queue;
+
+  // Updated by the done callbacks, which run on the scheduler's threads and might outlive this TaskRunner
+  std::shared_ptr<std::atomic<SchedulePriority>> _priority =
+      std::make_shared<std::atomic<SchedulePriority>>(SchedulePriority::Highest);
 };
 
 template <typename TResult>
 auto TaskRunner::dispatch_server_task(std::shared_ptr<TResult> task) -> decltype(task->get_future()) {
   using opossum::then_operator::then;
-  using TaskList = std::vector<std::shared_ptr<AbstractTask>>;
 
-  CurrentScheduler::schedule_tasks(TaskList({task}));
+  auto future = task->get_future();
+
+  const auto priority = _priority;
+  _admission_queue->submit(task, *priority, [priority](const std::chrono::nanoseconds execution_time) {
+    *priority = execution_time > LONG_RUNNING_TASK_THRESHOLD ? SchedulePriority::Default : SchedulePriority::Highest;
+  });
 
-  return task->get_future()
+  return std::move(future)
       .then(boost::launch::sync,
             [=](auto result) {
               // This result comes in on the scheduler thread, so we want to dispatch it back to the io_service
               return _io_service.post(boost::asio::use_boost_future)
-                     // Make sure to be on the main thread before re-throwing the exceptions
+                     // Make sure to be on one of the I/O threads before re-throwing the exceptions
                      >> then >> [result = std::move(result)]() mutable { return result.get(); };
             })
       .unwrap();
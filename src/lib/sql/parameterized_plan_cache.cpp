@@ -0,0 +1,185 @@
+#include "parameterized_plan_cache.hpp"
+
+#include <algorithm>
+#include <cctype>
+
+#include "expression/abstract_predicate_expression.hpp"
+#include "expression/expression_utils.hpp"
+#include "expression/value_expression.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "sql/parameter_id_allocator.hpp"
+#include "statistics/table_statistics.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+bool is_identifier_character(const char character) {
+  return std::isalnum(static_cast<unsigned char>(character)) || character == '_';
+}
+
+bool is_digit(const char character) { return std::isdigit(static_cast<unsigned char>(character)); }
+
+// Only literals compared to something other than a literal are parameterized, so that the PredicateNode can still be
+// translated into a scan. IN and IS NULL are never parameterized, the former because its literals form a list.
+bool is_parameterizable_predicate(const AbstractPredicateExpression& predicate) {
+  if (!is_binary_predicate_condition(predicate.predicate_condition) &&
+      predicate.predicate_condition != PredicateCondition::Between) {
+    return false;
+  }
+
+  return std::any_of(predicate.arguments.begin(), predicate.arguments.end(),
+                     [](const auto& argument) { return argument->type != ExpressionType::Value; });
+}
+
+}  // namespace
+
+namespace opossum {
+
+ParameterizedPlan::ParameterizedPlan(const std::shared_ptr<AbstractLQPNode>& lqp,
+                                     const std::shared_ptr<AbstractLQPNode>& optimized_lqp,
+                                     const std::vector<float>& predicate_row_counts)
+    : lqp(lqp), optimized_lqp(optimized_lqp), predicate_row_counts(predicate_row_counts) {}
+
+bool ParameterizedPlan::requires_reoptimization(const std::vector<float>& other_predicate_row_counts) const {
+  // Equal LQPs have the same PredicateNodes
+  DebugAssert(predicate_row_counts.size() == other_predicate_row_counts.size(),
+              "Expected the same number of row counts");
+
+  for (auto predicate_idx = size_t{0}; predicate_idx < predicate_row_counts.size(); ++predicate_idx) {
+    // Don't distinguish between row counts below one, their ratio could be arbitrarily large
+    const auto row_count = std::max(predicate_row_counts[predicate_idx], 1.0f);
+    const auto other_row_count = std::max(other_predicate_row_counts[predicate_idx], 1.0f);
+
+    if (std::max(row_count, other_row_count) / std::min(row_count, other_row_count) > REOPTIMIZATION_ROW_COUNT_FACTOR) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+std::string normalize_sql_literals(const std::string& sql) {
+  auto normalized_sql = std::string{};
+  normalized_sql.reserve(sql.size());
+
+  auto char_idx = size_t{0};
+  while (char_idx < sql.size()) {
+    const auto character = sql[char_idx];
+
+    if (character == '\'' || character == '"') {
+      // String literal or quoted identifier, find its end. Two quotes in a row are an escaped quote.
+      auto end_idx = char_idx + 1;
+      while (end_idx < sql.size()) {
+        if (sql[end_idx] == character) {
+          if (end_idx + 1 < sql.size() && sql[end_idx + 1] == character) {
+            end_idx += 2;
+            continue;
+          }
+          break;
+        }
+        ++end_idx;
+      }
+      end_idx = std::min(end_idx + 1, sql.size());
+
+      if (character == '\'') {
+        normalized_sql += '?';
+      } else {
+        normalized_sql.append(sql, char_idx, end_idx - char_idx);
+      }
+      char_idx = end_idx;
+    } else if (is_digit(character) && (char_idx == 0 || !is_identifier_character(sql[char_idx - 1]))) {
+      // Numeric literal, possibly with a fraction and an exponent
+      while (char_idx < sql.size() && (is_digit(sql[char_idx]) || sql[char_idx] == '.')) ++char_idx;
+      if (char_idx + 1 < sql.size() && (sql[char_idx] == 'e' || sql[char_idx] == 'E')) {
+        auto exponent_idx = char_idx + 1;
+        if (sql[exponent_idx] == '+' || sql[exponent_idx] == '-') ++exponent_idx;
+        if (exponent_idx < sql.size() && is_digit(sql[exponent_idx])) {
+          char_idx = exponent_idx;
+          while (char_idx < sql.size() && is_digit(sql[char_idx])) ++char_idx;
+        }
+      }
+      normalized_sql += '?';
+    } else {
+      normalized_sql += character;
+      ++char_idx;
+    }
+  }
+
+  return normalized_sql;
+}
+
+std::unordered_map<ParameterID, AllTypeVariant> lqp_parameterize_literals(
+    const std::shared_ptr<AbstractLQPNode>& lqp, ParameterIDAllocator& parameter_id_allocator) {
+  auto parameters = std::unordered_map<ParameterID, AllTypeVariant>{};
+
+  visit_lqp(lqp, [&](const auto& node) {
+    if (node->type != LQPNodeType::Predicate) return LQPVisitation::VisitInputs;
+
+    const auto predicate_node = std::static_pointer_cast<PredicateNode>(node);
+    const auto predicate = std::dynamic_pointer_cast<AbstractPredicateExpression>(predicate_node->predicate);
+    if (!predicate || !is_parameterizable_predicate(*predicate)) return LQPVisitation::VisitInputs;
+
+    for (auto& argument : predicate->arguments) {
+      if (argument->type != ExpressionType::Value) continue;
+
+      const auto& value = std::static_pointer_cast<ValueExpression>(argument)->value;
+      if (variant_is_null(value)) continue;
+
+      const auto parameter_id = parameter_id_allocator.allocate();
+      parameters.emplace(parameter_id, value);
+      argument = std::make_shared<ParameterExpression>(parameter_id);
+    }
+
+    return LQPVisitation::VisitInputs;
+  });
+
+  return parameters;
+}
+
+void lqp_set_parameters(const std::shared_ptr<AbstractLQPNode>& lqp,
+                        const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
+  visit_lqp(lqp, [&](const auto& node) {
+    expressions_set_parameters(node->node_expressions(), parameters);
+    return LQPVisitation::VisitInputs;
+  });
+}
+
+void lqp_bind_parameters(const std::shared_ptr<AbstractLQPNode>& lqp,
+                         const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
+  visit_lqp(lqp, [&](const auto& node) {
+    // The ParameterExpressions are never the root of a node's expression, so replacing them within the arguments of
+    // the (copied) root pointers suffices
+    for (auto& expression : node->node_expressions()) {
+      visit_expression(expression, [&](auto& sub_expression) {
+        if (sub_expression->type != ExpressionType::Parameter) return ExpressionVisitation::VisitArguments;
+
+        const auto parameter_id = std::static_pointer_cast<ParameterExpression>(sub_expression)->parameter_id;
+        const auto parameter_iter = parameters.find(parameter_id);
+        if (parameter_iter != parameters.end()) {
+          sub_expression = std::make_shared<ValueExpression>(parameter_iter->second);
+        }
+
+        return ExpressionVisitation::DoNotVisitArguments;
+      });
+    }
+    return LQPVisitation::VisitInputs;
+  });
+}
+
+std::vector<float> lqp_predicate_row_counts(const std::shared_ptr<AbstractLQPNode>& lqp) {
+  auto predicate_row_counts = std::vector<float>{};
+
+  visit_lqp(lqp, [&](const auto& node) {
+    if (node->type == LQPNodeType::Predicate) {
+      predicate_row_counts.emplace_back(node->get_statistics()->row_count());
+    }
+    return LQPVisitation::VisitInputs;
+  });
+
+  return predicate_row_counts;
+}
+
+}  // namespace opossum
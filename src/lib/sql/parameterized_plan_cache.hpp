@@ -0,0 +1,88 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "expression/parameter_expression.hpp"
+#include "sql/sql_query_cache.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+class ParameterIDAllocator;
+
+/**
+ * Statements that differ only in their literals (e.g., `SELECT * FROM t WHERE id = 5` and `... WHERE id = 6`) share a
+ * ParameterizedPlan. It is created by replacing the literals in the predicates of the unoptimized LQP with
+ * ParameterExpressions (see lqp_parameterize_literals()) and optimizing the result. When a matching statement is
+ * executed, the optimized LQP is copied and its parameters are replaced with the literals of that statement (see
+ * lqp_bind_parameters()), so that the statement is not optimized again.
+ *
+ * The plan was optimized for the literals of the statement that created it. If the literals of a later statement lead
+ * to very different cardinality estimates, the plan is not reused, but the statement is optimized anew and its plan
+ * replaces the cached one (see ParameterizedPlan::requires_reoptimization()).
+ */
+struct ParameterizedPlan {
+  // Only re-optimize if the estimated output row count of a predicate changes by more than this factor
+  static constexpr auto REOPTIMIZATION_ROW_COUNT_FACTOR = 10.0f;
+
+  ParameterizedPlan(const std::shared_ptr<AbstractLQPNode>& lqp, const std::shared_ptr<AbstractLQPNode>& optimized_lqp,
+                    const std::vector<float>& predicate_row_counts);
+
+  bool requires_reoptimization(const std::vector<float>& other_predicate_row_counts) const;
+
+  // The parameterized, unoptimized LQP. A statement can only use the plan if its parameterized LQP is equal to it.
+  const std::shared_ptr<AbstractLQPNode> lqp;
+
+  // The parameterized, optimized LQP. Needs to be copied before its parameters are bound.
+  const std::shared_ptr<AbstractLQPNode> optimized_lqp;
+
+  // The estimated output row counts of the PredicateNodes in `lqp` (see lqp_predicate_row_counts()) for the literals
+  // the plan was optimized for
+  const std::vector<float> predicate_row_counts;
+};
+
+/**
+ * Cache of ParameterizedPlans, the key is the statement's SQL string after normalize_sql_literals().
+ * Different statements can have the same key (e.g., if they differ in their LIMIT), so a cached plan is only used if
+ * its parameterized LQP is equal to the one of the statement.
+ */
+using ParameterizedPlanCache = SQLQueryCache<std::shared_ptr<const ParameterizedPlan>>;
+
+/**
+ * Replaces numeric and string literals in @param sql with `?`, e.g. `SELECT * FROM t WHERE a = 'x' AND b > 3.5` becomes
+ * `SELECT * FROM t WHERE a = ? AND b > ?`. Quoted identifiers and numbers that are part of an identifier are kept.
+ */
+std::string normalize_sql_literals(const std::string& sql);
+
+/**
+ * Replaces the non-NULL literals that are compared to columns in the PredicateNodes of @param lqp with
+ * ParameterExpressions, using ParameterIDs from @param parameter_id_allocator. Select expressions are not modified.
+ * @return  the replaced literals, by the ParameterID that replaced them
+ */
+std::unordered_map<ParameterID, AllTypeVariant> lqp_parameterize_literals(
+    const std::shared_ptr<AbstractLQPNode>& lqp, ParameterIDAllocator& parameter_id_allocator);
+
+/**
+ * Sets the values of the ParameterExpressions in @param lqp, so that the statistics of the LQP (and thus the optimizer)
+ * can use them
+ */
+void lqp_set_parameters(const std::shared_ptr<AbstractLQPNode>& lqp,
+                        const std::unordered_map<ParameterID, AllTypeVariant>& parameters);
+
+/**
+ * Replaces the ParameterExpressions in @param lqp with ValueExpressions holding their values from @param parameters.
+ * Afterwards, the LQP can be translated as if it had never been parameterized.
+ */
+void lqp_bind_parameters(const std::shared_ptr<AbstractLQPNode>& lqp,
+                         const std::unordered_map<ParameterID, AllTypeVariant>& parameters);
+
+/**
+ * @return  the estimated output row counts of all PredicateNodes in @param lqp, in the order they are visited
+ */
+std::vector<float> lqp_predicate_row_counts(const std::shared_ptr<AbstractLQPNode>& lqp);
+
+}  // namespace opossum
@@ -3,19 +3,76 @@
 #include <boost/algorithm/string.hpp>
 
 #include <algorithm>
+#include <exception>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include "SQLParser.h"
 #include "create_sql_parser_error_message.hpp"
+#include "expression/expression_utils.hpp"
+#include "expression/lqp_select_expression.hpp"
+#include "logical_query_plan/delete_node.hpp"
+#include "logical_query_plan/insert_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/update_node.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
 #include "utils/assert.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Collects the names of the tables that an LQP reads and modifies, including those accessed by subselects
+void collect_accessed_tables(const std::shared_ptr<AbstractLQPNode>& lqp, std::unordered_set<std::string>& read_tables,
+                             std::unordered_set<std::string>& modified_tables) {
+  visit_lqp(lqp, [&](const auto& node) {
+    switch (node->type) {
+      case LQPNodeType::StoredTable:
+        read_tables.emplace(std::static_pointer_cast<StoredTableNode>(node)->table_name);
+        break;
+      case LQPNodeType::Insert:
+        modified_tables.emplace(std::static_pointer_cast<InsertNode>(node)->table_name());
+        break;
+      case LQPNodeType::Update:
+        modified_tables.emplace(std::static_pointer_cast<UpdateNode>(node)->table_name);
+        break;
+      case LQPNodeType::Delete:
+        modified_tables.emplace(std::static_pointer_cast<DeleteNode>(node)->table_name());
+        break;
+      default: {
+      }
+    }
+
+    for (const auto& node_expression : node->node_expressions()) {
+      visit_expression(node_expression, [&](const auto& sub_expression) {
+        if (sub_expression->type == ExpressionType::LQPSelect) {
+          const auto select_expression = std::static_pointer_cast<LQPSelectExpression>(sub_expression);
+          collect_accessed_tables(select_expression->lqp, read_tables, modified_tables);
+        }
+        return ExpressionVisitation::VisitArguments;
+      });
+    }
+
+    return LQPVisitation::VisitInputs;
+  });
+}
+
+}  // namespace
+
 namespace opossum {
 
 SQLPipeline::SQLPipeline(const std::string& sql, std::shared_ptr<TransactionContext> transaction_context,
                          const UseMvcc use_mvcc, const std::shared_ptr<LQPTranslator>& lqp_translator,
                          const std::shared_ptr<Optimizer>& optimizer,
                          const std::shared_ptr<PreparedStatementCache>& prepared_statements,
-                         const CleanupTemporaries cleanup_temporaries)
+                         const CleanupTemporaries cleanup_temporaries,
+                         const std::shared_ptr<ResourceGroup>& resource_group)
     : _transaction_context(transaction_context), _optimizer(optimizer) {
   DebugAssert(!_transaction_context || _transaction_context->phase() == TransactionPhase::Active,
               "The transaction context cannot have been committed already.");
@@ -74,7 +131,7 @@ SQLPipeline::SQLPipeline(const std::string& sql, std::shared_ptr<TransactionCont
 
     auto pipeline_statement = std::make_shared<SQLPipelineStatement>(
         statement_string, std::move(parsed_statement), use_mvcc, transaction_context, lqp_translator, optimizer,
-        prepared_statements, cleanup_temporaries);
+        prepared_statements, cleanup_temporaries, resource_group);
     _sql_pipeline_statements.push_back(std::move(pipeline_statement));
   }
 
@@ -195,6 +252,12 @@ const std::vector<std::shared_ptr<const Table>>& SQLPipeline::get_result_tables(
 
   _result_tables.reserve(_sql_pipeline_statements.size());
 
+  if (_can_be_pipelined()) {
+    _get_result_tables_pipelined();
+    _pipeline_was_executed = true;
+    return _result_tables;
+  }
+
   for (auto& pipeline_statement : _sql_pipeline_statements) {
     pipeline_statement->get_result_table();
     if (_transaction_context && _transaction_context->aborted()) {
@@ -221,6 +284,122 @@ size_t SQLPipeline::statement_count() const { return _sql_pipeline_statements.si
 
 bool SQLPipeline::requires_execution() const { return _requires_execution; }
 
+bool SQLPipeline::_can_be_pipelined() const {
+  // Statements that share a TransactionContext have to see each other's changes in the order of the statements
+  if (!CurrentScheduler::is_set() || _transaction_context || _requires_execution || statement_count() < 2) {
+    return false;
+  }
+
+  // Other statements, e.g., PREPARE and EXECUTE, might depend on each other in ways that are not visible in the LQP
+  return std::all_of(_sql_pipeline_statements.cbegin(), _sql_pipeline_statements.cend(), [](const auto& statement) {
+    switch (statement->get_parsed_sql_statement()->getStatement(0)->type()) {
+      case hsql::StatementType::kStmtSelect:
+      case hsql::StatementType::kStmtInsert:
+      case hsql::StatementType::kStmtUpdate:
+      case hsql::StatementType::kStmtDelete:
+        return true;
+      default:
+        return false;
+    }
+  });
+}
+
+void SQLPipeline::_get_result_tables_pipelined() {
+  auto exceptions = std::vector<std::exception_ptr>(statement_count());
+  auto plan_tasks = std::vector<std::shared_ptr<JobTask>>{};
+  auto execute_tasks = std::vector<std::shared_ptr<JobTask>>{};
+  plan_tasks.reserve(statement_count());
+  execute_tasks.reserve(statement_count());
+
+  // For each table, the last statement that modified it and the statements that have read it since then
+  auto last_modifying_statement_by_table = std::unordered_map<std::string, size_t>{};
+  auto reading_statements_by_table = std::unordered_map<std::string, std::vector<size_t>>{};
+
+  for (auto statement_idx = size_t{0}; statement_idx < statement_count(); ++statement_idx) {
+    const auto& pipeline_statement = _sql_pipeline_statements[statement_idx];
+
+    // Translating is cheap compared to optimizing and compiling, which happen in the plan task
+    auto read_tables = std::unordered_set<std::string>{};
+    auto modified_tables = std::unordered_set<std::string>{};
+    collect_accessed_tables(pipeline_statement->get_unoptimized_logical_plan(), read_tables, modified_tables);
+
+    auto dependencies = std::set<size_t>{};
+    for (const auto& table_name : read_tables) {
+      const auto last_modifying_statement_iter = last_modifying_statement_by_table.find(table_name);
+      if (last_modifying_statement_iter != last_modifying_statement_by_table.end()) {
+        dependencies.emplace(last_modifying_statement_iter->second);
+      }
+      if (!modified_tables.count(table_name)) reading_statements_by_table[table_name].emplace_back(statement_idx);
+    }
+    for (const auto& table_name : modified_tables) {
+      const auto last_modifying_statement_iter = last_modifying_statement_by_table.find(table_name);
+      if (last_modifying_statement_iter != last_modifying_statement_by_table.end()) {
+        dependencies.emplace(last_modifying_statement_iter->second);
+      }
+      auto& reading_statements = reading_statements_by_table[table_name];
+      dependencies.insert(reading_statements.cbegin(), reading_statements.cend());
+      reading_statements.clear();
+      last_modifying_statement_by_table[table_name] = statement_idx;
+    }
+
+    const auto plan_task = std::make_shared<JobTask>([&, statement_idx, dependencies]() {
+      const auto dependency_failed = std::any_of(dependencies.cbegin(), dependencies.cend(),
+                                                 [&](const auto dependency) { return exceptions[dependency]; });
+      if (dependency_failed) return;
+
+      try {
+        _sql_pipeline_statements[statement_idx]->get_tasks();
+      } catch (...) {
+        exceptions[statement_idx] = std::current_exception();
+      }
+    });
+
+    // A modifying statement auto-commits its changes, which cannot be undone if an earlier statement fails. Thus, it is
+    // executed only after all earlier statements, and only if they succeeded.
+    const auto is_modifying = !modified_tables.empty();
+
+    const auto execute_task = std::make_shared<JobTask>([&, statement_idx, dependencies, is_modifying]() {
+      const auto dependency_failed = std::any_of(dependencies.cbegin(), dependencies.cend(),
+                                                 [&](const auto dependency) { return exceptions[dependency]; });
+      const auto earlier_statement_failed =
+          is_modifying && std::any_of(exceptions.cbegin(), exceptions.cbegin() + statement_idx,
+                                      [](const auto& exception) { return static_cast<bool>(exception); });
+      if (dependency_failed || earlier_statement_failed || exceptions[statement_idx]) return;
+
+      try {
+        _sql_pipeline_statements[statement_idx]->get_result_table();
+      } catch (...) {
+        exceptions[statement_idx] = std::current_exception();
+      }
+    });
+
+    if (!plan_tasks.empty()) plan_tasks.back()->set_as_predecessor_of(plan_task);
+    for (const auto dependency : dependencies) {
+      execute_tasks[dependency]->set_as_predecessor_of(plan_task);
+    }
+    plan_task->set_as_predecessor_of(execute_task);
+    if (is_modifying) {
+      for (const auto& earlier_execute_task : execute_tasks) {
+        earlier_execute_task->set_as_predecessor_of(execute_task);
+      }
+    }
+
+    plan_tasks.emplace_back(plan_task);
+    execute_tasks.emplace_back(execute_task);
+  }
+
+  CurrentScheduler::schedule_tasks(plan_tasks);
+  CurrentScheduler::schedule_and_wait_for_tasks(execute_tasks);
+
+  for (const auto& exception : exceptions) {
+    if (exception) std::rethrow_exception(exception);
+  }
+
+  for (const auto& pipeline_statement : _sql_pipeline_statements) {
+    _result_tables.emplace_back(pipeline_statement->get_result_table());
+  }
+}
+
 const SQLPipelineMetrics& SQLPipeline::metrics() {
   if (_metrics.statement_metrics.empty()) {
     _metrics.statement_metrics.reserve(statement_count());
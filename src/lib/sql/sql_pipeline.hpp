@@ -39,6 +39,11 @@ struct SQLPipelineMetrics {
  *
  * The SQLPipeline holds all results and only hands them out as const references. If the SQLPipeline goes out of scope
  * while the results are still needed, the result references are invalid (except maybe the result table).
+ *
+ * If a Scheduler is active and the statements neither share a TransactionContext nor alter the structure of the
+ * database, get_result_tables() does not process one statement after another. Instead, a statement is planned while
+ * earlier ones are executing and statements that do not access the same tables (or only read them) are executed
+ * concurrently. See _get_result_tables_pipelined().
  */
 class SQLPipeline : public Noncopyable {
  public:
@@ -46,7 +51,7 @@ class SQLPipeline : public Noncopyable {
   SQLPipeline(const std::string& sql, std::shared_ptr<TransactionContext> transaction_context, const UseMvcc use_mvcc,
               const std::shared_ptr<LQPTranslator>& lqp_translator, const std::shared_ptr<Optimizer>& optimizer,
               const std::shared_ptr<PreparedStatementCache>& prepared_statements,
-              const CleanupTemporaries cleanup_temporaries);
+              const CleanupTemporaries cleanup_temporaries, const std::shared_ptr<ResourceGroup>& resource_group);
 
   // Returns the SQL string for each statement.
   const std::vector<std::string>& get_sql_strings();
@@ -88,6 +93,18 @@ class SQLPipeline : public Noncopyable {
   const SQLPipelineMetrics& metrics();
 
  private:
+  // Returns whether get_result_tables() may plan and execute the statements concurrently
+  bool _can_be_pipelined() const;
+
+  // Each statement is planned and executed in a JobTask. A statement that modifies a table that an earlier statement
+  // accesses, or accesses a table that an earlier statement modifies, is planned only after that statement was
+  // executed, so that its transaction sees the changes. As the statements share the LQPTranslator, the planning
+  // tasks are additionally executed in order. A statement that modifies tables is only executed once all earlier
+  // statements succeeded, since its changes are committed right away. Thus, if a statement fails, no later statement
+  // has changed the database. Later read-only statements might have been executed, but their results are discarded
+  // and the first exception is rethrown.
+  void _get_result_tables_pipelined();
+
   std::vector<std::shared_ptr<SQLPipelineStatement>> _sql_pipeline_statements;
 
   const std::shared_ptr<TransactionContext> _transaction_context;
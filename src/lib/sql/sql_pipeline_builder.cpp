@@ -1,5 +1,7 @@
 #include "sql_pipeline_builder.hpp"
 
+#include "cost_model/cost_model_logical.hpp"
+
 namespace opossum {
 
 SQLPipelineBuilder::SQLPipelineBuilder(const std::string& sql) : _sql(sql) {}
@@ -33,6 +35,11 @@ SQLPipelineBuilder& SQLPipelineBuilder::with_transaction_context(
   return *this;
 }
 
+SQLPipelineBuilder& SQLPipelineBuilder::with_resource_group(const std::shared_ptr<ResourceGroup>& resource_group) {
+  _resource_group = resource_group;
+  return *this;
+}
+
 SQLPipelineBuilder& SQLPipelineBuilder::disable_mvcc() { return with_mvcc(UseMvcc::No); }
 
 SQLPipelineBuilder& SQLPipelineBuilder::dont_cleanup_temporaries() {
@@ -41,19 +48,22 @@ SQLPipelineBuilder& SQLPipelineBuilder::dont_cleanup_temporaries() {
 }
 
 SQLPipeline SQLPipelineBuilder::create_pipeline() const {
-  auto lqp_translator = _lqp_translator ? _lqp_translator : std::make_shared<LQPTranslator>();
+  auto lqp_translator =
+      _lqp_translator ? _lqp_translator : std::make_shared<LQPTranslator>(std::make_shared<CostModelLogical>());
   auto optimizer = _optimizer ? _optimizer : Optimizer::create_default_optimizer();
 
-  return {_sql, _transaction_context, _use_mvcc, lqp_translator, optimizer, _prepared_statements, _cleanup_temporaries};
+  return {_sql,      _transaction_context,  _use_mvcc,           lqp_translator, optimizer,
+          _prepared_statements, _cleanup_temporaries, _resource_group};
 }
 
 SQLPipelineStatement SQLPipelineBuilder::create_pipeline_statement(
     std::shared_ptr<hsql::SQLParserResult> parsed_sql) const {
-  auto lqp_translator = _lqp_translator ? _lqp_translator : std::make_shared<LQPTranslator>();
+  auto lqp_translator =
+      _lqp_translator ? _lqp_translator : std::make_shared<LQPTranslator>(std::make_shared<CostModelLogical>());
   auto optimizer = _optimizer ? _optimizer : Optimizer::create_default_optimizer();
 
   return {_sql,      std::move(parsed_sql), _use_mvcc,           _transaction_context, lqp_translator,
-          optimizer, _prepared_statements,  _cleanup_temporaries};
+          optimizer, _prepared_statements,  _cleanup_temporaries, _resource_group};
 }
 
 }  // namespace opossum
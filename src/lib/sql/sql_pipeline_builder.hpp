@@ -27,7 +27,9 @@ class Optimizer;
  * Defaults:
  *  - MVCC is enabled
  *  - The default Optimizer (Optimizer::create_default_optimizer() is used.
+ *  - The LQPTranslator chooses the join operators using the CostModelLogical
  *  - No JIT operators
+ *  - The ResourceGroup is chosen based on the estimated cost of each statement (see ResourceGroupManager)
  *
  * Favour this interface over calling the SQLPipeline[Statement] constructors with their long parameter list.
  * See SQLPipeline[Statement] doc for these classes, in short SQLPipeline ist for queries with multiple statement,
@@ -43,6 +45,11 @@ class SQLPipelineBuilder final {
   SQLPipelineBuilder& with_prepared_statement_cache(const std::shared_ptr<PreparedStatementCache>& prepared_statements);
   SQLPipelineBuilder& with_transaction_context(const std::shared_ptr<TransactionContext>& transaction_context);
 
+  /**
+   * Execute all statements in this ResourceGroup instead of choosing one based on their estimated costs
+   */
+  SQLPipelineBuilder& with_resource_group(const std::shared_ptr<ResourceGroup>& resource_group);
+
   /**
    * Short for with_mvcc(UseMvcc::No)
    */
@@ -70,6 +77,7 @@ class SQLPipelineBuilder final {
   std::shared_ptr<Optimizer> _optimizer;
   std::shared_ptr<PreparedStatementCache> _prepared_statements;
   CleanupTemporaries _cleanup_temporaries{true};
+  std::shared_ptr<ResourceGroup> _resource_group;
 };
 
 }  // namespace opossum
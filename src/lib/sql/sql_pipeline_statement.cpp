@@ -7,10 +7,18 @@
 
 #include "SQLParser.h"
 #include "concurrency/transaction_manager.hpp"
+#include "cost_model/cost_model_logical.hpp"
 #include "create_sql_parser_error_message.hpp"
 #include "expression/value_expression.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
 #include "optimizer/optimizer.hpp"
+#include "optimizer/strategy/chunk_pruning_rule.hpp"
 #include "scheduler/current_scheduler.hpp"
+#include "scheduler/resource_group.hpp"
+#include "scheduler/resource_group_manager.hpp"
+#include "sql/parameter_id_allocator.hpp"
+#include "sql/parameterized_plan_cache.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "sql/sql_query_plan.hpp"
 #include "sql/sql_translator.hpp"
@@ -24,7 +32,8 @@ SQLPipelineStatement::SQLPipelineStatement(const std::string& sql, std::shared_p
                                            const std::shared_ptr<LQPTranslator>& lqp_translator,
                                            const std::shared_ptr<Optimizer>& optimizer,
                                            const std::shared_ptr<PreparedStatementCache>& prepared_statements,
-                                           const CleanupTemporaries cleanup_temporaries)
+                                           const CleanupTemporaries cleanup_temporaries,
+                                           const std::shared_ptr<ResourceGroup>& resource_group)
     : _sql_string(sql),
       _use_mvcc(use_mvcc),
       _auto_commit(_use_mvcc == UseMvcc::Yes && !transaction_context),
@@ -34,7 +43,8 @@ SQLPipelineStatement::SQLPipelineStatement(const std::string& sql, std::shared_p
       _parsed_sql_statement(std::move(parsed_sql)),
       _metrics(std::make_shared<SQLPipelineStatementMetrics>()),
       _prepared_statements(prepared_statements),
-      _cleanup_temporaries(cleanup_temporaries) {
+      _cleanup_temporaries(cleanup_temporaries),
+      _resource_group(resource_group) {
   Assert(!_parsed_sql_statement || _parsed_sql_statement->size() == 1,
          "SQLPipelineStatement must hold exactly one SQL statement");
   DebugAssert(!_sql_string.empty(), "An SQLPipelineStatement should always contain a SQL statement string for caching");
@@ -78,7 +88,8 @@ const std::shared_ptr<AbstractLQPNode>& SQLPipelineStatement::get_unoptimized_lo
 
   const auto* statement = parsed_sql->getStatement(0);
 
-  SQLTranslator sql_translator{_use_mvcc};
+  _parameter_id_allocator = std::make_shared<ParameterIDAllocator>();
+  SQLTranslator sql_translator{_use_mvcc, nullptr, _parameter_id_allocator};
 
   std::vector<std::shared_ptr<AbstractLQPNode>> lqp_roots;
 
@@ -116,7 +127,12 @@ const std::shared_ptr<AbstractLQPNode>& SQLPipelineStatement::get_optimized_logi
 
   const auto started = std::chrono::high_resolution_clock::now();
 
-  _optimized_logical_plan = _optimizer->optimize(unoptimized_lqp);
+  if (get_parsed_sql_statement()->getStatement(0)->isType(hsql::kStmtPrepare)) {
+    // The plan of a prepared statement is cached with its value placeholders by the PreparedStatementCache
+    _optimized_logical_plan = _optimizer->optimize(unoptimized_lqp);
+  } else {
+    _optimized_logical_plan = _optimize_with_parameterized_plan_cache(unoptimized_lqp);
+  }
 
   const auto done = std::chrono::high_resolution_clock::now();
   _metrics->optimize_time_micros = std::chrono::duration_cast<std::chrono::microseconds>(done - started);
@@ -208,6 +224,10 @@ const std::shared_ptr<SQLQueryPlan>& SQLPipelineStatement::get_query_plan() {
     // Reset time to exclude previous pipeline steps
     started = std::chrono::high_resolution_clock::now();
     _query_plan->add_tree_by_root(_lqp_translator->translate_node(lqp));
+    // The estimated cost is only needed to choose the ResourceGroup of the statement
+    if (!_resource_group && ResourceGroupManager::get().heavy_query_cost_threshold()) {
+      _query_plan->set_estimated_cost(CostModelLogical{}.estimate_plan_cost(lqp));
+    }
 
     done = std::chrono::high_resolution_clock::now();
   }
@@ -231,6 +251,14 @@ const std::shared_ptr<SQLQueryPlan>& SQLPipelineStatement::get_query_plan() {
   return _query_plan;
 }
 
+const std::shared_ptr<ResourceGroup>& SQLPipelineStatement::get_resource_group() {
+  if (!_resource_group) {
+    _resource_group = ResourceGroupManager::get().resource_group_for_cost(get_query_plan()->estimated_cost());
+  }
+
+  return _resource_group;
+}
+
 const std::vector<std::shared_ptr<OperatorTask>>& SQLPipelineStatement::get_tasks() {
   if (!_tasks.empty()) {
     return _tasks;
@@ -241,7 +269,7 @@ const std::vector<std::shared_ptr<OperatorTask>>& SQLPipelineStatement::get_task
               "Physical query plan creation returned no or more than one plan for a single statement.");
 
   const auto& root = query_plan->tree_roots().front();
-  _tasks = OperatorTask::make_tasks_from_operator(root, _cleanup_temporaries);
+  _tasks = OperatorTask::make_tasks_from_operator(root, _cleanup_temporaries, get_resource_group()->priority());
   return _tasks;
 }
 
@@ -263,7 +291,9 @@ const std::shared_ptr<const Table>& SQLPipelineStatement::get_result_table() {
     return _result_table;
   }
 
-  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+  // The tasks are executed once the ResourceGroup admits the query
+  get_resource_group()->schedule_tasks(tasks);
+  CurrentScheduler::wait_for_tasks(tasks);
 
   if (_auto_commit) {
     _transaction_context->commit();
@@ -284,4 +314,53 @@ const std::shared_ptr<TransactionContext>& SQLPipelineStatement::transaction_con
 }
 
 const std::shared_ptr<SQLPipelineStatementMetrics>& SQLPipelineStatement::metrics() const { return _metrics; }
+
+std::shared_ptr<AbstractLQPNode> SQLPipelineStatement::_optimize_with_parameterized_plan_cache(
+    const std::shared_ptr<AbstractLQPNode>& unoptimized_lqp) {
+  // Parameterize a copy, the unoptimized LQP keeps its literals
+  const auto lqp = unoptimized_lqp->deep_copy();
+  const auto parameters = lqp_parameterize_literals(lqp, *_parameter_id_allocator);
+
+  // Without parameters, the plan is not reusable by any statement the SQLQueryCache doesn't already cover
+  if (parameters.empty()) return _optimizer->optimize(unoptimized_lqp);
+
+  auto& cache = ParameterizedPlanCache::get();
+  const auto cache_key = normalize_sql_literals(_sql_string);
+
+  auto parameterized_plan = cache.try_get(cache_key).value_or(nullptr);
+  if (parameterized_plan && !(*parameterized_plan->lqp == *lqp)) parameterized_plan = nullptr;
+
+  // Copying an LQP doesn't copy the values of its ParameterExpressions, so the copy that will be cached needs to be
+  // made before the values are set.
+  const auto unbound_lqp = parameterized_plan ? parameterized_plan->lqp : lqp->deep_copy();
+
+  lqp_set_parameters(lqp, parameters);
+  const auto predicate_row_counts = lqp_predicate_row_counts(lqp);
+
+  auto optimized_lqp = std::shared_ptr<AbstractLQPNode>{};
+  if (parameterized_plan && !parameterized_plan->requires_reoptimization(predicate_row_counts)) {
+    optimized_lqp = parameterized_plan->optimized_lqp->deep_copy();
+    _metrics->parameterized_plan_cache_hit = true;
+  } else {
+    optimized_lqp = _optimizer->optimize(lqp);
+    cache.set(cache_key,
+              std::make_shared<ParameterizedPlan>(unbound_lqp, optimized_lqp->deep_copy(), predicate_row_counts));
+  }
+
+  lqp_bind_parameters(optimized_lqp, parameters);
+
+  // The ChunkPruningRule cannot prune chunks based on ParameterExpressions, so the cached plan is valid for all
+  // literals. Now that they are bound, prune the chunks for the literals of this statement. The rule intersects its
+  // result with the chunks already excluded from a StoredTableNode, so these are reset first.
+  visit_lqp(optimized_lqp, [&](const auto& node) {
+    if (node->type == LQPNodeType::StoredTable) {
+      std::static_pointer_cast<StoredTableNode>(node)->set_excluded_chunk_ids({});
+    }
+    return LQPVisitation::VisitInputs;
+  });
+  ChunkPruningRule{}.apply_to(optimized_lqp);
+
+  return optimized_lqp;
+}
+
 }  // namespace opossum
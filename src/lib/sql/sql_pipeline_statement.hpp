@@ -12,6 +12,9 @@
 
 namespace opossum {
 
+class ParameterIDAllocator;
+class ResourceGroup;
+
 using PreparedStatementCache = SQLQueryCache<SQLQueryPlan>;
 
 // Holds relevant information about the execution of an SQLPipelineStatement.
@@ -22,6 +25,7 @@ struct SQLPipelineStatementMetrics {
   std::chrono::microseconds execution_time_micros{};
 
   bool query_plan_cache_hit = false;
+  bool parameterized_plan_cache_hit = false;
 };
 
 /**
@@ -47,7 +51,8 @@ class SQLPipelineStatement : public Noncopyable {
                        const std::shared_ptr<LQPTranslator>& lqp_translator,
                        const std::shared_ptr<Optimizer>& optimizer,
                        const std::shared_ptr<PreparedStatementCache>& prepared_statements,
-                       const CleanupTemporaries cleanup_temporaries);
+                       const CleanupTemporaries cleanup_temporaries,
+                       const std::shared_ptr<ResourceGroup>& resource_group);
 
   // Returns the raw SQL string.
   const std::string& get_sql_string();
@@ -58,12 +63,17 @@ class SQLPipelineStatement : public Noncopyable {
   // Returns all unoptimized LQP roots.
   const std::shared_ptr<AbstractLQPNode>& get_unoptimized_logical_plan();
 
-  // Returns all optimized LQP roots.
+  // Returns all optimized LQP roots. If a statement that differed only in its literals has been optimized before, its
+  // optimized LQP is reused (see ParameterizedPlan).
   const std::shared_ptr<AbstractLQPNode>& get_optimized_logical_plan();
 
   // For now, this always uses the optimized LQP.
   const std::shared_ptr<SQLQueryPlan>& get_query_plan();
 
+  // Returns the ResourceGroup the statement is executed in. Unless the statement was built with one, it is chosen based
+  // on the estimated cost of the query plan (see ResourceGroupManager).
+  const std::shared_ptr<ResourceGroup>& get_resource_group();
+
   // Returns all task sets that need to be executed for this query.
   const std::vector<std::shared_ptr<OperatorTask>>& get_tasks();
 
@@ -77,6 +87,9 @@ class SQLPipelineStatement : public Noncopyable {
   const std::shared_ptr<SQLPipelineStatementMetrics>& metrics() const;
 
  private:
+  std::shared_ptr<AbstractLQPNode> _optimize_with_parameterized_plan_cache(
+      const std::shared_ptr<AbstractLQPNode>& unoptimized_lqp);
+
   const std::string _sql_string;
   const UseMvcc _use_mvcc;
 
@@ -106,8 +119,13 @@ class SQLPipelineStatement : public Noncopyable {
   std::shared_ptr<PreparedStatementCache> _prepared_statements;
   std::unordered_map<ValuePlaceholderID, ParameterID> _parameter_ids;
 
+  // Allocates the ParameterIDs during SQL translation and those of parameterized literals
+  std::shared_ptr<ParameterIDAllocator> _parameter_id_allocator;
+
   // Delete temporary tables
   const CleanupTemporaries _cleanup_temporaries;
+
+  std::shared_ptr<ResourceGroup> _resource_group;
 };
 
 }  // namespace opossum
@@ -1,8 +1,12 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <shared_mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -17,11 +21,32 @@ inline constexpr size_t DefaultCacheCapacity = 1024;
 
 // Cache that stores instances of SQLParserResult.
 // Per-default, uses the GDFS cache as underlying storage.
+//
+// To avoid that all sessions serialize on a single mutex, the entries are distributed over independent shards by the
+// hash of their key. Each shard is an instance of the underlying cache with its own mutex and an equal part of the
+// capacity, so that the eviction policy is applied per shard. Small caches (e.g., in tests) use a single shard, for
+// which the eviction order is exactly that of the underlying cache.
+// A lookup takes the lock of its shard, too, as a hit updates the bookkeeping of the eviction policy (e.g., the
+// frequency for GDFS or the access history for LRU-K).
+// The shards themselves are replaced by resize() and replace_cache_impl(). All other operations hold a shared lock on
+// the shards while they access them, so that the shards can be replaced while the cache is in use.
 template <typename Value, typename Key = std::string>
 class SQLQueryCache {
  public:
+  // Each shard holds at least this many entries, up to MaxShardCount shards
+  static constexpr size_t MinShardCapacity = 64;
+  static constexpr size_t MaxShardCount = 16;
+
+  static size_t shard_count_for_capacity(const size_t capacity) {
+    return std::clamp(capacity / MinShardCapacity, size_t{1}, MaxShardCount);
+  }
+
   explicit SQLQueryCache(size_t capacity = DefaultCacheCapacity)
-      : _cache(std::move(std::make_unique<GDFSCache<Key, Value>>(capacity))) {}
+      : SQLQueryCache(capacity, shard_count_for_capacity(capacity)) {}
+
+  SQLQueryCache(size_t capacity, const size_t shard_count) {
+    _create_shards(_cache_factory<GDFSCache<Key, Value>>(), capacity, shard_count);
+  }
 
   virtual ~SQLQueryCache() {}
 
@@ -32,56 +57,139 @@ class SQLQueryCache {
 
   // Adds or refreshes the cache entry [query, value].
   void set(const Key& query, const Value& value) {
-    if (_cache->capacity() == 0) return;
-
-    std::lock_guard<std::mutex> lock(_mutex);
-    _cache->set(query, value);
+    if (_capacity == 0) return;
+
+    std::shared_lock<std::shared_mutex> shards_lock(_shards_mutex);
+    auto& shard = _shard(query);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    // With more shards than entries (see the constructor with an explicit shard count), a shard has no capacity
+    if (shard.cache->capacity() == 0) return;
+    shard.cache->set(query, value);
   }
 
   // Tries to fetch the cache entry for the query into the result object.
   // Returns true if the entry was found, false otherwise.
   std::optional<Value> try_get(const Key& query) {
-    if (_cache->capacity() == 0) return {};
+    if (_capacity == 0) return {};
 
-    std::lock_guard<std::mutex> lock(_mutex);
-    if (!_cache->has(query)) {
+    std::shared_lock<std::shared_mutex> shards_lock(_shards_mutex);
+    auto& shard = _shard(query);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    if (!shard.cache->has(query)) {
       return {};
     }
-    return _cache->get(query);
+    return shard.cache->get(query);
   }
 
   // Checks whether an entry for the query exists.
-  bool has(const Key& query) const { return _cache->has(query); }
+  bool has(const Key& query) const {
+    std::shared_lock<std::shared_mutex> shards_lock(_shards_mutex);
+    const auto& shard = _shard(query);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.cache->has(query);
+  }
 
   // Returns and refreshes the cache entry for the given query.
   // Causes undefined behavior if the query is not in the cache.
   Value get(const Key& query) {
-    std::lock_guard<std::mutex> lock(_mutex);
-    return _cache->get(query);
+    std::shared_lock<std::shared_mutex> shards_lock(_shards_mutex);
+    auto& shard = _shard(query);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.cache->get(query);
   }
 
   // Purges all entries from the cache.
-  void clear() { _cache->clear(); }
+  void clear() {
+    std::shared_lock<std::shared_mutex> shards_lock(_shards_mutex);
+    for (auto& shard : _shards) {
+      std::lock_guard<std::mutex> lock(shard->mutex);
+      shard->cache->clear();
+    }
+  }
 
-  void resize(size_t capacity) { _cache->resize(capacity); }
+  // Distributes the new capacity over the shards. If the new capacity calls for a different number of shards (see
+  // shard_count_for_capacity()), the shards are replaced by empty ones, so that no shard is left without capacity.
+  void resize(size_t capacity) {
+    // Resizing is rare, so the exclusive lock, which also covers the shards' caches, does not hurt
+    std::lock_guard<std::shared_mutex> shards_lock(_shards_mutex);
 
-  size_t size() const { return _cache->size(); }
+    const auto shard_count = shard_count_for_capacity(capacity);
+    if (shard_count != _shards.size()) {
+      _create_shards(_make_cache, capacity, shard_count);
+      return;
+    }
 
-  // Returns a reference to the underlying cache.
-  AbstractCache<Key, Value>& cache() { return *_cache; }
+    for (auto shard_id = size_t{0}; shard_id < _shards.size(); ++shard_id) {
+      _shards[shard_id]->cache->resize(_shard_capacity(capacity, _shards.size(), shard_id));
+    }
+    _capacity = capacity;
+  }
+
+  size_t size() const {
+    std::shared_lock<std::shared_mutex> shards_lock(_shards_mutex);
+    auto size = size_t{0};
+    for (const auto& shard : _shards) {
+      std::lock_guard<std::mutex> lock(shard->mutex);
+      size += shard->cache->size();
+    }
+    return size;
+  }
 
-  // Replaces the underlying cache by creating a new object
-  // of the given cache type.
+  size_t capacity() const { return _capacity; }
+
+  size_t shard_count() const {
+    std::shared_lock<std::shared_mutex> shards_lock(_shards_mutex);
+    return _shards.size();
+  }
+
+  // Replaces the underlying caches by creating new objects of the given cache type. The number of shards is chosen
+  // based on the capacity.
   template <class cache_t>
   void replace_cache_impl(size_t capacity) {
-    _cache = std::make_unique<cache_t>(capacity);
+    std::lock_guard<std::shared_mutex> shards_lock(_shards_mutex);
+    _create_shards(_cache_factory<cache_t>(), capacity, shard_count_for_capacity(capacity));
   }
 
  protected:
-  // Underlying cache strategy.
-  std::unique_ptr<AbstractCache<Key, Value>> _cache;
+  struct Shard {
+    std::unique_ptr<AbstractCache<Key, Value>> cache;
+    mutable std::mutex mutex;
+  };
+
+  // Creates an underlying cache of the given capacity. Kept to re-create the shards with the same cache type on resize.
+  using CacheFactory = std::function<std::unique_ptr<AbstractCache<Key, Value>>(size_t)>;
+
+  template <class cache_t>
+  static CacheFactory _cache_factory() {
+    return [](const size_t capacity) { return std::make_unique<cache_t>(capacity); };
+  }
+
+  // Expects _shards_mutex to be locked exclusively by the caller (or the cache to be under construction)
+  void _create_shards(const CacheFactory& make_cache, const size_t capacity, const size_t shard_count) {
+    _make_cache = make_cache;
+    _shards.clear();
+    _shards.reserve(shard_count);
+    for (auto shard_id = size_t{0}; shard_id < shard_count; ++shard_id) {
+      _shards.emplace_back(std::make_unique<Shard>());
+      _shards.back()->cache = _make_cache(_shard_capacity(capacity, shard_count, shard_id));
+    }
+    _capacity = capacity;
+  }
+
+  // Spreads the remainder of the capacity over the first shards, so that the capacities add up to the total
+  static size_t _shard_capacity(const size_t capacity, const size_t shard_count, const size_t shard_id) {
+    return capacity / shard_count + (shard_id < capacity % shard_count ? 1 : 0);
+  }
+
+  // Expects _shards_mutex to be locked by the caller
+  Shard& _shard(const Key& query) const { return *_shards[std::hash<Key>{}(query) % _shards.size()]; }
+
+  // Underlying caches, one per shard.
+  std::vector<std::unique_ptr<Shard>> _shards;
+  CacheFactory _make_cache;
+  mutable std::shared_mutex _shards_mutex;
 
-  std::mutex _mutex;
+  std::atomic<size_t> _capacity{0};
 };
 
 }  // namespace opossum
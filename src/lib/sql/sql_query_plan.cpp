@@ -14,14 +14,15 @@ void SQLQueryPlan::add_tree_by_root(const std::shared_ptr<AbstractOperator>& op)
 
 void SQLQueryPlan::append_plan(const SQLQueryPlan& other_plan) {
   _roots.insert(_roots.end(), other_plan._roots.begin(), other_plan._roots.end());
+  if (other_plan._estimated_cost) _estimated_cost = _estimated_cost.value_or(Cost{0}) + *other_plan._estimated_cost;
 }
 
-std::vector<std::shared_ptr<OperatorTask>> SQLQueryPlan::create_tasks() const {
+std::vector<std::shared_ptr<OperatorTask>> SQLQueryPlan::create_tasks(SchedulePriority priority) const {
   std::vector<std::shared_ptr<OperatorTask>> tasks;
 
   for (const auto& root : _roots) {
     std::vector<std::shared_ptr<OperatorTask>> sub_list;
-    sub_list = OperatorTask::make_tasks_from_operator(root, _cleanup_temporaries);
+    sub_list = OperatorTask::make_tasks_from_operator(root, _cleanup_temporaries, priority);
     tasks.insert(tasks.end(), sub_list.begin(), sub_list.end());
   }
 
@@ -40,6 +41,7 @@ SQLQueryPlan SQLQueryPlan::deep_copy() const {
   }
 
   new_plan._parameter_ids = _parameter_ids;
+  new_plan._estimated_cost = _estimated_cost;
 
   return new_plan;
 }
@@ -58,4 +60,8 @@ const std::unordered_map<ValuePlaceholderID, ParameterID>& SQLQueryPlan::paramet
   return _parameter_ids;
 }
 
+void SQLQueryPlan::set_estimated_cost(const std::optional<Cost>& estimated_cost) { _estimated_cost = estimated_cost; }
+
+const std::optional<Cost>& SQLQueryPlan::estimated_cost() const { return _estimated_cost; }
+
 }  // namespace opossum
@@ -1,9 +1,11 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <vector>
 
 #include "all_parameter_variant.hpp"
+#include "cost_model/cost.hpp"
 #include "operators/abstract_operator.hpp"
 #include "scheduler/operator_task.hpp"
 
@@ -26,8 +28,8 @@ class SQLQueryPlan {
   // Append all operator trees from the other plan.
   void append_plan(const SQLQueryPlan& other_plan);
 
-  // Wrap all operator trees in tasks and return them.
-  std::vector<std::shared_ptr<OperatorTask>> create_tasks() const;
+  // Wrap all operator trees in tasks with the given priority and return them.
+  std::vector<std::shared_ptr<OperatorTask>> create_tasks(SchedulePriority priority = SchedulePriority::Default) const;
 
   // Returns the root nodes of all operator trees in the plan.
   const std::vector<std::shared_ptr<AbstractOperator>>& tree_roots() const;
@@ -42,6 +44,11 @@ class SQLQueryPlan {
   void set_parameter_ids(const std::unordered_map<ValuePlaceholderID, ParameterID>& parameter_ids);
   const std::unordered_map<ValuePlaceholderID, ParameterID>& parameter_ids() const;
 
+  // The Cost that the optimizer estimated for the LQP this plan was translated from, if it could estimate one. Used to
+  // pick the ResourceGroup the plan is executed in (see ResourceGroupManager).
+  void set_estimated_cost(const std::optional<Cost>& estimated_cost);
+  const std::optional<Cost>& estimated_cost() const;
+
  protected:
   // Should we delete temporary result tables once they are not needed anymore?
   CleanupTemporaries _cleanup_temporaries;
@@ -49,6 +56,7 @@ class SQLQueryPlan {
   // Root nodes of all operator trees that this plan contains.
   std::vector<std::shared_ptr<AbstractOperator>> _roots;
   std::unordered_map<ValuePlaceholderID, ParameterID> _parameter_ids;
+  std::optional<Cost> _estimated_cost;
 };
 
 }  // namespace opossum
@@ -49,6 +49,13 @@ class BaseColumnStatistics {
    */
   std::shared_ptr<BaseColumnStatistics> without_null_values() const;
 
+  /**
+   * @return statistics describing the values of both this and @param base_other_column_statistics, e.g., of two
+   *         chunks of a column. @param row_count and @param other_row_count are the number of rows described by each.
+   */
+  virtual std::shared_ptr<BaseColumnStatistics> merge(const BaseColumnStatistics& base_other_column_statistics,
+                                                      const float row_count, const float other_row_count) const = 0;
+
   /**
    * @defgroup Cardinality estimation
    * @{
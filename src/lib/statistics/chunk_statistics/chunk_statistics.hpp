@@ -10,6 +10,8 @@
 
 namespace opossum {
 
+class TableStatistics;
+
 /**
  * Container class that holds objects with statistical information about a chunk.
  */
@@ -25,7 +27,18 @@ class ChunkStatistics final : public std::enable_shared_from_this<ChunkStatistic
   bool can_prune(const ColumnID column_id, const AllTypeVariant& value,
                  const PredicateCondition predicate_condition) const;
 
+  /**
+   * Statistics about the rows of the chunk, in the format of the statistics of a table. They are computed by
+   * generate_table_statistics() the first time it needs them and merged into the statistics of the table from then on.
+   * Concurrent calls of generate_table_statistics() may set them at the same time, so they are accessed atomically.
+   */
+  std::shared_ptr<const TableStatistics> table_statistics() const { return std::atomic_load(&_table_statistics); }
+  void set_table_statistics(const std::shared_ptr<const TableStatistics>& table_statistics) {
+    std::atomic_store(&_table_statistics, table_statistics);
+  }
+
  protected:
   std::vector<std::shared_ptr<ChunkColumnStatistics>> _statistics;
+  std::shared_ptr<const TableStatistics> _table_statistics;
 };
 }  // namespace opossum
@@ -1,7 +1,12 @@
 #include "column_statistics.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <sstream>
 
+#include "histogram.hpp"
+#include "hyper_log_log.hpp"
 #include "resolve_type.hpp"
 #include "table_statistics.hpp"
 #include "type_cast.hpp"
@@ -36,9 +41,83 @@ ColumnDataType ColumnStatistics<ColumnDataType>::max() const {
   return _max;
 }
 
+template <typename ColumnDataType>
+std::shared_ptr<const Histogram<ColumnDataType>> ColumnStatistics<ColumnDataType>::histogram() const {
+  return _histogram;
+}
+
+template <typename ColumnDataType>
+void ColumnStatistics<ColumnDataType>::set_histogram(
+    const std::shared_ptr<const Histogram<ColumnDataType>>& histogram) {
+  _histogram = histogram;
+}
+
+template <typename ColumnDataType>
+std::shared_ptr<const HyperLogLog> ColumnStatistics<ColumnDataType>::distinct_count_sketch() const {
+  return _distinct_count_sketch;
+}
+
+template <typename ColumnDataType>
+void ColumnStatistics<ColumnDataType>::set_distinct_count_sketch(
+    const std::shared_ptr<const HyperLogLog>& distinct_count_sketch) {
+  _distinct_count_sketch = distinct_count_sketch;
+}
+
 template <typename ColumnDataType>
 std::shared_ptr<BaseColumnStatistics> ColumnStatistics<ColumnDataType>::clone() const {
-  return std::make_shared<ColumnStatistics<ColumnDataType>>(null_value_ratio(), distinct_count(), _min, _max);
+  auto column_statistics =
+      std::make_shared<ColumnStatistics<ColumnDataType>>(null_value_ratio(), distinct_count(), _min, _max);
+  column_statistics->_histogram = _histogram;
+  column_statistics->_distinct_count_sketch = _distinct_count_sketch;
+  return column_statistics;
+}
+
+template <typename ColumnDataType>
+std::shared_ptr<BaseColumnStatistics> ColumnStatistics<ColumnDataType>::merge(
+    const BaseColumnStatistics& base_other_column_statistics, const float row_count,
+    const float other_row_count) const {
+  Assert(_data_type == base_other_column_statistics.data_type(), "Cannot merge statistics of different type");
+
+  const auto& other_column_statistics =
+      static_cast<const ColumnStatistics<ColumnDataType>&>(base_other_column_statistics);
+
+  if (other_row_count == 0.0f) return clone();
+  if (row_count == 0.0f) return other_column_statistics.clone();
+
+  const auto merged_null_value_ratio =
+      (null_value_ratio() * row_count + other_column_statistics.null_value_ratio() * other_row_count) /
+      (row_count + other_row_count);
+
+  // Without non-null values, min and max are meaningless
+  if (distinct_count() == 0.0f || other_column_statistics.distinct_count() == 0.0f) {
+    const auto& non_null_column_statistics = distinct_count() == 0.0f ? other_column_statistics : *this;
+    auto merged_column_statistics = non_null_column_statistics.clone();
+    merged_column_statistics->set_null_value_ratio(merged_null_value_ratio);
+    return merged_column_statistics;
+  }
+
+  // Without sketches, the distinct count of the union can only be bounded
+  const auto min_distinct_count = std::max(distinct_count(), other_column_statistics.distinct_count());
+  const auto max_distinct_count = distinct_count() + other_column_statistics.distinct_count();
+  auto merged_distinct_count = min_distinct_count;
+
+  auto merged_distinct_count_sketch = std::shared_ptr<HyperLogLog>{};
+  if (_distinct_count_sketch && other_column_statistics._distinct_count_sketch) {
+    merged_distinct_count_sketch = std::make_shared<HyperLogLog>(*_distinct_count_sketch);
+    merged_distinct_count_sketch->merge(*other_column_statistics._distinct_count_sketch);
+    merged_distinct_count = std::clamp(merged_distinct_count_sketch->estimate_distinct_count(), min_distinct_count,
+                                       max_distinct_count);
+  }
+
+  auto merged_column_statistics = std::make_shared<ColumnStatistics<ColumnDataType>>(
+      merged_null_value_ratio, merged_distinct_count, std::min(_min, other_column_statistics._min),
+      std::max(_max, other_column_statistics._max));
+  merged_column_statistics->_distinct_count_sketch = merged_distinct_count_sketch;
+  if (_histogram && other_column_statistics._histogram) {
+    merged_column_statistics->_histogram = _histogram->merge(*other_column_statistics._histogram);
+  }
+
+  return merged_column_statistics;
 }
 
 template <typename ColumnDataType>
@@ -57,11 +136,15 @@ FilterByValueEstimate ColumnStatistics<ColumnDataType>::estimate_predicate_with_
       // distinction between integers and floats
       // for integers "< value" means that the new max is value <= value - 1
       // for floats "< value" means that the new max is value <= value - ε
-      if (std::is_integral_v<ColumnDataType>) {
+      if constexpr (std::is_integral_v<ColumnDataType>) {
         return estimate_range(_min, value - 1);
+      } else if (_histogram) {
+        // Histograms know the exact row count of frequent values, so ε does matter
+        return estimate_range(_min, std::nextafter(value, std::numeric_limits<ColumnDataType>::lowest()));
       }
       // intentionally no break
-      // if ColumnType is a floating point number, OpLessThanEquals behaviour is expected instead of OpLessThan
+      // if ColumnType is a floating point number without a Histogram, OpLessThanEquals behaviour is expected instead
+      // of OpLessThan
       [[fallthrough]];
     }
     case PredicateCondition::LessThanEquals:
@@ -71,11 +154,13 @@ FilterByValueEstimate ColumnStatistics<ColumnDataType>::estimate_predicate_with_
       // distinction between integers and floats
       // for integers "> value" means that the new min value is >= value + 1
       // for floats "> value" means that the new min value is >= value + ε
-      if (std::is_integral_v<ColumnDataType>) {
+      if constexpr (std::is_integral_v<ColumnDataType>) {
         return estimate_range(value + 1, _max);
+      } else if (_histogram) {
+        return estimate_range(std::nextafter(value, std::numeric_limits<ColumnDataType>::max()), _max);
       }
       // intentionally no break
-      // if ColumnType is a floating point number,
+      // if ColumnType is a floating point number without a Histogram,
       // OpGreaterThanEquals behaviour is expected instead of OpGreaterThan
       [[fallthrough]];
     }
@@ -276,7 +361,12 @@ FilterByColumnComparisonEstimate ColumnStatistics<ColumnDataType>::estimate_pred
 
   auto equal_values_ratio = 0.0f;
   // calculate ratio of rows with equal values
-  if (left_overlapping_distinct_count < right_overlapping_distinct_count) {
+  if (_histogram && right_column_statistics._histogram && _histogram->total_count() > 0.0f &&
+      right_column_statistics._histogram->total_count() > 0.0f) {
+    // Joining the histograms accounts for skew, e.g., for frequent values occurring in both columns
+    equal_values_ratio = _histogram->estimate_equi_join(*right_column_statistics._histogram) /
+                         (_histogram->total_count() * right_column_statistics._histogram->total_count());
+  } else if (left_overlapping_distinct_count < right_overlapping_distinct_count) {
     equal_values_ratio = left_overlapping_ratio / right_column_statistics.distinct_count();
   } else {
     equal_values_ratio = right_overlapping_ratio / distinct_count();
@@ -373,6 +463,14 @@ FilterByColumnComparisonEstimate ColumnStatistics<std::string>::estimate_predica
     return {0.f, without_null_values(), right_column_statistics.without_null_values()};
   }
 
+  if (predicate_condition == PredicateCondition::Equals && _histogram && right_column_statistics._histogram &&
+      _histogram->total_count() > 0.0f && right_column_statistics._histogram->total_count() > 0.0f) {
+    const auto equal_values_ratio = _histogram->estimate_equi_join(*right_column_statistics._histogram) /
+                                    (_histogram->total_count() * right_column_statistics._histogram->total_count());
+    return {non_null_value_ratio() * right_column_statistics.non_null_value_ratio() * equal_values_ratio,
+            without_null_values(), right_column_statistics.without_null_values()};
+  }
+
   return {non_null_value_ratio() * right_column_statistics.non_null_value_ratio(), without_null_values(),
           right_column_statistics.without_null_values()};
 }
@@ -427,6 +525,14 @@ FilterByValueEstimate ColumnStatistics<ColumnDataType>::estimate_range(const Col
   if (common_min == _min && common_max == _max) {
     return {non_null_value_ratio(), without_null_values()};
   }
+  if (_histogram && _histogram->total_count() > 0.0f) {
+    const auto histogram_estimate = _histogram->estimate_range(common_min, common_max);
+    const auto selectivity = histogram_estimate.row_count / _histogram->total_count();
+    auto column_statistics = std::make_shared<ColumnStatistics<ColumnDataType>>(
+        0.0f, histogram_estimate.distinct_count, common_min, common_max);
+    return {non_null_value_ratio() * selectivity, column_statistics};
+  }
+
   auto selectivity = 0.f;
   // estimate_selectivity_for_range function expects that the minimum must not be greater than the maximum
   if (common_min <= common_max) {
@@ -444,6 +550,13 @@ FilterByValueEstimate ColumnStatistics<ColumnDataType>::estimate_equals_with_val
   if (value < _min || value > _max) {
     new_distinct_count = 0.f;
   }
+  if (_histogram && _histogram->total_count() > 0.0f) {
+    const auto row_count = _histogram->estimate_equals(value);
+    auto column_statistics =
+        std::make_shared<ColumnStatistics<ColumnDataType>>(0.0f, row_count > 0.0f ? 1.0f : 0.0f, value, value);
+    return {non_null_value_ratio() * row_count / _histogram->total_count(), column_statistics};
+  }
+
   auto column_statistics = std::make_shared<ColumnStatistics<ColumnDataType>>(0.0f, new_distinct_count, value, value);
   if (distinct_count() == 0.0f) {
     return {0.0f, column_statistics};
@@ -460,6 +573,10 @@ FilterByValueEstimate ColumnStatistics<ColumnDataType>::estimate_not_equals_with
     return {non_null_value_ratio(), without_null_values()};
   }
   auto column_statistics = std::make_shared<ColumnStatistics<ColumnDataType>>(0.0f, distinct_count() - 1, _min, _max);
+  if (_histogram && _histogram->total_count() > 0.0f) {
+    const auto equal_row_count = _histogram->estimate_equals(value);
+    return {non_null_value_ratio() * (1.0f - equal_row_count / _histogram->total_count()), column_statistics};
+  }
   if (distinct_count() == 0.0f) {
     return {0.0f, column_statistics};
   } else {
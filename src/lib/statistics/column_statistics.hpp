@@ -10,8 +10,17 @@
 
 namespace opossum {
 
+template <typename T>
+class Histogram;
+class HyperLogLog;
+
 /**
  * @tparam ColumnDataType   the DataType of the values in the Column that these statistics represent
+ *
+ * If a Histogram is set, it is used to estimate predicates instead of assuming a uniform distribution of the values
+ * between min and max.
+ *
+ * If a HyperLogLog sketch of the distinct values is set, merge() uses it to estimate the distinct count of the union.
  */
 template <typename ColumnDataType>
 class ColumnStatistics : public BaseColumnStatistics {
@@ -28,6 +37,12 @@ class ColumnStatistics : public BaseColumnStatistics {
    */
   ColumnDataType min() const;
   ColumnDataType max() const;
+
+  std::shared_ptr<const Histogram<ColumnDataType>> histogram() const;
+  void set_histogram(const std::shared_ptr<const Histogram<ColumnDataType>>& histogram);
+
+  std::shared_ptr<const HyperLogLog> distinct_count_sketch() const;
+  void set_distinct_count_sketch(const std::shared_ptr<const HyperLogLog>& distinct_count_sketch);
   /** @} */
 
   /**
@@ -35,6 +50,8 @@ class ColumnStatistics : public BaseColumnStatistics {
    * @{
    */
   std::shared_ptr<BaseColumnStatistics> clone() const override;
+  std::shared_ptr<BaseColumnStatistics> merge(const BaseColumnStatistics& base_other_column_statistics,
+                                              const float row_count, const float other_row_count) const override;
   FilterByValueEstimate estimate_predicate_with_value(
       const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
       const std::optional<AllTypeVariant>& value2 = std::nullopt) const override;
@@ -79,6 +96,8 @@ class ColumnStatistics : public BaseColumnStatistics {
  private:
   ColumnDataType _min;
   ColumnDataType _max;
+  std::shared_ptr<const Histogram<ColumnDataType>> _histogram;
+  std::shared_ptr<const HyperLogLog> _distinct_count_sketch;
 };
 
 }  // namespace opossum
@@ -1,29 +1,71 @@
 #pragma once
 
-#include <unordered_set>
+#include <algorithm>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "base_column_statistics.hpp"
 #include "column_statistics.hpp"
+#include "histogram.hpp"
+#include "hyper_log_log.hpp"
 #include "resolve_type.hpp"
+#include "storage/base_column.hpp"
 #include "storage/create_iterable_from_column.hpp"
 #include "storage/table.hpp"
 
 namespace opossum {
 
 /**
- * Generate the statistics of a single column. Used by generate_table_statistics()
+ * Generate the Histogram of a column from the number of occurrences of each of its distinct values
  */
 template <typename ColumnDataType>
-std::shared_ptr<BaseColumnStatistics> generate_column_statistics(const Table& table, const ColumnID column_id) {
-  std::unordered_set<ColumnDataType> distinct_set;
+std::shared_ptr<Histogram<ColumnDataType>> generate_histogram(
+    const std::unordered_map<ColumnDataType, size_t>& distinct_value_counts) {
+  auto value_counts = std::vector<std::pair<ColumnDataType, float>>{};
+  value_counts.reserve(distinct_value_counts.size());
+
+  for (const auto& distinct_value_count : distinct_value_counts) {
+    value_counts.emplace_back(distinct_value_count.first, static_cast<float>(distinct_value_count.second));
+  }
+
+  std::sort(value_counts.begin(), value_counts.end(),
+            [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+  return Histogram<ColumnDataType>::from_value_counts(value_counts);
+}
+
+/**
+ * Generate the HyperLogLog sketch of the distinct values of a column, which allows merging its distinct count with
+ * those of other columns (e.g., of other chunks)
+ */
+template <typename ColumnDataType>
+std::shared_ptr<HyperLogLog> generate_distinct_count_sketch(
+    const std::unordered_map<ColumnDataType, size_t>& distinct_value_counts) {
+  auto distinct_count_sketch = std::make_shared<HyperLogLog>();
+  for (const auto& distinct_value_count : distinct_value_counts) {
+    distinct_count_sketch->add(distinct_value_count.first);
+  }
+  return distinct_count_sketch;
+}
+
+/**
+ * Generate the statistics of the values in @param columns, e.g., the columns with the same ColumnID of all chunks of a
+ * table. Used by generate_table_statistics() and generate_chunk_statistics()
+ */
+template <typename ColumnDataType>
+std::shared_ptr<BaseColumnStatistics> generate_column_statistics(
+    const std::vector<std::shared_ptr<const BaseColumn>>& columns) {
+  std::unordered_map<ColumnDataType, size_t> distinct_value_counts;
 
+  auto row_count = size_t{0};
   auto null_value_count = size_t{0};
 
   auto min = std::numeric_limits<ColumnDataType>::max();
   auto max = std::numeric_limits<ColumnDataType>::lowest();
 
-  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
-    const auto base_column = table.get_chunk(chunk_id)->get_column(column_id);
+  for (const auto& base_column : columns) {
+    row_count += base_column->size();
 
     resolve_column_type<ColumnDataType>(*base_column, [&](auto& column) {
       auto iterable = create_iterable_from_column<ColumnDataType>(column);
@@ -31,7 +73,7 @@ std::shared_ptr<BaseColumnStatistics> generate_column_statistics(const Table& ta
         if (column_value.is_null()) {
           ++null_value_count;
         } else {
-          distinct_set.insert(column_value.value());
+          ++distinct_value_counts[column_value.value()];
           min = std::min(min, column_value.value());
           max = std::max(max, column_value.value());
         }
@@ -40,19 +82,39 @@ std::shared_ptr<BaseColumnStatistics> generate_column_statistics(const Table& ta
   }
 
   const auto null_value_ratio =
-      table.row_count() > 0 ? static_cast<float>(null_value_count) / static_cast<float>(table.row_count()) : 0.0f;
-  const auto distinct_count = static_cast<float>(distinct_set.size());
+      row_count > 0 ? static_cast<float>(null_value_count) / static_cast<float>(row_count) : 0.0f;
+  const auto distinct_count = static_cast<float>(distinct_value_counts.size());
 
   if (distinct_count == 0.0f) {
     min = std::numeric_limits<ColumnDataType>::min();
     max = std::numeric_limits<ColumnDataType>::max();
   }
 
-  return std::make_shared<ColumnStatistics<ColumnDataType>>(null_value_ratio, distinct_count, min, max);
+  const auto column_statistics =
+      std::make_shared<ColumnStatistics<ColumnDataType>>(null_value_ratio, distinct_count, min, max);
+  if (distinct_count > 0.0f) column_statistics->set_histogram(generate_histogram(distinct_value_counts));
+  column_statistics->set_distinct_count_sketch(generate_distinct_count_sketch(distinct_value_counts));
+
+  return column_statistics;
 }
 
 template <>
-std::shared_ptr<BaseColumnStatistics> generate_column_statistics<std::string>(const Table& table,
-                                                                              const ColumnID column_id);
+std::shared_ptr<BaseColumnStatistics> generate_column_statistics<std::string>(
+    const std::vector<std::shared_ptr<const BaseColumn>>& columns);
+
+/**
+ * Generate the statistics of a single column of a table
+ */
+template <typename ColumnDataType>
+std::shared_ptr<BaseColumnStatistics> generate_column_statistics(const Table& table, const ColumnID column_id) {
+  std::vector<std::shared_ptr<const BaseColumn>> columns;
+  columns.reserve(table.chunk_count());
+
+  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    columns.emplace_back(table.get_chunk(chunk_id)->get_column(column_id));
+  }
+
+  return generate_column_statistics<ColumnDataType>(columns);
+}
 
 }  // namespace opossum
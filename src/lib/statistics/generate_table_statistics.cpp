@@ -1,31 +1,95 @@
 #include "generate_table_statistics.hpp"
 
+#include <memory>
+#include <optional>
 #include <unordered_set>
 
 #include "base_column_statistics.hpp"
+#include "chunk_statistics/chunk_statistics.hpp"
 #include "column_statistics.hpp"
 #include "generate_column_statistics.hpp"
 #include "resolve_type.hpp"
+#include "storage/chunk.hpp"
 #include "storage/create_iterable_from_column.hpp"
 #include "storage/table.hpp"
 #include "table_statistics.hpp"
 
 namespace opossum {
 
-TableStatistics generate_table_statistics(const Table& table) {
+namespace {
+
+TableStatistics generate_statistics_from_chunks(const TableType table_type,
+                                                const std::vector<DataType>& column_data_types,
+                                                const std::vector<std::shared_ptr<const Chunk>>& chunks) {
   std::vector<std::shared_ptr<const BaseColumnStatistics>> column_statistics;
-  column_statistics.reserve(table.column_count());
+  column_statistics.reserve(column_data_types.size());
 
-  for (ColumnID column_id{0}; column_id < table.column_count(); ++column_id) {
-    const auto column_data_type = table.column_data_types()[column_id];
+  auto row_count = size_t{0};
+  for (const auto& chunk : chunks) {
+    row_count += chunk->size();
+  }
 
-    resolve_data_type(column_data_type, [&](auto type) {
+  for (ColumnID column_id{0}; column_id < column_data_types.size(); ++column_id) {
+    std::vector<std::shared_ptr<const BaseColumn>> columns;
+    columns.reserve(chunks.size());
+    for (const auto& chunk : chunks) {
+      columns.emplace_back(chunk->get_column(column_id));
+    }
+
+    resolve_data_type(column_data_types[column_id], [&](auto type) {
       using ColumnDataType = typename decltype(type)::type;
-      column_statistics.emplace_back(generate_column_statistics<ColumnDataType>(table, column_id));
+      column_statistics.emplace_back(generate_column_statistics<ColumnDataType>(columns));
     });
   }
 
-  return {table.type(), static_cast<float>(table.row_count()), column_statistics};
+  return {table_type, static_cast<float>(row_count), column_statistics};
+}
+
+}  // namespace
+
+TableStatistics generate_table_statistics(const Table& table) {
+  auto cached_table_statistics = std::optional<TableStatistics>{};
+  std::vector<std::shared_ptr<const Chunk>> chunks_to_scan;
+
+  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    const auto chunk_statistics = chunk->statistics();
+
+    // Only encoded chunks have ChunkStatistics. As they are immutable, their statistics are generated once and cached.
+    if (!chunk_statistics || chunk->is_mutable()) {
+      chunks_to_scan.emplace_back(chunk);
+      continue;
+    }
+
+    auto chunk_table_statistics = chunk_statistics->table_statistics();
+    if (!chunk_table_statistics) {
+      chunk_table_statistics =
+          std::make_shared<TableStatistics>(generate_chunk_statistics(chunk, table.column_data_types()));
+      chunk_statistics->set_table_statistics(chunk_table_statistics);
+    }
+
+    if (cached_table_statistics) {
+      cached_table_statistics.emplace(cached_table_statistics->merge(*chunk_table_statistics));
+    } else {
+      cached_table_statistics.emplace(*chunk_table_statistics);
+    }
+  }
+
+  // Scanning the remaining chunks together keeps their statistics exact
+  if (!cached_table_statistics || !chunks_to_scan.empty()) {
+    const auto scanned_table_statistics =
+        generate_statistics_from_chunks(table.type(), table.column_data_types(), chunks_to_scan);
+    if (!cached_table_statistics) return scanned_table_statistics;
+
+    cached_table_statistics.emplace(cached_table_statistics->merge(scanned_table_statistics));
+  }
+
+  return {table.type(), cached_table_statistics->row_count(), cached_table_statistics->column_statistics()};
+}
+
+TableStatistics generate_chunk_statistics(const std::shared_ptr<const Chunk>& chunk,
+                                          const std::vector<DataType>& column_data_types) {
+  return generate_statistics_from_chunks(TableType::Data, column_data_types, {chunk});
 }
 
 }  // namespace opossum
@@ -2,16 +2,29 @@
 
 #include <memory>
 #include <unordered_set>
+#include <vector>
 
 #include "table_statistics.hpp"
 
 namespace opossum {
 
+class Chunk;
 class Table;
 
 /**
  * Generate statistics about a Table by analysing its entire data. This may be slow, use with caution.
+ *
+ * The statistics of each encoded (and thus immutable) chunk are generated once (see generate_chunk_statistics()) and
+ * cached in its ChunkStatistics. Later calls do not scan these chunks again, but merge their cached statistics into
+ * those of the remaining chunks instead.
  */
 TableStatistics generate_table_statistics(const Table& table);
 
+/**
+ * Generate statistics about the rows of a single Chunk. For encoded chunks, generate_table_statistics() stores them in
+ * the ChunkStatistics, so that it can maintain the statistics of a growing table incrementally.
+ */
+TableStatistics generate_chunk_statistics(const std::shared_ptr<const Chunk>& chunk,
+                                          const std::vector<DataType>& column_data_types);
+
 }  // namespace opossum
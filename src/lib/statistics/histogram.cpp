@@ -0,0 +1,347 @@
+#include "histogram.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <optional>
+#include <sstream>
+#include <type_traits>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+template <typename T>
+std::shared_ptr<Histogram<T>> Histogram<T>::from_value_counts(const std::vector<std::pair<T, float>>& value_counts,
+                                                              const size_t top_value_count,
+                                                              const size_t bucket_count) {
+  DebugAssert(std::is_sorted(value_counts.begin(), value_counts.end(),
+                             [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; }),
+              "Expected value counts to be sorted by value");
+  Assert(bucket_count > 0, "Need at least one bucket");
+
+  // Determine the most frequent values. Ties are broken by picking the smaller value.
+  auto indices_by_count = std::vector<size_t>(value_counts.size());
+  std::iota(indices_by_count.begin(), indices_by_count.end(), size_t{0});
+
+  const auto actual_top_value_count = std::min(top_value_count, value_counts.size());
+  std::partial_sort(indices_by_count.begin(), indices_by_count.begin() + actual_top_value_count,
+                    indices_by_count.end(), [&](const auto lhs, const auto rhs) {
+                      if (value_counts[lhs].second != value_counts[rhs].second) {
+                        return value_counts[lhs].second > value_counts[rhs].second;
+                      }
+                      return lhs < rhs;
+                    });
+
+  auto is_top_value = std::vector<bool>(value_counts.size(), false);
+  for (auto top_value_idx = size_t{0}; top_value_idx < actual_top_value_count; ++top_value_idx) {
+    is_top_value[indices_by_count[top_value_idx]] = true;
+  }
+
+  auto top_values = std::vector<std::pair<T, float>>{};
+  top_values.reserve(actual_top_value_count);
+  auto remaining_row_count = 0.0f;
+
+  for (auto value_idx = size_t{0}; value_idx < value_counts.size(); ++value_idx) {
+    if (is_top_value[value_idx]) {
+      top_values.emplace_back(value_counts[value_idx]);
+    } else {
+      remaining_row_count += value_counts[value_idx].second;
+    }
+  }
+
+  // Distribute the remaining values among equi-depth buckets. A value is never split across buckets.
+  const auto bucket_depth = remaining_row_count / static_cast<float>(bucket_count);
+
+  auto buckets = std::vector<Bucket>{};
+  auto current_bucket = std::optional<Bucket>{};
+
+  for (auto value_idx = size_t{0}; value_idx < value_counts.size(); ++value_idx) {
+    if (is_top_value[value_idx]) continue;
+
+    const auto& value_count = value_counts[value_idx];
+    if (!current_bucket) current_bucket = Bucket{value_count.first, value_count.first, 0.0f, 0.0f};
+
+    current_bucket->max = value_count.first;
+    current_bucket->row_count += value_count.second;
+    current_bucket->distinct_count += 1.0f;
+
+    if (current_bucket->row_count >= bucket_depth) {
+      buckets.emplace_back(*current_bucket);
+      current_bucket.reset();
+    }
+  }
+
+  if (current_bucket) buckets.emplace_back(*current_bucket);
+
+  return std::make_shared<Histogram<T>>(top_values, buckets);
+}
+
+template <typename T>
+Histogram<T>::Histogram(const std::vector<std::pair<T, float>>& top_values, const std::vector<Bucket>& buckets)
+    : _top_values(top_values), _buckets(buckets) {
+  DebugAssert(std::is_sorted(_top_values.begin(), _top_values.end(),
+                             [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; }),
+              "Expected top values to be sorted");
+  DebugAssert(std::adjacent_find(_buckets.begin(), _buckets.end(),
+                                 [](const auto& lhs, const auto& rhs) { return !(lhs.max < rhs.min); }) ==
+                  _buckets.end(),
+              "Expected buckets to be sorted and non-overlapping");
+
+  for (const auto& top_value : _top_values) {
+    _total_count += top_value.second;
+  }
+  for (const auto& bucket : _buckets) {
+    _total_count += bucket.row_count;
+  }
+}
+
+template <typename T>
+const std::vector<std::pair<T, float>>& Histogram<T>::top_values() const {
+  return _top_values;
+}
+
+template <typename T>
+const std::vector<typename Histogram<T>::Bucket>& Histogram<T>::buckets() const {
+  return _buckets;
+}
+
+template <typename T>
+float Histogram<T>::total_count() const {
+  return _total_count;
+}
+
+template <typename T>
+float Histogram<T>::estimate_equals(const T& value) const {
+  const auto top_value_iter =
+      std::lower_bound(_top_values.begin(), _top_values.end(), value,
+                       [](const auto& top_value, const auto& search_value) { return top_value.first < search_value; });
+  if (top_value_iter != _top_values.end() && top_value_iter->first == value) {
+    return top_value_iter->second;
+  }
+
+  return _estimate_equals_in_buckets(value);
+}
+
+template <typename T>
+HistogramRangeEstimate Histogram<T>::estimate_range(const T& minimum, const T& maximum) const {
+  auto estimate = HistogramRangeEstimate{};
+  if (maximum < minimum) return estimate;
+
+  for (const auto& top_value : _top_values) {
+    if (top_value.first < minimum || maximum < top_value.first) continue;
+    estimate.row_count += top_value.second;
+    estimate.distinct_count += 1.0f;
+  }
+
+  for (const auto& bucket : _buckets) {
+    const auto overlap_ratio = _bucket_overlap_ratio(bucket, minimum, maximum);
+    estimate.row_count += overlap_ratio * bucket.row_count;
+    estimate.distinct_count += overlap_ratio * bucket.distinct_count;
+  }
+
+  return estimate;
+}
+
+template <typename T>
+float Histogram<T>::estimate_equi_join(const Histogram<T>& right) const {
+  auto row_count = 0.0f;
+
+  // Join the top values of this Histogram with all values of the right Histogram
+  for (const auto& top_value : _top_values) {
+    row_count += top_value.second * right.estimate_equals(top_value.first);
+  }
+
+  // Join the top values of the right Histogram with the buckets of this Histogram. Values that are top values in both
+  // Histograms were handled above.
+  for (const auto& right_top_value : right._top_values) {
+    if (_is_top_value(right_top_value.first)) continue;
+
+    row_count += right_top_value.second * _estimate_equals_in_buckets(right_top_value.first);
+  }
+
+  // Join the overlapping buckets of both Histograms
+  auto left_bucket_idx = size_t{0};
+  auto right_bucket_idx = size_t{0};
+
+  while (left_bucket_idx < _buckets.size() && right_bucket_idx < right._buckets.size()) {
+    const auto& left_bucket = _buckets[left_bucket_idx];
+    const auto& right_bucket = right._buckets[right_bucket_idx];
+
+    const auto overlap_min = std::max(left_bucket.min, right_bucket.min);
+    const auto overlap_max = std::min(left_bucket.max, right_bucket.max);
+
+    if (!(overlap_max < overlap_min)) {
+      const auto left_overlap_ratio = _bucket_overlap_ratio(left_bucket, overlap_min, overlap_max);
+      const auto right_overlap_ratio = _bucket_overlap_ratio(right_bucket, overlap_min, overlap_max);
+
+      const auto left_distinct_count = left_overlap_ratio * left_bucket.distinct_count;
+      const auto right_distinct_count = right_overlap_ratio * right_bucket.distinct_count;
+
+      row_count += (left_overlap_ratio * left_bucket.row_count) * (right_overlap_ratio * right_bucket.row_count) /
+                   std::max({left_distinct_count, right_distinct_count, 1.0f});
+    }
+
+    if (left_bucket.max < right_bucket.max) {
+      ++left_bucket_idx;
+    } else {
+      ++right_bucket_idx;
+    }
+  }
+
+  return row_count;
+}
+
+template <typename T>
+std::shared_ptr<Histogram<T>> Histogram<T>::merge(const Histogram<T>& other, const size_t top_value_count,
+                                                  const size_t bucket_count) const {
+  Assert(bucket_count > 0, "Need at least one bucket");
+
+  // The top values of the merged Histogram are chosen from the top values of both Histograms
+  auto candidates = std::vector<std::pair<T, float>>{};
+  for (const auto& top_value : _top_values) {
+    candidates.emplace_back(top_value.first, top_value.second + other.estimate_equals(top_value.first));
+  }
+  for (const auto& top_value : other._top_values) {
+    if (_is_top_value(top_value.first)) continue;
+    candidates.emplace_back(top_value.first, estimate_equals(top_value.first) + top_value.second);
+  }
+
+  const auto actual_top_value_count = std::min(top_value_count, candidates.size());
+  std::partial_sort(candidates.begin(), candidates.begin() + actual_top_value_count, candidates.end(),
+                    [](const auto& lhs, const auto& rhs) {
+                      if (lhs.second != rhs.second) return lhs.second > rhs.second;
+                      return lhs.first < rhs.first;
+                    });
+  candidates.resize(actual_top_value_count);
+  std::sort(candidates.begin(), candidates.end(),
+            [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+  const auto& merged_top_values = candidates;
+
+  const auto is_merged_top_value = [&](const T& value) {
+    return std::binary_search(merged_top_values.begin(), merged_top_values.end(), std::make_pair(value, 0.0f),
+                              [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+  };
+
+  // Collect the buckets of both Histograms, without the rows of the merged top values. Top values that didn't make it
+  // into the merged top values become buckets of their own.
+  auto buckets = std::vector<Bucket>{};
+
+  const auto add_buckets = [&](const Histogram<T>& histogram) {
+    for (const auto& top_value : histogram._top_values) {
+      if (!is_merged_top_value(top_value.first)) {
+        buckets.push_back({top_value.first, top_value.first, top_value.second, 1.0f});
+      }
+    }
+
+    for (auto bucket : histogram._buckets) {
+      for (const auto& top_value : merged_top_values) {
+        if (top_value.first < bucket.min || bucket.max < top_value.first || histogram._is_top_value(top_value.first)) {
+          continue;
+        }
+        bucket.row_count -= histogram._estimate_equals_in_buckets(top_value.first);
+        bucket.distinct_count -= 1.0f;
+      }
+
+      if (bucket.row_count <= 0.0f) continue;
+      bucket.distinct_count = std::max(bucket.distinct_count, 1.0f);
+      buckets.emplace_back(bucket);
+    }
+  };
+
+  add_buckets(*this);
+  add_buckets(other);
+
+  std::sort(buckets.begin(), buckets.end(), [](const auto& lhs, const auto& rhs) { return lhs.min < rhs.min; });
+
+  // Coalesce overlapping buckets. Within the overlapping range, the values of the bucket with fewer distinct values
+  // are assumed to be contained in the other bucket.
+  auto merged_buckets = std::vector<Bucket>{};
+  for (const auto& bucket : buckets) {
+    if (merged_buckets.empty() || merged_buckets.back().max < bucket.min) {
+      merged_buckets.emplace_back(bucket);
+      continue;
+    }
+
+    auto& merged_bucket = merged_buckets.back();
+    const auto overlap_max = std::min(merged_bucket.max, bucket.max);
+    const auto shared_distinct_count =
+        std::min(_bucket_overlap_ratio(merged_bucket, bucket.min, overlap_max) * merged_bucket.distinct_count,
+                 _bucket_overlap_ratio(bucket, bucket.min, overlap_max) * bucket.distinct_count);
+
+    merged_bucket.max = std::max(merged_bucket.max, bucket.max);
+    merged_bucket.row_count += bucket.row_count;
+    merged_bucket.distinct_count += bucket.distinct_count - shared_distinct_count;
+  }
+
+  // Combine neighbouring buckets until the bucket count is reached. Picking the pair with the fewest rows keeps the
+  // buckets roughly equi-depth.
+  while (merged_buckets.size() > bucket_count) {
+    auto smallest_pair_idx = size_t{0};
+    for (auto bucket_idx = size_t{1}; bucket_idx + 1 < merged_buckets.size(); ++bucket_idx) {
+      if (merged_buckets[bucket_idx].row_count + merged_buckets[bucket_idx + 1].row_count <
+          merged_buckets[smallest_pair_idx].row_count + merged_buckets[smallest_pair_idx + 1].row_count) {
+        smallest_pair_idx = bucket_idx;
+      }
+    }
+
+    auto& bucket = merged_buckets[smallest_pair_idx];
+    const auto& next_bucket = merged_buckets[smallest_pair_idx + 1];
+    bucket.max = next_bucket.max;
+    bucket.row_count += next_bucket.row_count;
+    bucket.distinct_count += next_bucket.distinct_count;
+    merged_buckets.erase(merged_buckets.begin() + smallest_pair_idx + 1);
+  }
+
+  return std::make_shared<Histogram<T>>(merged_top_values, merged_buckets);
+}
+
+template <typename T>
+std::string Histogram<T>::description() const {
+  std::stringstream stream;
+  stream << "Histogram: " << _top_values.size() << " top values, " << _buckets.size() << " buckets, " << _total_count
+         << " rows" << std::endl;
+  return stream.str();
+}
+
+template <typename T>
+float Histogram<T>::_bucket_overlap_ratio(const Bucket& bucket, const T& minimum, const T& maximum) {
+  const auto overlap_min = std::max(bucket.min, minimum);
+  const auto overlap_max = std::min(bucket.max, maximum);
+
+  if (overlap_max < overlap_min) return 0.0f;
+  if (overlap_min == bucket.min && overlap_max == bucket.max) return 1.0f;
+
+  // Since the overlap is partial, bucket.min < bucket.max
+  if constexpr (std::is_integral_v<T>) {
+    return static_cast<float>((static_cast<double>(overlap_max) - static_cast<double>(overlap_min) + 1.0) /
+                              (static_cast<double>(bucket.max) - static_cast<double>(bucket.min) + 1.0));
+  } else if constexpr (std::is_floating_point_v<T>) {
+    return static_cast<float>((static_cast<double>(overlap_max) - static_cast<double>(overlap_min)) /
+                              (static_cast<double>(bucket.max) - static_cast<double>(bucket.min)));
+  } else {
+    return 0.5f;
+  }
+}
+
+template <typename T>
+float Histogram<T>::_estimate_equals_in_buckets(const T& value) const {
+  // Find the first bucket that doesn't end before the value
+  const auto bucket_iter = std::lower_bound(
+      _buckets.begin(), _buckets.end(), value,
+      [](const auto& bucket, const auto& search_value) { return bucket.max < search_value; });
+  if (bucket_iter == _buckets.end() || value < bucket_iter->min) return 0.0f;
+
+  return bucket_iter->row_count / bucket_iter->distinct_count;
+}
+
+template <typename T>
+bool Histogram<T>::_is_top_value(const T& value) const {
+  const auto top_value_iter =
+      std::lower_bound(_top_values.begin(), _top_values.end(), value,
+                       [](const auto& top_value, const auto& search_value) { return top_value.first < search_value; });
+  return top_value_iter != _top_values.end() && top_value_iter->first == value;
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(Histogram);
+
+}  // namespace opossum
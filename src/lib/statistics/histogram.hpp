@@ -0,0 +1,117 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+
+namespace opossum {
+
+/**
+ * Estimated number of rows and distinct values for a range of a Histogram
+ */
+struct HistogramRangeEstimate final {
+  float row_count{0.0f};
+  float distinct_count{0.0f};
+};
+
+/**
+ * Describes the distribution of the non-null values of a column.
+ *
+ * The most frequent values ("top values") are stored with their exact row count. All other values are summarized in
+ * equi-depth buckets, i.e., each bucket covers a value range that contains roughly the same number of rows. Within a
+ * bucket, values are assumed to be distributed uniformly.
+ *
+ * Storing the top values separately captures heavy hitters on skewed columns, while the equi-depth buckets adapt to
+ * the remaining distribution, so that dense value ranges get more buckets than sparse ones.
+ *
+ * For strings, values within a bucket can't be interpolated. A bucket partially covered by a range is assumed to
+ * contribute half of its rows.
+ */
+template <typename T>
+class Histogram final {
+ public:
+  struct Bucket final {
+    T min;
+    T max;
+    float row_count;
+    float distinct_count;
+  };
+
+  static constexpr auto DEFAULT_TOP_VALUE_COUNT = size_t{16};
+  static constexpr auto DEFAULT_BUCKET_COUNT = size_t{64};
+
+  /**
+   * @param value_counts    Pairs of values and the number of their occurrences, sorted by value, without duplicates
+   */
+  static std::shared_ptr<Histogram<T>> from_value_counts(const std::vector<std::pair<T, float>>& value_counts,
+                                                         const size_t top_value_count = DEFAULT_TOP_VALUE_COUNT,
+                                                         const size_t bucket_count = DEFAULT_BUCKET_COUNT);
+
+  /**
+   * @param top_values  Sorted by value
+   * @param buckets     Sorted by value and non-overlapping. The rows of the top values are not part of any bucket.
+   */
+  Histogram(const std::vector<std::pair<T, float>>& top_values, const std::vector<Bucket>& buckets);
+
+  /**
+   * @defgroup Member access
+   * @{
+   */
+  const std::vector<std::pair<T, float>>& top_values() const;
+  const std::vector<Bucket>& buckets() const;
+
+  // Total number of (non-null) rows represented by this Histogram
+  float total_count() const;
+  /** @} */
+
+  /**
+   * @defgroup Cardinality estimation
+   * @{
+   */
+
+  /**
+   * @return the estimated number of rows with @param value
+   */
+  float estimate_equals(const T& value) const;
+
+  /**
+   * @return the estimated number of rows and distinct values in [@param minimum, @param maximum]
+   */
+  HistogramRangeEstimate estimate_range(const T& minimum, const T& maximum) const;
+
+  /**
+   * @return the estimated number of rows of an equi-join of the column described by this Histogram with the column
+   *         described by @param right. Buckets are joined under the assumption that the values in the overlapping
+   *         range of the column with fewer distinct values are contained in the other column.
+   */
+  float estimate_equi_join(const Histogram<T>& right) const;
+  /** @} */
+
+  /**
+   * @return a Histogram describing the rows of both this Histogram and @param other, e.g., of two chunks of a column.
+   *         The most frequent values of the union become its top values, all other values and buckets are merged into
+   *         at most @param bucket_count buckets.
+   */
+  std::shared_ptr<Histogram<T>> merge(const Histogram<T>& other, const size_t top_value_count = DEFAULT_TOP_VALUE_COUNT,
+                                      const size_t bucket_count = DEFAULT_BUCKET_COUNT) const;
+
+  std::string description() const;
+
+ private:
+  // Ratio of the bucket's value range that lies within [minimum, maximum]
+  static float _bucket_overlap_ratio(const Bucket& bucket, const T& minimum, const T& maximum);
+
+  // Number of rows with @param value, excluding the top values
+  float _estimate_equals_in_buckets(const T& value) const;
+
+  bool _is_top_value(const T& value) const;
+
+  std::vector<std::pair<T, float>> _top_values;
+  std::vector<Bucket> _buckets;
+  float _total_count{0.0f};
+};
+
+}  // namespace opossum
@@ -0,0 +1,56 @@
+#include "hyper_log_log.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace opossum {
+
+HyperLogLog::HyperLogLog() : _registers(REGISTER_COUNT, 0) {}
+
+void HyperLogLog::add_hash(const size_t hash) {
+  // std::hash is the identity for integers, so the bits are mixed using the finalizer of MurmurHash3
+  auto mixed_hash = static_cast<uint64_t>(hash);
+  mixed_hash ^= mixed_hash >> 33;
+  mixed_hash *= 0xff51afd7ed558ccdull;
+  mixed_hash ^= mixed_hash >> 33;
+  mixed_hash *= 0xc4ceb9fe1a85ec53ull;
+  mixed_hash ^= mixed_hash >> 33;
+
+  // The first PRECISION bits select the register, which stores the maximum position of the first set bit in the rest
+  const auto register_idx = mixed_hash >> (64 - PRECISION);
+  const auto remaining_bits = mixed_hash << PRECISION;
+  const auto rank =
+      static_cast<uint8_t>(remaining_bits == 0 ? 64 - PRECISION + 1 : __builtin_clzll(remaining_bits) + 1);
+
+  _registers[register_idx] = std::max(_registers[register_idx], rank);
+}
+
+void HyperLogLog::merge(const HyperLogLog& other) {
+  for (auto register_idx = size_t{0}; register_idx < REGISTER_COUNT; ++register_idx) {
+    _registers[register_idx] = std::max(_registers[register_idx], other._registers[register_idx]);
+  }
+}
+
+float HyperLogLog::estimate_distinct_count() const {
+  const auto register_count = static_cast<double>(REGISTER_COUNT);
+
+  auto harmonic_sum = 0.0;
+  auto empty_register_count = size_t{0};
+  for (const auto value : _registers) {
+    harmonic_sum += std::ldexp(1.0, -static_cast<int>(value));
+    if (value == 0) ++empty_register_count;
+  }
+
+  const auto alpha = 0.7213 / (1.0 + 1.079 / register_count);
+  auto estimate = alpha * register_count * register_count / harmonic_sum;
+
+  // Small range correction. With 64 bit hashes, no large range correction is necessary.
+  if (estimate <= 2.5 * register_count && empty_register_count > 0) {
+    estimate = register_count * std::log(register_count / static_cast<double>(empty_register_count));
+  }
+
+  // Distinct counts are integers
+  return static_cast<float>(std::round(estimate));
+}
+
+}  // namespace opossum
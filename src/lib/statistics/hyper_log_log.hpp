@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace opossum {
+
+/**
+ * Sketch of the distinct values of a column, used to estimate their number without storing them. Sketches of
+ * different parts of a column (e.g., its chunks) can be merged into the sketch of their union without rescanning the
+ * data, which makes them suitable for maintaining the distinct count of a growing table.
+ *
+ * Implements HyperLogLog as described in "HyperLogLog: the analysis of a near-optimal cardinality estimation
+ * algorithm", Flajolet et al., 2007. Small cardinalities are estimated using linear counting, so that they are
+ * (almost) exact.
+ */
+class HyperLogLog final {
+ public:
+  // The standard error of the estimation is about 1.04 / sqrt(2^PRECISION), i.e., 1.6%
+  static constexpr auto PRECISION = uint32_t{12};
+  static constexpr auto REGISTER_COUNT = size_t{1} << PRECISION;
+
+  HyperLogLog();
+
+  template <typename T>
+  void add(const T& value) {
+    add_hash(std::hash<T>{}(value));
+  }
+
+  // The hash doesn't need to be uniformly distributed, it is mixed before being used
+  void add_hash(const size_t hash);
+
+  // Afterwards, this sketch describes the union of the values added to this and to @param other
+  void merge(const HyperLogLog& other);
+
+  float estimate_distinct_count() const;
+
+ private:
+  std::vector<uint8_t> _registers;
+};
+
+}  // namespace opossum
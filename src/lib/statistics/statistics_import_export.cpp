@@ -4,6 +4,7 @@
 
 #include "column_statistics.hpp"
 #include "constant_mappings.hpp"
+#include "histogram.hpp"
 #include "resolve_type.hpp"
 #include "utils/assert.hpp"
 
@@ -66,8 +67,27 @@ std::shared_ptr<BaseColumnStatistics> import_column_statistics(const nlohmann::j
     const auto min = json["min"].get<ColumnDataType>();
     const auto max = json["max"].get<ColumnDataType>();
 
-    result_column_statistics =
+    const auto column_statistics =
         std::make_shared<ColumnStatistics<ColumnDataType>>(null_value_ratio, distinct_count, min, max);
+
+    if (json.count("histogram")) {
+      const auto& histogram_json = json["histogram"];
+
+      auto top_values = std::vector<std::pair<ColumnDataType, float>>{};
+      for (const auto& top_value_json : histogram_json["top_values"]) {
+        top_values.emplace_back(top_value_json["value"].get<ColumnDataType>(), top_value_json["count"].get<float>());
+      }
+
+      auto buckets = std::vector<typename Histogram<ColumnDataType>::Bucket>{};
+      for (const auto& bucket_json : histogram_json["buckets"]) {
+        buckets.push_back({bucket_json["min"].get<ColumnDataType>(), bucket_json["max"].get<ColumnDataType>(),
+                           bucket_json["row_count"].get<float>(), bucket_json["distinct_count"].get<float>()});
+      }
+
+      column_statistics->set_histogram(std::make_shared<Histogram<ColumnDataType>>(top_values, buckets));
+    }
+
+    result_column_statistics = column_statistics;
   });
 
   Assert(result_column_statistics, "resolve_data_type() apparently failed.");
@@ -98,6 +118,26 @@ nlohmann::json export_column_statistics(const BaseColumnStatistics& base_column_
     const auto& column_statistics = static_cast<const ColumnStatistics<ColumnDataType>&>(base_column_statistics);
     column_statistics_json["min"] = column_statistics.min();
     column_statistics_json["max"] = column_statistics.max();
+
+    const auto histogram = column_statistics.histogram();
+    if (!histogram) return;
+
+    nlohmann::json histogram_json;
+    histogram_json["top_values"] = nlohmann::json::array();
+    histogram_json["buckets"] = nlohmann::json::array();
+
+    for (const auto& top_value : histogram->top_values()) {
+      histogram_json["top_values"].push_back({{"value", top_value.first}, {"count", top_value.second}});
+    }
+
+    for (const auto& bucket : histogram->buckets()) {
+      histogram_json["buckets"].push_back({{"min", bucket.min},
+                                           {"max", bucket.max},
+                                           {"row_count", bucket.row_count},
+                                           {"distinct_count", bucket.distinct_count}});
+    }
+
+    column_statistics_json["histogram"] = histogram_json;
   });
 
   return column_statistics_json;
@@ -5,6 +5,7 @@
 #include "all_parameter_variant.hpp"
 #include "all_type_variant.hpp"
 #include "base_column_statistics.hpp"
+#include "utils/assert.hpp"
 
 namespace opossum {
 
@@ -266,6 +267,21 @@ TableStatistics TableStatistics::estimate_disjunction(const TableStatistics& rig
           column_statistics()};
 }
 
+TableStatistics TableStatistics::merge(const TableStatistics& other_table_statistics) const {
+  Assert(_column_statistics.size() == other_table_statistics._column_statistics.size(),
+         "Cannot merge statistics of tables with different columns");
+
+  std::vector<std::shared_ptr<const BaseColumnStatistics>> merged_column_statistics;
+  merged_column_statistics.reserve(_column_statistics.size());
+
+  for (auto column_id = ColumnID{0}; column_id < _column_statistics.size(); ++column_id) {
+    merged_column_statistics.emplace_back(_column_statistics[column_id]->merge(
+        *other_table_statistics._column_statistics[column_id], _row_count, other_table_statistics._row_count));
+  }
+
+  return {_table_type, _row_count + other_table_statistics._row_count, merged_column_statistics};
+}
+
 std::string TableStatistics::description() const {
   std::stringstream stream;
 
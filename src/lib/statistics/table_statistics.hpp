@@ -52,6 +52,12 @@ class TableStatistics final {
   TableStatistics estimate_disjunction(const TableStatistics& right_table_statistics) const;
   /** @} */
 
+  /**
+   * @return statistics describing the rows of both this and @param other_table_statistics, e.g., of two chunks of a
+   *         table, without rescanning their data
+   */
+  TableStatistics merge(const TableStatistics& other_table_statistics) const;
+
   std::string description() const;
 
  private:
@@ -3,13 +3,23 @@
 #include <limits>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include <boost/hana/for_each.hpp>
+
 #include "base_column.hpp"
+#include "base_dictionary_column.hpp"
+#include "base_value_column.hpp"
 #include "chunk.hpp"
+#include "index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
+#include "index/b_tree/b_tree_index.hpp"
 #include "index/base_index.hpp"
+#include "index/delta/delta_index.hpp"
+#include "index/group_key/composite_group_key_index.hpp"
+#include "index/group_key/group_key_index.hpp"
 #include "reference_column.hpp"
 #include "resolve_type.hpp"
 #include "statistics/chunk_statistics/chunk_statistics.hpp"
@@ -37,7 +47,45 @@ bool Chunk::is_mutable() const { return _is_mutable; }
 void Chunk::mark_immutable() { _is_mutable = false; }
 
 void Chunk::replace_column(size_t column_id, const std::shared_ptr<BaseColumn>& column) {
+  const auto old_column = std::atomic_load(&_columns.at(column_id));
+
+  // DeltaIndexes only index ValueColumns and are replaced by the index they stand in for. The replacements are built
+  // before the column is exchanged so that the (expensive) construction does not block index lookups.
+  auto replacements = std::vector<std::pair<std::shared_ptr<BaseIndex>, std::shared_ptr<BaseIndex>>>{};
+  {
+    std::shared_lock<std::shared_mutex> lock(_indices_mutex);
+    for (const auto& index : _indices) {
+      if (index->type() == ColumnIndexType::Delta && index->is_index_for({old_column})) {
+        replacements.emplace_back(index, nullptr);
+      }
+    }
+  }
+
+  for (auto& replacement : replacements) {
+    const auto compact_index_type = std::static_pointer_cast<DeltaIndex>(replacement.first)->compact_index_type();
+    if (std::dynamic_pointer_cast<const BaseValueColumn>(column)) {
+      replacement.second = std::make_shared<DeltaIndex>(std::vector<std::shared_ptr<const BaseColumn>>{column},
+                                                        compact_index_type);
+    } else if (compact_index_type == ColumnIndexType::BTree ||
+               std::dynamic_pointer_cast<const BaseDictionaryColumn>(column)) {
+      // All other compact indexes only work with dictionary columns and are dropped for other encodings
+      replacement.second = _make_index(compact_index_type, {column});
+    }
+  }
+
+  // The column and its indexes are exchanged together, so that lookups by ColumnID never see one without the other
+  std::lock_guard<std::shared_mutex> lock(_indices_mutex);
   std::atomic_store(&_columns.at(column_id), column);
+  for (const auto& replacement : replacements) {
+    const auto index_it = std::find(_indices.begin(), _indices.end(), replacement.first);
+    if (index_it == _indices.end()) continue;
+
+    if (replacement.second) {
+      *index_it = replacement.second;
+    } else {
+      _indices.erase(index_it);
+    }
+  }
 }
 
 void Chunk::append(const std::vector<AllTypeVariant>& values) {
@@ -56,6 +104,16 @@ void Chunk::append(const std::vector<AllTypeVariant>& values) {
   for (; column_it != _columns.end(); column_it++, value_it++) {
     (*column_it)->append(*value_it);
   }
+
+  update_delta_indexes(size() - 1, size());
+}
+
+void Chunk::update_delta_indexes(const ChunkOffset begin_offset, const ChunkOffset end_offset) {
+  std::shared_lock<std::shared_mutex> lock(_indices_mutex);
+  for (const auto& index : _indices) {
+    if (index->type() != ColumnIndexType::Delta) continue;
+    std::static_pointer_cast<DeltaIndex>(index)->insert(begin_offset, end_offset);
+  }
 }
 
 std::shared_ptr<BaseColumn> Chunk::get_column(ColumnID column_id) const {
@@ -93,33 +151,51 @@ void Chunk::set_mvcc_columns(const std::shared_ptr<MvccColumns>& mvcc_columns) {
 
 std::vector<std::shared_ptr<BaseIndex>> Chunk::get_indices(
     const std::vector<std::shared_ptr<const BaseColumn>>& columns) const {
-  auto result = std::vector<std::shared_ptr<BaseIndex>>();
-  std::copy_if(_indices.cbegin(), _indices.cend(), std::back_inserter(result),
-               [&](const auto& index) { return index->is_index_for(columns); });
-  return result;
+  std::shared_lock<std::shared_mutex> lock(_indices_mutex);
+  return _get_indices(columns);
 }
 
 std::vector<std::shared_ptr<BaseIndex>> Chunk::get_indices(const std::vector<ColumnID>& column_ids) const {
-  auto columns = _get_columns_for_ids(column_ids);
-  return get_indices(columns);
+  // The columns are resolved under the lock so that they match the indexes (see replace_column())
+  std::shared_lock<std::shared_mutex> lock(_indices_mutex);
+  return _get_indices(_get_columns_for_ids(column_ids));
 }
 
 std::shared_ptr<BaseIndex> Chunk::get_index(const ColumnIndexType index_type,
                                             const std::vector<std::shared_ptr<const BaseColumn>>& columns) const {
-  auto index_it = std::find_if(_indices.cbegin(), _indices.cend(), [&](const auto& index) {
-    return index->is_index_for(columns) && index->type() == index_type;
-  });
-
-  return (index_it == _indices.cend()) ? nullptr : *index_it;
+  std::shared_lock<std::shared_mutex> lock(_indices_mutex);
+  return _get_index(index_type, columns);
 }
 
 std::shared_ptr<BaseIndex> Chunk::get_index(const ColumnIndexType index_type,
                                             const std::vector<ColumnID>& column_ids) const {
-  auto columns = _get_columns_for_ids(column_ids);
-  return get_index(index_type, columns);
+  std::shared_lock<std::shared_mutex> lock(_indices_mutex);
+  return _get_index(index_type, _get_columns_for_ids(column_ids));
+}
+
+std::shared_ptr<BaseIndex> Chunk::create_index(const ColumnIndexType index_type,
+                                               const std::vector<std::shared_ptr<const BaseColumn>>& index_columns) {
+  DebugAssert(_contains_columns(index_columns), "All columns must be part of the chunk.");
+
+  auto index = _make_index(index_type, index_columns);
+  std::lock_guard<std::shared_mutex> lock(_indices_mutex);
+  _indices.emplace_back(index);
+  return index;
+}
+
+std::shared_ptr<BaseIndex> Chunk::create_delta_index(const ColumnID column_id,
+                                                     const ColumnIndexType compact_index_type) {
+  const auto column = get_column(column_id);
+  Assert(std::dynamic_pointer_cast<const BaseValueColumn>(column), "DeltaIndex only works with ValueColumns.");
+
+  auto index = std::make_shared<DeltaIndex>(std::vector<std::shared_ptr<const BaseColumn>>{column}, compact_index_type);
+  std::lock_guard<std::shared_mutex> lock(_indices_mutex);
+  _indices.emplace_back(index);
+  return index;
 }
 
 void Chunk::remove_index(const std::shared_ptr<BaseIndex>& index) {
+  std::lock_guard<std::shared_mutex> lock(_indices_mutex);
   auto it = std::find(_indices.cbegin(), _indices.cend(), index);
   DebugAssert(it != _indices.cend(), "Trying to remove a non-existing index");
   _indices.erase(it);
@@ -147,8 +223,11 @@ bool Chunk::references_exactly_one_table() const {
 
 void Chunk::migrate(boost::container::pmr::memory_resource* memory_source) {
   // Migrating chunks with indices is not implemented yet.
-  if (!_indices.empty()) {
-    Fail("Cannot migrate Chunk with Indices.");
+  {
+    std::shared_lock<std::shared_mutex> lock(_indices_mutex);
+    if (!_indices.empty()) {
+      Fail("Cannot migrate Chunk with Indices.");
+    }
   }
 
   _alloc = PolymorphicAllocator<size_t>(memory_source);
@@ -181,6 +260,46 @@ size_t Chunk::estimate_memory_usage() const {
   return bytes;
 }
 
+std::vector<std::shared_ptr<BaseIndex>> Chunk::_get_indices(
+    const std::vector<std::shared_ptr<const BaseColumn>>& columns) const {
+  auto result = std::vector<std::shared_ptr<BaseIndex>>();
+  std::copy_if(_indices.cbegin(), _indices.cend(), std::back_inserter(result),
+               [&](const auto& index) { return index->is_index_for(columns); });
+  return result;
+}
+
+std::shared_ptr<BaseIndex> Chunk::_get_index(const ColumnIndexType index_type,
+                                             const std::vector<std::shared_ptr<const BaseColumn>>& columns) const {
+  auto index_it = std::find_if(_indices.cbegin(), _indices.cend(), [&](const auto& index) {
+    return index->is_index_for(columns) && index->type() == index_type;
+  });
+
+  return (index_it == _indices.cend()) ? nullptr : *index_it;
+}
+
+std::shared_ptr<BaseIndex> Chunk::_make_index(const ColumnIndexType index_type,
+                                              const std::vector<std::shared_ptr<const BaseColumn>>& index_columns) {
+  auto index = std::shared_ptr<BaseIndex>{};
+
+  hana::for_each(detail::column_index_map, [&](const auto& index_pair) {
+    if (hana::second(index_pair) != index_type) return;
+
+    using Index = typename decltype(+hana::first(index_pair))::type;
+    index = std::make_shared<Index>(index_columns);
+  });
+
+  Assert(index, "Cannot create index of the given type.");
+  return index;
+}
+
+bool Chunk::_contains_columns(const std::vector<std::shared_ptr<const BaseColumn>>& columns) const {
+  for (const auto& column : columns) {
+    const auto column_it = std::find(_columns.cbegin(), _columns.cend(), column);
+    if (column_it == _columns.cend()) return false;
+  }
+  return true;
+}
+
 std::vector<std::shared_ptr<const BaseColumn>> Chunk::_get_columns_for_ids(
     const std::vector<ColumnID>& column_ids) const {
   DebugAssert(([&]() {
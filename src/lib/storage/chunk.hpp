@@ -52,7 +52,13 @@ class Chunk : private Noncopyable {
 
   void mark_immutable();
 
-  // Atomically replaces the current column at column_id with the passed column
+  /**
+   * Atomically replaces the current column at column_id with the passed column.
+   * DeltaIndexes on the replaced column are replaced with an index of their compact_index_type() on the new column
+   * (or with a new DeltaIndex if the new column is a ValueColumn). If the compact index cannot be built on the new
+   * column (e.g., a GroupKeyIndex on a RunLengthColumn), the index is dropped. The indexes are exchanged together with
+   * the column, i.e., a lookup by ColumnID finds either the old column's or the new column's indexes.
+   */
   void replace_column(size_t column_id, const std::shared_ptr<BaseColumn>& column);
 
   // returns the number of columns (cannot exceed ColumnID (uint16_t))
@@ -65,6 +71,9 @@ class Chunk : private Noncopyable {
   // note this is slow and not thread-safe and should be used for testing purposes only
   void append(const std::vector<AllTypeVariant>& values);
 
+  // adds the rows [begin_offset, end_offset), whose values have been written already, to the DeltaIndexes of the chunk
+  void update_delta_indexes(const ChunkOffset begin_offset, const ChunkOffset end_offset);
+
   /**
    * Atomically accesses and returns the column at a given position
    *
@@ -107,16 +116,10 @@ class Chunk : private Noncopyable {
 
   template <typename Index>
   std::shared_ptr<BaseIndex> create_index(const std::vector<std::shared_ptr<const BaseColumn>>& index_columns) {
-    DebugAssert(([&]() {
-                  for (auto column : index_columns) {
-                    const auto column_it = std::find(_columns.cbegin(), _columns.cend(), column);
-                    if (column_it == _columns.cend()) return false;
-                  }
-                  return true;
-                }()),
-                "All columns must be part of the chunk.");
+    DebugAssert(_contains_columns(index_columns), "All columns must be part of the chunk.");
 
     auto index = std::make_shared<Index>(index_columns);
+    std::lock_guard<std::shared_mutex> lock(_indices_mutex);
     _indices.emplace_back(index);
     return index;
   }
@@ -127,6 +130,16 @@ class Chunk : private Noncopyable {
     return create_index<Index>(columns);
   }
 
+  // Creates an index of the type given at runtime, see create_index<Index>()
+  std::shared_ptr<BaseIndex> create_index(const ColumnIndexType index_type,
+                                          const std::vector<std::shared_ptr<const BaseColumn>>& index_columns);
+
+  /**
+   * Creates a DeltaIndex on the ValueColumn at column_id, which is maintained while rows are added to the chunk and
+   * replaced with an index of compact_index_type once the column is encoded (see DeltaIndex)
+   */
+  std::shared_ptr<BaseIndex> create_delta_index(const ColumnID column_id, const ColumnIndexType compact_index_type);
+
   void remove_index(const std::shared_ptr<BaseIndex>& index);
 
   void migrate(boost::container::pmr::memory_resource* memory_source);
@@ -147,6 +160,18 @@ class Chunk : private Noncopyable {
   size_t estimate_memory_usage() const;
 
  private:
+  // Index lookups that expect _indices_mutex to be locked by the caller
+  std::vector<std::shared_ptr<BaseIndex>> _get_indices(
+      const std::vector<std::shared_ptr<const BaseColumn>>& columns) const;
+  std::shared_ptr<BaseIndex> _get_index(const ColumnIndexType index_type,
+                                        const std::vector<std::shared_ptr<const BaseColumn>>& columns) const;
+
+  // Creates an index of the type given at runtime without adding it to the chunk
+  static std::shared_ptr<BaseIndex> _make_index(const ColumnIndexType index_type,
+                                                const std::vector<std::shared_ptr<const BaseColumn>>& index_columns);
+
+  bool _contains_columns(const std::vector<std::shared_ptr<const BaseColumn>>& columns) const;
+
   std::vector<std::shared_ptr<const BaseColumn>> _get_columns_for_ids(const std::vector<ColumnID>& column_ids) const;
 
  private:
@@ -155,6 +180,8 @@ class Chunk : private Noncopyable {
   std::shared_ptr<MvccColumns> _mvcc_columns;
   std::shared_ptr<ChunkAccessCounter> _access_counter;
   pmr_vector<std::shared_ptr<BaseIndex>> _indices;
+  // Indexes are added and replaced while other threads look them up (e.g., by the ChunkCompressionTask)
+  mutable std::shared_mutex _indices_mutex;
   std::shared_ptr<ChunkStatistics> _statistics;
   bool _is_mutable = true;
 };
@@ -43,6 +43,8 @@ void ChunkEncoder::encode_chunk(const std::shared_ptr<Chunk>& chunk, const std::
   }
 
   chunk->mark_immutable();
+
+  // The (more expensive) TableStatistics of the chunk are only generated once generate_table_statistics() needs them
   chunk->set_statistics(std::make_shared<ChunkStatistics>(column_statistics));
 
   if (chunk->has_mvcc_columns()) {
@@ -67,6 +69,7 @@ void ChunkEncoder::encode_chunks(const std::shared_ptr<Table>& table, const std:
     const auto& chunk_encoding_spec = chunk_encoding_specs.at(chunk_id);
 
     encode_chunk(chunk, data_types, chunk_encoding_spec);
+    table->remove_indexes_missing_in_chunk(chunk_id);
   }
 }
 
@@ -79,6 +82,7 @@ void ChunkEncoder::encode_chunks(const std::shared_ptr<Table>& table, const std:
     auto chunk = table->get_chunk(chunk_id);
 
     encode_chunk(chunk, data_types, column_encoding_spec);
+    table->remove_indexes_missing_in_chunk(chunk_id);
   }
 }
 
@@ -93,6 +97,7 @@ void ChunkEncoder::encode_all_chunks(const std::shared_ptr<Table>& table,
     const auto chunk_encoding_spec = chunk_encoding_specs[chunk_id];
 
     encode_chunk(chunk, column_types, chunk_encoding_spec);
+    table->remove_indexes_missing_in_chunk(chunk_id);
   }
 }
 
@@ -105,6 +110,7 @@ void ChunkEncoder::encode_all_chunks(const std::shared_ptr<Table>& table,
   for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
     auto chunk = table->get_chunk(chunk_id);
     encode_chunk(chunk, column_types, chunk_encoding_spec);
+    table->remove_indexes_missing_in_chunk(chunk_id);
   }
 }
 
@@ -116,6 +122,7 @@ void ChunkEncoder::encode_all_chunks(const std::shared_ptr<Table>& table,
     auto chunk = table->get_chunk(chunk_id);
 
     encode_chunk(chunk, column_types, column_encoding_spec);
+    table->remove_indexes_missing_in_chunk(chunk_id);
   }
 }
 
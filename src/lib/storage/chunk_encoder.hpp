@@ -48,6 +48,9 @@ class ChunkEncoder {
    * Note: In some cases, it might be benificial to
    *       leave certain columns of a chunk unencoded.
    *       Use EncodingType::Unencoded in this case.
+   *
+   * Indexes that do not support the encoding are dropped (see Chunk::replace_column()). The methods encoding the chunks
+   * of a table also remove them from Table::get_indexes().
    */
   static void encode_chunk(const std::shared_ptr<Chunk>& chunk, const std::vector<DataType>& data_types,
                            const ChunkEncodingSpec& chunk_encoding_spec);
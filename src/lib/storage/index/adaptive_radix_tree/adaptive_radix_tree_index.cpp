@@ -92,6 +92,16 @@ std::shared_ptr<ARTNode> AdaptiveRadixTreeIndex::_bulk_insert(
     return std::make_shared<Leaf>(lower, upper);
   }
 
+  // Path compression: the bytes in which all keys are equal would result in nodes with a single child. Instead, they
+  // become the prefix of the next node. As not all keys are equal, they differ in at least one of the remaining bytes.
+  auto prefix = std::vector<uint8_t>{};
+  while (std::all_of(values.begin(), values.end(), [&](const std::pair<BinaryComparable, ChunkOffset>& pair) {
+    return pair.first[depth] == values.front().first[depth];
+  })) {
+    prefix.emplace_back(values.front().first[depth]);
+    ++depth;
+  }
+
   // radix-partition on the depths-byte into 256 partitions
   std::array<std::vector<std::pair<BinaryComparable, ChunkOffset>>, std::numeric_limits<uint8_t>::max() + 1> partitions;
   for (const auto& pair : values) {
@@ -110,13 +120,13 @@ std::shared_ptr<ARTNode> AdaptiveRadixTreeIndex::_bulk_insert(
   }
   // finally create the appropriate ARTNode according to the size of the children
   if (children.size() <= 4) {
-    return std::make_shared<ARTNode4>(children);
+    return std::make_shared<ARTNode4>(children, prefix);
   } else if (children.size() <= 16) {
-    return std::make_shared<ARTNode16>(children);
+    return std::make_shared<ARTNode16>(children, prefix);
   } else if (children.size() <= 48) {
-    return std::make_shared<ARTNode48>(children);
+    return std::make_shared<ARTNode48>(children, prefix);
   } else {
-    return std::make_shared<ARTNode256>(children);
+    return std::make_shared<ARTNode256>(children, prefix);
   }
 }
 
@@ -24,6 +24,11 @@ class BaseDictionaryColumn;
  * Each node has an array which contains pointers to its children and (if needed) an index array in order to map
  * partial keys to positions in the array of the child-pointers
  *
+ * Like in the paper, inner nodes skip the bytes that all of their keys share (path compression) and leafs are created
+ * as soon as a single key remains (lazy expansion), which reduces the depth of the tree: For a dictionary with fewer
+ * than 2^16 values, the two most significant bytes of all ValueIDs are zero and do not cost a node each.
+ * ARTNode16 searches its partial keys with SIMD instructions.
+ *
  * The full specification of an ART can be found in the following paper: https://db.in.tum.de/~leis/papers/ART.pdf
  *
  * Find more information about this in our wiki: https://github.com/hyrise/hyrise/wiki/AdaptiveRadixTree-(ART)-Index
@@ -36,6 +41,8 @@ class AdaptiveRadixTreeIndex : public BaseIndex {
 
   friend class AdaptiveRadixTreeIndexTest_BinaryComparableFromChunkOffset_Test;
 
+  friend class AdaptiveRadixTreeIndexTest_PathCompression_Test;
+
  public:
   explicit AdaptiveRadixTreeIndex(const std::vector<std::shared_ptr<const BaseColumn>>& index_columns);
 
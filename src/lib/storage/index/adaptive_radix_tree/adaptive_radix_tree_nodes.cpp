@@ -1,8 +1,13 @@
 #include "adaptive_radix_tree_nodes.hpp"
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 #include <algorithm>
 #include <iterator>
 #include <memory>
+#include <optional>
 #include <utility>
 #include <vector>
 
@@ -15,6 +20,19 @@ namespace opossum {
 
 constexpr uint8_t INVALID_INDEX = 255u;
 
+ARTNode::ARTNode(const std::vector<uint8_t>& prefix) : _prefix(prefix) {}
+
+std::optional<BaseIndex::Iterator> ARTNode::_match_prefix(const AdaptiveRadixTreeIndex::BinaryComparable& key,
+                                                          size_t& depth) const {
+  for (const auto prefix_byte : _prefix) {
+    const auto key_byte = key[depth];
+    if (key_byte < prefix_byte) return begin();
+    if (key_byte > prefix_byte) return end();
+    ++depth;
+  }
+  return std::nullopt;
+}
+
 /**
  *
  * ARTNode4 has two arrays of length 4:
@@ -24,7 +42,9 @@ constexpr uint8_t INVALID_INDEX = 255u;
  * default value of the _partial_keys array is 255u
  */
 
-ARTNode4::ARTNode4(std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>>& children) {
+ARTNode4::ARTNode4(std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>>& children,
+                   const std::vector<uint8_t>& prefix)
+    : ARTNode(prefix) {
   std::sort(children.begin(), children.end(),
             [](const std::pair<uint8_t, std::shared_ptr<ARTNode>>& left,
                const std::pair<uint8_t, std::shared_ptr<ARTNode>>& right) { return left.first < right.first; });
@@ -62,6 +82,8 @@ ARTNode4::ARTNode4(std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>>& ch
 BaseIndex::Iterator ARTNode4::_delegate_to_child(
     const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth,
     const std::function<Iterator(size_t, const AdaptiveRadixTreeIndex::BinaryComparable&, size_t)>& function) const {
+  if (const auto bound = _match_prefix(key, depth)) return *bound;
+
   auto partial_key = key[depth];
   for (uint8_t partial_key_id = 0; partial_key_id < 4; ++partial_key_id) {
     if (_partial_keys[partial_key_id] < partial_key) continue;  // key not found yet
@@ -73,15 +95,17 @@ BaseIndex::Iterator ARTNode4::_delegate_to_child(
 }
 
 BaseIndex::Iterator ARTNode4::lower_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const {
-  return _delegate_to_child(key, depth, [this](size_t i, AdaptiveRadixTreeIndex::BinaryComparable key, size_t depth) {
-    return _children[i]->lower_bound(key, depth);
-  });
+  return _delegate_to_child(
+      key, depth, [this](size_t i, const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) {
+        return _children[i]->lower_bound(key, depth);
+      });
 }
 
 BaseIndex::Iterator ARTNode4::upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const {
-  return _delegate_to_child(key, depth, [this](size_t i, AdaptiveRadixTreeIndex::BinaryComparable key, size_t depth) {
-    return _children[i]->upper_bound(key, depth);
-  });
+  return _delegate_to_child(
+      key, depth, [this](size_t i, const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) {
+        return _children[i]->upper_bound(key, depth);
+      });
 }
 
 BaseIndex::Iterator ARTNode4::begin() const { return _children[0]->begin(); }
@@ -105,7 +129,9 @@ BaseIndex::Iterator ARTNode4::end() const {
  *
  */
 
-ARTNode16::ARTNode16(std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>>& children) {
+ARTNode16::ARTNode16(std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>>& children,
+                     const std::vector<uint8_t>& prefix)
+    : ARTNode(prefix) {
   std::sort(children.begin(), children.end(),
             [](const std::pair<uint8_t, std::shared_ptr<ARTNode>>& left,
                const std::pair<uint8_t, std::shared_ptr<ARTNode>>& right) { return left.first < right.first; });
@@ -143,27 +169,49 @@ BaseIndex::Iterator ARTNode16::_delegate_to_child(
     const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth,
     const std::function<Iterator(std::iterator_traits<std::array<uint8_t, 16>::iterator>::difference_type,
                                  const AdaptiveRadixTreeIndex::BinaryComparable&, size_t)>& function) const {
+  if (const auto bound = _match_prefix(key, depth)) return *bound;
+
   auto partial_key = key[depth];
-  auto partial_key_iterator = std::lower_bound(_partial_keys.begin(), _partial_keys.end(), partial_key);
-  auto partial_key_pos = std::distance(_partial_keys.begin(), partial_key_iterator);
+  auto partial_key_pos = _lower_bound_position(partial_key);
 
-  if (*partial_key_iterator == partial_key) {
-    return function(partial_key_pos, key, ++depth);  // case0
-  }
   if (partial_key_pos >= 16) {
     return end();  // case 1a
   }
+  if (_partial_keys[partial_key_pos] == partial_key) {
+    return function(partial_key_pos, key, ++depth);  // case0
+  }
   if (_children[partial_key_pos] != nullptr) {
     return _children[partial_key_pos]->begin();  // case2
   }
   return end();  // case1b
 }
 
+/**
+ * With SSE2, all 16 partial keys are compared to partial_key at once. The unused entries of _partial_keys are 255u,
+ * i.e., not less than any partial_key, so that the first set bit of the comparison mask is the lower bound.
+ */
+std::iterator_traits<std::array<uint8_t, 16>::iterator>::difference_type ARTNode16::_lower_bound_position(
+    const uint8_t partial_key) const {
+#ifdef __SSE2__
+  const auto partial_keys = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_partial_keys.data()));
+  const auto search_keys = _mm_set1_epi8(static_cast<char>(partial_key));
+
+  // SSE2 only compares signed bytes. For unsigned bytes, a >= b <=> max(a, b) == a.
+  const auto not_less = _mm_cmpeq_epi8(_mm_max_epu8(partial_keys, search_keys), partial_keys);
+  const auto mask = static_cast<uint32_t>(_mm_movemask_epi8(not_less));
+
+  return mask ? __builtin_ctz(mask) : 16;
+#else
+  const auto partial_key_iterator = std::lower_bound(_partial_keys.begin(), _partial_keys.end(), partial_key);
+  return std::distance(_partial_keys.begin(), partial_key_iterator);
+#endif
+}
+
 BaseIndex::Iterator ARTNode16::lower_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const {
   return _delegate_to_child(
       key, depth,
       [this](std::iterator_traits<std::array<uint8_t, 16>::iterator>::difference_type partial_key_pos,
-             AdaptiveRadixTreeIndex::BinaryComparable key,
+             const AdaptiveRadixTreeIndex::BinaryComparable& key,
              size_t depth) { return _children[partial_key_pos]->lower_bound(key, depth); });
 }
 
@@ -171,7 +219,7 @@ BaseIndex::Iterator ARTNode16::upper_bound(const AdaptiveRadixTreeIndex::BinaryC
   return _delegate_to_child(
       key, depth,
       [this](std::iterator_traits<std::array<uint8_t, 16>::iterator>::difference_type partial_key_pos,
-             AdaptiveRadixTreeIndex::BinaryComparable key,
+             const AdaptiveRadixTreeIndex::BinaryComparable& key,
              size_t depth) { return _children[partial_key_pos]->upper_bound(key, depth); });
 }
 
@@ -185,9 +233,8 @@ BaseIndex::Iterator ARTNode16::begin() const { return _children[0]->begin(); }
  */
 
 BaseIndex::Iterator ARTNode16::end() const {
-  auto partial_key_iterator = std::lower_bound(_partial_keys.begin(), _partial_keys.end(), INVALID_INDEX);
-  auto partial_key_pos = std::distance(_partial_keys.begin(), partial_key_iterator);
-  if (_children[partial_key_pos] == nullptr) {
+  auto partial_key_pos = _lower_bound_position(INVALID_INDEX);
+  if (partial_key_pos >= 16 || _children[partial_key_pos] == nullptr) {
     // there does not exist a child with partial_key 255u, we take the partial_key in front of it
     return _children[partial_key_pos - 1]->end();
   } else {
@@ -206,7 +253,9 @@ BaseIndex::Iterator ARTNode16::end() const {
  * 47 as this is the maximum index for _children.
  */
 
-ARTNode48::ARTNode48(const std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>>& children) {
+ARTNode48::ARTNode48(const std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>>& children,
+                     const std::vector<uint8_t>& prefix)
+    : ARTNode(prefix) {
   _index_to_child.fill(INVALID_INDEX);
   for (uint8_t i = 0u; i < children.size(); ++i) {
     _index_to_child[children[i].first] = i;
@@ -248,6 +297,8 @@ ARTNode48::ARTNode48(const std::vector<std::pair<uint8_t, std::shared_ptr<ARTNod
 BaseIndex::Iterator ARTNode48::_delegate_to_child(
     const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth,
     const std::function<Iterator(uint8_t, const AdaptiveRadixTreeIndex::BinaryComparable&, size_t)>& function) const {
+  if (const auto bound = _match_prefix(key, depth)) return *bound;
+
   auto partial_key = key[depth];
   if (_index_to_child[partial_key] != INVALID_INDEX) {
     // case0
@@ -264,17 +315,17 @@ BaseIndex::Iterator ARTNode48::_delegate_to_child(
 }
 
 BaseIndex::Iterator ARTNode48::lower_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const {
-  return _delegate_to_child(key, depth,
-                            [this](uint8_t partial_key, AdaptiveRadixTreeIndex::BinaryComparable key, size_t depth) {
-                              return _children[_index_to_child[partial_key]]->lower_bound(key, depth);
-                            });
+  return _delegate_to_child(
+      key, depth, [this](uint8_t partial_key, const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) {
+        return _children[_index_to_child[partial_key]]->lower_bound(key, depth);
+      });
 }
 
 BaseIndex::Iterator ARTNode48::upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const {
-  return _delegate_to_child(key, depth,
-                            [this](uint8_t partial_key, AdaptiveRadixTreeIndex::BinaryComparable key, size_t depth) {
-                              return _children[_index_to_child[partial_key]]->upper_bound(key, depth);
-                            });
+  return _delegate_to_child(
+      key, depth, [this](uint8_t partial_key, const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) {
+        return _children[_index_to_child[partial_key]]->upper_bound(key, depth);
+      });
 }
 
 BaseIndex::Iterator ARTNode48::begin() const {
@@ -287,9 +338,9 @@ BaseIndex::Iterator ARTNode48::begin() const {
 }
 
 BaseIndex::Iterator ARTNode48::end() const {
-  for (uint8_t i = _index_to_child.size() - 1; i > 0; --i) {
+  for (int16_t i = _index_to_child.size() - 1; i >= 0; --i) {
     if (_index_to_child[i] != INVALID_INDEX) {
-      return _children[_index_to_child[i]]->begin();
+      return _children[_index_to_child[i]]->end();
     }
   }
   Fail("Empty _index_to_child array in ARTNode48 should never happen");
@@ -301,7 +352,9 @@ BaseIndex::Iterator ARTNode48::end() const {
  *
  */
 
-ARTNode256::ARTNode256(const std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>>& children) {
+ARTNode256::ARTNode256(const std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>>& children,
+                       const std::vector<uint8_t>& prefix)
+    : ARTNode(prefix) {
   for (const auto& child : children) {
     _children[child.first] = child.second;
   }
@@ -332,7 +385,9 @@ ARTNode256::ARTNode256(const std::vector<std::pair<uint8_t, std::shared_ptr<ARTN
 
 BaseIndex::Iterator ARTNode256::_delegate_to_child(
     const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth,
-    const std::function<Iterator(uint8_t, AdaptiveRadixTreeIndex::BinaryComparable, size_t)>& function) const {
+    const std::function<Iterator(uint8_t, const AdaptiveRadixTreeIndex::BinaryComparable&, size_t)>& function) const {
+  if (const auto bound = _match_prefix(key, depth)) return *bound;
+
   auto partial_key = key[depth];
   if (_children[partial_key] != nullptr) {
     // case0
@@ -349,17 +404,17 @@ BaseIndex::Iterator ARTNode256::_delegate_to_child(
 }
 
 BaseIndex::Iterator ARTNode256::upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const {
-  return _delegate_to_child(key, depth,
-                            [this](uint8_t partial_key, AdaptiveRadixTreeIndex::BinaryComparable key, size_t depth) {
-                              return _children[partial_key]->upper_bound(key, depth);
-                            });
+  return _delegate_to_child(
+      key, depth, [this](uint8_t partial_key, const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) {
+        return _children[partial_key]->upper_bound(key, depth);
+      });
 }
 
 BaseIndex::Iterator ARTNode256::lower_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const {
-  return _delegate_to_child(key, depth,
-                            [this](uint8_t partial_key, AdaptiveRadixTreeIndex::BinaryComparable key, size_t depth) {
-                              return _children[partial_key]->lower_bound(key, depth);
-                            });
+  return _delegate_to_child(
+      key, depth, [this](uint8_t partial_key, const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) {
+        return _children[partial_key]->lower_bound(key, depth);
+      });
 }
 
 BaseIndex::Iterator ARTNode256::begin() const {
@@ -374,7 +429,7 @@ BaseIndex::Iterator ARTNode256::begin() const {
 BaseIndex::Iterator ARTNode256::end() const {
   for (int16_t i = _children.size() - 1; i >= 0; --i) {
     if (_children[i] != nullptr) {
-      return _children[i]->begin();
+      return _children[i]->end();
     }
   }
   Fail("Empty _children array in ARTNode256 should never happen");
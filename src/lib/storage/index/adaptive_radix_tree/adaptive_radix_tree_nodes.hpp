@@ -4,6 +4,7 @@
 #include <functional>
 #include <iterator>
 #include <memory>
+#include <optional>
 #include <utility>
 #include <vector>
 
@@ -27,6 +28,7 @@ using Iterator = std::vector<ChunkOffset>::const_iterator;
 class ARTNode : private Noncopyable {
  public:
   ARTNode() = default;
+  explicit ARTNode(const std::vector<uint8_t>& prefix);
 
   virtual ~ARTNode() = default;
 
@@ -34,6 +36,17 @@ class ARTNode : private Noncopyable {
   virtual Iterator upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const = 0;
   virtual Iterator begin() const = 0;
   virtual Iterator end() const = 0;
+
+ protected:
+  /**
+   * Path compression: an inner node does not partition the bytes in which all of its keys are equal, but stores them
+   * as its _prefix (see AdaptiveRadixTreeIndex::_bulk_insert()). If the key matches the prefix, depth is advanced
+   * past it and std::nullopt is returned. Otherwise, the key is smaller or greater than all keys of this node, so the
+   * bound is begin() or end().
+   */
+  std::optional<Iterator> _match_prefix(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t& depth) const;
+
+  const std::vector<uint8_t> _prefix;
 };
 
 /**
@@ -48,9 +61,11 @@ class ARTNode : private Noncopyable {
  */
 class ARTNode4 final : public ARTNode {
   friend class AdaptiveRadixTreeIndexTest_BulkInsert_Test;
+  friend class AdaptiveRadixTreeIndexTest_PathCompression_Test;
 
  public:
-  explicit ARTNode4(std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>>& children);
+  explicit ARTNode4(std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>>& children,
+                    const std::vector<uint8_t>& prefix = {});
 
   Iterator lower_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const override;
   Iterator upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const override;
@@ -84,7 +99,8 @@ class ARTNode4 final : public ARTNode {
 
 class ARTNode16 final : public ARTNode {
  public:
-  explicit ARTNode16(std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>>& children);
+  explicit ARTNode16(std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>>& children,
+                     const std::vector<uint8_t>& prefix = {});
 
   Iterator lower_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const override;
   Iterator upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const override;
@@ -96,6 +112,11 @@ class ARTNode16 final : public ARTNode {
       const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth,
       const std::function<Iterator(std::iterator_traits<std::array<uint8_t, 16>::iterator>::difference_type,
                                    const AdaptiveRadixTreeIndex::BinaryComparable&, size_t)>& function) const;
+
+  // Position of the first partial key that is not less than partial_key, i.e., std::lower_bound() on _partial_keys
+  std::iterator_traits<std::array<uint8_t, 16>::iterator>::difference_type _lower_bound_position(
+      const uint8_t partial_key) const;
+
   std::array<uint8_t, 16> _partial_keys{};
   std::array<std::shared_ptr<ARTNode>, 16> _children{};
 };
@@ -115,7 +136,8 @@ class ARTNode16 final : public ARTNode {
  */
 class ARTNode48 final : public ARTNode {
  public:
-  explicit ARTNode48(const std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>>& children);
+  explicit ARTNode48(const std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>>& children,
+                     const std::vector<uint8_t>& prefix = {});
 
   Iterator lower_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const override;
   Iterator upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const override;
@@ -138,7 +160,8 @@ class ARTNode48 final : public ARTNode {
  */
 class ARTNode256 final : public ARTNode {
  public:
-  explicit ARTNode256(const std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>>& children);
+  explicit ARTNode256(const std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>>& children,
+                      const std::vector<uint8_t>& prefix = {});
 
   Iterator lower_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const override;
   Iterator upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const override;
@@ -148,7 +171,7 @@ class ARTNode256 final : public ARTNode {
  private:
   Iterator _delegate_to_child(
       const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth,
-      const std::function<Iterator(uint8_t, AdaptiveRadixTreeIndex::BinaryComparable, size_t)>& function) const;
+      const std::function<Iterator(uint8_t, const AdaptiveRadixTreeIndex::BinaryComparable&, size_t)>& function) const;
 
   std::array<std::shared_ptr<ARTNode>, 256> _children{};
 };
@@ -178,6 +201,10 @@ class ARTNode256 final : public ARTNode {
  *     for the last leaf, _upper_bound = _chunk_offsets.end()
  *
  * lower_bound() nets the same as begin(), upper_bound the same as end()
+ *
+ * Lazy expansion: a Leaf is created as soon as all of its keys are equal, so no inner nodes are created for the
+ * remaining bytes of the key. The Leaf does not store them either: The index only looks up ValueIDs that occur in the
+ * column (see AdaptiveRadixTreeIndex::_lower_bound()), so a lookup that reaches a Leaf always matches its key.
  */
 class Leaf final : public ARTNode {
   friend class AdaptiveRadixTreeIndexTest_BulkInsert_Test;
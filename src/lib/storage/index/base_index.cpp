@@ -1,6 +1,7 @@
 #include "base_index.hpp"
 
 #include <memory>
+#include <shared_mutex>
 #include <vector>
 
 namespace opossum {
@@ -38,4 +39,19 @@ BaseIndex::Iterator BaseIndex::cend() const { return _cend(); }
 
 ColumnIndexType BaseIndex::type() const { return _type; }
 
+std::shared_lock<std::shared_mutex> BaseIndex::lock_for_reading() const { return {}; }
+
+bool BaseIndex::supports_index_only_scans() const { return false; }
+
+std::shared_ptr<BaseColumn> BaseIndex::values(const Iterator begin, const Iterator end) const {
+  Assert(supports_index_only_scans(), "Index does not support index-only scans.");
+  DebugAssert(begin <= end, "Invalid range of entries.");
+
+  return _values(begin, end);
+}
+
+std::shared_ptr<BaseColumn> BaseIndex::_values(const Iterator begin, const Iterator end) const {
+  Fail("Index does not support index-only scans.");
+}
+
 }  // namespace opossum
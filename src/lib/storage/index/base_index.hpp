@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <shared_mutex>
 #include <vector>
 
 #include "all_type_variant.hpp"
@@ -108,6 +109,25 @@ class BaseIndex : private Noncopyable {
 
   ColumnIndexType type() const;
 
+  /**
+   * Indexes that are modified while they are used (i.e., the DeltaIndex) invalidate their Iterators when rows are
+   * added. Iterators stay valid as long as the returned lock is held. For all other indexes, it does not lock anything.
+   */
+  virtual std::shared_lock<std::shared_mutex> lock_for_reading() const;
+
+  /**
+   * Index-only scans (see IndexScan::set_index_only()) take the values of the rows they find from the index instead of
+   * reading them from the indexed column. Single-column indexes that know the value of each entry without accessing
+   * the column's attribute vector support this.
+   */
+  virtual bool supports_index_only_scans() const;
+
+  /**
+   * Returns a ValueColumn with the values of the entries in [begin, end), i.e., sorted by value.
+   * Calls _values() of the most derived class, which is only implemented if supports_index_only_scans() is true.
+   */
+  std::shared_ptr<BaseColumn> values(const Iterator begin, const Iterator end) const;
+
  protected:
   /**
    * Seperate the public interface of the index from the interface for programmers implementing own
@@ -118,6 +138,7 @@ class BaseIndex : private Noncopyable {
   virtual Iterator _cbegin() const = 0;
   virtual Iterator _cend() const = 0;
   virtual std::vector<std::shared_ptr<const BaseColumn>> _get_index_columns() const = 0;
+  virtual std::shared_ptr<BaseColumn> _values(const Iterator begin, const Iterator end) const;
 
  private:
   const ColumnIndexType _type;
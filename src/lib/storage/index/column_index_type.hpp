@@ -10,12 +10,22 @@ namespace opossum {
 
 namespace hana = boost::hana;
 
-enum class ColumnIndexType : uint8_t { Invalid, GroupKey, CompositeGroupKey, AdaptiveRadixTree, BTree };
+// PrimaryKey is not a chunk index, but the table-wide PrimaryKeyIndex (see Table::create_primary_key_index())
+enum class ColumnIndexType : uint8_t {
+  Invalid,
+  GroupKey,
+  CompositeGroupKey,
+  AdaptiveRadixTree,
+  BTree,
+  PrimaryKey,
+  Delta
+};
 
 class GroupKeyIndex;
 class CompositeGroupKeyIndex;
 class AdaptiveRadixTreeIndex;
 class BTreeIndex;
+class DeltaIndex;
 
 namespace detail {
 
@@ -23,7 +33,8 @@ constexpr auto column_index_map =
     hana::make_map(hana::make_pair(hana::type_c<GroupKeyIndex>, ColumnIndexType::GroupKey),
                    hana::make_pair(hana::type_c<CompositeGroupKeyIndex>, ColumnIndexType::CompositeGroupKey),
                    hana::make_pair(hana::type_c<AdaptiveRadixTreeIndex>, ColumnIndexType::AdaptiveRadixTree),
-                   hana::make_pair(hana::type_c<BTreeIndex>, ColumnIndexType::BTree));
+                   hana::make_pair(hana::type_c<BTreeIndex>, ColumnIndexType::BTree),
+                   hana::make_pair(hana::type_c<DeltaIndex>, ColumnIndexType::Delta));
 
 }  // namespace detail
 
@@ -0,0 +1,57 @@
+#include "delta_index.hpp"
+
+#include <memory>
+#include <shared_mutex>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/index/column_index_type.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+DeltaIndex::DeltaIndex(const std::vector<std::shared_ptr<const BaseColumn>>& index_columns,
+                       const ColumnIndexType compact_index_type)
+    : BaseIndex{get_index_type_of<DeltaIndex>()},
+      _index_column(index_columns[0]),
+      _compact_index_type(compact_index_type) {
+  Assert((index_columns.size() == 1), "DeltaIndex only works with a single column.");
+  Assert(_compact_index_type != ColumnIndexType::Delta && _compact_index_type != ColumnIndexType::PrimaryKey &&
+             _compact_index_type != ColumnIndexType::Invalid,
+         "Invalid compact index type.");
+
+  _impl = make_shared_by_data_type<BaseDeltaIndexImpl, DeltaIndexImpl>(_index_column->data_type());
+  insert(0u, _index_column->size());
+}
+
+ColumnIndexType DeltaIndex::compact_index_type() const { return _compact_index_type; }
+
+void DeltaIndex::insert(const ChunkOffset begin_offset, const ChunkOffset end_offset) {
+  _impl->insert(*_index_column, begin_offset, end_offset, _mutex);
+}
+
+std::shared_lock<std::shared_mutex> DeltaIndex::lock_for_reading() const {
+  return std::shared_lock<std::shared_mutex>(_mutex);
+}
+
+bool DeltaIndex::supports_index_only_scans() const { return true; }
+
+DeltaIndex::Iterator DeltaIndex::_lower_bound(const std::vector<AllTypeVariant>& values) const {
+  return _impl->lower_bound(values);
+}
+
+DeltaIndex::Iterator DeltaIndex::_upper_bound(const std::vector<AllTypeVariant>& values) const {
+  return _impl->upper_bound(values);
+}
+
+DeltaIndex::Iterator DeltaIndex::_cbegin() const { return _impl->cbegin(); }
+
+DeltaIndex::Iterator DeltaIndex::_cend() const { return _impl->cend(); }
+
+std::vector<std::shared_ptr<const BaseColumn>> DeltaIndex::_get_index_columns() const { return {_index_column}; }
+
+std::shared_ptr<BaseColumn> DeltaIndex::_values(const Iterator begin, const Iterator end) const {
+  return _impl->values(begin, end);
+}
+
+}  // namespace opossum
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <memory>
+#include <shared_mutex>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "delta_index_impl.hpp"
+#include "storage/base_column.hpp"
+#include "storage/index/base_index.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Index on a ValueColumn of a mutable Chunk. The other indexes cannot be built on (GroupKeyIndex,
+ * AdaptiveRadixTreeIndex) or kept up to date with (BTreeIndex) columns that rows are still appended to, so without the
+ * DeltaIndex the newest rows of a table are not indexed. Rows are added in batches via insert(), e.g., by
+ * Chunk::append() and the Insert operator (see Chunk::update_delta_indexes()). When the column is encoded, the Chunk
+ * replaces the DeltaIndex with an index of compact_index_type() (see Chunk::replace_column()).
+ *
+ * The DeltaIndex keeps the chunk offsets sorted by their values, so that it hands out Iterators like the other
+ * indexes. As insert() invalidates Iterators, they must only be used while holding the lock returned by
+ * lock_for_reading(). Rows with NULL values are not indexed. As the values are stored next to the chunk offsets, the
+ * DeltaIndex supports index-only scans.
+ */
+class DeltaIndex : public BaseIndex {
+ public:
+  using Iterator = std::vector<ChunkOffset>::const_iterator;
+
+  DeltaIndex() = delete;
+
+  // Indexes all rows that are already in @param index_columns
+  explicit DeltaIndex(const std::vector<std::shared_ptr<const BaseColumn>>& index_columns,
+                      const ColumnIndexType compact_index_type = ColumnIndexType::GroupKey);
+
+  // The type of the index that replaces this one once the column is encoded
+  ColumnIndexType compact_index_type() const;
+
+  /**
+   * Adds the rows [@param begin_offset, @param end_offset) of the indexed column. Their values must have been written
+   * already. Thread-safe.
+   */
+  void insert(const ChunkOffset begin_offset, const ChunkOffset end_offset);
+
+  std::shared_lock<std::shared_mutex> lock_for_reading() const override;
+
+  bool supports_index_only_scans() const override;
+
+ protected:
+  Iterator _lower_bound(const std::vector<AllTypeVariant>&) const override;
+  Iterator _upper_bound(const std::vector<AllTypeVariant>&) const override;
+  Iterator _cbegin() const override;
+  Iterator _cend() const override;
+  std::vector<std::shared_ptr<const BaseColumn>> _get_index_columns() const override;
+  std::shared_ptr<BaseColumn> _values(const Iterator begin, const Iterator end) const override;
+
+  const std::shared_ptr<const BaseColumn> _index_column;
+  const ColumnIndexType _compact_index_type;
+  std::shared_ptr<BaseDeltaIndexImpl> _impl;
+
+  // Held exclusively while insert() adds entries, and shared by the readers (see lock_for_reading())
+  mutable std::shared_mutex _mutex;
+};
+
+}  // namespace opossum
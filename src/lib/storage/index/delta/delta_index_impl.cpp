@@ -0,0 +1,87 @@
+#include "delta_index_impl.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/value_column.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+BaseDeltaIndexImpl::Iterator BaseDeltaIndexImpl::cbegin() const { return _chunk_offsets.cbegin(); }
+
+BaseDeltaIndexImpl::Iterator BaseDeltaIndexImpl::cend() const { return _chunk_offsets.cend(); }
+
+template <typename DataType>
+void DeltaIndexImpl<DataType>::insert(const BaseColumn& column, const ChunkOffset begin_offset,
+                                      const ChunkOffset end_offset, std::shared_mutex& mutex) {
+  const auto value_column = dynamic_cast<const ValueColumn<DataType>*>(&column);
+  Assert(value_column, "DeltaIndex only works with ValueColumns.");
+  DebugAssert(begin_offset <= end_offset && end_offset <= value_column->size(), "Invalid range of rows.");
+
+  // Sort the new entries. This does not touch the existing ones, so it does not block readers.
+  auto new_entries = std::vector<std::pair<DataType, ChunkOffset>>{};
+  new_entries.reserve(end_offset - begin_offset);
+  const auto& values = value_column->values();
+  for (auto chunk_offset = begin_offset; chunk_offset < end_offset; ++chunk_offset) {
+    if (value_column->is_nullable() && value_column->null_values()[chunk_offset]) continue;
+    new_entries.emplace_back(values[chunk_offset], chunk_offset);
+  }
+  if (new_entries.empty()) return;
+
+  std::sort(new_entries.begin(), new_entries.end());
+
+  std::unique_lock<std::shared_mutex> lock(mutex);
+
+  // Merge from the back, so that the existing entries are moved at most once
+  auto old_entry_idx = _values.size();
+  auto new_entry_idx = new_entries.size();
+  auto target_idx = _values.size() + new_entries.size();
+  _values.resize(target_idx);
+  _chunk_offsets.resize(target_idx);
+
+  while (new_entry_idx > 0) {
+    --target_idx;
+    const auto& new_entry = new_entries[new_entry_idx - 1];
+    if (old_entry_idx > 0 && std::tie(new_entry.first, new_entry.second) <
+                                 std::tie(_values[old_entry_idx - 1], _chunk_offsets[old_entry_idx - 1])) {
+      --old_entry_idx;
+      _values[target_idx] = std::move(_values[old_entry_idx]);
+      _chunk_offsets[target_idx] = _chunk_offsets[old_entry_idx];
+    } else {
+      --new_entry_idx;
+      _values[target_idx] = std::move(new_entries[new_entry_idx].first);
+      _chunk_offsets[target_idx] = new_entries[new_entry_idx].second;
+    }
+  }
+}
+
+template <typename DataType>
+BaseDeltaIndexImpl::Iterator DeltaIndexImpl<DataType>::lower_bound(const std::vector<AllTypeVariant>& values) const {
+  const auto value_it = std::lower_bound(_values.cbegin(), _values.cend(), type_cast<DataType>(values[0]));
+  return _chunk_offsets.cbegin() + std::distance(_values.cbegin(), value_it);
+}
+
+template <typename DataType>
+BaseDeltaIndexImpl::Iterator DeltaIndexImpl<DataType>::upper_bound(const std::vector<AllTypeVariant>& values) const {
+  const auto value_it = std::upper_bound(_values.cbegin(), _values.cend(), type_cast<DataType>(values[0]));
+  return _chunk_offsets.cbegin() + std::distance(_values.cbegin(), value_it);
+}
+
+template <typename DataType>
+std::shared_ptr<BaseColumn> DeltaIndexImpl<DataType>::values(const Iterator begin, const Iterator end) const {
+  const auto values_begin = _values.cbegin() + std::distance(_chunk_offsets.cbegin(), begin);
+  const auto values_end = values_begin + std::distance(begin, end);
+  return std::make_shared<ValueColumn<DataType>>(pmr_concurrent_vector<DataType>(values_begin, values_end));
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(DeltaIndexImpl);
+
+}  // namespace opossum
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <memory>
+#include <shared_mutex>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "storage/base_column.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseDeltaIndexImpl {
+ public:
+  BaseDeltaIndexImpl() = default;
+  BaseDeltaIndexImpl(BaseDeltaIndexImpl&&) = default;
+  BaseDeltaIndexImpl& operator=(BaseDeltaIndexImpl&&) = default;
+  virtual ~BaseDeltaIndexImpl() = default;
+
+  using Iterator = std::vector<ChunkOffset>::const_iterator;
+
+  // Adds the rows [begin_offset, end_offset) of column, holding mutex exclusively while modifying the entries
+  virtual void insert(const BaseColumn& column, const ChunkOffset begin_offset, const ChunkOffset end_offset,
+                      std::shared_mutex& mutex) = 0;
+
+  virtual Iterator lower_bound(const std::vector<AllTypeVariant>&) const = 0;
+  virtual Iterator upper_bound(const std::vector<AllTypeVariant>&) const = 0;
+  Iterator cbegin() const;
+  Iterator cend() const;
+
+  // Returns a ValueColumn with the values of the entries [begin, end)
+  virtual std::shared_ptr<BaseColumn> values(const Iterator begin, const Iterator end) const = 0;
+
+ protected:
+  std::vector<ChunkOffset> _chunk_offsets;
+};
+
+/**
+ * Keeps the values of the indexed rows in the same order as their chunk offsets, i.e., sorted by (value, chunk offset).
+ * New rows are merged into the existing entries from the back, so that only entries greater than the smallest new
+ * one are moved. For the common case of an Insert of a few rows, this is cheaper than rebuilding a sorted copy.
+ */
+template <typename DataType>
+class DeltaIndexImpl : public BaseDeltaIndexImpl {
+ public:
+  DeltaIndexImpl() = default;
+
+  DeltaIndexImpl(const DeltaIndexImpl&) = delete;
+  DeltaIndexImpl& operator=(const DeltaIndexImpl&) = delete;
+
+  DeltaIndexImpl(DeltaIndexImpl&&) = default;
+  DeltaIndexImpl& operator=(DeltaIndexImpl&&) = default;
+
+  void insert(const BaseColumn& column, const ChunkOffset begin_offset, const ChunkOffset end_offset,
+              std::shared_mutex& mutex) override;
+
+  Iterator lower_bound(const std::vector<AllTypeVariant>&) const override;
+  Iterator upper_bound(const std::vector<AllTypeVariant>&) const override;
+
+  std::shared_ptr<BaseColumn> values(const Iterator begin, const Iterator end) const override;
+
+ protected:
+  std::vector<DataType> _values;
+};
+
+}  // namespace opossum
@@ -1,9 +1,16 @@
 #include "group_key_index.hpp"
 
+#include <algorithm>
 #include <memory>
+#include <string>
+#include <type_traits>
 #include <vector>
 
+#include "resolve_type.hpp"
 #include "storage/base_dictionary_column.hpp"
+#include "storage/dictionary_column.hpp"
+#include "storage/fixed_string_dictionary_column.hpp"
+#include "storage/value_column.hpp"
 #include "storage/vector_compression/resolve_compressed_vector_type.hpp"
 
 namespace opossum {
@@ -89,4 +96,45 @@ GroupKeyIndex::Iterator GroupKeyIndex::_get_postings_iterator_at(ValueID value_i
 
 std::vector<std::shared_ptr<const BaseColumn>> GroupKeyIndex::_get_index_columns() const { return {_index_column}; }
 
+bool GroupKeyIndex::supports_index_only_scans() const { return true; }
+
+std::shared_ptr<BaseColumn> GroupKeyIndex::_values(const Iterator begin, const Iterator end) const {
+  auto values_column = std::shared_ptr<BaseColumn>{};
+
+  resolve_data_type(_index_column->data_type(), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    // FixedStringDictionaryColumns materialize their dictionary, so it is retrieved only once
+    auto dictionary = std::shared_ptr<const pmr_vector<ColumnDataType>>{};
+    if (_index_column->encoding_type() == EncodingType::Dictionary) {
+      dictionary = static_cast<const DictionaryColumn<ColumnDataType>&>(*_index_column).dictionary();
+    } else if constexpr (std::is_same_v<ColumnDataType, std::string>) {
+      dictionary = static_cast<const FixedStringDictionaryColumn<std::string>&>(*_index_column).dictionary();
+    } else {
+      Fail("Unexpected dictionary column type.");
+    }
+
+    auto position = static_cast<size_t>(std::distance(_index_postings.cbegin(), begin));
+    const auto end_position = static_cast<size_t>(std::distance(_index_postings.cbegin(), end));
+
+    auto values = pmr_concurrent_vector<ColumnDataType>(end_position - position);
+    auto values_it = values.begin();
+
+    // The last value id whose postings start at or before position
+    const auto offset_it = std::upper_bound(_index_offsets.cbegin(), _index_offsets.cend(), position);
+    auto value_id = static_cast<size_t>(std::distance(_index_offsets.cbegin(), offset_it)) - 1u;
+
+    while (position < end_position) {
+      const auto run_end_position = std::min(_index_offsets[value_id + 1u], end_position);
+      values_it = std::fill_n(values_it, run_end_position - position, (*dictionary)[value_id]);
+      position = run_end_position;
+      ++value_id;
+    }
+
+    values_column = std::make_shared<ValueColumn<ColumnDataType>>(std::move(values));
+  });
+
+  return values_column;
+}
+
 }  // namespace opossum
@@ -53,6 +53,8 @@ class GroupKeyIndex : public BaseIndex {
 
   explicit GroupKeyIndex(const std::vector<std::shared_ptr<const BaseColumn>>& index_columns);
 
+  bool supports_index_only_scans() const final;
+
  private:
   Iterator _lower_bound(const std::vector<AllTypeVariant>& values) const final;
 
@@ -71,6 +73,12 @@ class GroupKeyIndex : public BaseIndex {
 
   std::vector<std::shared_ptr<const BaseColumn>> _get_index_columns() const;
 
+  /**
+   * The postings of a value id are stored contiguously. Thus, the values of the entries are runs of dictionary
+   * entries, which are found via _index_offsets without accessing the attribute vector.
+   */
+  std::shared_ptr<BaseColumn> _values(const Iterator begin, const Iterator end) const final;
+
  private:
   const std::shared_ptr<const BaseDictionaryColumn> _index_column;
   std::vector<std::size_t> _index_offsets;   // maps value-ids to offsets in _index_postings
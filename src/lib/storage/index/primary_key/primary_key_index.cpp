@@ -0,0 +1,96 @@
+#include "primary_key_index.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/create_iterable_from_column.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+PrimaryKeyIndex::PrimaryKeyIndex(const std::vector<ColumnID>& column_ids, const std::vector<DataType>& data_types)
+    : _column_ids(column_ids), _data_types(data_types) {
+  Assert(!_column_ids.empty(), "PrimaryKeyIndex requires at least one key column.");
+  Assert(_column_ids.size() == _data_types.size(), "Expected one data type per key column.");
+}
+
+const std::vector<ColumnID>& PrimaryKeyIndex::column_ids() const { return _column_ids; }
+
+void PrimaryKeyIndex::insert(const Chunk& chunk, const ChunkID chunk_id, const ChunkOffset begin_offset,
+                             const ChunkOffset end_offset) {
+  DebugAssert(begin_offset <= end_offset && end_offset <= chunk.size(), "Invalid range of rows.");
+  if (begin_offset == end_offset) return;
+
+  // Only access the rows in the range, the chunk might be much larger (e.g., for an Insert into a mutable chunk)
+  auto chunk_offsets = ChunkOffsetsList{};
+  chunk_offsets.reserve(end_offset - begin_offset);
+  for (auto chunk_offset = begin_offset; chunk_offset < end_offset; ++chunk_offset) {
+    chunk_offsets.push_back({chunk_offset, chunk_offset});
+  }
+
+  // Materialize the keys column by column
+  auto keys = std::vector<Key>(end_offset - begin_offset);
+  auto key_is_null = std::vector<bool>(end_offset - begin_offset);
+  for (const auto column_id : _column_ids) {
+    resolve_data_and_column_type(*chunk.get_column(column_id), [&](auto type, auto& typed_column) {
+      using ColumnDataType = typename decltype(type)::type;
+      using ColumnType = std::decay_t<decltype(typed_column)>;
+
+      if constexpr (std::is_same_v<ColumnType, ReferenceColumn>) {
+        Fail("PrimaryKeyIndex can only index data columns.");
+      } else {
+        auto iterable = create_iterable_from_column<ColumnDataType>(typed_column);
+        iterable.for_each(&chunk_offsets, [&](const auto& value) {
+          const auto key_idx = value.chunk_offset() - begin_offset;
+          if (value.is_null()) {
+            key_is_null[key_idx] = true;
+          } else {
+            keys[key_idx].emplace_back(value.value());
+          }
+        });
+      }
+    });
+  }
+
+  for (auto key_idx = size_t{0}; key_idx < keys.size(); ++key_idx) {
+    if (key_is_null[key_idx]) continue;
+    _entries.emplace(std::move(keys[key_idx]), RowID{chunk_id, static_cast<ChunkOffset>(begin_offset + key_idx)});
+  }
+}
+
+PosList PrimaryKeyIndex::lookup(const std::vector<AllTypeVariant>& values) const {
+  Assert(values.size() == _column_ids.size(), "Expected one value per key column.");
+
+  auto key = Key{};
+  key.reserve(values.size());
+  for (auto column_idx = size_t{0}; column_idx < values.size(); ++column_idx) {
+    // NULL is never equal to anything
+    if (variant_is_null(values[column_idx])) return {};
+
+    // The hash of an AllTypeVariant depends on its type, so the values need to have the type of the key columns
+    resolve_data_type(_data_types[column_idx], [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      key.emplace_back(type_cast<ColumnDataType>(values[column_idx]));
+    });
+  }
+
+  auto matches = PosList{};
+  const auto range = _entries.equal_range(key);
+  for (auto entry_iter = range.first; entry_iter != range.second; ++entry_iter) {
+    matches.emplace_back(entry_iter->second);
+  }
+
+  // The order of entries with the same key is not defined
+  std::sort(matches.begin(), matches.end());
+
+  return matches;
+}
+
+size_t PrimaryKeyIndex::size() const { return _entries.size(); }
+
+}  // namespace opossum
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <tbb/concurrent_unordered_map.h>
+
+#include <boost/functional/hash.hpp>
+
+#include <memory>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+
+/**
+ * A hash index over all rows of a Table. As opposed to the indexes derived from BaseIndex, which are built per Chunk
+ * and only over immutable columns, it is maintained while rows are inserted. Thus, a point lookup (e.g.,
+ * `WHERE pk = ?` in an OLTP transaction) neither probes the indexes of all Chunks nor scans the mutable ones.
+ *
+ * Entries are never removed. A lookup returns all rows that ever held the key, including deleted rows, rows of
+ * uncommitted or rolled back transactions, and older versions of updated rows (an Update is a Delete followed by an
+ * Insert, which adds the new version to the index). Which of these rows are visible is decided by their MVCC columns,
+ * i.e., by a Validate following the IndexScan. This way, the index needs no maintenance on commit and rollback, and
+ * transactions with older snapshots still find the rows they see.
+ *
+ * Rows with a NULL in one of the key columns are not indexed. The uniqueness of the key is not enforced.
+ * Inserting entries and lookups are thread-safe.
+ */
+class PrimaryKeyIndex : private Noncopyable {
+ public:
+  PrimaryKeyIndex(const std::vector<ColumnID>& column_ids, const std::vector<DataType>& data_types);
+
+  const std::vector<ColumnID>& column_ids() const;
+
+  /**
+   * Adds the rows [@param begin_offset, @param end_offset) of @param chunk, which has the ID @param chunk_id, to the
+   * index. The values of these rows must have been written already.
+   */
+  void insert(const Chunk& chunk, const ChunkID chunk_id, const ChunkOffset begin_offset, const ChunkOffset end_offset);
+
+  /**
+   * @return  the RowIDs of all rows holding @param values in the key columns. The values are converted to the data
+   *          types of the key columns.
+   */
+  PosList lookup(const std::vector<AllTypeVariant>& values) const;
+
+  // Number of entries, including those of deleted and rolled back rows
+  size_t size() const;
+
+ protected:
+  using Key = std::vector<AllTypeVariant>;
+
+  struct KeyHash {
+    size_t operator()(const Key& key) const { return boost::hash_range(key.begin(), key.end()); }
+  };
+
+  const std::vector<ColumnID> _column_ids;
+  const std::vector<DataType> _data_types;
+  tbb::concurrent_unordered_multimap<Key, RowID, KeyHash> _entries;
+};
+
+}  // namespace opossum
@@ -8,7 +8,9 @@
 #include <utility>
 #include <vector>
 
+#include "base_value_column.hpp"
 #include "resolve_type.hpp"
+#include "storage/index/primary_key/primary_key_index.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 #include "value_column.hpp"
@@ -25,7 +27,8 @@ Table::Table(const TableColumnDefinitions& column_definitions, const TableType t
       _type(type),
       _use_mvcc(use_mvcc),
       _max_chunk_size(max_chunk_size),
-      _append_mutex(std::make_unique<std::mutex>()) {
+      _append_mutex(std::make_unique<std::mutex>()),
+      _indexes_mutex(std::make_unique<std::mutex>()) {
   Assert(max_chunk_size > 0, "Table must have a chunk size greater than 0.");
 }
 
@@ -91,6 +94,11 @@ void Table::append(const std::vector<AllTypeVariant>& values) {
   }
 
   _chunks.back()->append(values);
+
+  if (_primary_key_index) {
+    const auto chunk_size = _chunks.back()->size();
+    _primary_key_index->insert(*_chunks.back(), ChunkID{chunk_count() - 1}, chunk_size - 1, chunk_size);
+  }
 }
 
 void Table::append_mutable_chunk() {
@@ -166,6 +174,11 @@ void Table::append_chunk(const ChunkColumns& columns, const std::optional<Polymo
   }
 
   _chunks.emplace_back(std::make_shared<Chunk>(columns, mvcc_columns, alloc, access_counter));
+  _create_delta_indexes_for_last_chunk();
+
+  if (_primary_key_index) {
+    _primary_key_index->insert(*_chunks.back(), ChunkID{chunk_count() - 1}, 0u, chunk_size);
+  }
 }
 
 void Table::append_chunk(const std::shared_ptr<Chunk>& chunk) {
@@ -187,11 +200,71 @@ void Table::append_chunk(const std::shared_ptr<Chunk>& chunk) {
               "Chunk does not have the same MVCC setting as the table.");
 
   _chunks.emplace_back(chunk);
+  _create_delta_indexes_for_last_chunk();
+
+  if (_primary_key_index) {
+    _primary_key_index->insert(*chunk, ChunkID{chunk_count() - 1}, 0u, chunk->size());
+  }
 }
 
 std::unique_lock<std::mutex> Table::acquire_append_mutex() { return std::unique_lock<std::mutex>(*_append_mutex); }
 
-std::vector<IndexInfo> Table::get_indexes() const { return _indexes; }
+std::vector<IndexInfo> Table::get_indexes() const {
+  std::lock_guard<std::mutex> lock(*_indexes_mutex);
+  return _indexes;
+}
+
+void Table::remove_indexes_missing_in_chunk(const ChunkID chunk_id) {
+  const auto& chunk = *get_chunk(chunk_id);
+
+  std::lock_guard<std::mutex> lock(*_indexes_mutex);
+  _indexes.erase(std::remove_if(_indexes.begin(), _indexes.end(),
+                                [&](const auto& index_info) {
+                                  // The PrimaryKeyIndex is not stored in the chunks
+                                  if (index_info.type == ColumnIndexType::PrimaryKey) return false;
+                                  return !chunk.get_index(index_info.type, index_info.column_ids) &&
+                                         !chunk.get_index(ColumnIndexType::Delta, index_info.column_ids);
+                                }),
+                 _indexes.end());
+}
+
+bool Table::_indexes_value_column(const Chunk& chunk, const std::vector<ColumnID>& column_ids) {
+  return column_ids.size() == 1 &&
+         std::dynamic_pointer_cast<const BaseValueColumn>(chunk.get_column(column_ids.front())) != nullptr;
+}
+
+void Table::_create_delta_indexes_for_last_chunk() {
+  const auto& chunk = _chunks.back();
+  std::lock_guard<std::mutex> lock(*_indexes_mutex);
+  for (const auto& index_info : _indexes) {
+    if (index_info.type == ColumnIndexType::PrimaryKey || !_indexes_value_column(*chunk, index_info.column_ids)) {
+      continue;
+    }
+    chunk->create_delta_index(index_info.column_ids.front(), index_info.type);
+  }
+}
+
+void Table::create_primary_key_index(const std::vector<ColumnID>& column_ids, const std::string& name) {
+  Assert(!_primary_key_index, "Table already has a PrimaryKeyIndex.");
+  Assert(_type == TableType::Data, "PrimaryKeyIndex can only be created for data tables.");
+
+  auto data_types = std::vector<DataType>{};
+  data_types.reserve(column_ids.size());
+  for (const auto column_id : column_ids) {
+    Assert(column_id < column_count(), "ColumnID out of range");
+    data_types.emplace_back(column_data_type(column_id));
+  }
+
+  _primary_key_index = std::make_shared<PrimaryKeyIndex>(column_ids, data_types);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count(); ++chunk_id) {
+    _primary_key_index->insert(*_chunks[chunk_id], chunk_id, 0u, _chunks[chunk_id]->size());
+  }
+
+  std::lock_guard<std::mutex> lock(*_indexes_mutex);
+  _indexes.emplace_back(IndexInfo{column_ids, name, ColumnIndexType::PrimaryKey});
+}
+
+std::shared_ptr<PrimaryKeyIndex> Table::primary_key_index() const { return _primary_key_index; }
 
 size_t Table::estimate_memory_usage() const {
   auto bytes = size_t{sizeof(*this)};
@@ -18,6 +18,7 @@
 
 namespace opossum {
 
+class PrimaryKeyIndex;
 class TableStatistics;
 
 /**
@@ -147,23 +148,55 @@ class Table : private Noncopyable {
 
   std::vector<IndexInfo> get_indexes() const;
 
+  /**
+   * Creates an Index on @param column_ids in all chunks. Single-column indexes on ValueColumns (i.e., in mutable
+   * chunks) are DeltaIndexes, which are maintained while rows are appended and replaced with an Index once the chunk
+   * is encoded. Chunks appended later on get DeltaIndexes as well.
+   */
   template <typename Index>
   void create_index(const std::vector<ColumnID>& column_ids, const std::string& name = "") {
     ColumnIndexType index_type = get_index_type_of<Index>();
 
     for (auto& chunk : _chunks) {
-      chunk->create_index<Index>(column_ids);
+      if (_indexes_value_column(*chunk, column_ids)) {
+        chunk->create_delta_index(column_ids.front(), index_type);
+      } else {
+        chunk->create_index<Index>(column_ids);
+      }
     }
     IndexInfo i = {column_ids, name, index_type};
+    std::lock_guard<std::mutex> lock(*_indexes_mutex);
     _indexes.emplace_back(i);
   }
 
+  /**
+   * Removes the indexes that @param chunk_id has neither as an Index nor as a DeltaIndex from get_indexes(). This is
+   * called once the chunk has been encoded, which drops indexes that do not support the encoding (see
+   * Chunk::replace_column()). Hence, they are no longer considered by the optimizer.
+   */
+  void remove_indexes_missing_in_chunk(const ChunkID chunk_id);
+
+  /**
+   * Creates a PrimaryKeyIndex over @param column_ids. Unlike the indexes created by create_index(), it covers all rows
+   * of the table, including those in mutable chunks and those appended later on. A table has at most one.
+   */
+  void create_primary_key_index(const std::vector<ColumnID>& column_ids, const std::string& name = "");
+
+  // nullptr if the table has no PrimaryKeyIndex
+  std::shared_ptr<PrimaryKeyIndex> primary_key_index() const;
+
   /**
    * For debugging purposes, makes an estimation about the memory used by this Table (including Chunk and Columns)
    */
   size_t estimate_memory_usage() const;
 
  protected:
+  // Whether a single-column index on @param column_ids in @param chunk has to be a DeltaIndex
+  static bool _indexes_value_column(const Chunk& chunk, const std::vector<ColumnID>& column_ids);
+
+  // Creates DeltaIndexes in the last chunk for the single-column indexes of the table, see create_index()
+  void _create_delta_indexes_for_last_chunk();
+
   const TableColumnDefinitions _column_definitions;
   const TableType _type;
   const UseMvcc _use_mvcc;
@@ -171,6 +204,9 @@ class Table : private Noncopyable {
   std::vector<std::shared_ptr<Chunk>> _chunks;
   std::shared_ptr<TableStatistics> _table_statistics;
   std::unique_ptr<std::mutex> _append_mutex;
+  // Indexes are removed while other threads read them (e.g., by the ChunkCompressionTask)
+  std::unique_ptr<std::mutex> _indexes_mutex;
   std::vector<IndexInfo> _indexes;
+  std::shared_ptr<PrimaryKeyIndex> _primary_key_index;
 };
 }  // namespace opossum
@@ -3,6 +3,8 @@
 #include <string>
 #include <vector>
 
+#include "statistics/generate_table_statistics.hpp"
+#include "statistics/table_statistics.hpp"
 #include "storage/chunk.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/storage_manager.hpp"
@@ -33,6 +35,13 @@ void ChunkCompressionTask::_on_execute() {
                 "Chunk is not completed and thus can’t be compressed.");
 
     ChunkEncoder::encode_chunk(chunk, table->column_data_types());
+    table->remove_indexes_missing_in_chunk(chunk_id);
+  }
+
+  // The statistics of the now immutable chunks are merged into the table's statistics, only the chunks that are still
+  // mutable are scanned
+  if (table->table_statistics()) {
+    table->set_table_statistics(std::make_shared<TableStatistics>(generate_table_statistics(*table)));
   }
 }
 
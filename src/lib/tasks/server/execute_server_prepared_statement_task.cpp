@@ -3,14 +3,19 @@
 #include "concurrency/transaction_context.hpp"
 #include "concurrency/transaction_manager.hpp"
 #include "scheduler/current_scheduler.hpp"
+#include "scheduler/resource_group.hpp"
+#include "scheduler/resource_group_manager.hpp"
 #include "sql/sql_query_plan.hpp"
 
 namespace opossum {
 
 void ExecuteServerPreparedStatementTask::_on_execute() {
   try {
-    const auto tasks = _prepared_plan->create_tasks();
-    CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+    // Prepared statements are admitted like any other statement (see SQLPipelineStatement::get_result_table())
+    const auto& resource_group = ResourceGroupManager::get().resource_group_for_cost(_prepared_plan->estimated_cost());
+    const auto tasks = _prepared_plan->create_tasks(resource_group->priority());
+    resource_group->schedule_tasks(tasks);
+    CurrentScheduler::wait_for_tasks(tasks);
     auto result_table = tasks.back()->get_operator()->get_output();
     _promise.set_value(std::move(result_table));
   } catch (const std::exception&) {
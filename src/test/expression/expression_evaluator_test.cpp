@@ -599,4 +599,19 @@ TEST_F(ExpressionEvaluatorTest, CastSeries) {
       test_expression<std::string>(table_a, *cast_(c, DataType::String), {"33", std::nullopt, "34", std::nullopt}));
 }
 
+TEST_F(ExpressionEvaluatorTest, CommonSubexpressionsAreEvaluatedOnce) {
+  auto evaluator = ExpressionEvaluator{table_a, ChunkID{0}};
+
+  // mul_(a, b) is evaluated as a part of the first expression, equal expressions reuse its result
+  const auto sum = evaluator.evaluate_expression_to_result<int32_t>(*add_(mul_(a, b), 1));
+  const auto product = evaluator.evaluate_expression_to_result<int32_t>(*mul_(a, b));
+  const auto other_product = evaluator.evaluate_expression_to_result<int32_t>(*mul_(a, b));
+  EXPECT_EQ(product, other_product);
+  EXPECT_EQ(product->values, std::vector<int32_t>({2, 6, 12, 20}));
+  EXPECT_EQ(sum->values, std::vector<int32_t>({3, 7, 13, 21}));
+
+  // Results of other Expressions are not mixed up
+  EXPECT_NE(evaluator.evaluate_expression_to_result<int32_t>(*mul_(a, c)), product);
+}
+
 }  // namespace opossum
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <numeric>
@@ -15,6 +16,7 @@
 #include "storage/index/group_key/composite_group_key_index.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
 #include "storage/table.hpp"
+#include "storage/value_column.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -214,6 +216,77 @@ TYPED_TEST(OperatorsIndexScanTest, SingleColumnScanOnlySomeChunks) {
   }
 }
 
+TYPED_TEST(OperatorsIndexScanTest, IndexOnlyScan) {
+  const auto right_values = std::vector<AllTypeVariant>{AllTypeVariant{4}};
+  const auto right_values2 = std::vector<AllTypeVariant>{AllTypeVariant{9}};
+
+  auto scan = std::make_shared<IndexScan>(this->_int_int, this->_index_type, this->_column_ids,
+                                          PredicateCondition::Between, right_values, right_values2);
+  scan->set_index_only(true);
+
+  const auto chunk = this->_int_int->get_output()->get_chunk(ChunkID{0});
+  const auto index = chunk->get_index(this->_index_type, this->_column_ids);
+  if (!index->supports_index_only_scans()) {
+    EXPECT_THROW(scan->execute(), std::logic_error);
+    return;
+  }
+
+  scan->execute();
+
+  // Only the indexed column is output, with its values taken from the index, sorted within each chunk
+  const auto output = scan->get_output();
+  EXPECT_EQ(output->type(), TableType::Data);
+  ASSERT_EQ(output->column_count(), 1u);
+  EXPECT_EQ(output->column_name(ColumnID{0}), "a");
+  EXPECT_FALSE(output->column_is_nullable(ColumnID{0}));
+  this->ASSERT_COLUMN_EQ(output, ColumnID{0u}, {4, 6, 8, 4, 6, 8});
+
+  for (auto chunk_id = ChunkID{0u}; chunk_id < output->chunk_count(); ++chunk_id) {
+    const auto values_column = output->get_chunk(chunk_id)->get_column(ColumnID{0});
+    const auto& values = std::dynamic_pointer_cast<const ValueColumn<int32_t>>(values_column)->values();
+    EXPECT_TRUE(std::is_sorted(values.begin(), values.end()));
+  }
+}
+
+TYPED_TEST(OperatorsIndexScanTest, ScanChunksWithoutIndex) {
+  // Chunks without the index (e.g., because it was dropped when the chunk was encoded) are scanned without it
+  const auto table = load_table("src/test/tables/int_int_shuffled_2.tbl", 5);
+  ChunkEncoder::encode_all_chunks(table);
+  table->get_chunk(ChunkID{0})->template create_index<TypeParam>(this->_column_ids);
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto right_values = std::vector<AllTypeVariant>{AllTypeVariant{4}};
+  const auto right_values2 = std::vector<AllTypeVariant>{AllTypeVariant{9}};
+
+  std::map<PredicateCondition, std::vector<AllTypeVariant>> tests;
+  tests[PredicateCondition::Equals] = {104, 104};
+  tests[PredicateCondition::NotEquals] = {100, 102, 106, 108, 110, 112, 100, 102, 106, 108, 110, 112};
+  tests[PredicateCondition::LessThan] = {100, 102, 100, 102};
+  tests[PredicateCondition::LessThanEquals] = {100, 102, 104, 100, 102, 104};
+  tests[PredicateCondition::GreaterThan] = {106, 108, 110, 112, 106, 108, 110, 112};
+  tests[PredicateCondition::GreaterThanEquals] = {104, 106, 108, 110, 112, 104, 106, 108, 110, 112};
+  tests[PredicateCondition::Between] = {104, 106, 108, 104, 106, 108};
+
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<IndexScan>(table_wrapper, this->_index_type, this->_column_ids, test.first,
+                                            right_values, right_values2);
+    scan->execute();
+
+    this->ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1u}, test.second);
+  }
+
+  if (!table->get_chunk(ChunkID{0})->get_index(this->_index_type, this->_column_ids)->supports_index_only_scans()) {
+    return;
+  }
+
+  auto index_only_scan = std::make_shared<IndexScan>(table_wrapper, this->_index_type, this->_column_ids,
+                                                     PredicateCondition::Between, right_values, right_values2);
+  index_only_scan->set_index_only(true);
+  index_only_scan->execute();
+  this->ASSERT_COLUMN_EQ(index_only_scan->get_output(), ColumnID{0u}, {4, 6, 8, 4, 6, 8});
+}
+
 TYPED_TEST(OperatorsIndexScanTest, OperatorName) {
   const auto right_values = std::vector<AllTypeVariant>(this->_column_ids.size(), AllTypeVariant{0});
 
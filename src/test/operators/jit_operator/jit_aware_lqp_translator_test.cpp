@@ -7,13 +7,17 @@
 #include "logical_query_plan/sort_node.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
 #include "logical_query_plan/union_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
 #include "operators/jit_operator/jit_aware_lqp_translator.hpp"
 #include "operators/jit_operator/operators/jit_aggregate.hpp"
 #include "operators/jit_operator/operators/jit_compute.hpp"
 #include "operators/jit_operator/operators/jit_filter.hpp"
+#include "operators/jit_operator/operators/jit_hash_join_build.hpp"
+#include "operators/jit_operator/operators/jit_hash_join_probe.hpp"
 #include "operators/jit_operator/operators/jit_read_tuples.hpp"
 #include "operators/jit_operator/operators/jit_write_tuples.hpp"
 #include "sql/sql_pipeline_builder.hpp"
+#include "storage/chunk_encoder.hpp"
 
 using namespace opossum::expression_functional;  // NOLINT
 
@@ -179,6 +183,69 @@ TEST_F(JitAwareLQPTranslatorTest, LiteralValuesAreAddedToJitReadTupleAdapter) {
   ASSERT_EQ(input_literals[1].tuple_value.is_nullable(), false);
 }
 
+TEST_F(JitAwareLQPTranslatorTest, DictionaryColumnComparisonsAreAddedToJitReadTupleAdapter) {
+  // Comparisons of dictionary-encoded columns with literals are evaluated by the JitReadTuples adapter, which can
+  // compare ValueIDs instead of values
+  ChunkEncoder::encode_all_chunks(StorageManager::get().get_table("table_a"));
+
+  const auto jit_operator_wrapper = translate_query("SELECT a, b FROM table_a WHERE a > 1 AND 2 = b");
+  ASSERT_TRUE(jit_operator_wrapper);
+  const auto jit_operators = jit_operator_wrapper->jit_operators();
+  ASSERT_EQ(jit_operators.size(), 4u);
+
+  const auto jit_read_tuples = std::dynamic_pointer_cast<JitReadTuples>(jit_operators[0]);
+  const auto jit_compute = std::dynamic_pointer_cast<JitCompute>(jit_operators[1]);
+  ASSERT_NE(jit_read_tuples, nullptr);
+  ASSERT_NE(jit_compute, nullptr);
+
+  // The literals are not read into the runtime tuple, but part of the comparisons
+  ASSERT_TRUE(jit_read_tuples->input_literals().empty());
+
+  const auto input_comparisons = jit_read_tuples->input_comparisons();
+  ASSERT_EQ(input_comparisons.size(), 2u);
+
+  ASSERT_EQ(input_comparisons[0].column_id, ColumnID{0});
+  ASSERT_EQ(input_comparisons[0].predicate_condition, PredicateCondition::GreaterThan);
+  ASSERT_EQ(input_comparisons[0].value, AllTypeVariant(1));
+  ASSERT_EQ(input_comparisons[0].tuple_value.data_type(), DataType::Bool);
+
+  // The column is always on the left side of an input comparison
+  ASSERT_EQ(input_comparisons[1].column_id, ColumnID{1});
+  ASSERT_EQ(input_comparisons[1].predicate_condition, PredicateCondition::Equals);
+  ASSERT_EQ(input_comparisons[1].value, AllTypeVariant(2));
+
+  // Only the conjunction of the comparison results is left to be computed
+  const auto expression = jit_compute->expression();
+  ASSERT_EQ(expression->expression_type(), JitExpressionType::And);
+  ASSERT_EQ(expression->left_child()->result(), input_comparisons[0].tuple_value);
+  ASSERT_EQ(expression->right_child()->result(), input_comparisons[1].tuple_value);
+}
+
+TEST_F(JitAwareLQPTranslatorTest, DictionaryColumnComparisonsBelowValidateAreAddedToJitReadTupleAdapter) {
+  // With MVCC, the input to the operator pipeline is a Validate on the stored table. JitReadTuples reads the ValueIDs
+  // through the position lists of the Validate's output.
+  ChunkEncoder::encode_all_chunks(StorageManager::get().get_table("table_a"));
+
+  // clang-format off
+  const auto lqp =
+  ProjectionNode::make(expression_vector(a_a),
+    PredicateNode::make(greater_than_(a_a, 1),
+      ValidateNode::make(
+        stored_table_node_a)));
+  // clang-format on
+
+  const auto jit_operator_wrapper = translate_lqp(lqp);
+  ASSERT_TRUE(jit_operator_wrapper);
+  const auto jit_read_tuples = std::dynamic_pointer_cast<JitReadTuples>(jit_operator_wrapper->jit_operators()[0]);
+  ASSERT_NE(jit_read_tuples, nullptr);
+
+  const auto input_comparisons = jit_read_tuples->input_comparisons();
+  ASSERT_EQ(input_comparisons.size(), 1u);
+  ASSERT_EQ(input_comparisons[0].column_id, ColumnID{0});
+  ASSERT_EQ(input_comparisons[0].predicate_condition, PredicateCondition::GreaterThan);
+  ASSERT_EQ(input_comparisons[0].value, AllTypeVariant(1));
+}
+
 TEST_F(JitAwareLQPTranslatorTest, ColumnSubsetIsOutputCorrectly) {
   // Select a subset of columns
   const auto jit_operator_wrapper = translate_query("SELECT a FROM table_a WHERE a > 1");
@@ -472,4 +539,62 @@ TEST_F(JitAwareLQPTranslatorTest, AggregateOperator) {
   ASSERT_EQ(jit_read_tuples->find_input_column(aggregate_columns[4].tuple_value), ColumnID{1});
 }
 
+TEST_F(JitAwareLQPTranslatorTest, InnerEquiJoinIsIntegratedIntoOperatorChain) {
+  const auto jit_operator_wrapper = translate_query(
+      "SELECT table_a.a, SUM(table_b.b) FROM table_a JOIN table_b ON table_a.a = table_b.a WHERE table_a.b > 1 "
+      "GROUP BY table_a.a");
+  ASSERT_NE(jit_operator_wrapper, nullptr);
+
+  // The build side is processed by a separate operator chain on the right input of the JitOperatorWrapper
+  ASSERT_NE(jit_operator_wrapper->input_right(), nullptr);
+
+  // Check the type of jit operators in the operator pipeline
+  const auto jit_operators = jit_operator_wrapper->jit_operators();
+  ASSERT_EQ(jit_operators.size(), 5u);
+
+  const auto jit_read_tuples = std::dynamic_pointer_cast<JitReadTuples>(jit_operators[0]);
+  const auto jit_hash_join_probe = std::dynamic_pointer_cast<JitHashJoinProbe>(jit_operators[1]);
+  const auto jit_compute = std::dynamic_pointer_cast<JitCompute>(jit_operators[2]);
+  const auto jit_filter = std::dynamic_pointer_cast<JitFilter>(jit_operators[3]);
+  const auto jit_aggregate = std::dynamic_pointer_cast<JitAggregate>(jit_operators[4]);
+  ASSERT_NE(jit_read_tuples, nullptr);
+  ASSERT_NE(jit_hash_join_probe, nullptr);
+  ASSERT_NE(jit_compute, nullptr);
+  ASSERT_NE(jit_filter, nullptr);
+  ASSERT_NE(jit_aggregate, nullptr);
+
+  // The probe compares table_a.a to table_b.a and provides table_b.b to the aggregate operator
+  const auto key_columns = jit_hash_join_probe->key_columns();
+  ASSERT_EQ(key_columns.size(), 1u);
+  ASSERT_EQ(jit_read_tuples->find_input_column(key_columns[0].tuple_value), ColumnID{0});
+  ASSERT_EQ(key_columns[0].build_column_id, ColumnID{0});
+
+  const auto build_columns = jit_hash_join_probe->build_columns();
+  ASSERT_EQ(build_columns.size(), 1u);
+  ASSERT_EQ(build_columns[0].build_column_id, ColumnID{1});
+
+  const auto aggregate_columns = jit_aggregate->aggregate_columns();
+  ASSERT_EQ(aggregate_columns.size(), 1u);
+  ASSERT_EQ(aggregate_columns[0].tuple_value, build_columns[0].tuple_value);
+
+  // Check the operators that build the hash table
+  const auto build_jit_operators = jit_operator_wrapper->build_jit_operators();
+  ASSERT_EQ(build_jit_operators.size(), 2u);
+  ASSERT_NE(std::dynamic_pointer_cast<JitReadTuples>(build_jit_operators[0]), nullptr);
+  ASSERT_NE(std::dynamic_pointer_cast<JitHashJoinBuild>(build_jit_operators[1]), nullptr);
+}
+
+TEST_F(JitAwareLQPTranslatorTest, OuterJoinsAreNotIntegratedIntoOperatorChain) {
+  const auto jit_operator_wrapper = translate_query(
+      "SELECT table_a.a, SUM(table_b.b) FROM table_a LEFT JOIN table_b ON table_a.a = table_b.a GROUP BY table_a.a");
+  ASSERT_NE(jit_operator_wrapper, nullptr);
+
+  // Only the aggregate is jitted, the join is executed by a regular join operator
+  ASSERT_EQ(jit_operator_wrapper->input_right(), nullptr);
+  ASSERT_TRUE(jit_operator_wrapper->build_jit_operators().empty());
+  for (const auto& jit_operator : jit_operator_wrapper->jit_operators()) {
+    ASSERT_EQ(std::dynamic_pointer_cast<JitHashJoinProbe>(jit_operator), nullptr);
+  }
+}
+
 }  // namespace opossum
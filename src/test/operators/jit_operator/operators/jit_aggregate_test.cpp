@@ -1,3 +1,4 @@
+#include <optional>
 #include <random>
 
 #include "../../../base_test.hpp"
@@ -342,4 +343,68 @@ TEST_F(JitAggregateTest, EmptyInputTableNoGroupbyColumns) {
                                 FloatComparisonMode::AbsoluteDifference));
 }
 
+// Check that the groups of a second morsel are merged into the hashmap of the first one.
+TEST_F(JitAggregateTest, MergesMorsels) {
+  const auto value_a = JitTupleValue(DataType::Int, true, 0);
+  const auto value_b = JitTupleValue(DataType::Int, true, 1);
+
+  _aggregate->add_groupby_column("groupby", value_a);
+  _aggregate->add_aggregate_column("count", value_b, AggregateFunction::Count);
+  _aggregate->add_aggregate_column("sum", value_b, AggregateFunction::Sum);
+  _aggregate->add_aggregate_column("max", value_b, AggregateFunction::Max);
+  _aggregate->add_aggregate_column("min", value_b, AggregateFunction::Min);
+  _aggregate->add_aggregate_column("avg", value_b, AggregateFunction::Avg);
+
+  auto output_table = _aggregate->create_output_table(Chunk::MAX_SIZE);
+  auto morsel_table = _aggregate->create_output_table(Chunk::MAX_SIZE);
+
+  JitRuntimeContext context;
+  context.tuple.resize(2);
+  _aggregate->before_query(*output_table, context);
+
+  JitRuntimeContext morsel_context;
+  morsel_context.tuple.resize(2);
+  _aggregate->before_query(*morsel_table, morsel_context);
+
+  // Emits a (groupby, value) tuple in the given context. std::nullopt represents NULL.
+  const auto emit = [&](const std::optional<int32_t> groupby, const std::optional<int32_t> value,
+                        JitRuntimeContext& emit_context) {
+    value_a.set_is_null(!groupby, emit_context);
+    if (groupby) value_a.set<int32_t>(*groupby, emit_context);
+    value_b.set_is_null(!value, emit_context);
+    if (value) value_b.set<int32_t>(*value, emit_context);
+    _source->emit(emit_context);
+  };
+
+  // Group 1 occurs in both morsels, group 2 only in the first, group 3 only in the second. The NULL group occurs in
+  // both morsels, but only has NULL values in the first one.
+  emit(1, 4, context);
+  emit(1, 2, context);
+  emit(2, 7, context);
+  emit(std::nullopt, std::nullopt, context);
+  emit(1, 9, morsel_context);
+  emit(1, std::nullopt, morsel_context);
+  emit(3, 5, morsel_context);
+  emit(std::nullopt, 6, morsel_context);
+
+  _aggregate->merge_morsel(*output_table, context, *morsel_table, morsel_context);
+  _aggregate->after_query(*output_table, context);
+
+  const auto expected_column_definitions = TableColumnDefinitions({{"groupby", DataType::Int, true},
+                                                                   {"count", DataType::Long, false},
+                                                                   {"sum", DataType::Int, true},
+                                                                   {"max", DataType::Int, true},
+                                                                   {"min", DataType::Int, true},
+                                                                   {"avg", DataType::Double, true}});
+
+  auto expected_output_table = std::make_shared<Table>(expected_column_definitions, TableType::Data);
+  expected_output_table->append({1, 3, 15, 9, 2, 5.0});
+  expected_output_table->append({2, 1, 7, 7, 7, 7.0});
+  expected_output_table->append({3, 1, 5, 5, 5, 5.0});
+  expected_output_table->append({NullValue{}, 1, 6, 6, 6, 6.0});
+
+  EXPECT_TRUE(check_table_equal(output_table, expected_output_table, OrderSensitivity::No, TypeCmpMode::Strict,
+                                FloatComparisonMode::AbsoluteDifference));
+}
+
 }  // namespace opossum
@@ -0,0 +1,135 @@
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "../../../base_test.hpp"
+#include "operators/jit_operator/operators/jit_hash_join_build.hpp"
+#include "operators/jit_operator/operators/jit_hash_join_probe.hpp"
+
+namespace opossum {
+
+// Mock JitOperator that passes individual tuples into the chain.
+class MockSource : public AbstractJittable {
+ public:
+  std::string description() const final { return "MockSource"; }
+
+  void emit(JitRuntimeContext& context) { _emit(context); }
+
+ private:
+  void _consume(JitRuntimeContext& context) const final {}
+};
+
+// Mock JitOperator that records the value of a tuple value for each tuple passed to it
+class MockSink : public AbstractJittable {
+ public:
+  explicit MockSink(const JitTupleValue& tuple_value) : _tuple_value{tuple_value} {}
+
+  std::string description() const final { return "MockSink"; }
+
+  const std::vector<int32_t>& values() const { return _values; }
+
+ private:
+  void _consume(JitRuntimeContext& context) const final { _values.push_back(_tuple_value.get<int32_t>(context)); }
+
+  const JitTupleValue _tuple_value;
+  mutable std::vector<int32_t> _values;
+};
+
+class JitHashJoinTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // The probe side reads its key from column 0 of the left input into x0. The build side is joined on its nullable
+    // column 0 and provides the value of its column 1 in x1.
+    JitReadTuples read_tuples;
+    read_tuples.add_input_column(DataType::Int, true, ColumnID{0});
+    _probe = std::make_shared<JitHashJoinProbe>();
+    _probe->add_key_column(_probe_key, ColumnID{0}, true);
+    ASSERT_EQ(_probe->add_build_column(DataType::Int, false, ColumnID{1}, read_tuples), _build_value);
+  }
+
+  // Fills the hash table with the given (key, value) pairs of build tuples
+  void build(const std::vector<std::pair<std::optional<int32_t>, int32_t>>& build_tuples, JitRuntimeContext& context) {
+    const auto build_operators = _probe->create_build_operators();
+    const auto hash_join_build = std::dynamic_pointer_cast<JitHashJoinBuild>(build_operators[1]);
+    const auto key_value = hash_join_build->key_columns()[0].tuple_value;
+    const auto payload_value = hash_join_build->payload_columns()[0].tuple_value;
+
+    // The tuples are passed to the JitHashJoinBuild directly instead of being read from a table
+    auto source = std::make_shared<MockSource>();
+    source->set_next_operator(hash_join_build);
+
+    JitRuntimeContext build_context;
+    build_context.tuple.resize(2);
+    hash_join_build->before_query(build_context);
+    for (const auto& [key, value] : build_tuples) {
+      key_value.set_is_null(!key, build_context);
+      if (key) key_value.set<int32_t>(*key, build_context);
+      payload_value.set<int32_t>(value, build_context);
+      source->emit(build_context);
+    }
+
+    context.join_hashmap = std::make_shared<JitRuntimeHashmap>(std::move(build_context.hashmap));
+  }
+
+  const JitTupleValue _probe_key{DataType::Int, true, 0};
+  const JitTupleValue _build_value{DataType::Int, false, 1};
+  std::shared_ptr<JitHashJoinProbe> _probe;
+};
+
+TEST_F(JitHashJoinTest, CreatesBuildOperators) {
+  const auto build_operators = _probe->create_build_operators();
+  ASSERT_EQ(build_operators.size(), 2u);
+
+  const auto build_read_tuples = std::dynamic_pointer_cast<JitReadTuples>(build_operators[0]);
+  const auto hash_join_build = std::dynamic_pointer_cast<JitHashJoinBuild>(build_operators[1]);
+  ASSERT_NE(build_read_tuples, nullptr);
+  ASSERT_NE(hash_join_build, nullptr);
+
+  // The build operators read the key and build columns into the hashmap columns that the probe accesses
+  const auto key_columns = hash_join_build->key_columns();
+  ASSERT_EQ(key_columns.size(), 1u);
+  EXPECT_EQ(build_read_tuples->find_input_column(key_columns[0].tuple_value), ColumnID{0});
+  EXPECT_TRUE(key_columns[0].tuple_value.is_nullable());
+  EXPECT_EQ(key_columns[0].hashmap_value.column_index(), _probe->key_columns()[0].hashmap_value.column_index());
+
+  const auto payload_columns = hash_join_build->payload_columns();
+  ASSERT_EQ(payload_columns.size(), 1u);
+  EXPECT_EQ(build_read_tuples->find_input_column(payload_columns[0].tuple_value), ColumnID{1});
+  EXPECT_EQ(payload_columns[0].hashmap_value.column_index(), _probe->build_columns()[0].hashmap_value.column_index());
+}
+
+TEST_F(JitHashJoinTest, BuildColumnsAreAddedOnce) {
+  JitReadTuples read_tuples;
+  const auto build_value = _probe->add_build_column(DataType::Int, false, ColumnID{1}, read_tuples);
+  EXPECT_EQ(build_value, _build_value);
+  EXPECT_EQ(_probe->build_columns().size(), 1u);
+}
+
+TEST_F(JitHashJoinTest, EmitsOneTupleForEachMatch) {
+  JitRuntimeContext context;
+  build({{1, 10}, {2, 20}, {1, 11}, {std::nullopt, 30}}, context);
+
+  // NULL keys are not inserted into the hash table
+  EXPECT_EQ(context.join_hashmap->indices.size(), 2u);
+
+  context.tuple.resize(2);
+  auto source = std::make_shared<MockSource>();
+  auto sink = std::make_shared<MockSink>(_build_value);
+  source->set_next_operator(_probe);
+  _probe->set_next_operator(sink);
+
+  for (const auto probe_key : {1, 3, 2}) {
+    _probe_key.set_is_null(false, context);
+    _probe_key.set<int32_t>(probe_key, context);
+    source->emit(context);
+  }
+
+  // NULL never matches in a join
+  _probe_key.set_is_null(true, context);
+  source->emit(context);
+
+  EXPECT_EQ(sink->values(), (std::vector<int32_t>{10, 11, 20}));
+}
+
+}  // namespace opossum
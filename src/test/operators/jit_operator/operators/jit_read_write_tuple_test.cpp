@@ -1,10 +1,36 @@
 #include "../../../base_test.hpp"
+#include "constant_mappings.hpp"
 #include "operators/jit_operator/operators/jit_read_tuples.hpp"
 #include "operators/jit_operator/operators/jit_write_tuples.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/reference_column.hpp"
+#include "type_comparison.hpp"
 #include "utils/load_table.hpp"
 
 namespace opossum {
 
+// Mock JitOperator that records the boolean result of an input comparison for each tuple passed to it
+class MockComparisonSink : public AbstractJittable {
+ public:
+  explicit MockComparisonSink(const JitTupleValue& tuple_value) : _tuple_value{tuple_value} {}
+
+  std::string description() const final { return "MockComparisonSink"; }
+
+  const std::vector<std::optional<bool>>& results() const { return _results; }
+
+ private:
+  void _consume(JitRuntimeContext& context) const final {
+    if (_tuple_value.is_null(context)) {
+      _results.emplace_back(std::nullopt);
+    } else {
+      _results.emplace_back(_tuple_value.get<bool>(context));
+    }
+  }
+
+  const JitTupleValue _tuple_value;
+  mutable std::vector<std::optional<bool>> _results;
+};
+
 class JitReadWriteTupleTest : public BaseTest {};
 
 TEST_F(JitReadWriteTupleTest, CreateOutputTable) {
@@ -100,4 +126,98 @@ TEST_F(JitReadWriteTupleTest, CopyTable) {
                                 FloatComparisonMode::AbsoluteDifference));
 }
 
+TEST_F(JitReadWriteTupleTest, InputComparisonsOnValueAndDictionaryColumns) {
+  // Column a contains NULL, 123, 1234 and 12345. Only the first chunk is dictionary-encoded, so the comparisons are
+  // evaluated on ValueIDs for the first and on values for the second chunk.
+  auto input_table = load_table("src/test/tables/int_float_null_sorted_asc.tbl", 2);
+  ChunkEncoder::encode_chunks(input_table, {ChunkID{0}});
+
+  const auto column_values = std::vector<std::optional<int32_t>>{std::nullopt, 123, 1234, 12345};
+  const auto predicate_conditions = {PredicateCondition::Equals,      PredicateCondition::NotEquals,
+                                     PredicateCondition::LessThan,    PredicateCondition::LessThanEquals,
+                                     PredicateCondition::GreaterThan, PredicateCondition::GreaterThanEquals};
+
+  // The literals cover values in the dictionary of the first chunk, values in between and values outside of it
+  for (const auto literal : {0, 123, 1000, 1234, 20000}) {
+    for (const auto predicate_condition : predicate_conditions) {
+      auto read_tuples = std::make_shared<JitReadTuples>();
+      const auto result_value =
+          read_tuples->add_input_comparison(DataType::Int, true, ColumnID{0}, predicate_condition, literal);
+      auto sink = std::make_shared<MockComparisonSink>(result_value);
+      read_tuples->set_next_operator(sink);
+
+      JitRuntimeContext context;
+      read_tuples->before_query(*input_table, context);
+      for (const auto& chunk : input_table->chunks()) {
+        read_tuples->before_chunk(*input_table, *chunk, context);
+        read_tuples->execute(context);
+      }
+
+      auto expected_results = std::vector<std::optional<bool>>{};
+      for (const auto& column_value : column_values) {
+        if (!column_value) {
+          expected_results.emplace_back(std::nullopt);
+          continue;
+        }
+        with_comparator(predicate_condition,
+                        [&](auto comparator) { expected_results.emplace_back(comparator(*column_value, literal)); });
+      }
+
+      EXPECT_EQ(sink->results(), expected_results)
+          << predicate_condition_to_string.left.at(predicate_condition) << " " << literal;
+    }
+  }
+}
+
+TEST_F(JitReadWriteTupleTest, InputComparisonsOnReferenceColumns) {
+  // Column a contains NULL, 123, 1234 and 12345. Only the first chunk is dictionary-encoded. The first chunk of the
+  // reference table references only that chunk, so the comparisons are evaluated on its ValueIDs. The second chunk
+  // references both chunks and is evaluated on the values.
+  auto data_table = load_table("src/test/tables/int_float_null_sorted_asc.tbl", 2);
+  ChunkEncoder::encode_chunks(data_table, {ChunkID{0}});
+
+  auto input_table = std::make_shared<Table>(data_table->column_definitions(), TableType::References);
+  const auto single_chunk_pos_list = std::make_shared<PosList>(PosList{RowID{ChunkID{0}, 1}, RowID{ChunkID{0}, 0}});
+  const auto mixed_pos_list = std::make_shared<PosList>(PosList{RowID{ChunkID{1}, 1}, RowID{ChunkID{0}, 1}});
+  for (const auto& pos_list : {single_chunk_pos_list, mixed_pos_list}) {
+    input_table->append_chunk({std::make_shared<ReferenceColumn>(data_table, ColumnID{0}, pos_list),
+                               std::make_shared<ReferenceColumn>(data_table, ColumnID{1}, pos_list)});
+  }
+
+  const auto column_values = std::vector<std::optional<int32_t>>{123, std::nullopt, 12345, 123};
+  const auto predicate_conditions = {PredicateCondition::Equals,      PredicateCondition::NotEquals,
+                                     PredicateCondition::LessThan,    PredicateCondition::LessThanEquals,
+                                     PredicateCondition::GreaterThan, PredicateCondition::GreaterThanEquals};
+
+  for (const auto literal : {0, 123, 1000, 12345, 20000}) {
+    for (const auto predicate_condition : predicate_conditions) {
+      auto read_tuples = std::make_shared<JitReadTuples>();
+      const auto result_value =
+          read_tuples->add_input_comparison(DataType::Int, true, ColumnID{0}, predicate_condition, literal);
+      auto sink = std::make_shared<MockComparisonSink>(result_value);
+      read_tuples->set_next_operator(sink);
+
+      JitRuntimeContext context;
+      read_tuples->before_query(*input_table, context);
+      for (const auto& chunk : input_table->chunks()) {
+        read_tuples->before_chunk(*input_table, *chunk, context);
+        read_tuples->execute(context);
+      }
+
+      auto expected_results = std::vector<std::optional<bool>>{};
+      for (const auto& column_value : column_values) {
+        if (!column_value) {
+          expected_results.emplace_back(std::nullopt);
+          continue;
+        }
+        with_comparator(predicate_condition,
+                        [&](auto comparator) { expected_results.emplace_back(comparator(*column_value, literal)); });
+      }
+
+      EXPECT_EQ(sink->results(), expected_results)
+          << predicate_condition_to_string.left.at(predicate_condition) << " " << literal;
+    }
+  }
+}
+
 }  // namespace opossum
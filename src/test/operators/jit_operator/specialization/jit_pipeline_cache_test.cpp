@@ -0,0 +1,82 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../../../base_test.hpp"
+#include "operators/jit_operator/operators/jit_compute.hpp"
+#include "operators/jit_operator/operators/jit_expression.hpp"
+#include "operators/jit_operator/operators/jit_read_tuples.hpp"
+#include "operators/jit_operator/operators/jit_write_tuples.hpp"
+#include "operators/jit_operator/specialization/jit_pipeline_cache.hpp"
+#include "operators/jit_operator_wrapper.hpp"
+#include "operators/table_wrapper.hpp"
+
+namespace opossum {
+
+class JitPipelineCacheTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _int_table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/10_ints.tbl", 5));
+    _int_table_wrapper->execute();
+    JitPipelineCache::get().clear();
+  }
+
+  // Creates the operators for SELECT a + <literal> FROM ...
+  std::vector<std::shared_ptr<AbstractJittable>> add_literal_operators(
+      const AllTypeVariant& literal, const DataType column_data_type = DataType::Int) {
+    auto read_operator = std::make_shared<JitReadTuples>();
+    const auto column_expression =
+        std::make_shared<JitExpression>(read_operator->add_input_column(column_data_type, false, ColumnID{0}));
+    const auto literal_expression = std::make_shared<JitExpression>(read_operator->add_literal_value(literal));
+    const auto expression = std::make_shared<JitExpression>(column_expression, JitExpressionType::Addition,
+                                                            literal_expression, read_operator->add_temporary_value());
+
+    auto write_operator = std::make_shared<JitWriteTuples>();
+    write_operator->add_output_column("a+literal", expression->result());
+
+    return {read_operator, std::make_shared<JitCompute>(expression), write_operator};
+  }
+
+  std::shared_ptr<TableWrapper> _int_table_wrapper;
+};
+
+TEST_F(JitPipelineCacheTest, FingerprintIgnoresLiteralValues) {
+  const auto fingerprint = JitPipelineCache::fingerprint(add_literal_operators(1));
+
+  EXPECT_EQ(JitPipelineCache::fingerprint(add_literal_operators(2)), fingerprint);
+  EXPECT_NE(JitPipelineCache::fingerprint(add_literal_operators(int64_t{1})), fingerprint);
+  EXPECT_NE(JitPipelineCache::fingerprint(add_literal_operators(1, DataType::Long)), fingerprint);
+}
+
+TEST_F(JitPipelineCacheTest, ReusesCompiledPipeline) {
+  auto& cache = JitPipelineCache::get();
+
+  const auto first_wrapper =
+      std::make_shared<JitOperatorWrapper>(_int_table_wrapper, JitExecutionMode::Compile, add_literal_operators(1));
+  first_wrapper->execute();
+  EXPECT_EQ(cache.miss_count(), 1u);
+  EXPECT_EQ(cache.hit_count(), 0u);
+  EXPECT_EQ(cache.size(), 1u);
+
+  // The second query uses the code compiled for the first one, but its own literal
+  const auto second_wrapper =
+      std::make_shared<JitOperatorWrapper>(_int_table_wrapper, JitExecutionMode::Compile, add_literal_operators(100));
+  second_wrapper->execute();
+  EXPECT_EQ(cache.miss_count(), 1u);
+  EXPECT_EQ(cache.hit_count(), 1u);
+
+  const auto first_result = first_wrapper->get_output();
+  const auto second_result = second_wrapper->get_output();
+  ASSERT_EQ(first_result->row_count(), second_result->row_count());
+  for (auto row_id = size_t{0}; row_id < first_result->row_count(); ++row_id) {
+    EXPECT_EQ(first_result->get_value<int32_t>(ColumnID{0}, row_id) + 99,
+              second_result->get_value<int32_t>(ColumnID{0}, row_id));
+  }
+
+  cache.clear();
+  EXPECT_EQ(cache.size(), 0u);
+  EXPECT_EQ(cache.hit_count(), 0u);
+  EXPECT_EQ(cache.saved_compile_time().count(), 0);
+}
+
+}  // namespace opossum
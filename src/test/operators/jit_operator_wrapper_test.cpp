@@ -6,8 +6,12 @@
 #include "operators/jit_operator/operators/jit_filter.hpp"
 #include "operators/jit_operator/operators/jit_read_tuples.hpp"
 #include "operators/jit_operator/operators/jit_write_tuples.hpp"
+#include "operators/jit_operator/specialization/jit_pipeline_cache.hpp"
 #include "operators/jit_operator_wrapper.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
 
 namespace opossum {
 
@@ -22,6 +26,20 @@ class JitOperatorWrapperTest : public BaseTest {
     _int_table_wrapper->execute();
   }
 
+  // Creates the operators for SELECT a+a FROM ...
+  std::vector<std::shared_ptr<AbstractJittable>> add_operators() {
+    auto read_operator = std::make_shared<JitReadTuples>();
+    const auto column_expression =
+        std::make_shared<JitExpression>(read_operator->add_input_column(DataType::Int, false, ColumnID{0}));
+    const auto expression = std::make_shared<JitExpression>(column_expression, JitExpressionType::Addition,
+                                                            column_expression, read_operator->add_temporary_value());
+
+    auto write_operator = std::make_shared<JitWriteTuples>();
+    write_operator->add_output_column("a+a", expression->result());
+
+    return {read_operator, std::make_shared<JitCompute>(expression), write_operator};
+  }
+
   std::shared_ptr<Table> _empty_table;
   std::shared_ptr<Table> _int_table;
   std::shared_ptr<TableWrapper> _empty_table_wrapper;
@@ -155,4 +173,68 @@ TEST_F(JitOperatorWrapperTest, JitOperatorsSpecializedWithMultipleInliningOfSame
   ASSERT_EQ(result->get_value<int>(ColumnID(0), 1), 48);
 }
 
+TEST_F(JitOperatorWrapperTest, AdaptiveModeCompilesAfterFirstChunk) {
+  JitPipelineCache::get().clear();
+
+  auto interpreting_wrapper =
+      std::make_shared<JitOperatorWrapper>(_int_table_wrapper, JitExecutionMode::Interpret, add_operators());
+  interpreting_wrapper->execute();
+
+  // Without a scheduler, the compile task is executed right after the first of the two chunks
+  auto adaptive_wrapper =
+      std::make_shared<JitOperatorWrapper>(_int_table_wrapper, JitExecutionMode::Adaptive, add_operators());
+  adaptive_wrapper->execute();
+  EXPECT_TABLE_EQ_ORDERED(adaptive_wrapper->get_output(), interpreting_wrapper->get_output());
+  EXPECT_EQ(JitPipelineCache::get().size(), 1u);
+  EXPECT_EQ(JitPipelineCache::get().miss_count(), 1u);
+
+  // A later execution uses the compiled pipeline from the start
+  auto second_adaptive_wrapper =
+      std::make_shared<JitOperatorWrapper>(_int_table_wrapper, JitExecutionMode::Adaptive, add_operators());
+  second_adaptive_wrapper->execute();
+  EXPECT_TABLE_EQ_ORDERED(second_adaptive_wrapper->get_output(), interpreting_wrapper->get_output());
+  EXPECT_EQ(JitPipelineCache::get().hit_count(), 1u);
+  EXPECT_EQ(JitPipelineCache::get().miss_count(), 1u);
+}
+
+TEST_F(JitOperatorWrapperTest, AdaptiveModeInterpretsSingleChunk) {
+  JitPipelineCache::get().clear();
+
+  auto table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/10_ints.tbl", 100));
+  table_wrapper->execute();
+
+  auto adaptive_wrapper =
+      std::make_shared<JitOperatorWrapper>(table_wrapper, JitExecutionMode::Adaptive, add_operators());
+  adaptive_wrapper->execute();
+  ASSERT_EQ(adaptive_wrapper->get_output()->row_count(), 10u);
+  EXPECT_EQ(adaptive_wrapper->get_output()->get_value<int>(ColumnID{0}, 1), 48);
+
+  // Nothing was left to be processed by compiled code, so the chain was not compiled
+  EXPECT_EQ(JitPipelineCache::get().size(), 0u);
+  EXPECT_EQ(JitPipelineCache::get().miss_count(), 0u);
+}
+
+TEST_F(JitOperatorWrapperTest, ProcessesChunksInParallelMorsels) {
+  auto table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/10_ints.tbl", 2));
+  table_wrapper->execute();
+
+  auto interpreting_wrapper =
+      std::make_shared<JitOperatorWrapper>(table_wrapper, JitExecutionMode::Interpret, add_operators());
+  interpreting_wrapper->execute();
+
+  // The five chunks are split into up to four morsels, whose output chunks are merged in the order of the input chunks
+  Topology::use_fake_numa_topology(4, 2);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  auto parallel_wrapper =
+      std::make_shared<JitOperatorWrapper>(table_wrapper, JitExecutionMode::Interpret, add_operators());
+  parallel_wrapper->execute();
+
+  CurrentScheduler::get()->finish();
+  CurrentScheduler::set(nullptr);
+
+  EXPECT_EQ(parallel_wrapper->get_output()->chunk_count(), ChunkID{5});
+  EXPECT_TABLE_EQ_ORDERED(parallel_wrapper->get_output(), interpreting_wrapper->get_output());
+}
+
 }  // namespace opossum
@@ -4,8 +4,11 @@
 #include "gtest/gtest.h"
 
 #include "operators/join_hash.hpp"
+#include "operators/join_hash/composite_key.hpp"
 #include "operators/join_hash/hash_traits.hpp"
+#include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "storage/reference_column.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -124,4 +127,232 @@ TEST_F(JoinHashTest, OperatorName) {
   EXPECT_EQ(join->name(), "JoinHash");
 }
 
+TEST_F(JoinHashTest, SplitsSkewedProbePartitions) {
+  // The build relation holds each key once. In the probe relation, a single heavy-hitter key makes up most of the rows.
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int}};
+  auto build_table = std::make_shared<Table>(column_definitions, TableType::Data, 10'000);
+  for (auto key = int32_t{0}; key < 16'000; ++key) {
+    build_table->append({key});
+  }
+  auto probe_table = std::make_shared<Table>(column_definitions, TableType::Data, 10'000);
+  for (auto row = int32_t{0}; row < 50'000; ++row) {
+    probe_table->append({row < 40'000 ? 7 : row % 16'000});
+  }
+
+  auto build_table_wrapper = std::make_shared<TableWrapper>(build_table);
+  build_table_wrapper->execute();
+  auto probe_table_wrapper = std::make_shared<TableWrapper>(probe_table);
+  probe_table_wrapper->execute();
+
+  // The radix bits are fixed, as skew is detected relative to the average size of the eight partitions
+  auto join = std::make_shared<JoinHash>(build_table_wrapper, probe_table_wrapper, JoinMode::Inner,
+                                         ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals,
+                                         std::vector<ColumnIDPair>{}, 3);
+  join->execute();
+
+  // Each probe row matches exactly one build row
+  const auto output_table = join->get_output();
+  EXPECT_EQ(output_table->row_count(), 50'000u);
+
+  // The partition of the heavy-hitter key has been probed in multiple ranges, each of which forms an output chunk
+  for (ChunkID chunk_id{0}; chunk_id < output_table->chunk_count(); ++chunk_id) {
+    EXPECT_LT(output_table->get_chunk(chunk_id)->size(), 40'000u);
+  }
+}
+
+TEST_F(JoinHashTest, ColumnsWithSamePosListsShareOutputPosList) {
+  auto table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/int_float.tbl", 2));
+  table_wrapper->execute();
+
+  // Both columns of the scan output reference the same pos list in each chunk
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, PredicateCondition::GreaterThanEquals, 0);
+  scan->execute();
+
+  auto join = std::make_shared<JoinHash>(scan, table_wrapper, JoinMode::Inner,
+                                         ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals);
+  join->execute();
+
+  const auto output_table = join->get_output();
+  EXPECT_EQ(output_table->row_count(), 3u);
+  for (ChunkID chunk_id{0}; chunk_id < output_table->chunk_count(); ++chunk_id) {
+    const auto& columns = output_table->get_chunk(chunk_id)->columns();
+    const auto column_a = std::dynamic_pointer_cast<const ReferenceColumn>(columns[0]);
+    const auto column_b = std::dynamic_pointer_cast<const ReferenceColumn>(columns[1]);
+    ASSERT_TRUE(column_a && column_b);
+    EXPECT_EQ(column_a->pos_list(), column_b->pos_list());
+  }
+}
+
+TEST_F(JoinHashTest, MultiPassPartitioningMatchesSinglePass) {
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int}};
+  auto build_table = std::make_shared<Table>(column_definitions, TableType::Data, 100);
+  for (auto key = int32_t{0}; key < 1'000; ++key) {
+    build_table->append({key});
+  }
+  auto probe_table = std::make_shared<Table>(column_definitions, TableType::Data, 100);
+  for (auto row = int32_t{0}; row < 3'000; ++row) {
+    probe_table->append({row % 1'500});
+  }
+
+  auto build_table_wrapper = std::make_shared<TableWrapper>(build_table);
+  build_table_wrapper->execute();
+  auto probe_table_wrapper = std::make_shared<TableWrapper>(probe_table);
+  probe_table_wrapper->execute();
+
+  // Without radix bits, there is a single partition. Twelve radix bits exceed the fan-out of a single pass.
+  auto single_partition_join =
+      std::make_shared<JoinHash>(build_table_wrapper, probe_table_wrapper, JoinMode::Inner,
+                                 ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals,
+                                 std::vector<ColumnIDPair>{}, 0);
+  single_partition_join->execute();
+  auto multi_pass_join =
+      std::make_shared<JoinHash>(build_table_wrapper, probe_table_wrapper, JoinMode::Inner,
+                                 ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals,
+                                 std::vector<ColumnIDPair>{}, 12);
+  multi_pass_join->execute();
+
+  EXPECT_EQ(single_partition_join->get_output()->row_count(), 2'000u);
+  EXPECT_TABLE_EQ_UNORDERED(multi_pass_join->get_output(), single_partition_join->get_output());
+}
+
+TEST_F(JoinHashTest, CompositeKeyJoin) {
+  // Joins on (w, d), which are an Int and a Long column on the right side
+  auto left_table = std::make_shared<Table>(
+      TableColumnDefinitions{{"w", DataType::Int}, {"d", DataType::Int}, {"name", DataType::String}}, TableType::Data,
+      2);
+  left_table->append({1, 1, "a"});
+  left_table->append({1, 2, "b"});
+  left_table->append({2, 1, "c"});
+  left_table->append({2, 2, "d"});
+  left_table->append({3, 1, "e"});
+  auto right_table = std::make_shared<Table>(
+      TableColumnDefinitions{{"w", DataType::Int}, {"d", DataType::Long, true}, {"x", DataType::Int}}, TableType::Data,
+      2);
+  right_table->append({1, int64_t{2}, 10});
+  right_table->append({2, int64_t{1}, 20});
+  right_table->append({2, int64_t{2}, 30});
+  right_table->append({2, int64_t{2}, 31});
+  right_table->append({3, NullValue{}, 40});
+  right_table->append({4, int64_t{1}, 50});
+
+  auto left_table_wrapper = std::make_shared<TableWrapper>(left_table);
+  left_table_wrapper->execute();
+  auto right_table_wrapper = std::make_shared<TableWrapper>(right_table);
+  right_table_wrapper->execute();
+
+  const auto additional_column_ids = std::vector<ColumnIDPair>{{ColumnID{1}, ColumnID{1}}};
+
+  // The columns of the right input are nullable in the expected result of the outer join
+  auto output_column_definitions = concatenated(left_table->column_definitions(), right_table->column_definitions());
+  for (auto& column_definition : output_column_definitions) column_definition.nullable = true;
+  auto expected_inner = std::make_shared<Table>(output_column_definitions, TableType::Data);
+  expected_inner->append({1, 2, "b", 1, int64_t{2}, 10});
+  expected_inner->append({2, 1, "c", 2, int64_t{1}, 20});
+  expected_inner->append({2, 2, "d", 2, int64_t{2}, 30});
+  expected_inner->append({2, 2, "d", 2, int64_t{2}, 31});
+
+  auto inner_join = std::make_shared<JoinHash>(left_table_wrapper, right_table_wrapper, JoinMode::Inner,
+                                               ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals,
+                                               additional_column_ids);
+  inner_join->execute();
+  EXPECT_TABLE_EQ_UNORDERED(inner_join->get_output(), expected_inner);
+
+  // Rows of the left input that match on w, but not on d, are not part of any match
+  auto expected_left = std::make_shared<Table>(output_column_definitions, TableType::Data);
+  expected_left->append({1, 1, "a", NullValue{}, NullValue{}, NullValue{}});
+  expected_left->append({1, 2, "b", 1, int64_t{2}, 10});
+  expected_left->append({2, 1, "c", 2, int64_t{1}, 20});
+  expected_left->append({2, 2, "d", 2, int64_t{2}, 30});
+  expected_left->append({2, 2, "d", 2, int64_t{2}, 31});
+  expected_left->append({3, 1, "e", NullValue{}, NullValue{}, NullValue{}});
+
+  auto left_join = std::make_shared<JoinHash>(left_table_wrapper, right_table_wrapper, JoinMode::Left,
+                                              ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals,
+                                              additional_column_ids);
+  left_join->execute();
+  EXPECT_TABLE_EQ_UNORDERED(left_join->get_output(), expected_left);
+}
+
+TEST_F(JoinHashTest, CompositeKeysArePackedIfTheyFit) {
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Long}, {"b", DataType::Long}};
+  auto left_table = std::make_shared<Table>(column_definitions, TableType::Data);
+  left_table->append({int64_t{1'000'000}, int64_t{0}});
+  left_table->append({int64_t{1'000'001}, int64_t{1} << 40});
+  auto right_table = std::make_shared<Table>(column_definitions, TableType::Data);
+  right_table->append({int64_t{1'000'001}, int64_t{1} << 40});
+
+  // a needs one bit, b needs 41 bits
+  const auto [left_keys, right_keys] = create_composite_key_tables(
+      left_table, right_table, {{ColumnID{0}, ColumnID{0}}, {ColumnID{1}, ColumnID{1}}});
+  EXPECT_EQ(left_keys->column_data_type(ColumnID{0}), DataType::Long);
+  EXPECT_EQ(left_keys->get_value<int64_t>(ColumnID{0}, 0u), 0);
+  EXPECT_EQ(left_keys->get_value<int64_t>(ColumnID{0}, 1u), (int64_t{1} << 41) + 1);
+  EXPECT_EQ(right_keys->get_value<int64_t>(ColumnID{0}, 0u), (int64_t{1} << 41) + 1);
+
+  // a needs 64 bits, so the keys don't fit into a Long anymore
+  left_table->append({std::numeric_limits<int64_t>::min(), int64_t{0}});
+  left_table->append({std::numeric_limits<int64_t>::max(), int64_t{0}});
+  const auto [left_serialized_keys, right_serialized_keys] = create_composite_key_tables(
+      left_table, right_table, {{ColumnID{0}, ColumnID{0}}, {ColumnID{1}, ColumnID{1}}});
+  EXPECT_EQ(left_serialized_keys->column_data_type(ColumnID{0}), DataType::String);
+  EXPECT_EQ(left_serialized_keys->get_value<std::string>(ColumnID{0}, 1u),
+            right_serialized_keys->get_value<std::string>(ColumnID{0}, 0u));
+  EXPECT_NE(left_serialized_keys->get_value<std::string>(ColumnID{0}, 0u),
+            right_serialized_keys->get_value<std::string>(ColumnID{0}, 0u));
+}
+
+TEST_F(JoinHashTest, CompositeKeysWithConstantColumnAfterSixtyFourBits) {
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Long}, {"b", DataType::Long, true}};
+  auto left_table = std::make_shared<Table>(column_definitions, TableType::Data);
+  left_table->append({int64_t{-1}, int64_t{5}});
+  left_table->append({std::numeric_limits<int64_t>::max(), int64_t{5}});
+  left_table->append({std::numeric_limits<int64_t>::max(), NullValue{}});
+  auto right_table = std::make_shared<Table>(column_definitions, TableType::Data);
+  right_table->append({std::numeric_limits<int64_t>::max(), int64_t{5}});
+
+  // a needs all 64 bits, b is constant and needs none
+  const auto [left_keys, right_keys] = create_composite_key_tables(
+      left_table, right_table, {{ColumnID{0}, ColumnID{0}}, {ColumnID{1}, ColumnID{1}}});
+  EXPECT_EQ(left_keys->column_data_type(ColumnID{0}), DataType::Long);
+  EXPECT_EQ(left_keys->get_value<int64_t>(ColumnID{0}, 0u), 0);
+  EXPECT_EQ(left_keys->get_value<int64_t>(ColumnID{0}, 1u), right_keys->get_value<int64_t>(ColumnID{0}, 0u));
+  EXPECT_TRUE(variant_is_null((*left_keys->get_chunk(ChunkID{0})->get_column(ColumnID{0}))[2]));
+}
+
+TEST_F(JoinHashTest, CompositeKeyJoinOnStringAndFloatColumns) {
+  auto left_table = std::make_shared<Table>(
+      TableColumnDefinitions{{"s", DataType::String}, {"f", DataType::Float}}, TableType::Data);
+  left_table->append({"ab", 1.5f});
+  left_table->append({"a", 1.5f});
+  left_table->append({"ab", 2.0f});
+  auto right_table = std::make_shared<Table>(
+      TableColumnDefinitions{{"s", DataType::String}, {"i", DataType::Int}, {"d", DataType::Double}},
+      TableType::Data);
+  right_table->append({"ab", 2, 2.0});
+  right_table->append({"a", 1, 1.5});
+  right_table->append({"b", 2, 2.0});
+
+  auto left_table_wrapper = std::make_shared<TableWrapper>(left_table);
+  left_table_wrapper->execute();
+  auto right_table_wrapper = std::make_shared<TableWrapper>(right_table);
+  right_table_wrapper->execute();
+
+  // s = s AND f = i AND f = d, where f is compared to i as a floating-point value
+  auto join = std::make_shared<JoinHash>(
+      left_table_wrapper, right_table_wrapper, JoinMode::Inner, ColumnIDPair(ColumnID{0}, ColumnID{0}),
+      PredicateCondition::Equals, std::vector<ColumnIDPair>{{ColumnID{1}, ColumnID{1}}, {ColumnID{1}, ColumnID{2}}});
+  join->execute();
+  EXPECT_EQ(join->get_output()->row_count(), 1u);
+
+  auto semi_join = std::make_shared<JoinHash>(left_table_wrapper, right_table_wrapper, JoinMode::Semi,
+                                              ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals,
+                                              std::vector<ColumnIDPair>{{ColumnID{1}, ColumnID{2}}});
+  semi_join->execute();
+
+  auto expected_semi = std::make_shared<Table>(left_table->column_definitions(), TableType::Data);
+  expected_semi->append({"a", 1.5f});
+  expected_semi->append({"ab", 2.0f});
+  EXPECT_TABLE_EQ_UNORDERED(semi_join->get_output(), expected_semi);
+}
+
 }  // namespace opossum
@@ -13,6 +13,9 @@
 #include "operators/projection.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
@@ -130,4 +133,44 @@ TEST_F(OperatorsProjectionTest, SetParameters) {
   EXPECT_EQ(*parameter_expression->value(), AllTypeVariant{13});
 }
 
+TEST_F(OperatorsProjectionTest, ProjectsChunksInParallel) {
+  auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}}, TableType::Data, 100);
+  for (auto value = int32_t{0}; value < 1'000; ++value) {
+    table->append({value});
+  }
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto a = PQPColumnExpression::from_table(*table, "a");
+
+  Topology::use_fake_numa_topology(4, 2);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  // (a + 1) is a common subexpression of both expressions
+  const auto projection = std::make_shared<Projection>(
+      table_wrapper, expression_vector(add_(a, 1), mul_(add_(a, 1), add_(a, 1))));
+  projection->execute();
+
+  // Projections that only forward columns are performed without jobs
+  const auto forwarding_projection = std::make_shared<Projection>(table_wrapper, expression_vector(a));
+  forwarding_projection->execute();
+
+  CurrentScheduler::get()->finish();
+  CurrentScheduler::set(nullptr);
+
+  ASSERT_EQ(forwarding_projection->get_output()->chunk_count(), 10u);
+  for (auto chunk_id = ChunkID{0}; chunk_id < 10u; ++chunk_id) {
+    EXPECT_EQ(forwarding_projection->get_output()->get_chunk(chunk_id)->get_column(ColumnID{0}),
+              table->get_chunk(chunk_id)->get_column(ColumnID{0}));
+  }
+
+  // The output chunks are in the order of the input chunks
+  const auto output_table = projection->get_output();
+  ASSERT_EQ(output_table->chunk_count(), 10u);
+  for (auto row = int32_t{0}; row < 1'000; ++row) {
+    EXPECT_EQ(output_table->get_value<int32_t>(ColumnID{0}, row), row + 1);
+    EXPECT_EQ(output_table->get_value<int32_t>(ColumnID{1}, row), (row + 1) * (row + 1));
+  }
+}
+
 }  // namespace opossum
@@ -0,0 +1,92 @@
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "optimizer/join_ordering/enumerate_ccp.hpp"
+
+namespace opossum {
+
+class EnumerateCcpTest : public ::testing::Test {
+ protected:
+  static JoinGraphVertexSet vertex_set(const size_t num_vertices, const unsigned long value) {  // NOLINT
+    return JoinGraphVertexSet{num_vertices, value};
+  }
+
+  /**
+   * Checks that each csg-cmp-pair is disjoint, is emitted only once and that its components were emitted as a result
+   * of previous pairs (or are single vertices), i.e. that the order of the pairs is suitable for dynamic programming
+   */
+  static void check_pairs(const size_t num_vertices,
+                          const std::vector<std::pair<JoinGraphVertexSet, JoinGraphVertexSet>>& pairs) {
+    auto available_sets = std::set<JoinGraphVertexSet>{};
+    for (auto vertex_idx = size_t{0}; vertex_idx < num_vertices; ++vertex_idx) {
+      auto single_vertex_set = JoinGraphVertexSet{num_vertices};
+      single_vertex_set.set(vertex_idx);
+      available_sets.emplace(single_vertex_set);
+    }
+
+    auto emitted_pairs = std::set<std::pair<JoinGraphVertexSet, JoinGraphVertexSet>>{};
+
+    for (const auto& pair : pairs) {
+      EXPECT_FALSE(pair.first.intersects(pair.second));
+      EXPECT_TRUE(available_sets.count(pair.first));
+      EXPECT_TRUE(available_sets.count(pair.second));
+      EXPECT_TRUE(emitted_pairs.emplace(pair).second);
+      EXPECT_FALSE(emitted_pairs.count({pair.second, pair.first}));
+      available_sets.emplace(pair.first | pair.second);
+    }
+  }
+};
+
+TEST_F(EnumerateCcpTest, Chain) {
+  // 0 - 1 - 2
+  const auto pairs = EnumerateCcp{3, {{0, 1}, {1, 2}}}();
+
+  ASSERT_EQ(pairs.size(), 4u);
+  EXPECT_EQ(pairs[0], std::make_pair(vertex_set(3, 0b010), vertex_set(3, 0b100)));
+  EXPECT_EQ(pairs[1], std::make_pair(vertex_set(3, 0b001), vertex_set(3, 0b010)));
+  EXPECT_EQ(pairs[2], std::make_pair(vertex_set(3, 0b001), vertex_set(3, 0b110)));
+  EXPECT_EQ(pairs[3], std::make_pair(vertex_set(3, 0b011), vertex_set(3, 0b100)));
+}
+
+TEST_F(EnumerateCcpTest, NumberOfPairs) {
+  // The number of csg-cmp-pairs for chains, stars, cycles and cliques is known, see Moerkotte and Neumann, 2006
+
+  // Chain: (n^3 - n) / 6
+  const auto chain = EnumerateCcp{5, {{3, 1}, {1, 4}, {4, 0}, {0, 2}}}();
+  EXPECT_EQ(chain.size(), 20u);
+  check_pairs(5, chain);
+
+  // Star: (n - 1) * 2^(n - 2)
+  const auto star = EnumerateCcp{5, {{2, 0}, {2, 1}, {2, 3}, {2, 4}}}();
+  EXPECT_EQ(star.size(), 32u);
+  check_pairs(5, star);
+
+  // Cycle: (n^3 - 2n^2 + n) / 2
+  const auto cycle = EnumerateCcp{5, {{0, 1}, {1, 2}, {2, 3}, {3, 4}, {4, 0}}}();
+  EXPECT_EQ(cycle.size(), 40u);
+  check_pairs(5, cycle);
+
+  // Clique: (3^n - 2^(n+1) + 1) / 2
+  auto clique_edges = std::vector<std::pair<size_t, size_t>>{};
+  for (auto vertex_a = size_t{0}; vertex_a < 6; ++vertex_a) {
+    for (auto vertex_b = vertex_a + 1; vertex_b < 6; ++vertex_b) {
+      clique_edges.emplace_back(vertex_a, vertex_b);
+    }
+  }
+  const auto clique = EnumerateCcp{6, clique_edges}();
+  EXPECT_EQ(clique.size(), 301u);
+  check_pairs(6, clique);
+}
+
+TEST_F(EnumerateCcpTest, CycleWithChord) {
+  // 0 - 1 - 2 - 3 - 0 with a chord 0 - 2
+  const auto pairs = EnumerateCcp{4, {{0, 1}, {1, 2}, {2, 3}, {3, 0}, {0, 2}}}();
+
+  EXPECT_EQ(pairs.size(), 21u);
+  check_pairs(4, pairs);
+}
+
+}  // namespace opossum
@@ -0,0 +1,130 @@
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "optimizer/join_ordering/join_graph.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class JoinGraphTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    node_a = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "a"}});
+    node_b = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "b"}});
+    node_c = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "c"}});
+
+    a = node_a->get_column("a");
+    b = node_b->get_column("b");
+    c = node_c->get_column("c");
+  }
+
+  static JoinGraphVertexSet vertex_set(const size_t num_vertices, const unsigned long value) {  // NOLINT
+    return JoinGraphVertexSet{num_vertices, value};
+  }
+
+  std::shared_ptr<MockNode> node_a, node_b, node_c;
+  LQPColumnReference a, b, c;
+};
+
+TEST_F(JoinGraphTest, FromLQP) {
+  // clang-format off
+  const auto lqp =
+  PredicateNode::make(greater_than_(a, 5),
+    PredicateNode::make(and_(equals_(add_(a, b), c), less_than_(b, 3)),
+      JoinNode::make(JoinMode::Inner, equals_(a, b),
+        node_a,
+        JoinNode::make(JoinMode::Cross,
+          node_b,
+          node_c))));
+  // clang-format on
+
+  const auto join_graph = JoinGraph::from_lqp(lqp);
+  ASSERT_TRUE(join_graph);
+
+  ASSERT_EQ(join_graph->vertices.size(), 3u);
+  EXPECT_EQ(join_graph->vertices.at(0), node_a);
+  EXPECT_EQ(join_graph->vertices.at(1), node_b);
+  EXPECT_EQ(join_graph->vertices.at(2), node_c);
+
+  ASSERT_EQ(join_graph->edges.size(), 4u);
+  EXPECT_EQ(join_graph->edges.at(0).vertex_set, vertex_set(3, 0b001));
+  ASSERT_EQ(join_graph->edges.at(0).predicates.size(), 1u);
+  EXPECT_EQ(*join_graph->edges.at(0).predicates.at(0), *greater_than_(a, 5));
+  EXPECT_EQ(join_graph->edges.at(1).vertex_set, vertex_set(3, 0b111));
+  ASSERT_EQ(join_graph->edges.at(1).predicates.size(), 1u);
+  EXPECT_EQ(*join_graph->edges.at(1).predicates.at(0), *equals_(add_(a, b), c));
+  EXPECT_EQ(join_graph->edges.at(2).vertex_set, vertex_set(3, 0b010));
+  ASSERT_EQ(join_graph->edges.at(2).predicates.size(), 1u);
+  EXPECT_EQ(*join_graph->edges.at(2).predicates.at(0), *less_than_(b, 3));
+  EXPECT_EQ(join_graph->edges.at(3).vertex_set, vertex_set(3, 0b011));
+  ASSERT_EQ(join_graph->edges.at(3).predicates.size(), 1u);
+  EXPECT_EQ(*join_graph->edges.at(3).predicates.at(0), *equals_(a, b));
+}
+
+TEST_F(JoinGraphTest, OuterJoinsAreVertices) {
+  // clang-format off
+  const auto outer_join_node = JoinNode::make(JoinMode::Left, equals_(b, c), node_b, node_c);
+  const auto lqp =
+  JoinNode::make(JoinMode::Inner, equals_(a, b),
+    node_a,
+    outer_join_node);
+  // clang-format on
+
+  const auto join_graph = JoinGraph::from_lqp(lqp);
+  ASSERT_TRUE(join_graph);
+
+  ASSERT_EQ(join_graph->vertices.size(), 2u);
+  EXPECT_EQ(join_graph->vertices.at(0), node_a);
+  EXPECT_EQ(join_graph->vertices.at(1), outer_join_node);
+
+  ASSERT_EQ(join_graph->edges.size(), 1u);
+  EXPECT_EQ(join_graph->edges.at(0).vertex_set, vertex_set(2, 0b11));
+
+  // A single outer join is no JoinGraph
+  EXPECT_FALSE(JoinGraph::from_lqp(outer_join_node));
+}
+
+TEST_F(JoinGraphTest, NoJoinGraph) {
+  EXPECT_FALSE(JoinGraph::from_lqp(node_a));
+  EXPECT_FALSE(JoinGraph::from_lqp(PredicateNode::make(greater_than_(a, 5), node_a)));
+}
+
+TEST_F(JoinGraphTest, FindPredicates) {
+  // clang-format off
+  const auto lqp =
+  PredicateNode::make(greater_than_(a, 5),
+    PredicateNode::make(equals_(b, c),
+      JoinNode::make(JoinMode::Inner, equals_(a, b),
+        node_a,
+        JoinNode::make(JoinMode::Cross,
+          node_b,
+          node_c))));
+  // clang-format on
+
+  const auto join_graph = JoinGraph::from_lqp(lqp);
+  ASSERT_TRUE(join_graph);
+
+  const auto local_predicates_a = join_graph->find_local_predicates(0);
+  ASSERT_EQ(local_predicates_a.size(), 1u);
+  EXPECT_EQ(*local_predicates_a.at(0), *greater_than_(a, 5));
+  EXPECT_TRUE(join_graph->find_local_predicates(1).empty());
+
+  const auto join_predicates_a_bc = join_graph->find_join_predicates(vertex_set(3, 0b001), vertex_set(3, 0b110));
+  ASSERT_EQ(join_predicates_a_bc.size(), 1u);
+  EXPECT_EQ(*join_predicates_a_bc.at(0), *equals_(a, b));
+
+  const auto join_predicates_ab_c = join_graph->find_join_predicates(vertex_set(3, 0b011), vertex_set(3, 0b100));
+  ASSERT_EQ(join_predicates_ab_c.size(), 1u);
+  EXPECT_EQ(*join_predicates_ab_c.at(0), *equals_(b, c));
+
+  EXPECT_TRUE(join_graph->find_join_predicates(vertex_set(3, 0b001), vertex_set(3, 0b100)).empty());
+}
+
+}  // namespace opossum
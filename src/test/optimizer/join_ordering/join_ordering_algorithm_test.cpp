@@ -0,0 +1,126 @@
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "cost_model/cost_model_logical.hpp"
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "optimizer/join_ordering/dp_ccp.hpp"
+#include "optimizer/join_ordering/greedy_operator_ordering.hpp"
+#include "optimizer/join_ordering/join_graph.hpp"
+#include "statistics/column_statistics.hpp"
+#include "statistics/table_statistics.hpp"
+#include "testing_assert.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+template <typename JoinOrderingAlgorithm>
+class JoinOrderingAlgorithmTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    cost_model = std::make_shared<CostModelLogical>();
+
+    /**
+     * Joining a and b first yields only a few rows, while joining b and c first produces a huge intermediate result
+     */
+    node_a = MockNode::make(std::make_shared<TableStatistics>(
+        TableType::Data, 10,
+        std::vector<std::shared_ptr<const BaseColumnStatistics>>{
+            std::make_shared<ColumnStatistics<int32_t>>(0.0f, 10, 0, 9)}));
+    node_b = MockNode::make(std::make_shared<TableStatistics>(
+        TableType::Data, 10'000,
+        std::vector<std::shared_ptr<const BaseColumnStatistics>>{
+            std::make_shared<ColumnStatistics<int32_t>>(0.0f, 10'000, 0, 9'999),
+            std::make_shared<ColumnStatistics<int32_t>>(0.0f, 100, 0, 99)}));
+    node_c = MockNode::make(std::make_shared<TableStatistics>(
+        TableType::Data, 10'000,
+        std::vector<std::shared_ptr<const BaseColumnStatistics>>{
+            std::make_shared<ColumnStatistics<int32_t>>(0.0f, 100, 0, 99)}));
+    node_d = MockNode::make(std::make_shared<TableStatistics>(
+        TableType::Data, 5,
+        std::vector<std::shared_ptr<const BaseColumnStatistics>>{
+            std::make_shared<ColumnStatistics<int32_t>>(0.0f, 5, 0, 4)}));
+
+    a = LQPColumnReference{node_a, ColumnID{0}};
+    b1 = LQPColumnReference{node_b, ColumnID{0}};
+    b2 = LQPColumnReference{node_b, ColumnID{1}};
+    c = LQPColumnReference{node_c, ColumnID{0}};
+    d = LQPColumnReference{node_d, ColumnID{0}};
+  }
+
+  static JoinGraphVertexSet vertex_set(const size_t num_vertices, const unsigned long value) {  // NOLINT
+    return JoinGraphVertexSet{num_vertices, value};
+  }
+
+  std::shared_ptr<CostModelLogical> cost_model;
+  std::shared_ptr<MockNode> node_a, node_b, node_c, node_d;
+  LQPColumnReference a, b1, b2, c, d;
+};
+
+using JoinOrderingAlgorithmTypes = ::testing::Types<DpCcp, GreedyOperatorOrdering>;
+TYPED_TEST_CASE(JoinOrderingAlgorithmTest, JoinOrderingAlgorithmTypes);
+
+TYPED_TEST(JoinOrderingAlgorithmTest, ChainJoinsSmallIntermediateResultFirst) {
+  const auto join_graph = JoinGraph{{this->node_a, this->node_b, this->node_c},
+                                    {JoinGraphEdge{this->vertex_set(3, 0b011), {equals_(this->a, this->b1)}},
+                                     JoinGraphEdge{this->vertex_set(3, 0b110), {equals_(this->b2, this->c)}}}};
+
+  const auto actual_lqp = TypeParam{this->cost_model}(join_graph);
+
+  // clang-format off
+  const auto expected_lqp =
+  JoinNode::make(JoinMode::Inner, equals_(this->b2, this->c),
+    JoinNode::make(JoinMode::Inner, equals_(this->a, this->b1),
+      this->node_a,
+      this->node_b),
+    this->node_c);
+  // clang-format on
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TYPED_TEST(JoinOrderingAlgorithmTest, LocalAndComplexPredicates) {
+  const auto join_graph = JoinGraph{{this->node_a, this->node_b},
+                                    {JoinGraphEdge{this->vertex_set(2, 0b01), {greater_than_(this->a, 5)}},
+                                     JoinGraphEdge{this->vertex_set(2, 0b11),
+                                                   {equals_(add_(this->a, this->b2), 3), equals_(this->a, this->b1)}}}};
+
+  const auto actual_lqp = TypeParam{this->cost_model}(join_graph);
+
+  // The equi-predicate becomes the join predicate, the complex predicate is placed on top
+  // clang-format off
+  const auto expected_lqp =
+  PredicateNode::make(equals_(add_(this->a, this->b2), 3),
+    JoinNode::make(JoinMode::Inner, equals_(this->a, this->b1),
+      PredicateNode::make(greater_than_(this->a, 5),
+        this->node_a),
+      this->node_b));
+  // clang-format on
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TYPED_TEST(JoinOrderingAlgorithmTest, DisconnectedGraphUsesCrossJoin) {
+  const auto join_graph = JoinGraph{{this->node_a, this->node_b, this->node_d},
+                                    {JoinGraphEdge{this->vertex_set(3, 0b011), {equals_(this->a, this->b1)}}}};
+
+  const auto actual_lqp = TypeParam{this->cost_model}(join_graph);
+
+  // clang-format off
+  const auto expected_lqp =
+  JoinNode::make(JoinMode::Cross,
+    JoinNode::make(JoinMode::Inner, equals_(this->a, this->b1),
+      this->node_a,
+      this->node_b),
+    this->node_d);
+  // clang-format on
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+}  // namespace opossum
@@ -6,6 +6,7 @@
 
 #include "gtest/gtest.h"
 
+#include "cost_model/cost_model_logical.hpp"
 #include "expression/aggregate_expression.hpp"
 #include "expression/arithmetic_expression.hpp"
 #include "expression/expression_functional.hpp"
@@ -24,10 +25,13 @@
 #include "logical_query_plan/sort_node.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
 #include "logical_query_plan/union_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
 #include "operators/aggregate.hpp"
 #include "operators/get_table.hpp"
 #include "operators/index_scan.hpp"
 #include "operators/join_hash.hpp"
+#include "operators/join_index.hpp"
+#include "operators/join_mpsm.hpp"
 #include "operators/join_sort_merge.hpp"
 #include "operators/limit.hpp"
 #include "operators/maintenance/show_columns.hpp"
@@ -37,6 +41,10 @@
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/union_positions.hpp"
+#include "operators/validate.hpp"
+#include "scheduler/topology.hpp"
+#include "statistics/column_statistics.hpp"
+#include "statistics/table_statistics.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
 #include "storage/storage_manager.hpp"
@@ -525,6 +533,146 @@ TEST_F(LQPTranslatorTest, PredicateNodeBinaryIndexScan) {
   EXPECT_EQ(table_scan_op2->right_parameter(), AllParameterVariant(42));
 }
 
+TEST_F(LQPTranslatorTest, PredicateNodeIndexOnlyScan) {
+  /**
+   * Build LQP and translate to PQP
+   */
+  const auto stored_table_node = StoredTableNode::make("int_float_chunked");
+  const auto b = stored_table_node->get_column("b");
+
+  const auto table = StorageManager::get().get_table("int_float_chunked");
+  const auto index_column_ids = std::vector<ColumnID>{ColumnID{1}};
+  table->get_chunk(ChunkID{0})->create_index<GroupKeyIndex>(index_column_ids);
+  table->get_chunk(ChunkID{2})->create_index<GroupKeyIndex>(index_column_ids);
+
+  const auto projection_node = ProjectionNode::make(expression_vector(b), stored_table_node);
+  const auto predicate_node = PredicateNode::make(greater_than_(b, 42), projection_node);
+  predicate_node->scan_type = ScanType::IndexOnlyScan;
+
+  /**
+   * Check PQP
+   */
+  // Chunk 1 has no index, so the column is scanned after projecting it
+  const auto table_scan_op = std::dynamic_pointer_cast<TableScan>(LQPTranslator{}.translate_node(predicate_node));
+  ASSERT_TRUE(table_scan_op);
+  EXPECT_EQ(table_scan_op->left_column_id(), ColumnID{0});
+  EXPECT_EQ(table_scan_op->input_left()->type(), OperatorType::Projection);
+
+  table->get_chunk(ChunkID{1})->create_index<GroupKeyIndex>(index_column_ids);
+
+  const auto index_scan_op = std::dynamic_pointer_cast<IndexScan>(LQPTranslator{}.translate_node(predicate_node));
+  ASSERT_TRUE(index_scan_op);
+  EXPECT_TRUE(index_scan_op->is_index_only());
+  EXPECT_EQ(index_scan_op->input_left()->type(), OperatorType::GetTable);
+}
+
+TEST_F(LQPTranslatorTest, PredicateNodeIndexOnlyScanWithValueOnTheLeftAndBetween) {
+  const auto stored_table_node = StoredTableNode::make("int_float_chunked");
+  const auto b = stored_table_node->get_column("b");
+
+  const auto table = StorageManager::get().get_table("int_float_chunked");
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    table->get_chunk(chunk_id)->create_index<GroupKeyIndex>(std::vector<ColumnID>{ColumnID{1}});
+  }
+
+  const auto execute_index_only_scan = [&](const std::shared_ptr<AbstractExpression>& predicate) {
+    const auto projection_node = ProjectionNode::make(expression_vector(b), stored_table_node);
+    const auto predicate_node = PredicateNode::make(predicate, projection_node);
+    predicate_node->scan_type = ScanType::IndexOnlyScan;
+
+    const auto index_scan_op = std::dynamic_pointer_cast<IndexScan>(LQPTranslator{}.translate_node(predicate_node));
+    EXPECT_TRUE(index_scan_op && index_scan_op->is_index_only());
+    if (!index_scan_op) return std::shared_ptr<const Table>{};
+
+    std::const_pointer_cast<AbstractOperator>(index_scan_op->input_left())->execute();
+    index_scan_op->execute();
+    return index_scan_op->get_output();
+  };
+
+  // The values of b are 458.7, 456.7, and 457.7. `457 < b` is executed as `b > 457`.
+  const auto flipped_output = execute_index_only_scan(less_than_(457.0f, b));
+  ASSERT_TRUE(flipped_output);
+  EXPECT_EQ(flipped_output->row_count(), 2u);
+
+  const auto between_output = execute_index_only_scan(between(b, 457.0f, 458.0f));
+  ASSERT_TRUE(between_output);
+  ASSERT_EQ(between_output->row_count(), 1u);
+  EXPECT_FLOAT_EQ(between_output->get_value<float>(ColumnID{0}, 0), 457.7f);
+}
+
+TEST_F(LQPTranslatorTest, PredicateNodePrimaryKeyIndexScanOnPrunedTable) {
+  /**
+   * Build LQP and translate to PQP
+   */
+  // One row per chunk: 12345 | 123 | 1234
+  const auto table = StorageManager::get().get_table("int_float_chunked");
+  table->create_primary_key_index({ColumnID{0}});
+
+  const auto stored_table_node = StoredTableNode::make("int_float_chunked");
+  stored_table_node->set_excluded_chunk_ids({ChunkID{0}});
+  const auto a = stored_table_node->get_column("a");
+
+  const auto predicate_node = PredicateNode::make(equals_(a, 1234), stored_table_node);
+  predicate_node->scan_type = ScanType::IndexScan;
+  const auto op = LQPTranslator{}.translate_node(predicate_node);
+
+  /**
+   * Check PQP
+   */
+  // The PrimaryKeyIndex is only available on the unpruned table
+  const auto index_scan_op = std::dynamic_pointer_cast<IndexScan>(op);
+  ASSERT_TRUE(index_scan_op);
+  ASSERT_EQ(index_scan_op->input_left()->type(), OperatorType::GetTable);
+
+  index_scan_op->mutable_input_left()->execute();
+  index_scan_op->execute();
+  const auto& output = index_scan_op->get_output();
+  ASSERT_EQ(output->row_count(), 1u);
+  EXPECT_EQ(output->get_value<int32_t>(ColumnID{0}, 0u), 1234);
+
+  // Rows in pruned chunks are dropped
+  const auto pruned_predicate_node = PredicateNode::make(equals_(a, 12345), stored_table_node);
+  pruned_predicate_node->scan_type = ScanType::IndexScan;
+  const auto pruned_op = LQPTranslator{}.translate_node(pruned_predicate_node);
+  pruned_op->mutable_input_left()->execute();
+  pruned_op->execute();
+  EXPECT_EQ(pruned_op->get_output()->row_count(), 0u);
+}
+
+TEST_F(LQPTranslatorTest, PredicateNodesCompositePrimaryKeyIndexScan) {
+  /**
+   * Build LQP and translate to PQP
+   */
+  const auto table = load_table("src/test/tables/int_int_int.tbl", 2);
+  table->create_primary_key_index({ColumnID{0}, ColumnID{2}});
+  StorageManager::get().add_table("int_int_int", table);
+
+  const auto stored_table_node = StoredTableNode::make("int_int_int");
+  const auto a = stored_table_node->get_column("a");
+  const auto c = stored_table_node->get_column("c");
+
+  // The chain of key PredicateNodes as created by the IndexScanRule, in a different order than the key columns
+  const auto predicate_node_c = PredicateNode::make(equals_(c, 11), stored_table_node);
+  const auto predicate_node_a = PredicateNode::make(equals_(11, a), predicate_node_c);
+  predicate_node_a->scan_type = ScanType::IndexScan;
+  const auto op = LQPTranslator{}.translate_node(predicate_node_a);
+
+  /**
+   * Check PQP
+   */
+  // Both PredicateNodes are translated into a single lookup
+  const auto index_scan_op = std::dynamic_pointer_cast<IndexScan>(op);
+  ASSERT_TRUE(index_scan_op);
+  EXPECT_EQ(index_scan_op->input_left()->type(), OperatorType::GetTable);
+
+  index_scan_op->mutable_input_left()->execute();
+  index_scan_op->execute();
+  const auto& output = index_scan_op->get_output();
+  ASSERT_EQ(output->row_count(), 1u);
+  EXPECT_EQ(output->get_value<int32_t>(ColumnID{0}, 0u), 11);
+  EXPECT_EQ(output->get_value<int32_t>(ColumnID{2}, 0u), 11);
+}
+
 TEST_F(LQPTranslatorTest, PredicateNodeIndexScanFailsWhenNotApplicable) {
   if (!IS_DEBUG) return;
   /**
@@ -581,6 +729,141 @@ TEST_F(LQPTranslatorTest, JoinNode) {
   EXPECT_EQ(join_op->mode(), JoinMode::Outer);
 }
 
+TEST_F(LQPTranslatorTest, PredicatesAboveHashJoinBecomeJoinColumns) {
+  /**
+   * The equality predicate between both join inputs is executed by the JoinHash, the other one by a TableScan
+   */
+  // clang-format off
+  const auto lqp =
+  PredicateNode::make(greater_than_(int_float_b, int_float2_b),
+    PredicateNode::make(equals_(int_float2_b, int_float_b),
+      JoinNode::make(JoinMode::Inner, equals_(int_float_a, int_float2_a),
+        int_float_node,
+        int_float2_node)));
+  // clang-format on
+
+  const auto op = LQPTranslator{}.translate_node(lqp);
+
+  const auto table_scan_op = std::dynamic_pointer_cast<const TableScan>(op);
+  ASSERT_TRUE(table_scan_op);
+  EXPECT_EQ(table_scan_op->predicate_condition(), PredicateCondition::GreaterThan);
+
+  const auto join_op = std::dynamic_pointer_cast<const JoinHash>(table_scan_op->input_left());
+  ASSERT_TRUE(join_op);
+  EXPECT_EQ(join_op->column_ids(), ColumnIDPair(ColumnID{0}, ColumnID{0}));
+  EXPECT_EQ(join_op->additional_column_ids(), std::vector<ColumnIDPair>({{ColumnID{1}, ColumnID{1}}}));
+  EXPECT_TRUE(std::dynamic_pointer_cast<const GetTable>(join_op->input_left()));
+  EXPECT_TRUE(std::dynamic_pointer_cast<const GetTable>(join_op->input_right()));
+}
+
+TEST_F(LQPTranslatorTest, JoinNodeWithCostModel) {
+  /**
+   * Without an index, JoinHash is the cheapest join operator for equi joins, JoinSortMerge is the only one for other
+   * joins
+   */
+  const auto translator = LQPTranslator{std::make_shared<CostModelLogical>()};
+
+  const auto equi_join_node =
+      JoinNode::make(JoinMode::Inner, equals_(int_float_a, int_float2_a), int_float_node, int_float2_node);
+  const auto equi_join_op = translator.translate_node(equi_join_node);
+  EXPECT_TRUE(std::dynamic_pointer_cast<JoinHash>(equi_join_op));
+
+  const auto non_equi_join_node =
+      JoinNode::make(JoinMode::Inner, less_than_(int_float_a, int_float2_a), int_float_node, int_float2_node);
+  const auto non_equi_join_op = translator.translate_node(non_equi_join_node);
+  EXPECT_TRUE(std::dynamic_pointer_cast<JoinSortMerge>(non_equi_join_op));
+}
+
+TEST_F(LQPTranslatorTest, JoinNodeWithCostModelUsesIndex) {
+  /**
+   * The right input is large and has an index on the join column in every chunk, so looking up the few rows of the
+   * left input in the index is cheaper than hashing the right input
+   */
+  const auto table = StorageManager::get().get_table("int_float_chunked");
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    table->get_chunk(chunk_id)->create_index<GroupKeyIndex>(std::vector<ColumnID>{ColumnID{0}});
+  }
+  table->set_table_statistics(std::make_shared<TableStatistics>(
+      TableType::Data, 10'000,
+      std::vector<std::shared_ptr<const BaseColumnStatistics>>{
+          std::make_shared<ColumnStatistics<int32_t>>(0.0f, 10'000, 0, 9'999),
+          std::make_shared<ColumnStatistics<float>>(0.0f, 10'000, 0.0f, 9'999.0f)}));
+
+  const auto int_float_chunked_node = StoredTableNode::make("int_float_chunked");
+  const auto int_float_chunked_a = int_float_chunked_node->get_column("a");
+  const auto join_node = JoinNode::make(JoinMode::Inner, equals_(int_float_a, int_float_chunked_a), int_float_node,
+                                        int_float_chunked_node);
+
+  const auto op = LQPTranslator{std::make_shared<CostModelLogical>()}.translate_node(join_node);
+
+  const auto join_op = std::dynamic_pointer_cast<JoinIndex>(op);
+  ASSERT_TRUE(join_op);
+  EXPECT_EQ(join_op->column_ids(), ColumnIDPair(ColumnID{0}, ColumnID{0}));
+  EXPECT_EQ(join_op->predicate_condition(), PredicateCondition::Equals);
+
+  // Without a cost model, the index is not considered
+  EXPECT_TRUE(std::dynamic_pointer_cast<JoinHash>(LQPTranslator{}.translate_node(join_node)));
+
+  // JoinIndex doesn't support Semi joins
+  const auto semi_join_node = JoinNode::make(JoinMode::Semi, equals_(int_float_a, int_float_chunked_a), int_float_node,
+                                             int_float_chunked_node);
+  const auto semi_join_op = LQPTranslator{std::make_shared<CostModelLogical>()}.translate_node(semi_join_node);
+  EXPECT_TRUE(std::dynamic_pointer_cast<JoinHash>(semi_join_op));
+}
+
+TEST_F(LQPTranslatorTest, JoinNodeWithCostModelUsesIndexBelowValidate) {
+  /**
+   * With MVCC, the output of the Validate has no indexes. The JoinIndex probes the stored table and validates the
+   * matches itself.
+   */
+  const auto table = StorageManager::get().get_table("int_float_chunked");
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    table->get_chunk(chunk_id)->create_index<GroupKeyIndex>(std::vector<ColumnID>{ColumnID{0}});
+  }
+  table->set_table_statistics(std::make_shared<TableStatistics>(
+      TableType::Data, 10'000,
+      std::vector<std::shared_ptr<const BaseColumnStatistics>>{
+          std::make_shared<ColumnStatistics<int32_t>>(0.0f, 10'000, 0, 9'999),
+          std::make_shared<ColumnStatistics<float>>(0.0f, 10'000, 0.0f, 9'999.0f)}));
+
+  const auto int_float_chunked_node = StoredTableNode::make("int_float_chunked");
+  const auto int_float_chunked_a = int_float_chunked_node->get_column("a");
+  const auto join_node = JoinNode::make(JoinMode::Inner, equals_(int_float_a, int_float_chunked_a), int_float_node,
+                                        ValidateNode::make(int_float_chunked_node));
+
+  const auto op = LQPTranslator{std::make_shared<CostModelLogical>()}.translate_node(join_node);
+
+  const auto join_op = std::dynamic_pointer_cast<JoinIndex>(op);
+  ASSERT_TRUE(join_op);
+  EXPECT_TRUE(join_op->validates_right_input());
+  EXPECT_TRUE(std::dynamic_pointer_cast<const GetTable>(join_op->input_right()));
+
+  // Only inner joins can validate the right input
+  const auto left_join_node = JoinNode::make(JoinMode::Left, equals_(int_float_a, int_float_chunked_a),
+                                             int_float_node, ValidateNode::make(int_float_chunked_node));
+  const auto left_join_op = LQPTranslator{std::make_shared<CostModelLogical>()}.translate_node(left_join_node);
+  EXPECT_FALSE(std::dynamic_pointer_cast<JoinIndex>(left_join_op));
+  EXPECT_TRUE(std::dynamic_pointer_cast<const Validate>(left_join_op->input_right()));
+}
+
+TEST_F(LQPTranslatorTest, JoinNodeWithCostModelOnNUMASystem) {
+  /**
+   * JoinMPSM does the same work as JoinSortMerge, but is preferred if there are multiple NUMA nodes
+   */
+  Topology::use_fake_numa_topology(8, 1);
+
+  auto join_node = JoinNode::make(JoinMode::Outer, equals_(int_float_b, int_float2_a), int_float_node, int_float2_node);
+  const auto op = LQPTranslator{std::make_shared<CostModelLogical>()}.translate_node(join_node);
+
+  if (Topology::get().nodes().size() > 1) {
+    EXPECT_TRUE(std::dynamic_pointer_cast<JoinMPSM>(op));
+  } else {
+    EXPECT_TRUE(std::dynamic_pointer_cast<JoinSortMerge>(op));
+  }
+
+  Topology::use_default_topology();
+}
+
 TEST_F(LQPTranslatorTest, ShowTablesNode) {
   /**
    * Build LQP and translate to PQP
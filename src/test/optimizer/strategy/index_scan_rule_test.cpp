@@ -9,9 +9,13 @@
 
 #include "expression/abstract_expression.hpp"
 #include "expression/expression_functional.hpp"
+#include "expression/parameter_expression.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
 #include "logical_query_plan/mock_node.hpp"
 #include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
 #include "optimizer/strategy/index_scan_rule.hpp"
 #include "optimizer/strategy/strategy_base_test.hpp"
 #include "statistics/column_statistics.hpp"
@@ -168,4 +172,165 @@ TEST_F(IndexScanRuleTest, IndexScanOnlyOnOutputOfStoredTableNode) {
   EXPECT_EQ(predicate_node_1->scan_type, ScanType::TableScan);
 }
 
+TEST_F(IndexScanRuleTest, IndexScanWithPrimaryKeyIndex) {
+  table->create_primary_key_index({ColumnID{0}});
+
+  // The selectivity and the table size do not matter for lookups in the PrimaryKeyIndex
+  auto statistics_mock = generate_mock_statistics(10);
+  table->set_table_statistics(statistics_mock);
+
+  auto predicate_node_0 = PredicateNode::make(equals_(a, 10));
+  predicate_node_0->set_left_input(stored_table_node);
+
+  auto reordered = StrategyBaseTest::apply_rule(rule, predicate_node_0);
+  EXPECT_EQ(predicate_node_0->scan_type, ScanType::IndexScan);
+
+  // Only Equals is supported
+  auto predicate_node_1 = PredicateNode::make(greater_than_(a, 10));
+  predicate_node_1->set_left_input(stored_table_node);
+
+  reordered = StrategyBaseTest::apply_rule(rule, predicate_node_1);
+  EXPECT_EQ(predicate_node_1->scan_type, ScanType::TableScan);
+
+  // Parameters without a value (e.g., of prepared statements) cannot be translated into an IndexScan
+  auto predicate_node_2 = PredicateNode::make(equals_(a, std::make_shared<ParameterExpression>(ParameterID{0})));
+  predicate_node_2->set_left_input(stored_table_node);
+
+  reordered = StrategyBaseTest::apply_rule(rule, predicate_node_2);
+  EXPECT_EQ(predicate_node_2->scan_type, ScanType::TableScan);
+}
+
+TEST_F(IndexScanRuleTest, PrimaryKeyIndexScanBelowValidate) {
+  table->create_primary_key_index({ColumnID{0}});
+  table->set_table_statistics(generate_mock_statistics(10));
+
+  const auto validate_node = ValidateNode::make(stored_table_node);
+
+  auto predicate_node = PredicateNode::make(equals_(a, 10));
+  predicate_node->set_left_input(validate_node);
+
+  // The PredicateNode is moved below the ValidateNode
+  const auto optimized_lqp = StrategyBaseTest::apply_rule(rule, predicate_node);
+  EXPECT_EQ(optimized_lqp, validate_node);
+  EXPECT_EQ(validate_node->left_input(), predicate_node);
+  EXPECT_EQ(predicate_node->left_input(), stored_table_node);
+  EXPECT_EQ(predicate_node->scan_type, ScanType::IndexScan);
+}
+
+TEST_F(IndexScanRuleTest, CompositePrimaryKeyIndexScan) {
+  table->create_primary_key_index({ColumnID{0}, ColumnID{1}});
+  table->set_table_statistics(generate_mock_statistics(10));
+
+  // The key predicates are spread across the chain, one of them is above the ValidateNode
+  const auto predicate_node_a = PredicateNode::make(equals_(a, 10), stored_table_node);
+  const auto validate_node = ValidateNode::make(predicate_node_a);
+  const auto predicate_node_b = PredicateNode::make(equals_(10, b), validate_node);
+  const auto predicate_node_c = PredicateNode::make(greater_than_(c, 10), predicate_node_b);
+
+  const auto optimized_lqp = StrategyBaseTest::apply_rule(rule, predicate_node_c);
+
+  // The key PredicateNodes are moved directly above the StoredTableNode, in the order of the key columns
+  EXPECT_EQ(optimized_lqp, predicate_node_c);
+  EXPECT_EQ(predicate_node_c->left_input(), validate_node);
+  EXPECT_EQ(validate_node->left_input(), predicate_node_a);
+  EXPECT_EQ(predicate_node_a->left_input(), predicate_node_b);
+  EXPECT_EQ(predicate_node_b->left_input(), stored_table_node);
+
+  EXPECT_EQ(predicate_node_a->scan_type, ScanType::IndexScan);
+  EXPECT_EQ(predicate_node_b->scan_type, ScanType::TableScan);
+  EXPECT_EQ(predicate_node_c->scan_type, ScanType::TableScan);
+}
+
+TEST_F(IndexScanRuleTest, NoPrimaryKeyIndexScanForKeyPrefix) {
+  table->create_primary_key_index({ColumnID{0}, ColumnID{1}});
+  table->set_table_statistics(generate_mock_statistics(10));
+
+  // The PrimaryKeyIndex is a hash index, a prefix of the key cannot be looked up
+  const auto predicate_node_a = PredicateNode::make(equals_(a, 10), stored_table_node);
+  const auto predicate_node_b = PredicateNode::make(greater_than_(b, 10), predicate_node_a);
+
+  const auto optimized_lqp = StrategyBaseTest::apply_rule(rule, predicate_node_b);
+  EXPECT_EQ(optimized_lqp, predicate_node_b);
+  EXPECT_EQ(predicate_node_b->left_input(), predicate_node_a);
+  EXPECT_EQ(predicate_node_a->scan_type, ScanType::TableScan);
+  EXPECT_EQ(predicate_node_b->scan_type, ScanType::TableScan);
+}
+
+TEST_F(IndexScanRuleTest, IndexOnlyScanForCoveredAggregate) {
+  table->create_index<GroupKeyIndex>({ColumnID{2}});
+
+  // Index-only scans do not depend on the selectivity
+  table->set_table_statistics(generate_mock_statistics(1'000'000));
+
+  const auto predicate_node = PredicateNode::make(greater_than_(c, 10), stored_table_node);
+  const auto aggregate_node =
+      AggregateNode::make(expression_vector(), expression_vector(count_star_(), min_(c), max_(c)), predicate_node);
+
+  const auto optimized_lqp = StrategyBaseTest::apply_rule(rule, aggregate_node);
+  EXPECT_EQ(optimized_lqp, aggregate_node);
+  EXPECT_EQ(predicate_node->scan_type, ScanType::IndexOnlyScan);
+
+  // The ProjectionNode below the PredicateNode only selects the indexed column
+  const auto projection_node = std::dynamic_pointer_cast<ProjectionNode>(predicate_node->left_input());
+  ASSERT_TRUE(projection_node);
+  ASSERT_EQ(projection_node->column_expressions().size(), 1u);
+  EXPECT_EQ(*projection_node->column_expressions()[0], *column_(c));
+  EXPECT_EQ(projection_node->left_input(), stored_table_node);
+}
+
+TEST_F(IndexScanRuleTest, IndexOnlyScanForFlippedPredicateAndBetween) {
+  table->create_index<GroupKeyIndex>({ColumnID{2}});
+  table->set_table_statistics(generate_mock_statistics(1'000'000));
+
+  const auto predicate_node_0 = PredicateNode::make(less_than_(10, c), stored_table_node);
+  const auto aggregate_node_0 = AggregateNode::make(expression_vector(), expression_vector(count_star_()),
+                                                    predicate_node_0);
+  StrategyBaseTest::apply_rule(rule, aggregate_node_0);
+  EXPECT_EQ(predicate_node_0->scan_type, ScanType::IndexOnlyScan);
+
+  const auto predicate_node_1 = PredicateNode::make(between(c, 10, 20), stored_table_node);
+  const auto aggregate_node_1 = AggregateNode::make(expression_vector(), expression_vector(count_star_()),
+                                                    predicate_node_1);
+  StrategyBaseTest::apply_rule(rule, aggregate_node_1);
+  EXPECT_EQ(predicate_node_1->scan_type, ScanType::IndexOnlyScan);
+}
+
+TEST_F(IndexScanRuleTest, NoIndexOnlyScanForUnsupportedPredicateConditions) {
+  table->create_index<GroupKeyIndex>({ColumnID{2}});
+  table->set_table_statistics(generate_mock_statistics(1'000'000));
+
+  // The IndexScan cannot execute IS NULL, IS NOT NULL, or LIKE
+  for (const auto& predicate : expression_vector(is_null_(c), is_not_null_(c), like_(c, "1%"))) {
+    const auto predicate_node = PredicateNode::make(predicate, stored_table_node);
+    const auto aggregate_node =
+        AggregateNode::make(expression_vector(), expression_vector(count_star_()), predicate_node);
+
+    StrategyBaseTest::apply_rule(rule, aggregate_node);
+    EXPECT_EQ(predicate_node->scan_type, ScanType::TableScan);
+    EXPECT_EQ(predicate_node->left_input(), stored_table_node);
+  }
+}
+
+TEST_F(IndexScanRuleTest, NoIndexOnlyScanForUncoveredColumns) {
+  table->create_index<GroupKeyIndex>({ColumnID{2}});
+  table->set_table_statistics(generate_mock_statistics(1'000'000));
+
+  // b is not indexed
+  const auto predicate_node_0 = PredicateNode::make(greater_than_(c, 10), stored_table_node);
+  const auto projection_node = ProjectionNode::make(expression_vector(c, b), predicate_node_0);
+
+  StrategyBaseTest::apply_rule(rule, projection_node);
+  EXPECT_EQ(predicate_node_0->scan_type, ScanType::TableScan);
+  EXPECT_EQ(predicate_node_0->left_input(), stored_table_node);
+
+  // The ValidateNode needs the MVCC columns
+  const auto predicate_node_1 = PredicateNode::make(greater_than_(c, 10), stored_table_node);
+  const auto validate_node = ValidateNode::make(predicate_node_1);
+  const auto aggregate_node = AggregateNode::make(expression_vector(), expression_vector(count_star_()), validate_node);
+
+  StrategyBaseTest::apply_rule(rule, aggregate_node);
+  EXPECT_EQ(predicate_node_1->scan_type, ScanType::TableScan);
+  EXPECT_EQ(predicate_node_1->left_input(), stored_table_node);
+}
+
 }  // namespace opossum
@@ -0,0 +1,111 @@
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "cost_model/cost_model_logical.hpp"
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "optimizer/strategy/join_ordering_rule.hpp"
+#include "optimizer/strategy/strategy_base_test.hpp"
+#include "statistics/column_statistics.hpp"
+#include "statistics/table_statistics.hpp"
+#include "testing_assert.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class JoinOrderingRuleTest : public StrategyBaseTest {
+ protected:
+  void SetUp() override {
+    _rule = std::make_shared<JoinOrderingRule>(std::make_shared<CostModelLogical>());
+
+    node_a = MockNode::make(std::make_shared<TableStatistics>(
+        TableType::Data, 10,
+        std::vector<std::shared_ptr<const BaseColumnStatistics>>{
+            std::make_shared<ColumnStatistics<int32_t>>(0.0f, 10, 0, 9)}));
+    node_b = MockNode::make(std::make_shared<TableStatistics>(
+        TableType::Data, 10'000,
+        std::vector<std::shared_ptr<const BaseColumnStatistics>>{
+            std::make_shared<ColumnStatistics<int32_t>>(0.0f, 10'000, 0, 9'999),
+            std::make_shared<ColumnStatistics<int32_t>>(0.0f, 100, 0, 99)}));
+    node_c = MockNode::make(std::make_shared<TableStatistics>(
+        TableType::Data, 10'000,
+        std::vector<std::shared_ptr<const BaseColumnStatistics>>{
+            std::make_shared<ColumnStatistics<int32_t>>(0.0f, 100, 0, 99)}));
+
+    a = LQPColumnReference{node_a, ColumnID{0}};
+    b1 = LQPColumnReference{node_b, ColumnID{0}};
+    b2 = LQPColumnReference{node_b, ColumnID{1}};
+    c = LQPColumnReference{node_c, ColumnID{0}};
+  }
+
+  std::shared_ptr<JoinOrderingRule> _rule;
+  std::shared_ptr<MockNode> node_a, node_b, node_c;
+  LQPColumnReference a, b1, b2, c;
+};
+
+TEST_F(JoinOrderingRuleTest, ReordersJoinsAndRestoresColumnOrder) {
+  // clang-format off
+  const auto input_lqp =
+  JoinNode::make(JoinMode::Inner, equals_(a, b1),
+    JoinNode::make(JoinMode::Inner, equals_(b2, c),
+      node_b,
+      node_c),
+    node_a);
+
+  const auto expected_lqp =
+  ProjectionNode::make(expression_vector(b1, b2, c, a),
+    JoinNode::make(JoinMode::Inner, equals_(b2, c),
+      JoinNode::make(JoinMode::Inner, equals_(a, b1),
+        node_a,
+        node_b),
+      node_c));
+  // clang-format on
+
+  const auto actual_lqp = apply_rule(_rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(JoinOrderingRuleTest, PlacesPredicates) {
+  // clang-format off
+  const auto input_lqp =
+  PredicateNode::make(greater_than_(a, 5),
+    JoinNode::make(JoinMode::Inner, equals_(a, b1),
+      node_a,
+      node_b));
+
+  const auto expected_lqp =
+  JoinNode::make(JoinMode::Inner, equals_(a, b1),
+    PredicateNode::make(greater_than_(a, 5),
+      node_a),
+    node_b);
+  // clang-format on
+
+  const auto actual_lqp = apply_rule(_rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(JoinOrderingRuleTest, OuterJoinsAreNotReordered) {
+  // clang-format off
+  const auto input_lqp =
+  JoinNode::make(JoinMode::Left, equals_(b2, c),
+    JoinNode::make(JoinMode::Left, equals_(a, b1),
+      node_a,
+      node_b),
+    node_c);
+  // clang-format on
+
+  const auto expected_lqp = input_lqp->deep_copy();
+  const auto actual_lqp = apply_rule(_rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+}  // namespace opossum
@@ -0,0 +1,171 @@
+#include <memory>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/resource_group.hpp"
+#include "scheduler/resource_group_manager.hpp"
+#include "scheduler/topology.hpp"
+
+namespace opossum {
+
+class ResourceGroupTest : public BaseTest {
+ protected:
+  // A query whose only task waits for release_task, which is not part of the query
+  std::vector<std::shared_ptr<JobTask>> pending_query(const std::shared_ptr<JobTask>& release_task) {
+    const auto task = std::make_shared<JobTask>([]() {});
+    release_task->set_as_predecessor_of(task);
+    return {task};
+  }
+
+  std::vector<std::shared_ptr<JobTask>> query() { return {std::make_shared<JobTask>([]() {})}; }
+};
+
+TEST_F(ResourceGroupTest, ExecutesQueriesWithoutScheduler) {
+  const auto resource_group = std::make_shared<ResourceGroup>("unlimited", SchedulePriority::Default);
+
+  auto execution_count = 0;
+  const auto tasks = std::vector<std::shared_ptr<JobTask>>{std::make_shared<JobTask>([&]() { ++execution_count; }),
+                                                           std::make_shared<JobTask>([&]() { ++execution_count; })};
+  tasks[0]->set_as_predecessor_of(tasks[1]);
+
+  resource_group->schedule_tasks(tasks);
+
+  EXPECT_EQ(execution_count, 2);
+  EXPECT_EQ(resource_group->running_query_count(), 0u);
+}
+
+TEST_F(ResourceGroupTest, QueuesQueriesBeyondLimit) {
+  const auto resource_group = std::make_shared<ResourceGroup>("limited", SchedulePriority::Lowest, 1);
+
+  const auto release_task = std::make_shared<JobTask>([]() {});
+  const auto first_query = pending_query(release_task);
+  const auto second_query = query();
+
+  resource_group->schedule_tasks(first_query);
+  resource_group->schedule_tasks(second_query);
+  EXPECT_EQ(resource_group->running_query_count(), 1u);
+  EXPECT_EQ(resource_group->queued_query_count(), 1u);
+  EXPECT_FALSE(second_query[0]->is_done());
+
+  // Once the first query is done, the second one takes over its slot
+  release_task->schedule();
+  EXPECT_TRUE(first_query[0]->is_done());
+  EXPECT_TRUE(second_query[0]->is_done());
+  EXPECT_EQ(resource_group->running_query_count(), 0u);
+  EXPECT_EQ(resource_group->queued_query_count(), 0u);
+}
+
+TEST_F(ResourceGroupTest, RaisingLimitAdmitsQueuedQueries) {
+  const auto resource_group = std::make_shared<ResourceGroup>("limited", SchedulePriority::Lowest, 1);
+
+  const auto release_task = std::make_shared<JobTask>([]() {});
+  const auto first_query = pending_query(release_task);
+  const auto second_query = query();
+
+  resource_group->schedule_tasks(first_query);
+  resource_group->schedule_tasks(second_query);
+  EXPECT_EQ(resource_group->queued_query_count(), 1u);
+
+  resource_group->set_max_concurrent_query_count(2);
+  EXPECT_TRUE(second_query[0]->is_done());
+  EXPECT_FALSE(first_query[0]->is_done());
+  EXPECT_EQ(resource_group->running_query_count(), 1u);
+
+  release_task->schedule();
+  EXPECT_EQ(resource_group->running_query_count(), 0u);
+}
+
+TEST_F(ResourceGroupTest, QueryWithSeveralRootsIsDoneOnceAllRootsAreDone) {
+  const auto resource_group = std::make_shared<ResourceGroup>("limited", SchedulePriority::Lowest, 1);
+
+  // The last task of the query is done right away, the first one waits for release_task
+  const auto release_task = std::make_shared<JobTask>([]() {});
+  auto first_query = pending_query(release_task);
+  first_query.emplace_back(std::make_shared<JobTask>([]() {}));
+  const auto second_query = query();
+
+  resource_group->schedule_tasks(first_query);
+  resource_group->schedule_tasks(second_query);
+  EXPECT_TRUE(first_query[1]->is_done());
+  EXPECT_EQ(resource_group->running_query_count(), 1u);
+  EXPECT_EQ(resource_group->queued_query_count(), 1u);
+
+  release_task->schedule();
+  EXPECT_TRUE(second_query[0]->is_done());
+  EXPECT_EQ(resource_group->running_query_count(), 0u);
+}
+
+TEST_F(ResourceGroupTest, FailedQueryReleasesSlot) {
+  const auto resource_group = std::make_shared<ResourceGroup>("limited", SchedulePriority::Lowest, 1);
+
+  const auto failing_query =
+      std::vector<std::shared_ptr<JobTask>>{std::make_shared<JobTask>([]() { Fail("Operator failed"); })};
+  EXPECT_THROW(resource_group->schedule_tasks(failing_query), std::logic_error);
+  EXPECT_EQ(resource_group->running_query_count(), 0u);
+
+  const auto next_query = query();
+  resource_group->schedule_tasks(next_query);
+  EXPECT_TRUE(next_query[0]->is_done());
+}
+
+TEST_F(ResourceGroupTest, DestroyingTasksReleasesSlot) {
+  const auto resource_group = std::make_shared<ResourceGroup>("limited", SchedulePriority::Lowest, 1);
+
+  {
+    // The query is admitted, but never done
+    const auto release_task = std::make_shared<JobTask>([]() {});
+    resource_group->schedule_tasks(pending_query(release_task));
+    EXPECT_EQ(resource_group->running_query_count(), 1u);
+  }
+
+  EXPECT_EQ(resource_group->running_query_count(), 0u);
+}
+
+TEST_F(ResourceGroupTest, QueuesQueriesWithScheduler) {
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  const auto resource_group = std::make_shared<ResourceGroup>("limited", SchedulePriority::Lowest, 1);
+
+  const auto release_task = std::make_shared<JobTask>([]() {});
+  const auto first_query = pending_query(release_task);
+  const auto second_query = query();
+
+  resource_group->schedule_tasks(first_query);
+  resource_group->schedule_tasks(second_query);
+  EXPECT_EQ(resource_group->queued_query_count(), 1u);
+
+  release_task->schedule();
+  CurrentScheduler::wait_for_tasks(first_query);
+  CurrentScheduler::wait_for_tasks(second_query);
+  EXPECT_EQ(resource_group->running_query_count(), 0u);
+  EXPECT_EQ(resource_group->queued_query_count(), 0u);
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(ResourceGroupTest, ManagerChoosesGroupByCost) {
+  auto& manager = ResourceGroupManager::get();
+  EXPECT_EQ(manager.short_query_group()->priority(), SchedulePriority::Default);
+  EXPECT_EQ(manager.short_query_group()->max_concurrent_query_count(), 0u);
+  EXPECT_EQ(manager.heavy_query_group()->priority(), SchedulePriority::Lowest);
+  EXPECT_GT(manager.heavy_query_group()->max_concurrent_query_count(), 0u);
+
+  EXPECT_EQ(manager.heavy_query_cost_threshold(), ResourceGroupManager::DEFAULT_HEAVY_QUERY_COST_THRESHOLD);
+
+  manager.set_heavy_query_cost_threshold(100.0f);
+  EXPECT_EQ(manager.resource_group_for_cost(std::nullopt), manager.short_query_group());
+  EXPECT_EQ(manager.resource_group_for_cost(100.0f), manager.short_query_group());
+  EXPECT_EQ(manager.resource_group_for_cost(101.0f), manager.heavy_query_group());
+
+  // Without a threshold, all queries are short queries
+  manager.set_heavy_query_cost_threshold(std::nullopt);
+  EXPECT_EQ(manager.resource_group_for_cost(101.0f), manager.short_query_group());
+}
+
+}  // namespace opossum
@@ -208,4 +208,17 @@ TEST_F(SchedulerTest, MultipleOperators) {
   EXPECT_TABLE_EQ_UNORDERED(ts->get_output(), expected_result);
 }
 
+TEST_F(SchedulerTest, MakeTasksFromOperatorWithPriority) {
+  auto test_table = load_table("src/test/tables/int_float.tbl", 2);
+  StorageManager::get().add_table("table", std::move(test_table));
+
+  auto gt = std::make_shared<GetTable>("table");
+  auto ts = std::make_shared<TableScan>(gt, ColumnID{0}, PredicateCondition::GreaterThanEquals, 1234);
+
+  const auto tasks = OperatorTask::make_tasks_from_operator(ts, CleanupTemporaries::Yes, SchedulePriority::Lowest);
+  ASSERT_EQ(tasks.size(), 2u);
+  EXPECT_EQ(tasks[0]->priority(), SchedulePriority::Lowest);
+  EXPECT_EQ(tasks[1]->priority(), SchedulePriority::Lowest);
+}
+
 }  // namespace opossum
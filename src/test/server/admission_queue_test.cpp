@@ -0,0 +1,82 @@
+#include <future>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
+#include "server/admission_queue.hpp"
+
+namespace opossum {
+
+class AdmissionQueueTest : public BaseTest {};
+
+TEST_F(AdmissionQueueTest, ExecutesTasksWithoutScheduler) {
+  const auto admission_queue = std::make_shared<AdmissionQueue>(1);
+
+  auto execution_count = 0;
+  auto done_callback_count = 0;
+  for (auto task_id = 0; task_id < 3; ++task_id) {
+    admission_queue->submit(std::make_shared<JobTask>([&]() { ++execution_count; }), SchedulePriority::Default,
+                            [&](std::chrono::nanoseconds) { ++done_callback_count; });
+  }
+
+  EXPECT_EQ(execution_count, 3);
+  EXPECT_EQ(done_callback_count, 3);
+  EXPECT_EQ(admission_queue->running_task_count(), 0u);
+  EXPECT_EQ(admission_queue->queued_task_count(), 0u);
+}
+
+TEST_F(AdmissionQueueTest, AdmitsQueuedTasksByPriority) {
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  const auto admission_queue = std::make_shared<AdmissionQueue>(1);
+
+  std::mutex mutex;
+  std::vector<std::string> execution_order;
+  const auto make_task = [&](const std::string& name) {
+    return std::make_shared<JobTask>([&, name]() {
+      std::lock_guard<std::mutex> lock(mutex);
+      execution_order.emplace_back(name);
+    });
+  };
+
+  // The first task occupies the only slot until it is released
+  auto release_promise = std::promise<void>{};
+  auto release_future = release_promise.get_future().share();
+  const auto blocking_task = std::make_shared<JobTask>([&, release_future]() {
+    release_future.wait();
+    std::lock_guard<std::mutex> lock(mutex);
+    execution_order.emplace_back("blocking");
+  });
+  admission_queue->submit(blocking_task, SchedulePriority::Default);
+
+  const auto tasks = std::vector<std::shared_ptr<AbstractTask>>{blocking_task, make_task("default_1"),
+                                                                make_task("highest"), make_task("default_2")};
+  admission_queue->submit(tasks[1], SchedulePriority::Default);
+  admission_queue->submit(tasks[2], SchedulePriority::Highest);
+  admission_queue->submit(tasks[3], SchedulePriority::Default);
+
+  EXPECT_EQ(admission_queue->running_task_count(), 1u);
+  EXPECT_EQ(admission_queue->queued_task_count(), 3u);
+
+  release_promise.set_value();
+  for (const auto& task : tasks) {
+    // Tasks that are still queued are not scheduled yet, so we cannot join() them
+    while (!task->is_done()) std::this_thread::yield();
+  }
+
+  EXPECT_EQ(execution_order, (std::vector<std::string>{"blocking", "highest", "default_1", "default_2"}));
+  EXPECT_EQ(admission_queue->running_task_count(), 0u);
+  EXPECT_EQ(admission_queue->queued_task_count(), 0u);
+
+  CurrentScheduler::get()->finish();
+}
+
+}  // namespace opossum
@@ -17,7 +17,7 @@ class MockConnection {
   MOCK_METHOD1(receive_describe_packet_body, boost::future<std::string>(uint32_t size));
   MOCK_METHOD1(receive_sync_packet_body, boost::future<void>(uint32_t size));
   MOCK_METHOD1(receive_flush_packet_body, boost::future<void>(uint32_t size));
-  MOCK_METHOD1(receive_execute_packet_body, boost::future<std::string>(uint32_t size));
+  MOCK_METHOD1(receive_execute_packet_body, boost::future<ExecutePacket>(uint32_t size));
 
   MOCK_METHOD0(send_ssl_denied, boost::future<void>());
   MOCK_METHOD0(send_auth, boost::future<void>());
@@ -27,7 +27,7 @@ class MockConnection {
   MOCK_METHOD1(send_notice, boost::future<void>(const std::string& notice));
   MOCK_METHOD1(send_status_message, boost::future<void>(const NetworkMessageType& type));
   MOCK_METHOD1(send_row_description, boost::future<void>(const std::vector<ColumnDescription>& row_description));
-  MOCK_METHOD1(send_data_row, boost::future<void>(const std::vector<std::string>& row_strings));
+  MOCK_METHOD1(send_data_rows, boost::future<void>(const std::shared_ptr<const ByteBuffer>& data));
   MOCK_METHOD1(send_command_complete, boost::future<void>(const std::string& message));
 };
 
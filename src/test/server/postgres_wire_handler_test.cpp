@@ -58,6 +58,46 @@ TEST_F(PostgresWireHandlerTest, HandleStartupPackage) {
   ASSERT_EQ(result, 92ul);  // 100 - 2 * sizeof(uint32_t)
 }
 
+TEST_F(PostgresWireHandlerTest, HandleExecutePacket) {
+  ByteBuffer buffer = {'p', 'o', 'r', 't', 'a', 'l', '\0'};
+  uint32_t value = htonl(100);
+  char* chars = reinterpret_cast<char*>(&value);
+  buffer.insert(buffer.end(), chars, chars + sizeof(uint32_t));  // max rows
+  _input_packet.data = buffer;
+  _input_packet.offset = _input_packet.data.cbegin();
+
+  auto result = postgres_wire_handler.handle_execute_packet(_input_packet);
+  ASSERT_EQ(result.portal, "portal");
+  ASSERT_EQ(result.max_rows, 100u);
+}
+
+TEST_F(PostgresWireHandlerTest, HandleBindPacket) {
+  // Unnamed portal and statement, no parameters
+  ByteBuffer buffer = {'\0', '\0', 0, 0, 0, 0};
+  const auto append_int16 = [&](const int16_t value) {
+    const auto network_value = htons(value);
+    const auto chars = reinterpret_cast<const char*>(&network_value);
+    buffer.insert(buffer.end(), chars, chars + sizeof(int16_t));
+  };
+  append_int16(2);  // number of result column format codes
+  append_int16(1);
+  append_int16(0);
+  _input_packet.data = buffer;
+  _input_packet.offset = _input_packet.data.cbegin();
+
+  const auto result = postgres_wire_handler.handle_bind_packet(_input_packet);
+  EXPECT_EQ(result.result_format_codes, std::vector<FormatCode>({FormatCode::Binary, FormatCode::Text}));
+
+  // An unknown format code is reported to the client
+  buffer.resize(6);
+  append_int16(1);
+  append_int16(2);
+  _input_packet.data = buffer;
+  _input_packet.offset = _input_packet.data.cbegin();
+
+  EXPECT_THROW(postgres_wire_handler.handle_bind_packet(_input_packet), InvalidInputException);
+}
+
 TEST_F(PostgresWireHandlerTest, WriteString) {
   std::string value("Response");
 
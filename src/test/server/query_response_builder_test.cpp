@@ -0,0 +1,134 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "server/postgres_wire_handler.hpp"
+#include "server/query_response_builder.hpp"
+#include "storage/chunk.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class QueryResponseBuilderTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, true},
+                                                           {"b", DataType::Long, false},
+                                                           {"c", DataType::Float, false},
+                                                           {"d", DataType::Double, false},
+                                                           {"e", DataType::String, false}};
+    _table = std::make_shared<Table>(column_definitions, TableType::Data);
+    _table->append({1, int64_t{2}, 1.5f, 0.25, "ab"});
+    _table->append({NULL_VALUE, int64_t{-3}, 2.0f, 100.0, ""});
+  }
+
+  // Appends a DataRow message with the given fields, each of which already contains its length
+  static void append_data_row(ByteBuffer& buffer, const std::vector<ByteBuffer>& fields) {
+    auto message = ByteBuffer{};
+    append_bytes(message, ByteBuffer{0, static_cast<char>(fields.size())});
+    for (const auto& field : fields) {
+      append_bytes(message, field);
+    }
+
+    buffer.emplace_back('D');
+    append_bytes(buffer, int32_bytes(static_cast<int32_t>(message.size() + sizeof(int32_t))));
+    append_bytes(buffer, message);
+  }
+
+  static void append_bytes(ByteBuffer& buffer, const ByteBuffer& bytes) {
+    buffer.insert(buffer.end(), bytes.cbegin(), bytes.cend());
+  }
+
+  static ByteBuffer int32_bytes(const int32_t value) {
+    return ByteBuffer{static_cast<char>(value >> 24), static_cast<char>(value >> 16), static_cast<char>(value >> 8),
+                      static_cast<char>(value)};
+  }
+
+  static ByteBuffer int64_bytes(const int64_t value) {
+    auto bytes = int32_bytes(static_cast<int32_t>(value >> 32));
+    append_bytes(bytes, int32_bytes(static_cast<int32_t>(value)));
+    return bytes;
+  }
+
+  static ByteBuffer text_field(const std::string& value) {
+    auto field = int32_bytes(static_cast<int32_t>(value.size()));
+    field.insert(field.end(), value.cbegin(), value.cend());
+    return field;
+  }
+
+  static ByteBuffer binary_field(const ByteBuffer& value) {
+    auto field = int32_bytes(static_cast<int32_t>(value.size()));
+    append_bytes(field, value);
+    return field;
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(QueryResponseBuilderTest, BuildFormatCodes) {
+  EXPECT_EQ(QueryResponseBuilder::build_format_codes({}, 2), std::vector<FormatCode>(2, FormatCode::Text));
+  EXPECT_EQ(QueryResponseBuilder::build_format_codes({FormatCode::Binary}, 2),
+            std::vector<FormatCode>(2, FormatCode::Binary));
+  EXPECT_EQ(QueryResponseBuilder::build_format_codes({FormatCode::Binary, FormatCode::Text}, 2),
+            (std::vector<FormatCode>{FormatCode::Binary, FormatCode::Text}));
+  EXPECT_THROW(QueryResponseBuilder::build_format_codes({FormatCode::Binary, FormatCode::Text}, 3), std::logic_error);
+}
+
+TEST_F(QueryResponseBuilderTest, BuildTextDataRows) {
+  auto output = ByteBuffer{};
+  QueryResponseBuilder::build_data_rows(*_table->get_chunk(ChunkID{0}), ChunkOffset{0}, ChunkOffset{2},
+                                        std::vector<FormatCode>(5, FormatCode::Text), output);
+
+  auto expected_output = ByteBuffer{};
+  append_data_row(expected_output,
+                  {text_field("1"), text_field("2"), text_field("1.5"), text_field("0.25"), text_field("ab")});
+  // NULLs have a length of -1 and no value
+  append_data_row(expected_output,
+                  {int32_bytes(-1), text_field("-3"), text_field("2"), text_field("100"), text_field("")});
+  EXPECT_EQ(output, expected_output);
+}
+
+TEST_F(QueryResponseBuilderTest, BuildBinaryDataRows) {
+  // Only the second row, with the string column in text format
+  auto output = ByteBuffer{};
+  const auto format_codes = std::vector<FormatCode>{FormatCode::Binary, FormatCode::Binary, FormatCode::Binary,
+                                                    FormatCode::Binary, FormatCode::Text};
+  QueryResponseBuilder::build_data_rows(*_table->get_chunk(ChunkID{0}), ChunkOffset{1}, ChunkOffset{2}, format_codes,
+                                        output);
+
+  auto expected_output = ByteBuffer{};
+  append_data_row(expected_output,
+                  {int32_bytes(-1), binary_field(int64_bytes(-3)), binary_field(int32_bytes(0x40000000)),
+                   binary_field(int64_bytes(0x4059000000000000)), text_field("")});
+  EXPECT_EQ(output, expected_output);
+
+  output.clear();
+  QueryResponseBuilder::build_data_rows(*_table->get_chunk(ChunkID{0}), ChunkOffset{0}, ChunkOffset{1},
+                                        std::vector<FormatCode>(5, FormatCode::Binary), output);
+
+  expected_output.clear();
+  append_data_row(expected_output,
+                  {binary_field(int32_bytes(1)), binary_field(int64_bytes(2)), binary_field(int32_bytes(0x3FC00000)),
+                   binary_field(int64_bytes(0x3FD0000000000000)), text_field("ab")});
+  EXPECT_EQ(output, expected_output);
+}
+
+TEST_F(QueryResponseBuilderTest, BuildDataRowsFromReferenceColumn) {
+  const auto pos_list = std::make_shared<PosList>(PosList{RowID{ChunkID{0}, ChunkOffset{1}}, NULL_ROW_ID,
+                                                          RowID{ChunkID{0}, ChunkOffset{0}}});
+  auto chunk = Chunk{ChunkColumns{std::make_shared<ReferenceColumn>(_table, ColumnID{4}, pos_list)}};
+
+  auto output = ByteBuffer{};
+  QueryResponseBuilder::build_data_rows(chunk, ChunkOffset{1}, ChunkOffset{3}, {FormatCode::Text}, output);
+
+  auto expected_output = ByteBuffer{};
+  append_data_row(expected_output, {int32_bytes(-1)});
+  append_data_row(expected_output, {text_field("ab")});
+  EXPECT_EQ(output, expected_output);
+}
+
+}  // namespace opossum
@@ -13,9 +13,12 @@ namespace opossum {
 using ::testing::_;
 using ::testing::An;
 using ::testing::ByMove;
+using ::testing::Each;
+using ::testing::Field;
 using ::testing::InSequence;
 using ::testing::Invoke;
 using ::testing::NiceMock;
+using ::testing::ResultOf;
 using ::testing::Return;
 using ::testing::Throw;
 
@@ -26,6 +29,19 @@ using TestConnection = NiceMock<MockConnection>;
 using TestTaskRunner = NiceMock<MockTaskRunner>;
 using TestServerSession = ServerSessionImpl<TestConnection, TestTaskRunner>;
 
+// Returns the number of DataRow messages in the data passed to send_data_rows
+size_t data_row_count(const std::shared_ptr<const ByteBuffer>& data) {
+  auto count = size_t{0};
+  for (auto offset = size_t{0}; offset < data->size(); ++count) {
+    EXPECT_EQ(static_cast<NetworkMessageType>((*data)[offset]), NetworkMessageType::DataRow);
+    uint32_t network_length;
+    std::copy_n(data->begin() + offset + 1, sizeof(network_length), reinterpret_cast<char*>(&network_length));
+    // The length does not include the message type
+    offset += 1 + ntohl(network_length);
+  }
+  return count;
+}
+
 class ServerSessionTest : public BaseTest {
  protected:
   void SetUp() override {
@@ -76,7 +92,7 @@ class ServerSessionTest : public BaseTest {
     ON_CALL(*_connection, send_row_description(_)).WillByDefault(Invoke([](const std::vector<ColumnDescription>&) {
       return boost::make_ready_future();
     }));
-    ON_CALL(*_connection, send_data_row(_)).WillByDefault(Invoke([](const std::vector<std::string>&) {
+    ON_CALL(*_connection, send_data_rows(_)).WillByDefault(Invoke([](const std::shared_ptr<const ByteBuffer>&) {
       return boost::make_ready_future();
     }));
     ON_CALL(*_connection, send_command_complete(_)).WillByDefault(Invoke([](const std::string&) {
@@ -229,8 +245,8 @@ TEST_F(ServerSessionTest, SessionExecutesSimpleQueryCommand) {
   // It sends the result schema...
   EXPECT_CALL(*_connection, send_row_description(_));
 
-  // ... as well as the row data (one message per row)
-  EXPECT_CALL(*_connection, send_data_row(_)).Times(3);
+  // ... as well as the row data (one batch per chunk)
+  EXPECT_CALL(*_connection, send_data_rows(ResultOf(data_row_count, 3)));
 
   // Finally, the session completes the command...
   EXPECT_CALL(*_connection, send_command_complete(_));
@@ -272,7 +288,7 @@ TEST_F(ServerSessionTest, SessionHandlesExtendedProtocolFlow) {
   RequestHeader bind_request{NetworkMessageType::BindCommand, 42};
   EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(bind_request))));
 
-  BindPacket bind_packet = {"", "", {}};
+  BindPacket bind_packet = {"", "", {}, {}};
   EXPECT_CALL(*_connection, receive_bind_packet_body(42))
       .WillOnce(Return(ByMove(boost::make_ready_future(bind_packet))));
 
@@ -290,15 +306,16 @@ TEST_F(ServerSessionTest, SessionHandlesExtendedProtocolFlow) {
   EXPECT_CALL(*_connection, receive_packet_header())
       .WillOnce(Return(ByMove(boost::make_ready_future(execute_request))));
 
+  ExecutePacket execute_packet = {"", 0};
   EXPECT_CALL(*_connection, receive_execute_packet_body(42))
-      .WillOnce(Return(ByMove(boost::make_ready_future(std::string("")))));
+      .WillOnce(Return(ByMove(boost::make_ready_future(execute_packet))));
 
   // The session executes the SQLPipeline using another scheduled task
   EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<ExecuteServerPreparedStatementTask>>()))
       .WillOnce(Return(ByMove(boost::make_ready_future(sql_pipeline->get_result_table()))));
 
-  // It sends the row data (one message per row)
-  EXPECT_CALL(*_connection, send_data_row(_)).Times(3);
+  // It sends the row data (one batch per chunk)
+  EXPECT_CALL(*_connection, send_data_rows(ResultOf(data_row_count, 3)));
 
   // ... and completes the command
   EXPECT_CALL(*_connection, send_command_complete(_));
@@ -317,6 +334,127 @@ TEST_F(ServerSessionTest, SessionHandlesExtendedProtocolFlow) {
   _session->start().wait();
 }
 
+TEST_F(ServerSessionTest, SessionSuspendsPortalWhenExecuteRowLimitIsReached) {
+  InSequence s;
+
+  EXPECT_CALL(*_connection, send_ready_for_query());
+
+  RequestHeader parse_request{NetworkMessageType::ParseCommand, 42};
+  EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(parse_request))));
+
+  ParsePacket parse_packet = {"", "SELECT * FROM foo;"};
+  EXPECT_CALL(*_connection, receive_parse_packet_body(42))
+      .WillOnce(Return(ByMove(boost::make_ready_future(parse_packet))));
+
+  auto sql_pipeline = _create_working_sql_pipeline();
+  auto create_pipeline_result = std::make_unique<CreatePipelineResult>();
+  create_pipeline_result->sql_pipeline = sql_pipeline;
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<CreatePipelineTask>>()))
+      .WillOnce(Return(ByMove(boost::make_ready_future(std::move(create_pipeline_result)))));
+
+  EXPECT_CALL(*_connection, send_status_message(NetworkMessageType::ParseComplete));
+
+  RequestHeader bind_request{NetworkMessageType::BindCommand, 42};
+  EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(bind_request))));
+
+  // The client requests the binary format for all result columns
+  BindPacket bind_packet = {"", "", {}, {FormatCode::Binary}};
+  EXPECT_CALL(*_connection, receive_bind_packet_body(42))
+      .WillOnce(Return(ByMove(boost::make_ready_future(bind_packet))));
+
+  const auto placeholder_plan = sql_pipeline->get_query_plans().front();
+  auto sql_query_plan = std::make_unique<SQLQueryPlan>(placeholder_plan->deep_copy());
+
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<BindServerPreparedStatementTask>>()))
+      .WillOnce(Return(ByMove(boost::make_ready_future(std::move(sql_query_plan)))));
+
+  EXPECT_CALL(*_connection, send_status_message(NetworkMessageType::BindComplete));
+
+  // The first Execute command only asks for two of the three rows
+  RequestHeader execute_request{NetworkMessageType::ExecuteCommand, 42};
+  EXPECT_CALL(*_connection, receive_packet_header())
+      .WillOnce(Return(ByMove(boost::make_ready_future(execute_request))));
+
+  ExecutePacket limited_execute_packet = {"", 2};
+  EXPECT_CALL(*_connection, receive_execute_packet_body(42))
+      .WillOnce(Return(ByMove(boost::make_ready_future(limited_execute_packet))));
+
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<ExecuteServerPreparedStatementTask>>()))
+      .WillOnce(Return(ByMove(boost::make_ready_future(sql_pipeline->get_result_table()))));
+
+  EXPECT_CALL(*_connection, send_row_description(Each(Field(&ColumnDescription::format_code, FormatCode::Binary))));
+  EXPECT_CALL(*_connection, send_data_rows(ResultOf(data_row_count, 2)));
+
+  // The portal is suspended instead of completed
+  EXPECT_CALL(*_connection, send_status_message(NetworkMessageType::PortalSuspended));
+
+  // The second Execute command continues with the remaining row, without executing the query plan again
+  EXPECT_CALL(*_connection, receive_packet_header())
+      .WillOnce(Return(ByMove(boost::make_ready_future(execute_request))));
+
+  ExecutePacket execute_packet = {"", 0};
+  EXPECT_CALL(*_connection, receive_execute_packet_body(42))
+      .WillOnce(Return(ByMove(boost::make_ready_future(execute_packet))));
+
+  EXPECT_CALL(*_connection, send_data_rows(ResultOf(data_row_count, 1)));
+  EXPECT_CALL(*_connection, send_command_complete("SELECT 1"));
+
+  RequestHeader sync_request{NetworkMessageType::SyncCommand, 42};
+  EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(sync_request))));
+
+  EXPECT_CALL(*_connection, receive_sync_packet_body(42)).WillOnce(Return(ByMove(boost::make_ready_future())));
+
+  EXPECT_CALL(*_connection, send_ready_for_query());
+  EXPECT_CALL(*_connection, receive_packet_header());
+
+  _session->start().wait();
+}
+
+TEST_F(ServerSessionTest, SessionSendsErrorWhenBindingWrongNumberOfResultFormatCodes) {
+  InSequence s;
+
+  EXPECT_CALL(*_connection, send_ready_for_query());
+
+  RequestHeader parse_request{NetworkMessageType::ParseCommand, 42};
+  EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(parse_request))));
+
+  ParsePacket parse_packet = {"", "SELECT * FROM foo;"};
+  EXPECT_CALL(*_connection, receive_parse_packet_body(42))
+      .WillOnce(Return(ByMove(boost::make_ready_future(parse_packet))));
+
+  auto sql_pipeline = _create_working_sql_pipeline();
+  auto create_pipeline_result = std::make_unique<CreatePipelineResult>();
+  create_pipeline_result->sql_pipeline = sql_pipeline;
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<CreatePipelineTask>>()))
+      .WillOnce(Return(ByMove(boost::make_ready_future(std::move(create_pipeline_result)))));
+
+  EXPECT_CALL(*_connection, send_status_message(NetworkMessageType::ParseComplete));
+
+  RequestHeader bind_request{NetworkMessageType::BindCommand, 42};
+  EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(bind_request))));
+
+  // The result of the statement has a single column, but the client requests formats for two
+  BindPacket bind_packet = {"", "", {}, {FormatCode::Text, FormatCode::Binary}};
+  EXPECT_CALL(*_connection, receive_bind_packet_body(42))
+      .WillOnce(Return(ByMove(boost::make_ready_future(bind_packet))));
+
+  const auto placeholder_plan = sql_pipeline->get_query_plans().front();
+  auto sql_query_plan = std::make_unique<SQLQueryPlan>(placeholder_plan->deep_copy());
+
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<BindServerPreparedStatementTask>>()))
+      .WillOnce(Return(ByMove(boost::make_ready_future(std::move(sql_query_plan)))));
+
+  // The error is reported by the Bind instead of the Execute
+  EXPECT_CALL(*_connection,
+              send_error("Invalid input error: The number of result format codes does not match the number of result "
+                         "columns."));
+
+  EXPECT_CALL(*_connection, send_ready_for_query());
+  EXPECT_CALL(*_connection, receive_packet_header());
+
+  _session->start().wait();
+}
+
 TEST_F(ServerSessionTest, SessionHandlesLoadTableRequestInSimpleQueryCommand) {
   InSequence s;
 
@@ -385,7 +523,7 @@ TEST_F(ServerSessionTest, SessionSendsErrorWhenBindingUnknownNamedStatement) {
   RequestHeader bind_request{NetworkMessageType::BindCommand, 42};
   EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(bind_request))));
 
-  BindPacket bind_packet = {"my_named_statement", "", {}};
+  BindPacket bind_packet = {"my_named_statement", "", {}, {}};
   EXPECT_CALL(*_connection, receive_bind_packet_body(42))
       .WillOnce(Return(ByMove(boost::make_ready_future(bind_packet))));
 
@@ -423,7 +561,7 @@ TEST_F(ServerSessionTest, SessionSendsErrorWhenRedefiningNamedPortal) {
   RequestHeader bind_request{NetworkMessageType::BindCommand, 42};
   EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(bind_request))));
 
-  BindPacket bind_packet = {"my_named_statement", "my_named_portal", {}};
+  BindPacket bind_packet = {"my_named_statement", "my_named_portal", {}, {}};
   EXPECT_CALL(*_connection, receive_bind_packet_body(42))
       .WillOnce(Return(ByMove(boost::make_ready_future(bind_packet))));
 
@@ -8,6 +8,7 @@
 #include "scheduler/topology.hpp"
 
 #include "server/server.hpp"
+#include "sql/parameterized_plan_cache.hpp"
 
 namespace opossum {
 
@@ -16,6 +17,7 @@ class ServerTestRunner : public BaseTest {
   void SetUp() override {
     StorageManager::get().reset();
     SQLQueryCache<SQLQueryPlan>::get().clear();
+    ParameterizedPlanCache::get().clear();
 
     _table_a = load_table("src/test/tables/int_float.tbl", 2);
     StorageManager::get().add_table("table_a", _table_a);
@@ -0,0 +1,115 @@
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+
+#include "expression/value_expression.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "sql/parameterized_plan_cache.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "sql/sql_pipeline_statement.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/storage_manager.hpp"
+
+namespace opossum {
+
+class ParameterizedPlanCacheTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    StorageManager::get().add_table("table_a", load_table("src/test/tables/int_float.tbl", 2));
+    StorageManager::get().add_table("customer", load_table("src/test/tables/tpch/sf-0.001/customer.tbl", 50));
+
+    SQLQueryCache<SQLQueryPlan>::get().clear();
+    ParameterizedPlanCache::get().clear();
+  }
+
+  // Executes the query and returns whether it used a cached ParameterizedPlan
+  bool execute_query(const std::string& query, const size_t expected_row_count) {
+    auto pipeline_statement = SQLPipelineBuilder{query}.create_pipeline_statement();
+    const auto result_table = pipeline_statement.get_result_table();
+    EXPECT_EQ(result_table->row_count(), expected_row_count) << query;
+
+    return pipeline_statement.metrics()->parameterized_plan_cache_hit;
+  }
+};
+
+TEST_F(ParameterizedPlanCacheTest, NormalizeSQLLiterals) {
+  EXPECT_EQ(normalize_sql_literals("SELECT * FROM t1 WHERE a = 5 AND b > 3.5e-2 AND c = 'it''s'"),
+            "SELECT * FROM t1 WHERE a = ? AND b > ? AND c = ?");
+  EXPECT_EQ(normalize_sql_literals("SELECT \"col 1\" FROM t WHERE x2 < 10 LIMIT 3;"),
+            "SELECT \"col 1\" FROM t WHERE x2 < ? LIMIT ?;");
+  EXPECT_EQ(normalize_sql_literals("SELECT a FROM t"), "SELECT a FROM t");
+}
+
+TEST_F(ParameterizedPlanCacheTest, ReuseForDifferentLiterals) {
+  EXPECT_FALSE(execute_query("SELECT * FROM table_a WHERE a > 1000", 2));
+  EXPECT_TRUE(execute_query("SELECT * FROM table_a WHERE a > 2000", 1));
+  EXPECT_TRUE(execute_query("SELECT * FROM table_a WHERE a > 100", 3));
+  EXPECT_EQ(ParameterizedPlanCache::get().size(), 1u);
+
+  // The optimized LQP of a cache hit contains the literals of its statement
+  auto pipeline_statement = SQLPipelineBuilder{"SELECT * FROM table_a WHERE a > 124"}.create_pipeline_statement();
+  const auto& optimized_lqp = pipeline_statement.get_optimized_logical_plan();
+  EXPECT_TRUE(pipeline_statement.metrics()->parameterized_plan_cache_hit);
+
+  auto predicate_node = std::shared_ptr<PredicateNode>{};
+  visit_lqp(optimized_lqp, [&](const auto& node) {
+    if (node->type == LQPNodeType::Predicate) predicate_node = std::static_pointer_cast<PredicateNode>(node);
+    return LQPVisitation::VisitInputs;
+  });
+  ASSERT_TRUE(predicate_node);
+  ASSERT_EQ(predicate_node->predicate->arguments.size(), 2u);
+  EXPECT_EQ(*predicate_node->predicate->arguments[1], ValueExpression{int32_t{124}});
+}
+
+TEST_F(ParameterizedPlanCacheTest, MismatchingStatements) {
+  // Same normalized SQL string, but the LIMIT is not parameterized
+  EXPECT_FALSE(execute_query("SELECT * FROM table_a WHERE a > 100 LIMIT 1", 1));
+  EXPECT_FALSE(execute_query("SELECT * FROM table_a WHERE a > 100 LIMIT 2", 2));
+
+  // Statements without literals to parameterize are not cached
+  EXPECT_FALSE(execute_query("SELECT * FROM table_a WHERE a IS NULL", 0));
+  EXPECT_EQ(ParameterizedPlanCache::get().size(), 1u);
+}
+
+TEST_F(ParameterizedPlanCacheTest, ReoptimizeForDifferentSelectivity) {
+  EXPECT_FALSE(execute_query("SELECT c_custkey FROM customer WHERE c_custkey < 3", 2));
+
+  // Far more rows are expected to qualify
+  EXPECT_FALSE(execute_query("SELECT c_custkey FROM customer WHERE c_custkey < 140", 139));
+
+  // The plan optimized for the previous statement replaced the first one
+  EXPECT_TRUE(execute_query("SELECT c_custkey FROM customer WHERE c_custkey < 145", 144));
+  EXPECT_FALSE(execute_query("SELECT c_custkey FROM customer WHERE c_custkey < 2", 1));
+}
+
+TEST_F(ParameterizedPlanCacheTest, ChunksArePrunedForTheLiteralsOfEachStatement) {
+  // One row per chunk: 12345 | 123 | 1234
+  const auto table = load_table("src/test/tables/int_float.tbl", 1);
+  ChunkEncoder::encode_all_chunks(table);
+  StorageManager::get().add_table("table_pruned", table);
+
+  const auto get_excluded_chunk_ids = [](const std::string& query, const bool expect_cache_hit) {
+    auto pipeline_statement = SQLPipelineBuilder{query}.create_pipeline_statement();
+    const auto& optimized_lqp = pipeline_statement.get_optimized_logical_plan();
+    EXPECT_EQ(pipeline_statement.metrics()->parameterized_plan_cache_hit, expect_cache_hit) << query;
+
+    auto excluded_chunk_ids = std::vector<ChunkID>{};
+    visit_lqp(optimized_lqp, [&](const auto& node) {
+      if (node->type == LQPNodeType::StoredTable) {
+        excluded_chunk_ids = std::static_pointer_cast<StoredTableNode>(node)->excluded_chunk_ids();
+      }
+      return LQPVisitation::VisitInputs;
+    });
+    return excluded_chunk_ids;
+  };
+
+  EXPECT_EQ(get_excluded_chunk_ids("SELECT * FROM table_pruned WHERE a > 1000", false),
+            (std::vector<ChunkID>{ChunkID{1}}));
+  EXPECT_EQ(get_excluded_chunk_ids("SELECT * FROM table_pruned WHERE a > 10000", true),
+            (std::vector<ChunkID>{ChunkID{1}, ChunkID{2}}));
+}
+
+}  // namespace opossum
@@ -1,3 +1,7 @@
+#include <string>
+#include <thread>
+#include <vector>
+
 #include "../base_test.hpp"
 #include "gtest/gtest.h"
 
@@ -6,6 +10,7 @@
 #include "sql/lru_cache.hpp"
 #include "sql/lru_k_cache.hpp"
 #include "sql/random_cache.hpp"
+#include "sql/sql_query_cache.hpp"
 
 namespace opossum {
 
@@ -302,4 +307,115 @@ TYPED_TEST(CacheTest, ResizeShrink) {
   ASSERT_EQ(cache.get(3), 6);
 }
 
+// Sharded SQLQueryCache
+TEST_F(SQLBasicCacheTest, SQLQueryCacheShards) {
+  EXPECT_EQ(SQLQueryCache<int>::shard_count_for_capacity(0), 1u);
+  EXPECT_EQ(SQLQueryCache<int>::shard_count_for_capacity(100), 1u);
+  EXPECT_EQ(SQLQueryCache<int>::shard_count_for_capacity(256), 4u);
+  EXPECT_EQ(SQLQueryCache<int>::shard_count_for_capacity(DefaultCacheCapacity), 16u);
+  EXPECT_EQ(SQLQueryCache<int>::shard_count_for_capacity(1'000'000), 16u);
+
+  SQLQueryCache<int> cache(100, 4);
+  ASSERT_EQ(cache.shard_count(), 4u);
+
+  for (auto value = 0; value < 1000; ++value) {
+    cache.set(std::to_string(value), value);
+  }
+
+  // Each shard evicts on its own, so no more than the capacity is held
+  EXPECT_LE(cache.size(), 100u);
+  EXPECT_GT(cache.size(), 0u);
+  EXPECT_EQ(cache.try_get("999"), 999);
+  EXPECT_EQ(cache.try_get("not cached"), std::nullopt);
+
+  // Resizing recomputes the number of shards, so that no shard is left without capacity
+  cache.resize(2);
+  EXPECT_EQ(cache.shard_count(), 1u);
+  EXPECT_EQ(cache.capacity(), 2u);
+  for (auto value = 0; value < 10; ++value) {
+    cache.set(std::to_string(value), value);
+  }
+  EXPECT_EQ(cache.size(), 2u);
+  EXPECT_EQ(cache.try_get("9"), 9);
+
+  cache.resize(DefaultCacheCapacity);
+  EXPECT_EQ(cache.shard_count(), SQLQueryCache<int>::MaxShardCount);
+  for (auto value = 0; value < 16; ++value) {
+    cache.set(std::to_string(value), value);
+    EXPECT_EQ(cache.try_get(std::to_string(value)), value);
+  }
+
+  // Resizing a cache of 16 shards to 16 entries still caches every entry that fits into the single remaining shard
+  cache.resize(16);
+  EXPECT_EQ(cache.shard_count(), 1u);
+  for (auto value = 0; value < 16; ++value) {
+    cache.set(std::to_string(value), value);
+  }
+  EXPECT_EQ(cache.size(), 16u);
+
+  cache.clear();
+  EXPECT_EQ(cache.size(), 0u);
+}
+
+TEST_F(SQLBasicCacheTest, SQLQueryCacheResizeKeepsCacheType) {
+  SQLQueryCache<int> cache;
+  cache.replace_cache_impl<LRUCache<std::string, int>>(DefaultCacheCapacity);
+  ASSERT_EQ(cache.shard_count(), SQLQueryCache<int>::MaxShardCount);
+
+  // After re-creating the shards, the cache still evicts the least recently used entry, although GDFS would keep the
+  // frequently used one
+  cache.resize(3);
+  ASSERT_EQ(cache.shard_count(), 1u);
+  cache.set("a", 1);
+  EXPECT_EQ(cache.try_get("a"), 1);
+  EXPECT_EQ(cache.try_get("a"), 1);
+  cache.set("b", 2);
+  cache.set("c", 3);
+  cache.set("d", 4);
+  EXPECT_FALSE(cache.has("a"));
+  EXPECT_TRUE(cache.has("b"));
+}
+
+TEST_F(SQLBasicCacheTest, SQLQueryCacheConcurrentResize) {
+  SQLQueryCache<int> cache;
+
+  // Lookups and insertions continue while the shards are re-created
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_id = 0; thread_id < 4; ++thread_id) {
+    threads.emplace_back([&, thread_id]() {
+      for (auto value = 0; value < 1000; ++value) {
+        const auto query = std::to_string(thread_id * 1000 + value);
+        cache.set(query, value);
+        const auto cached_value = cache.try_get(query);
+        if (cached_value) EXPECT_EQ(*cached_value, value);
+      }
+    });
+  }
+
+  for (auto iteration = 0; iteration < 100; ++iteration) {
+    cache.resize(iteration % 2 == 0 ? 16 : DefaultCacheCapacity);
+  }
+
+  for (auto& thread : threads) thread.join();
+
+  EXPECT_EQ(cache.shard_count(), SQLQueryCache<int>::MaxShardCount);
+  EXPECT_LE(cache.size(), DefaultCacheCapacity);
+}
+
+TEST_F(SQLBasicCacheTest, SQLQueryCacheSingleShard) {
+  // Small caches use a single shard and thus evict exactly like the underlying cache
+  SQLQueryCache<int> cache(2);
+  cache.replace_cache_impl<LRUCache<std::string, int>>(2);
+  ASSERT_EQ(cache.shard_count(), 1u);
+
+  cache.set("a", 1);
+  cache.set("b", 2);
+  EXPECT_EQ(cache.try_get("a"), 1);
+  cache.set("c", 3);  // Evict b.
+
+  EXPECT_TRUE(cache.has("a"));
+  EXPECT_FALSE(cache.has("b"));
+  EXPECT_TRUE(cache.has("c"));
+}
+
 }  // namespace opossum
@@ -14,7 +14,10 @@
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/resource_group.hpp"
+#include "scheduler/resource_group_manager.hpp"
 #include "scheduler/topology.hpp"
+#include "sql/parameterized_plan_cache.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "sql/sql_pipeline_statement.hpp"
 #include "storage/storage_manager.hpp"
@@ -71,6 +74,7 @@ class SQLPipelineStatementTest : public BaseTest {
     hsql::SQLParser::parse(_multi_statement_dependant, _multi_statement_parse_result.get());
 
     SQLQueryCache<SQLQueryPlan>::get().clear();
+    ParameterizedPlanCache::get().clear();
   }
 
   std::shared_ptr<Table> _table_a;
@@ -762,4 +766,53 @@ TEST_F(SQLPipelineStatementTest, CopySubselectFromCache) {
   EXPECT_TABLE_EQ_UNORDERED(second_subselect_result, expected_second_result);
 }
 
+TEST_F(SQLPipelineStatementTest, ResourceGroupByEstimatedCost) {
+  const auto query = std::string{"SELECT * FROM table_a WHERE a > 1000"};
+  auto& manager = ResourceGroupManager::get();
+
+  // The scan of the three rows of table_a is the only operator with a cost
+  auto short_statement = SQLPipelineBuilder{query}.create_pipeline_statement();
+  ASSERT_TRUE(short_statement.get_query_plan()->estimated_cost());
+  EXPECT_FLOAT_EQ(*short_statement.get_query_plan()->estimated_cost(), 3.0f);
+  EXPECT_EQ(short_statement.get_resource_group(), manager.short_query_group());
+  for (const auto& task : short_statement.get_tasks()) {
+    EXPECT_EQ(task->priority(), SchedulePriority::Default);
+  }
+
+  // The cached plan keeps its estimated cost
+  manager.set_heavy_query_cost_threshold(2.0f);
+  auto heavy_statement = SQLPipelineBuilder{query}.create_pipeline_statement();
+  EXPECT_EQ(heavy_statement.get_resource_group(), manager.heavy_query_group());
+  for (const auto& task : heavy_statement.get_tasks()) {
+    EXPECT_EQ(task->priority(), SchedulePriority::Lowest);
+  }
+  EXPECT_EQ(heavy_statement.get_result_table()->row_count(), 2u);
+  EXPECT_EQ(manager.heavy_query_group()->running_query_count(), 0u);
+
+  // We cannot estimate the cost of INSERTs
+  manager.set_heavy_query_cost_threshold(0.0f);
+  auto insert_statement = SQLPipelineBuilder{"INSERT INTO table_a VALUES (1, 1.0)"}.create_pipeline_statement();
+  EXPECT_FALSE(insert_statement.get_query_plan()->estimated_cost());
+  EXPECT_EQ(insert_statement.get_resource_group(), manager.short_query_group());
+
+  // Without a threshold, the cost is not estimated
+  manager.set_heavy_query_cost_threshold(std::nullopt);
+  auto unestimated_statement = SQLPipelineBuilder{"SELECT * FROM table_a WHERE a > 2000"}.create_pipeline_statement();
+  EXPECT_FALSE(unestimated_statement.get_query_plan()->estimated_cost());
+  EXPECT_EQ(unestimated_statement.get_resource_group(), manager.short_query_group());
+}
+
+TEST_F(SQLPipelineStatementTest, ExplicitResourceGroup) {
+  const auto resource_group = std::make_shared<ResourceGroup>("reporting", SchedulePriority::Highest, 1);
+
+  auto statement = SQLPipelineBuilder{_join_query}.with_resource_group(resource_group).create_pipeline_statement();
+  EXPECT_EQ(statement.get_resource_group(), resource_group);
+  for (const auto& task : statement.get_tasks()) {
+    EXPECT_EQ(task->priority(), SchedulePriority::Highest);
+  }
+
+  EXPECT_TABLE_EQ_UNORDERED(statement.get_result_table(), _join_result);
+  EXPECT_EQ(resource_group->running_query_count(), 0u);
+}
+
 }  // namespace opossum
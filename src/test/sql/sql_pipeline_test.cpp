@@ -7,16 +7,25 @@
 #include "SQLParserResult.h"
 #include "gtest/gtest.h"
 #include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_translator.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
 
 #include "operators/abstract_join_operator.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/join_index.hpp"
 #include "operators/print.hpp"
 #include "operators/validate.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
 #include "scheduler/topology.hpp"
+#include "sql/parameterized_plan_cache.hpp"
 #include "sql/sql_pipeline.hpp"
 #include "sql/sql_pipeline_builder.hpp"
+#include "statistics/column_statistics.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
 #include "storage/storage_manager.hpp"
 
 namespace {
@@ -58,6 +67,7 @@ class SQLPipelineTest : public BaseTest {
     _join_result->append({12345, 458.7f, 457.7f});
 
     SQLQueryCache<SQLQueryPlan>::get().clear();
+    ParameterizedPlanCache::get().clear();
   }
 
   std::shared_ptr<Table> _table_a;
@@ -411,6 +421,70 @@ TEST_F(SQLPipelineTest, DisabledCleanupWithScheduler) {
   }
 }
 
+TEST_F(SQLPipelineTest, GetResultTablesPipelinedWithScheduler) {
+  const auto sql = "INSERT INTO table_a VALUES (11, 11.11); SELECT * FROM table_b; SELECT * FROM table_a";
+  auto sql_pipeline = SQLPipelineBuilder{sql}.create_pipeline();
+
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+  const auto& tables = sql_pipeline.get_result_tables();
+
+  // The last statement is executed after the INSERT, the second one might be executed concurrently
+  ASSERT_EQ(tables.size(), 3u);
+  EXPECT_EQ(tables[0], nullptr);
+  EXPECT_TABLE_EQ_UNORDERED(tables[1], _table_b);
+  EXPECT_TABLE_EQ_UNORDERED(tables[2], _table_a_multi);
+}
+
+TEST_F(SQLPipelineTest, GetResultTablesPipelinedModifyingReadTable) {
+  // The DELETE must not be executed before the first SELECT
+  const auto sql = "SELECT * FROM table_a; DELETE FROM table_a WHERE a > 0; SELECT * FROM table_a";
+  auto sql_pipeline = SQLPipelineBuilder{sql}.create_pipeline();
+
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+  const auto& tables = sql_pipeline.get_result_tables();
+
+  ASSERT_EQ(tables.size(), 3u);
+  EXPECT_TABLE_EQ_UNORDERED(tables[0], _table_a);
+  EXPECT_EQ(tables[2]->row_count(), 0u);
+}
+
+TEST_F(SQLPipelineTest, GetResultTablesPipelinedBadQuery) {
+  const auto sql = "SELECT * FROM table_a; SELECT a + not_a_column FROM table_a";
+  auto sql_pipeline = SQLPipelineBuilder{sql}.create_pipeline();
+
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  EXPECT_THROW(sql_pipeline.get_result_tables(), std::exception);
+}
+
+TEST_F(SQLPipelineTest, GetResultTablesPipelinedNoModificationAfterFailedStatement) {
+  // Fails to plan statements that read table_b, after their SQL was translated
+  class FailingLQPTranslator : public LQPTranslator {
+   public:
+    std::shared_ptr<AbstractOperator> translate_node(const std::shared_ptr<AbstractLQPNode>& node) const override {
+      if (node->type == LQPNodeType::StoredTable &&
+          std::static_pointer_cast<StoredTableNode>(node)->table_name == "table_b") {
+        Fail("Cannot translate table_b");
+      }
+      return LQPTranslator::translate_node(node);
+    }
+  };
+
+  // The INSERT is independent of the failing first statement, but must not be executed after it failed
+  const auto sql = "SELECT * FROM table_b; INSERT INTO table_a VALUES (11, 11.11)";
+  auto sql_pipeline =
+      SQLPipelineBuilder{sql}.with_lqp_translator(std::make_shared<FailingLQPTranslator>()).create_pipeline();
+
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  EXPECT_THROW(sql_pipeline.get_result_tables(), std::exception);
+  EXPECT_EQ(_table_a->row_count(), 3u);
+}
+
 TEST_F(SQLPipelineTest, GetResultTableBadQuery) {
   auto sql = "SELECT a + not_a_column FROM table_a";
   auto sql_pipeline = SQLPipelineBuilder{sql}.create_pipeline();
@@ -545,4 +619,37 @@ TEST_F(SQLPipelineTest, CacheQueryPlanTwice) {
   EXPECT_TRUE(cache.has("INSERT INTO table_a VALUES (11, 11.11);"));
 }
 
+TEST_F(SQLPipelineTest, JoinOperatorDependsOnInputSizes) {
+  const auto indexed_table = load_table("src/test/tables/int_float2.tbl", 2);
+  ChunkEncoder::encode_all_chunks(indexed_table);
+  indexed_table->create_index<GroupKeyIndex>({ColumnID{0}});
+  StorageManager::get().add_table("table_indexed", indexed_table);
+
+  const auto large_table_statistics = std::make_shared<TableStatistics>(
+      TableType::Data, 10'000,
+      std::vector<std::shared_ptr<const BaseColumnStatistics>>{
+          std::make_shared<ColumnStatistics<int32_t>>(0.0f, 10'000, 0, 9'999),
+          std::make_shared<ColumnStatistics<float>>(0.0f, 10'000, 0.0f, 9'999.0f)});
+  indexed_table->set_table_statistics(large_table_statistics);
+
+  const auto join_query = "SELECT * FROM table_a, table_indexed WHERE table_a.a = table_indexed.a";
+  const auto get_join_operator = [&]() {
+    SQLQueryCache<SQLQueryPlan>::get().clear();
+    ParameterizedPlanCache::get().clear();
+
+    // Without MVCC, the StoredTableNode of table_indexed is the right input of the JoinNode
+    auto sql_pipeline = SQLPipelineBuilder{join_query}.disable_mvcc().create_pipeline();
+    auto op = std::shared_ptr<const AbstractOperator>{sql_pipeline.get_query_plans().at(0)->tree_roots().at(0)};
+    while (op && !std::dynamic_pointer_cast<const AbstractJoinOperator>(op)) op = op->input_left();
+    return op;
+  };
+
+  // Looking up the few rows of table_a in the index is cheaper than hashing the large table_indexed
+  EXPECT_TRUE(std::dynamic_pointer_cast<const JoinIndex>(get_join_operator()));
+
+  // If both inputs are large, the JoinHash is cheaper
+  _table_a->set_table_statistics(large_table_statistics);
+  EXPECT_TRUE(std::dynamic_pointer_cast<const JoinHash>(get_join_operator()));
+}
+
 }  // namespace opossum
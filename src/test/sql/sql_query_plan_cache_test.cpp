@@ -7,6 +7,7 @@
 #include "sql/gdfs_cache.hpp"
 #include "sql/lru_cache.hpp"
 #include "sql/lru_k_cache.hpp"
+#include "sql/parameterized_plan_cache.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "sql/sql_pipeline_statement.hpp"
 #include "sql/sql_query_cache.hpp"
@@ -27,6 +28,7 @@ class SQLQueryPlanCacheTest : public BaseTest {
     _query_plan_cache_hits = 0;
 
     SQLQueryCache<SQLQueryPlan>::get().clear();
+    ParameterizedPlanCache::get().clear();
   }
 
   void execute_query(const std::string& query) {
@@ -19,6 +19,7 @@
 #include "scheduler/node_queue_scheduler.hpp"
 #include "scheduler/operator_task.hpp"
 #include "scheduler/topology.hpp"
+#include "sql/parameterized_plan_cache.hpp"
 #include "sql/sql_pipeline.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "sql/sql_pipeline_statement.hpp"
@@ -63,6 +64,7 @@ class SQLiteTestRunner : public BaseTestWithParam<std::string> {
     opossum::CurrentScheduler::set(std::make_shared<opossum::NodeQueueScheduler>());
 
     SQLQueryCache<SQLQueryPlan>::get().clear();
+    ParameterizedPlanCache::get().clear();
   }
 
   std::unique_ptr<SQLiteWrapper> _sqlite;
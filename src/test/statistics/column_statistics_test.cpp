@@ -134,10 +134,9 @@ TEST_F(ColumnStatisticsTest, LessThanTest) {
   std::vector<float> selectivities_int{0.f, 0.f, 1.f / 3.f, 5.f / 6.f, 1.f};
   predict_selectivities_and_compare(_column_statistics_int, predicate_condition, _int_values, selectivities_int);
 
-  std::vector<float> selectivities_float{0.f, 0.f, 0.4f, 1.f, 1.f};
-  predict_selectivities_and_compare(_column_statistics_float, predicate_condition, _float_values, selectivities_float);
-  predict_selectivities_and_compare(_column_statistics_double, predicate_condition, _double_values,
-                                    selectivities_float);
+  // The generated Histograms store the exact row count of each value, so floats behave like integers here
+  predict_selectivities_and_compare(_column_statistics_float, predicate_condition, _float_values, selectivities_int);
+  predict_selectivities_and_compare(_column_statistics_double, predicate_condition, _double_values, selectivities_int);
 }
 
 TEST_F(ColumnStatisticsTest, LessEqualThanTest) {
@@ -146,7 +145,8 @@ TEST_F(ColumnStatisticsTest, LessEqualThanTest) {
   std::vector<float> selectivities_int{0.f, 1.f / 6.f, 1.f / 2.f, 1.f, 1.f};
   predict_selectivities_and_compare(_column_statistics_int, predicate_condition, _int_values, selectivities_int);
 
-  std::vector<float> selectivities_float{0.f, 0.f, 0.4f, 1.f, 1.f};
+  // The generated Histograms store the exact row count of each value
+  std::vector<float> selectivities_float{0.f, 1.f / 6.f, 1.f / 2.f, 1.f, 1.f};
   predict_selectivities_and_compare(_column_statistics_float, predicate_condition, _float_values, selectivities_float);
   predict_selectivities_and_compare(_column_statistics_double, predicate_condition, _double_values,
                                     selectivities_float);
@@ -158,10 +158,9 @@ TEST_F(ColumnStatisticsTest, GreaterThanTest) {
   std::vector<float> selectivities_int{1.f, 5.f / 6.f, 1.f / 2.f, 0.f, 0.f};
   predict_selectivities_and_compare(_column_statistics_int, predicate_condition, _int_values, selectivities_int);
 
-  std::vector<float> selectivities_float{1.f, 1.f, 0.6f, 0.f, 0.f};
-  predict_selectivities_and_compare(_column_statistics_float, predicate_condition, _float_values, selectivities_float);
-  predict_selectivities_and_compare(_column_statistics_double, predicate_condition, _double_values,
-                                    selectivities_float);
+  // The generated Histograms store the exact row count of each value, so floats behave like integers here
+  predict_selectivities_and_compare(_column_statistics_float, predicate_condition, _float_values, selectivities_int);
+  predict_selectivities_and_compare(_column_statistics_double, predicate_condition, _double_values, selectivities_int);
 }
 
 TEST_F(ColumnStatisticsTest, GreaterEqualThanTest) {
@@ -170,7 +169,8 @@ TEST_F(ColumnStatisticsTest, GreaterEqualThanTest) {
   std::vector<float> selectivities_int{1.f, 1.f, 2.f / 3.f, 1.f / 6.f, 0.f};
   predict_selectivities_and_compare(_column_statistics_int, predicate_condition, _int_values, selectivities_int);
 
-  std::vector<float> selectivities_float{1.f, 1.f, 0.6f, 0.f, 0.f};
+  // The generated Histograms store the exact row count of each value
+  std::vector<float> selectivities_float{1.f, 1.f, 2.f / 3.f, 1.f / 6.f, 0.f};
   predict_selectivities_and_compare(_column_statistics_float, predicate_condition, _float_values, selectivities_float);
   predict_selectivities_and_compare(_column_statistics_double, predicate_condition, _double_values,
                                     selectivities_float);
@@ -185,7 +185,7 @@ TEST_F(ColumnStatisticsTest, BetweenTest) {
 
   std::vector<std::pair<float, float>> float_values{{-1.f, 0.f}, {-1.f, 2.f}, {1.f, 2.f}, {0.f, 7.f},
                                                     {5.f, 6.f},  {5.f, 8.f},  {7.f, 8.f}};
-  std::vector<float> selectivities_float{0.f, 1.f / 5.f, 1.f / 5.f, 1.f, 1.f / 5.f, 1.f / 5.f, 0.f};
+  std::vector<float> selectivities_float{0.f, 1.f / 3.f, 1.f / 3.f, 1.f, 1.f / 3.f, 1.f / 3.f, 0.f};
   predict_selectivities_and_compare(_column_statistics_float, predicate_condition, float_values, selectivities_float);
 
   std::vector<std::pair<double, double>> double_values{{-1., 0.}, {-1., 2.}, {1., 2.}, {0., 7.},
@@ -260,7 +260,7 @@ TEST_F(ColumnStatisticsTest, StoredProcedureBetweenTest) {
   predict_selectivities_for_stored_procedures_and_compare(_column_statistics_int, predicate_condition, _int_values,
                                                           selectivities_int);
 
-  std::vector<float> selectivities_float{0.f, 0.f, 2.f / 15.f, 1.f / 3.f, 1.f / 3.f};
+  std::vector<float> selectivities_float{0.f, 1.f / 18.f, 1.f / 6.f, 1.f / 3.f, 1.f / 3.f};
   predict_selectivities_for_stored_procedures_and_compare(_column_statistics_float, predicate_condition, _float_values,
                                                           selectivities_float);
   predict_selectivities_for_stored_procedures_and_compare(_column_statistics_double, predicate_condition,
@@ -365,7 +365,7 @@ TEST_F(ColumnStatisticsTest, NonNullRatioOneColumnTest) {
   result = _column_statistics_int->estimate_predicate_with_value(predicate_condition, AllTypeVariant(3));
   EXPECT_FLOAT_EQ(result.selectivity, 0.75f * 2.f / 6.f);
   result = _column_statistics_float->estimate_predicate_with_value(predicate_condition, AllTypeVariant(3.f));
-  EXPECT_FLOAT_EQ(result.selectivity, 0.5f * 2.f / 5.f);
+  EXPECT_FLOAT_EQ(result.selectivity, 0.5f * 2.f / 6.f);
   result = _column_statistics_string->estimate_predicate_with_value(predicate_condition, AllTypeVariant("c"));
   EXPECT_FLOAT_EQ(result.selectivity, 0.f);
 
@@ -373,7 +373,7 @@ TEST_F(ColumnStatisticsTest, NonNullRatioOneColumnTest) {
   result = _column_statistics_int->estimate_predicate_with_value(predicate_condition, AllTypeVariant(3));
   EXPECT_FLOAT_EQ(result.selectivity, 0.75f * 4.f / 6.f);
   result = _column_statistics_float->estimate_predicate_with_value(predicate_condition, AllTypeVariant(3.f));
-  EXPECT_FLOAT_EQ(result.selectivity, 0.5f * 3.f / 5.f);
+  EXPECT_FLOAT_EQ(result.selectivity, 0.5f * 4.f / 6.f);
   result = _column_statistics_string->estimate_predicate_with_value(predicate_condition, AllTypeVariant("c"));
   EXPECT_FLOAT_EQ(result.selectivity, 0.f);
 
@@ -383,7 +383,7 @@ TEST_F(ColumnStatisticsTest, NonNullRatioOneColumnTest) {
   EXPECT_FLOAT_EQ(result.selectivity, 0.75f * 3.f / 6.f);
   result = _column_statistics_float->estimate_predicate_with_value(predicate_condition, AllTypeVariant(4.f),
                                                                    AllTypeVariant(6.f));
-  EXPECT_FLOAT_EQ(result.selectivity, 0.5f * 2.f / 5.f);
+  EXPECT_FLOAT_EQ(result.selectivity, 0.5f * 3.f / 6.f);
   result = _column_statistics_string->estimate_predicate_with_value(predicate_condition, AllTypeVariant("c"),
                                                                     AllTypeVariant("d"));
   EXPECT_FLOAT_EQ(result.selectivity, 0.f);
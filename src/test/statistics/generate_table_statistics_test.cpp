@@ -1,9 +1,13 @@
 #include "gtest/gtest.h"
 
+#include "statistics/chunk_statistics/chunk_statistics.hpp"
 #include "statistics/column_statistics.hpp"
 #include "statistics/generate_table_statistics.hpp"
+#include "statistics/histogram.hpp"
 #include "statistics/table_statistics.hpp"
 #include "statistics_test_utils.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/table.hpp"
 #include "utils/load_table.hpp"
 
 namespace opossum {
@@ -24,4 +28,62 @@ TEST_F(GenerateTableStatisticsTest, GenerateTableStatisticsUnsampled) {
   EXPECT_FLOAT_COLUMN_STATISTICS(table_statistics.column_statistics().at(5), 0.0f, 150, -986.96f, 9983.38f);
 }
 
+TEST_F(GenerateTableStatisticsTest, GenerateTableStatisticsFromChunkStatistics) {
+  const auto table = load_table("src/test/tables/tpch/sf-0.001/customer.tbl", 40);
+  ChunkEncoder::encode_chunks(table, {ChunkID{0}, ChunkID{1}, ChunkID{2}});
+
+  // Encoding does not generate the statistics of a chunk yet, the last chunk is still mutable
+  ASSERT_TRUE(table->get_chunk(ChunkID{0})->statistics());
+  EXPECT_FALSE(table->get_chunk(ChunkID{0})->statistics()->table_statistics());
+  EXPECT_FALSE(table->get_chunk(ChunkID{3})->statistics());
+
+  const auto table_statistics = generate_table_statistics(*table);
+
+  // Encoded chunks cache their statistics, the mutable chunk gets scanned each time
+  ASSERT_TRUE(table->get_chunk(ChunkID{0})->statistics()->table_statistics());
+  EXPECT_EQ(table->get_chunk(ChunkID{0})->statistics()->table_statistics()->row_count(), 40u);
+  EXPECT_FALSE(table->get_chunk(ChunkID{3})->statistics());
+  EXPECT_EQ(generate_table_statistics(*table).row_count(), 150u);
+
+  ASSERT_EQ(table_statistics.column_statistics().size(), 8u);
+  EXPECT_EQ(table_statistics.row_count(), 150u);
+
+  // Distinct counts of merged chunk statistics are estimated, min and max are exact
+  const auto c_custkey_statistics =
+      std::dynamic_pointer_cast<const ColumnStatistics<int32_t>>(table_statistics.column_statistics().at(0));
+  ASSERT_TRUE(c_custkey_statistics);
+  EXPECT_NEAR(c_custkey_statistics->distinct_count(), 150.0f, 5.0f);
+  EXPECT_EQ(c_custkey_statistics->min(), 1);
+  EXPECT_EQ(c_custkey_statistics->max(), 150);
+
+  const auto c_nationkey_statistics =
+      std::dynamic_pointer_cast<const ColumnStatistics<int32_t>>(table_statistics.column_statistics().at(3));
+  ASSERT_TRUE(c_nationkey_statistics);
+  EXPECT_NEAR(c_nationkey_statistics->distinct_count(), 25.0f, 1.0f);
+  EXPECT_EQ(c_nationkey_statistics->min(), 0);
+  EXPECT_EQ(c_nationkey_statistics->max(), 24);
+}
+
+TEST_F(GenerateTableStatisticsTest, MergeTableStatistics) {
+  const auto table = load_table("src/test/tables/tpch/sf-0.001/customer.tbl", 100);
+  const auto data_types = table->column_data_types();
+
+  const auto first_chunk_statistics = generate_chunk_statistics(table->get_chunk(ChunkID{0}), data_types);
+  const auto second_chunk_statistics = generate_chunk_statistics(table->get_chunk(ChunkID{1}), data_types);
+  EXPECT_EQ(first_chunk_statistics.row_count(), 100u);
+  EXPECT_EQ(second_chunk_statistics.row_count(), 50u);
+
+  const auto merged_statistics = first_chunk_statistics.merge(second_chunk_statistics);
+  EXPECT_EQ(merged_statistics.row_count(), 150u);
+
+  const auto c_acctbal_statistics =
+      std::dynamic_pointer_cast<const ColumnStatistics<float>>(merged_statistics.column_statistics().at(5));
+  ASSERT_TRUE(c_acctbal_statistics);
+  EXPECT_NEAR(c_acctbal_statistics->distinct_count(), 150.0f, 5.0f);
+  EXPECT_FLOAT_EQ(c_acctbal_statistics->min(), -986.96f);
+  EXPECT_FLOAT_EQ(c_acctbal_statistics->max(), 9983.38f);
+  ASSERT_TRUE(c_acctbal_statistics->histogram());
+  EXPECT_FLOAT_EQ(c_acctbal_statistics->histogram()->total_count(), 150.0f);
+}
+
 }  // namespace opossum
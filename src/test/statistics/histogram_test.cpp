@@ -0,0 +1,206 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "statistics/column_statistics.hpp"
+#include "statistics/generate_column_statistics.hpp"
+#include "statistics/histogram.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+class HistogramTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    // Values 1..100 occur once, except for 42, which occurs 1000 times
+    for (auto value = int32_t{1}; value <= 100; ++value) {
+      skewed_value_counts.emplace_back(value, value == 42 ? 1000.0f : 1.0f);
+    }
+  }
+
+  std::vector<std::pair<int32_t, float>> skewed_value_counts;
+};
+
+TEST_F(HistogramTest, FromValueCounts) {
+  const auto histogram = Histogram<int32_t>::from_value_counts(skewed_value_counts, 1, 3);
+
+  EXPECT_FLOAT_EQ(histogram->total_count(), 1099.0f);
+
+  ASSERT_EQ(histogram->top_values().size(), 1u);
+  EXPECT_EQ(histogram->top_values().at(0).first, 42);
+  EXPECT_FLOAT_EQ(histogram->top_values().at(0).second, 1000.0f);
+
+  // The 99 remaining values are distributed among three buckets of 33 values each
+  ASSERT_EQ(histogram->buckets().size(), 3u);
+  EXPECT_EQ(histogram->buckets().at(0).min, 1);
+  EXPECT_EQ(histogram->buckets().at(0).max, 33);
+  EXPECT_FLOAT_EQ(histogram->buckets().at(0).row_count, 33.0f);
+  EXPECT_EQ(histogram->buckets().at(1).min, 34);
+  EXPECT_EQ(histogram->buckets().at(1).max, 67);
+  EXPECT_FLOAT_EQ(histogram->buckets().at(1).distinct_count, 33.0f);
+  EXPECT_EQ(histogram->buckets().at(2).min, 68);
+  EXPECT_EQ(histogram->buckets().at(2).max, 100);
+}
+
+TEST_F(HistogramTest, EstimateEquals) {
+  const auto histogram = Histogram<int32_t>::from_value_counts(skewed_value_counts, 1, 3);
+
+  EXPECT_FLOAT_EQ(histogram->estimate_equals(42), 1000.0f);
+  EXPECT_FLOAT_EQ(histogram->estimate_equals(1), 1.0f);
+  EXPECT_FLOAT_EQ(histogram->estimate_equals(50), 1.0f);
+  EXPECT_FLOAT_EQ(histogram->estimate_equals(0), 0.0f);
+  EXPECT_FLOAT_EQ(histogram->estimate_equals(101), 0.0f);
+}
+
+TEST_F(HistogramTest, EstimateRange) {
+  const auto histogram = Histogram<int32_t>::from_value_counts(skewed_value_counts, 1, 3);
+
+  const auto estimate_first_bucket = histogram->estimate_range(1, 10);
+  EXPECT_FLOAT_EQ(estimate_first_bucket.row_count, 10.0f);
+  EXPECT_FLOAT_EQ(estimate_first_bucket.distinct_count, 10.0f);
+
+  // 34..67 contains 33 distinct values spread over 34 possible values
+  const auto estimate_with_top_value = histogram->estimate_range(40, 45);
+  EXPECT_NEAR(estimate_with_top_value.row_count, 1005.0f, 1.0f);
+  EXPECT_NEAR(estimate_with_top_value.distinct_count, 6.0f, 1.0f);
+
+  const auto estimate_all = histogram->estimate_range(0, 200);
+  EXPECT_FLOAT_EQ(estimate_all.row_count, 1099.0f);
+  EXPECT_FLOAT_EQ(estimate_all.distinct_count, 100.0f);
+
+  EXPECT_FLOAT_EQ(histogram->estimate_range(101, 200).row_count, 0.0f);
+  EXPECT_FLOAT_EQ(histogram->estimate_range(50, 40).row_count, 0.0f);
+}
+
+TEST_F(HistogramTest, EstimateEquiJoin) {
+  const auto skewed_histogram = Histogram<int32_t>::from_value_counts(skewed_value_counts, 1, 3);
+
+  // Values 1..100 occurring once each
+  auto uniform_value_counts = std::vector<std::pair<int32_t, float>>{};
+  for (auto value = int32_t{1}; value <= 100; ++value) {
+    uniform_value_counts.emplace_back(value, 1.0f);
+  }
+  const auto uniform_histogram = Histogram<int32_t>::from_value_counts(uniform_value_counts, 1, 4);
+
+  // Each value of the uniform column finds its matches, 42 finds 1000 of them
+  EXPECT_NEAR(skewed_histogram->estimate_equi_join(*uniform_histogram), 1099.0f, 1.0f);
+  EXPECT_NEAR(uniform_histogram->estimate_equi_join(*skewed_histogram), 1099.0f, 1.0f);
+
+  // Self join: 42 alone contributes 1000 * 1000 rows
+  EXPECT_NEAR(skewed_histogram->estimate_equi_join(*skewed_histogram), 1'000'099.0f, 1.0f);
+}
+
+TEST_F(HistogramTest, Strings) {
+  const auto histogram = Histogram<std::string>::from_value_counts(
+      {{"a", 1.0f}, {"b", 1.0f}, {"c", 10.0f}, {"d", 1.0f}, {"e", 1.0f}}, 1, 2);
+
+  EXPECT_FLOAT_EQ(histogram->total_count(), 14.0f);
+  EXPECT_FLOAT_EQ(histogram->estimate_equals("c"), 10.0f);
+  EXPECT_FLOAT_EQ(histogram->estimate_equals("a"), 1.0f);
+  EXPECT_FLOAT_EQ(histogram->estimate_equals("x"), 0.0f);
+
+  // Partially covered buckets contribute half of their rows
+  EXPECT_FLOAT_EQ(histogram->estimate_range("a", "a").row_count, 1.0f);
+  EXPECT_FLOAT_EQ(histogram->estimate_range("a", "z").row_count, 14.0f);
+}
+
+TEST_F(HistogramTest, Merge) {
+  // Split the skewed values into two halves, with 42 occurring in both of them
+  auto lower_value_counts = std::vector<std::pair<int32_t, float>>{};
+  auto upper_value_counts = std::vector<std::pair<int32_t, float>>{};
+  for (const auto& value_count : skewed_value_counts) {
+    if (value_count.first == 42) {
+      lower_value_counts.emplace_back(42, 400.0f);
+      upper_value_counts.emplace_back(42, 600.0f);
+    } else if (value_count.first < 50) {
+      lower_value_counts.emplace_back(value_count);
+    } else {
+      upper_value_counts.emplace_back(value_count);
+    }
+  }
+
+  const auto lower_histogram = Histogram<int32_t>::from_value_counts(lower_value_counts, 1, 3);
+  const auto upper_histogram = Histogram<int32_t>::from_value_counts(upper_value_counts, 1, 3);
+  const auto merged_histogram = lower_histogram->merge(*upper_histogram, 1, 3);
+
+  EXPECT_FLOAT_EQ(merged_histogram->total_count(), 1099.0f);
+  ASSERT_EQ(merged_histogram->top_values().size(), 1u);
+  EXPECT_EQ(merged_histogram->top_values().at(0).first, 42);
+  EXPECT_FLOAT_EQ(merged_histogram->top_values().at(0).second, 1000.0f);
+  EXPECT_EQ(merged_histogram->buckets().size(), 3u);
+
+  EXPECT_NEAR(merged_histogram->estimate_equals(10), 1.0f, 0.1f);
+  EXPECT_NEAR(merged_histogram->estimate_range(1, 100).distinct_count, 100.0f, 1.0f);
+  EXPECT_FLOAT_EQ(merged_histogram->estimate_equals(101), 0.0f);
+}
+
+TEST_F(HistogramTest, MergeOverlappingBuckets) {
+  const auto histogram_a = std::make_shared<Histogram<int32_t>>(
+      std::vector<std::pair<int32_t, float>>{{5, 10.0f}},
+      std::vector<Histogram<int32_t>::Bucket>{{1, 10, 9.0f, 9.0f}, {11, 20, 10.0f, 10.0f}});
+  const auto histogram_b = std::make_shared<Histogram<int32_t>>(
+      std::vector<std::pair<int32_t, float>>{{15, 20.0f}},
+      std::vector<Histogram<int32_t>::Bucket>{{1, 10, 10.0f, 10.0f}, {16, 30, 14.0f, 14.0f}});
+
+  const auto merged_histogram = histogram_a->merge(*histogram_b, 2, 2);
+  EXPECT_FLOAT_EQ(merged_histogram->total_count(), histogram_a->total_count() + histogram_b->total_count());
+
+  // Both top values remain top values. Their rows in the buckets of the other Histogram are moved to the top values.
+  ASSERT_EQ(merged_histogram->top_values().size(), 2u);
+  EXPECT_EQ(merged_histogram->top_values().at(0).first, 5);
+  EXPECT_FLOAT_EQ(merged_histogram->top_values().at(0).second, 11.0f);
+  EXPECT_EQ(merged_histogram->top_values().at(1).first, 15);
+  EXPECT_FLOAT_EQ(merged_histogram->top_values().at(1).second, 21.0f);
+
+  ASSERT_EQ(merged_histogram->buckets().size(), 2u);
+  EXPECT_EQ(merged_histogram->buckets().at(0).min, 1);
+  EXPECT_EQ(merged_histogram->buckets().at(0).max, 10);
+  EXPECT_FLOAT_EQ(merged_histogram->buckets().at(0).row_count, 18.0f);
+  EXPECT_FLOAT_EQ(merged_histogram->buckets().at(0).distinct_count, 9.0f);
+  EXPECT_EQ(merged_histogram->buckets().at(1).min, 11);
+  EXPECT_EQ(merged_histogram->buckets().at(1).max, 30);
+}
+
+TEST_F(HistogramTest, ColumnStatisticsUseHistogram) {
+  auto column_statistics = ColumnStatistics<int32_t>{0.0f, 100, 1, 100};
+
+  // Without a Histogram, values are assumed to be distributed uniformly
+  EXPECT_FLOAT_EQ(column_statistics.estimate_predicate_with_value(PredicateCondition::Equals, 42).selectivity, 0.01f);
+
+  column_statistics.set_histogram(Histogram<int32_t>::from_value_counts(skewed_value_counts, 1, 3));
+
+  EXPECT_FLOAT_EQ(column_statistics.estimate_predicate_with_value(PredicateCondition::Equals, 42).selectivity,
+                  1000.0f / 1099.0f);
+  EXPECT_FLOAT_EQ(column_statistics.estimate_predicate_with_value(PredicateCondition::NotEquals, 42).selectivity,
+                  99.0f / 1099.0f);
+  EXPECT_FLOAT_EQ(column_statistics.estimate_predicate_with_value(PredicateCondition::LessThan, 34).selectivity,
+                  33.0f / 1099.0f);
+  EXPECT_FLOAT_EQ(
+      column_statistics.estimate_predicate_with_value(PredicateCondition::GreaterThanEquals, 68).selectivity,
+      33.0f / 1099.0f);
+
+  // Clones keep the Histogram
+  const auto clone = std::static_pointer_cast<ColumnStatistics<int32_t>>(column_statistics.clone());
+  EXPECT_EQ(clone->histogram(), column_statistics.histogram());
+}
+
+TEST_F(HistogramTest, GenerateColumnStatistics) {
+  const auto table = load_table("src/test/tables/int_float_double_string.tbl");
+
+  const auto column_statistics = std::dynamic_pointer_cast<ColumnStatistics<int32_t>>(
+      generate_column_statistics<int32_t>(*table, ColumnID{0}));
+  ASSERT_TRUE(column_statistics);
+  ASSERT_TRUE(column_statistics->histogram());
+  EXPECT_FLOAT_EQ(column_statistics->histogram()->total_count(), static_cast<float>(table->row_count()));
+
+  const auto string_column_statistics = std::dynamic_pointer_cast<ColumnStatistics<std::string>>(
+      generate_column_statistics<std::string>(*table, ColumnID{3}));
+  ASSERT_TRUE(string_column_statistics);
+  ASSERT_TRUE(string_column_statistics->histogram());
+  EXPECT_FLOAT_EQ(string_column_statistics->histogram()->total_count(), static_cast<float>(table->row_count()));
+}
+
+}  // namespace opossum
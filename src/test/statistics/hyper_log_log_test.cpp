@@ -0,0 +1,66 @@
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "statistics/hyper_log_log.hpp"
+
+namespace opossum {
+
+class HyperLogLogTest : public ::testing::Test {};
+
+TEST_F(HyperLogLogTest, Empty) {
+  const auto sketch = HyperLogLog{};
+  EXPECT_FLOAT_EQ(sketch.estimate_distinct_count(), 0.0f);
+}
+
+TEST_F(HyperLogLogTest, SmallCardinalities) {
+  auto sketch = HyperLogLog{};
+  for (auto value = int32_t{0}; value < 10; ++value) {
+    sketch.add(value);
+    sketch.add(value);
+  }
+  EXPECT_FLOAT_EQ(sketch.estimate_distinct_count(), 10.0f);
+
+  for (auto value = int32_t{10}; value < 100; ++value) {
+    sketch.add(value);
+  }
+  EXPECT_NEAR(sketch.estimate_distinct_count(), 100.0f, 2.0f);
+
+  auto string_sketch = HyperLogLog{};
+  string_sketch.add(std::string{"a"});
+  string_sketch.add(std::string{"b"});
+  string_sketch.add(std::string{"a"});
+  EXPECT_FLOAT_EQ(string_sketch.estimate_distinct_count(), 2.0f);
+}
+
+TEST_F(HyperLogLogTest, LargeCardinalities) {
+  auto sketch = HyperLogLog{};
+  for (auto value = int64_t{0}; value < 1'000'000; ++value) {
+    sketch.add(value);
+  }
+
+  // The standard error is about 1.6%
+  EXPECT_NEAR(sketch.estimate_distinct_count(), 1'000'000.0f, 50'000.0f);
+}
+
+TEST_F(HyperLogLogTest, Merge) {
+  auto sketch_a = HyperLogLog{};
+  auto sketch_b = HyperLogLog{};
+
+  for (auto value = int64_t{0}; value < 60'000; ++value) {
+    sketch_a.add(value);
+  }
+  for (auto value = int64_t{40'000}; value < 100'000; ++value) {
+    sketch_b.add(value);
+  }
+
+  sketch_a.merge(sketch_b);
+  EXPECT_NEAR(sketch_a.estimate_distinct_count(), 100'000.0f, 5'000.0f);
+
+  // Merging a sketch with itself doesn't change it
+  const auto distinct_count = sketch_a.estimate_distinct_count();
+  sketch_a.merge(sketch_a);
+  EXPECT_FLOAT_EQ(sketch_a.estimate_distinct_count(), distinct_count);
+}
+
+}  // namespace opossum
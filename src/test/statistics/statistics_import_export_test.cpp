@@ -5,6 +5,7 @@
 
 #include "base_test.hpp"
 #include "statistics/column_statistics.hpp"
+#include "statistics/histogram.hpp"
 #include "statistics/statistics_import_export.hpp"
 #include "statistics/table_statistics.hpp"
 #include "statistics_test_utils.hpp"
@@ -44,4 +45,36 @@ TEST_F(StatisticsImportExportTest, EndToEnd) {
   EXPECT_STRING_COLUMN_STATISTICS(imported_table_statistics.column_statistics().at(4), 0.7f, 53.3f, "abc", "xyz");
 }
 
+TEST_F(StatisticsImportExportTest, Histogram) {
+  auto column_statistics = std::make_shared<ColumnStatistics<int32_t>>(0.0f, 4.0f, 1, 10);
+  column_statistics->set_histogram(std::make_shared<Histogram<int32_t>>(
+      std::vector<std::pair<int32_t, float>>{{5, 20.0f}},
+      std::vector<Histogram<int32_t>::Bucket>{{1, 4, 3.0f, 2.0f}, {6, 10, 2.0f, 1.0f}}));
+
+  TableStatistics original_table_statistics{TableType::Data, 25, {column_statistics}};
+
+  const auto exported_statistics_file_path = test_data_path + "exported_table_statistics_test.json";
+
+  export_table_statistics(original_table_statistics, exported_statistics_file_path);
+
+  const auto imported_table_statistics = import_table_statistics(exported_statistics_file_path);
+  ASSERT_EQ(imported_table_statistics.column_statistics().size(), 1u);
+
+  const auto imported_column_statistics =
+      std::dynamic_pointer_cast<const ColumnStatistics<int32_t>>(imported_table_statistics.column_statistics().at(0));
+  ASSERT_TRUE(imported_column_statistics);
+
+  const auto histogram = imported_column_statistics->histogram();
+  ASSERT_TRUE(histogram);
+  ASSERT_EQ(histogram->top_values().size(), 1u);
+  EXPECT_EQ(histogram->top_values().at(0).first, 5);
+  EXPECT_FLOAT_EQ(histogram->top_values().at(0).second, 20.0f);
+  ASSERT_EQ(histogram->buckets().size(), 2u);
+  EXPECT_EQ(histogram->buckets().at(1).min, 6);
+  EXPECT_EQ(histogram->buckets().at(1).max, 10);
+  EXPECT_FLOAT_EQ(histogram->buckets().at(1).row_count, 2.0f);
+  EXPECT_FLOAT_EQ(histogram->buckets().at(1).distinct_count, 1.0f);
+  EXPECT_FLOAT_EQ(histogram->total_count(), 25.0f);
+}
+
 }  // namespace opossum
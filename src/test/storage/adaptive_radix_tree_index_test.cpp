@@ -115,6 +115,38 @@ TEST_F(AdaptiveRadixTreeIndexTest, BulkInsert) {
   EXPECT_FALSE(std::find(leaf02->begin(), leaf02->end(), static_cast<uint8_t>(0x00000006u)) == leaf02->end());
 }
 
+TEST_F(AdaptiveRadixTreeIndexTest, PathCompression) {
+  index1->_chunk_offsets.clear();
+
+  std::vector<std::pair<AdaptiveRadixTreeIndex::BinaryComparable, ChunkOffset>> small_keys;
+  for (const auto& [key, chunk_offset] : std::vector<std::pair<ValueID, ChunkOffset>>{
+           {ValueID{0x00000201u}, 0u}, {ValueID{0x00000101u}, 1u}, {ValueID{0x00000102u}, 2u}}) {
+    small_keys.emplace_back(AdaptiveRadixTreeIndex::BinaryComparable(key), chunk_offset);
+  }
+  const auto small_root = index1->_bulk_insert(small_keys);
+
+  // The two most significant bytes are equal for all keys and do not get a node each
+  const auto root4 = std::dynamic_pointer_cast<ARTNode4>(small_root);
+  ASSERT_TRUE(root4);
+  EXPECT_EQ(root4->_prefix, (std::vector<uint8_t>{0x00u, 0x00u}));
+  EXPECT_EQ(root4->_partial_keys[0], static_cast<uint8_t>(0x01u));
+  EXPECT_EQ(root4->_partial_keys[1], static_cast<uint8_t>(0x02u));
+
+  const auto child01 = std::dynamic_pointer_cast<ARTNode4>(root4->_children[0]);
+  ASSERT_TRUE(child01);
+  EXPECT_TRUE(child01->_prefix.empty());
+  EXPECT_TRUE(std::dynamic_pointer_cast<Leaf>(root4->_children[1]));
+
+  EXPECT_EQ(index1->_chunk_offsets, (std::vector<ChunkOffset>{1u, 2u, 0u}));
+  const auto key = AdaptiveRadixTreeIndex::BinaryComparable(ValueID{0x00000102u});
+  EXPECT_EQ(*small_root->lower_bound(key, 0), 2u);
+  EXPECT_EQ(*small_root->upper_bound(key, 0), 0u);
+
+  // Keys that do not match the prefix are greater than all keys of the tree
+  const auto greater_key = AdaptiveRadixTreeIndex::BinaryComparable(ValueID{0x01000101u});
+  EXPECT_EQ(small_root->lower_bound(greater_key, 0), index1->_chunk_offsets.cend());
+}
+
 TEST_F(AdaptiveRadixTreeIndexTest, VectorOfRandomInts) {
   std::vector<int> ints(10001);
   for (auto i = 0u; i < ints.size(); ++i) {
@@ -0,0 +1,143 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/get_table.hpp"
+#include "operators/index_scan.hpp"
+#include "operators/insert.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/delta/delta_index.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+
+namespace opossum {
+
+class DeltaIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::String, true}}, TableType::Data, 10);
+    table->create_index<GroupKeyIndex>({ColumnID{0}});
+
+    for (const auto& value : std::vector<AllTypeVariant>{"delta", "bravo", NULL_VALUE, "delta", "alpha"}) {
+      table->append({value});
+    }
+  }
+
+  std::vector<ChunkOffset> chunk_offsets(BaseIndex::Iterator begin, BaseIndex::Iterator end) {
+    return std::vector<ChunkOffset>(begin, end);
+  }
+
+  std::shared_ptr<Table> table;
+};
+
+TEST_F(DeltaIndexTest, MaintainedOnAppend) {
+  const auto chunk = table->get_chunk(ChunkID{0});
+  EXPECT_EQ(chunk->get_index(ColumnIndexType::GroupKey, std::vector<ColumnID>{ColumnID{0}}), nullptr);
+
+  const auto index = chunk->get_index(ColumnIndexType::Delta, std::vector<ColumnID>{ColumnID{0}});
+  ASSERT_TRUE(index);
+  EXPECT_EQ(std::static_pointer_cast<DeltaIndex>(index)->compact_index_type(), ColumnIndexType::GroupKey);
+
+  // NULLs are not indexed, equal values are ordered by their chunk offsets
+  EXPECT_EQ(chunk_offsets(index->cbegin(), index->cend()), (std::vector<ChunkOffset>{4, 1, 0, 3}));
+  EXPECT_EQ(chunk_offsets(index->lower_bound({"delta"}), index->upper_bound({"delta"})),
+            (std::vector<ChunkOffset>{0, 3}));
+  EXPECT_EQ(chunk_offsets(index->lower_bound({"charlie"}), index->upper_bound({"charlie"})),
+            (std::vector<ChunkOffset>{}));
+
+  table->append({"charlie"});
+  table->append({"alpha"});
+
+  EXPECT_EQ(chunk_offsets(index->cbegin(), index->cend()), (std::vector<ChunkOffset>{4, 6, 1, 5, 0, 3}));
+  EXPECT_EQ(chunk_offsets(index->lower_bound({"charlie"}), index->upper_bound({"charlie"})),
+            (std::vector<ChunkOffset>{5}));
+}
+
+TEST_F(DeltaIndexTest, Values) {
+  const auto chunk = table->get_chunk(ChunkID{0});
+  const auto index = chunk->get_index(ColumnIndexType::Delta, std::vector<ColumnID>{ColumnID{0}});
+  ASSERT_TRUE(index);
+  ASSERT_TRUE(index->supports_index_only_scans());
+
+  const auto values = std::dynamic_pointer_cast<ValueColumn<std::string>>(
+      index->values(index->lower_bound({"bravo"}), index->upper_bound({"delta"})));
+  ASSERT_TRUE(values);
+  EXPECT_EQ(std::vector<std::string>(values->values().begin(), values->values().end()),
+            (std::vector<std::string>{"bravo", "delta", "delta"}));
+}
+
+TEST_F(DeltaIndexTest, ReplacedOnEncoding) {
+  // Chunks appended after the index was created get a DeltaIndex as well
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}};
+  const auto int_table = std::make_shared<Table>(column_definitions, TableType::Data, 2);
+  int_table->create_index<GroupKeyIndex>({ColumnID{0}});
+  int_table->append({4});
+  int_table->append({2});
+  int_table->append({3});
+
+  ChunkEncoder::encode_chunks(int_table, {ChunkID{0}});
+
+  const auto encoded_chunk = int_table->get_chunk(ChunkID{0});
+  EXPECT_EQ(encoded_chunk->get_index(ColumnIndexType::Delta, std::vector<ColumnID>{ColumnID{0}}), nullptr);
+  const auto group_key_index = encoded_chunk->get_index(ColumnIndexType::GroupKey, std::vector<ColumnID>{ColumnID{0}});
+  ASSERT_TRUE(group_key_index);
+  EXPECT_EQ(chunk_offsets(group_key_index->cbegin(), group_key_index->cend()), (std::vector<ChunkOffset>{1, 0}));
+
+  const auto mutable_chunk = int_table->get_chunk(ChunkID{1});
+  EXPECT_TRUE(mutable_chunk->get_index(ColumnIndexType::Delta, std::vector<ColumnID>{ColumnID{0}}));
+
+  EXPECT_EQ(int_table->get_indexes().size(), 1u);
+}
+
+TEST_F(DeltaIndexTest, DroppedOnEncodingWithoutDictionary) {
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}};
+  const auto int_table = std::make_shared<Table>(column_definitions, TableType::Data, 2);
+  int_table->create_index<GroupKeyIndex>({ColumnID{0}});
+  int_table->append({4});
+  int_table->append({2});
+
+  // A GroupKeyIndex can only be built on dictionary columns
+  ChunkEncoder::encode_chunks(int_table, {ChunkID{0}}, {EncodingType::RunLength});
+
+  const auto encoded_chunk = int_table->get_chunk(ChunkID{0});
+  EXPECT_TRUE(encoded_chunk->get_indices(std::vector<ColumnID>{ColumnID{0}}).empty());
+
+  // The optimizer must not use the index anymore, as the chunk is no longer covered by it
+  EXPECT_TRUE(int_table->get_indexes().empty());
+}
+
+TEST_F(DeltaIndexTest, MaintainedByInsert) {
+  const auto int_table = load_table("src/test/tables/int_float.tbl", 2);
+  int_table->create_index<GroupKeyIndex>({ColumnID{0}});
+  StorageManager::get().add_table("table_a", int_table);
+
+  // Insert all rows of the table a second time, into chunk 1 and a new chunk 2
+  const auto get_table = std::make_shared<GetTable>("table_a");
+  get_table->execute();
+  const auto insert = std::make_shared<Insert>("table_a", get_table);
+  const auto context = TransactionManager::get().new_transaction_context();
+  insert->set_transaction_context(context);
+  insert->execute();
+  context->commit();
+
+  // The IndexScan uses the DeltaIndexes of the mutable chunks instead of GroupKeyIndexes
+  const auto get_table_after_insert = std::make_shared<GetTable>("table_a");
+  get_table_after_insert->execute();
+  const auto index_scan = std::make_shared<IndexScan>(
+      get_table_after_insert, ColumnIndexType::GroupKey, std::vector<ColumnID>{ColumnID{0}},
+      PredicateCondition::GreaterThan, std::vector<AllTypeVariant>{1000});
+  index_scan->set_included_chunk_ids({ChunkID{0}, ChunkID{1}, ChunkID{2}});
+  index_scan->execute();
+
+  // 12345 and 1234, twice each
+  EXPECT_EQ(index_scan->get_output()->row_count(), 4u);
+}
+
+}  // namespace opossum
@@ -11,6 +11,7 @@
 #include "../lib/storage/base_column.hpp"
 #include "../lib/storage/chunk.hpp"
 #include "../lib/storage/index/group_key/group_key_index.hpp"
+#include "../lib/storage/value_column.hpp"
 #include "../lib/types.hpp"
 
 namespace opossum {
@@ -57,4 +58,22 @@ TEST_F(GroupKeyIndexTest, IndexPostings) {
   }
 }
 
+TEST_F(GroupKeyIndexTest, Values) {
+  ASSERT_TRUE(index->supports_index_only_scans());
+
+  const auto all_values =
+      std::dynamic_pointer_cast<ValueColumn<std::string>>(index->values(index->cbegin(), index->cend()));
+  ASSERT_TRUE(all_values);
+  EXPECT_EQ(std::vector<std::string>(all_values->values().begin(), all_values->values().end()),
+            (std::vector<std::string>{"apple", "charlie", "charlie", "delta", "delta", "frank", "hotel", "inbox"}));
+
+  // Ranges may start and end within the postings of a value
+  const auto some_values =
+      std::static_pointer_cast<ValueColumn<std::string>>(index->values(index->cbegin() + 2, index->cbegin() + 6));
+  EXPECT_EQ(std::vector<std::string>(some_values->values().begin(), some_values->values().end()),
+            (std::vector<std::string>{"charlie", "delta", "delta", "frank"}));
+
+  EXPECT_EQ(index->values(index->cend(), index->cend())->size(), 0u);
+}
+
 }  // namespace opossum
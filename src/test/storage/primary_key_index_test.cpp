@@ -0,0 +1,210 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/get_table.hpp"
+#include "operators/index_scan.hpp"
+#include "operators/insert.hpp"
+#include "operators/join_index.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/primary_key/primary_key_index.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class PrimaryKeyIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Three rows in two chunks: 12345, 123 | 1234
+    table = load_table("src/test/tables/int_float.tbl", 2);
+    StorageManager::get().add_table("table_a", table);
+  }
+
+  std::shared_ptr<Table> table;
+};
+
+TEST_F(PrimaryKeyIndexTest, LookupAcrossChunks) {
+  ChunkEncoder::encode_chunks(table, {ChunkID{0}});
+  table->create_primary_key_index({ColumnID{0}}, "pk_a");
+
+  const auto index = table->primary_key_index();
+  ASSERT_TRUE(index);
+  EXPECT_EQ(index->size(), 3u);
+
+  EXPECT_EQ(index->lookup({12345}), (PosList{RowID{ChunkID{0}, 0u}}));
+  EXPECT_EQ(index->lookup({1234}), (PosList{RowID{ChunkID{1}, 0u}}));
+  EXPECT_TRUE(index->lookup({42}).empty());
+  EXPECT_TRUE(index->lookup({NULL_VALUE}).empty());
+
+  // Values are converted to the type of the key column
+  EXPECT_EQ(index->lookup({int64_t{123}}), (PosList{RowID{ChunkID{0}, 1u}}));
+
+  const auto index_infos = table->get_indexes();
+  ASSERT_EQ(index_infos.size(), 1u);
+  EXPECT_EQ(index_infos[0].name, "pk_a");
+  EXPECT_EQ(index_infos[0].type, ColumnIndexType::PrimaryKey);
+}
+
+TEST_F(PrimaryKeyIndexTest, CompositeKeyMaintainedOnAppend) {
+  const auto column_definitions =
+      TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::String, true}};
+  const auto composite_key_table = std::make_shared<Table>(column_definitions, TableType::Data, 2);
+  composite_key_table->create_primary_key_index({ColumnID{0}, ColumnID{1}});
+
+  composite_key_table->append({1, "x"});
+  composite_key_table->append({1, "y"});
+  composite_key_table->append({1, NULL_VALUE});
+  composite_key_table->append({1, "x"});
+
+  const auto index = composite_key_table->primary_key_index();
+
+  // Rows with a NULL key are not indexed
+  EXPECT_EQ(index->size(), 3u);
+  EXPECT_EQ(index->lookup({1, "x"}), (PosList{RowID{ChunkID{0}, 0u}, RowID{ChunkID{1}, 1u}}));
+  EXPECT_EQ(index->lookup({1, "y"}), (PosList{RowID{ChunkID{0}, 1u}}));
+  EXPECT_TRUE(index->lookup({2, "x"}).empty());
+}
+
+TEST_F(PrimaryKeyIndexTest, MaintainedByInsert) {
+  table->create_primary_key_index({ColumnID{0}});
+
+  // Insert all rows of the table a second time, into chunk 1 and a new chunk 2. The rows to insert come from a
+  // separate table, as the chunks referenced by a GetTable grow with the insertion.
+  const auto values_to_insert = std::make_shared<TableWrapper>(load_table("src/test/tables/int_float.tbl", 2));
+  values_to_insert->execute();
+  const auto insert = std::make_shared<Insert>("table_a", values_to_insert);
+  const auto insert_context = TransactionManager::get().new_transaction_context();
+  insert->set_transaction_context(insert_context);
+  insert->execute();
+  insert_context->commit();
+
+  const auto index = table->primary_key_index();
+  EXPECT_EQ(index->size(), 6u);
+  EXPECT_EQ(index->lookup({123}), (PosList{RowID{ChunkID{0}, 1u}, RowID{ChunkID{2}, 0u}}));
+
+  // Entries of rolled back rows remain, but the rows are invisible
+  const auto rolled_back_insert = std::make_shared<Insert>("table_a", values_to_insert);
+  const auto rollback_context = TransactionManager::get().new_transaction_context();
+  rolled_back_insert->set_transaction_context(rollback_context);
+  rolled_back_insert->execute();
+  rollback_context->rollback();
+
+  EXPECT_EQ(index->size(), 9u);
+
+  const auto get_table = std::make_shared<GetTable>("table_a");
+  get_table->execute();
+  const auto index_scan = std::make_shared<IndexScan>(get_table, ColumnIndexType::PrimaryKey,
+                                                      std::vector<ColumnID>{ColumnID{0}}, PredicateCondition::Equals,
+                                                      std::vector<AllTypeVariant>{1234});
+  index_scan->execute();
+  EXPECT_EQ(index_scan->get_output()->row_count(), 3u);
+
+  const auto validate = std::make_shared<Validate>(index_scan);
+  const auto validate_context = TransactionManager::get().new_transaction_context();
+  validate->set_transaction_context(validate_context);
+  validate->execute();
+  EXPECT_EQ(validate->get_output()->row_count(), 2u);
+}
+
+TEST_F(PrimaryKeyIndexTest, JoinIndex) {
+  table->create_primary_key_index({ColumnID{0}});
+
+  const auto get_table_left = std::make_shared<GetTable>("table_a");
+  get_table_left->execute();
+  const auto get_table_right = std::make_shared<GetTable>("table_a");
+  get_table_right->execute();
+
+  const auto join = std::make_shared<JoinIndex>(get_table_left, get_table_right, JoinMode::Inner,
+                                                ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals);
+  join->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(join->get_output(), load_table("src/test/tables/joinoperators/int_float_self_join.tbl"));
+
+  const auto& performance_data = static_cast<const JoinIndex::PerformanceData&>(join->performance_data());
+  EXPECT_EQ(performance_data.chunks_scanned_with_index, 2u);
+  EXPECT_EQ(performance_data.chunks_scanned_without_index, 0u);
+}
+
+TEST_F(PrimaryKeyIndexTest, JoinIndexValidatesRightInput) {
+  table->create_primary_key_index({ColumnID{0}});
+
+  // The rows of a rolled back insert remain in the index, but are invisible
+  const auto values_to_insert = std::make_shared<TableWrapper>(load_table("src/test/tables/int_float.tbl", 2));
+  values_to_insert->execute();
+  const auto rolled_back_insert = std::make_shared<Insert>("table_a", values_to_insert);
+  const auto rollback_context = TransactionManager::get().new_transaction_context();
+  rolled_back_insert->set_transaction_context(rollback_context);
+  rolled_back_insert->execute();
+  rollback_context->rollback();
+
+  const auto get_table = std::make_shared<GetTable>("table_a");
+  get_table->execute();
+
+  const auto join = std::make_shared<JoinIndex>(values_to_insert, get_table, JoinMode::Inner,
+                                                ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals);
+  join->execute();
+  EXPECT_EQ(join->get_output()->row_count(), 6u);
+
+  const auto validating_join = std::make_shared<JoinIndex>(values_to_insert, get_table, JoinMode::Inner,
+                                                           ColumnIDPair(ColumnID{0}, ColumnID{0}),
+                                                           PredicateCondition::Equals);
+  validating_join->set_validate_right_input(true);
+  const auto join_context = TransactionManager::get().new_transaction_context();
+  validating_join->set_transaction_context(join_context);
+  validating_join->execute();
+  EXPECT_TABLE_EQ_UNORDERED(validating_join->get_output(),
+                            load_table("src/test/tables/joinoperators/int_float_self_join.tbl"));
+}
+
+TEST_F(PrimaryKeyIndexTest, JoinIndexOnCompositeKey) {
+  // (a, b): (9, 10) | (10, 10) | (11, 10) | (9, 10)
+  const auto right_table = load_table("src/test/tables/int_int_int.tbl", 2);
+  right_table->create_primary_key_index({ColumnID{1}, ColumnID{0}});
+  StorageManager::get().add_table("table_b", right_table);
+
+  const auto left_table =
+      std::make_shared<Table>(TableColumnDefinitions{{"x", DataType::Int, false}, {"y", DataType::Int, true}},
+                              TableType::Data, Chunk::MAX_SIZE, UseMvcc::Yes);
+  left_table->append({9, 10});
+  left_table->append({10, 11});
+  left_table->append({11, NULL_VALUE});
+  StorageManager::get().add_table("table_c", left_table);
+
+  const auto get_table_left = std::make_shared<GetTable>("table_c");
+  get_table_left->execute();
+  const auto get_table_right = std::make_shared<GetTable>("table_b");
+  get_table_right->execute();
+
+  // x = a AND y = b, the key columns are in a different order than the join columns
+  const auto join = std::make_shared<JoinIndex>(get_table_left, get_table_right, JoinMode::Left,
+                                                ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals,
+                                                std::vector<ColumnIDPair>{{ColumnID{1}, ColumnID{1}}});
+  join->execute();
+
+  // Rows with a NULL in one of the key columns never match
+  const auto expected_table = std::make_shared<Table>(
+      TableColumnDefinitions{{"x", DataType::Int, false},
+                             {"y", DataType::Int, true},
+                             {"a", DataType::Int, true},
+                             {"b", DataType::Int, true},
+                             {"c", DataType::Int, true}},
+      TableType::Data);
+  expected_table->append({9, 10, 9, 10, 11});
+  expected_table->append({9, 10, 9, 10, 9});
+  expected_table->append({10, 11, NULL_VALUE, NULL_VALUE, NULL_VALUE});
+  expected_table->append({11, NULL_VALUE, NULL_VALUE, NULL_VALUE, NULL_VALUE});
+  EXPECT_TABLE_EQ_UNORDERED(join->get_output(), expected_table);
+
+  const auto& performance_data = static_cast<const JoinIndex::PerformanceData&>(join->performance_data());
+  EXPECT_EQ(performance_data.chunks_scanned_with_index, 2u);
+}
+
+}  // namespace opossum
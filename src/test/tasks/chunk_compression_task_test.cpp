@@ -9,6 +9,9 @@
 #include "operators/get_table.hpp"
 #include "operators/insert.hpp"
 #include "operators/validate.hpp"
+#include "statistics/chunk_statistics/chunk_statistics.hpp"
+#include "statistics/column_statistics.hpp"
+#include "statistics/table_statistics.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/storage_manager.hpp"
 #include "tasks/chunk_compression_task.hpp"
@@ -110,4 +113,49 @@ TEST_F(ChunkCompressionTaskTest, CompressionWithAbortedInsert) {
   EXPECT_EQ(validate->get_output()->row_count(), 12u);
 }
 
+TEST_F(ChunkCompressionTaskTest, CompressionMaintainsTableStatistics) {
+  auto table = load_table("src/test/tables/compression_input.tbl", 6u);
+  StorageManager::get().add_table("table_statistics", table);
+  ASSERT_TRUE(table->table_statistics());
+  EXPECT_FLOAT_EQ(table->table_statistics()->row_count(), 12.0f);
+
+  auto get_table = std::make_shared<GetTable>("table_statistics");
+  get_table->execute();
+
+  auto insert = std::make_shared<Insert>("table_statistics", get_table);
+  auto context = TransactionManager::get().new_transaction_context();
+  insert->set_transaction_context(context);
+  insert->execute();
+  context->commit();
+
+  // Committed inserts are reflected in the row count immediately
+  EXPECT_FLOAT_EQ(table->table_statistics()->row_count(), 24.0f);
+
+  auto compression = std::make_unique<ChunkCompressionTask>("table_statistics", std::vector<ChunkID>{ChunkID{0}});
+  compression->execute();
+
+  // The compressed chunk keeps its own statistics, which are merged with the statistics of the mutable chunks
+  const auto chunk_statistics = table->get_chunk(ChunkID{0})->statistics();
+  ASSERT_TRUE(chunk_statistics);
+  ASSERT_TRUE(chunk_statistics->table_statistics());
+  EXPECT_FLOAT_EQ(chunk_statistics->table_statistics()->row_count(), 6.0f);
+
+  const auto table_statistics = table->table_statistics();
+  EXPECT_FLOAT_EQ(table_statistics->row_count(), 24.0f);
+
+  const auto string_column_statistics =
+      std::dynamic_pointer_cast<const ColumnStatistics<std::string>>(table_statistics->column_statistics().at(0));
+  ASSERT_TRUE(string_column_statistics);
+  EXPECT_FLOAT_EQ(string_column_statistics->distinct_count(), 3.0f);
+  EXPECT_EQ(string_column_statistics->min(), "bar");
+  EXPECT_EQ(string_column_statistics->max(), "hurz");
+
+  const auto int_column_statistics =
+      std::dynamic_pointer_cast<const ColumnStatistics<int32_t>>(table_statistics->column_statistics().at(1));
+  ASSERT_TRUE(int_column_statistics);
+  EXPECT_FLOAT_EQ(int_column_statistics->distinct_count(), 3.0f);
+  EXPECT_EQ(int_column_statistics->min(), 1);
+  EXPECT_EQ(int_column_statistics->max(), 3);
+}
+
 }  // namespace opossum